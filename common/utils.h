@@ -18,8 +18,10 @@
 
 #include <string>
 #include <memory>
+#include <vector>
 
 #include "log.h"
+#include "neural_network_runtime/neural_network_runtime_type.h"
 
 namespace OHOS {
 namespace NeuralNetworkRuntime {
@@ -51,6 +53,10 @@ std::unique_ptr<T> CreateUniquePtr(Args&&... args)
 
 std::string GenUniqueName(const std::string&, const std::string&, const std::string&);
 
+// Parses index pairs written as "first:second" and separated by ';', such as "0:1;2:3". An entry may carry up to
+// maxFields indices, the ones after the pair are returned with it. No two entries share their first or second index.
+OH_NN_ReturnCode ParseIndexPairs(const std::string& value, size_t maxFields, std::vector<std::vector<uint32_t>>& pairs);
+
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
 #endif // NEURAL_NETWORK_RUNTIME_UTILS_H
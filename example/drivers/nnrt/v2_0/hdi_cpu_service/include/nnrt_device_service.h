@@ -16,13 +16,17 @@
 #ifndef OHOS_HDI_NNRT_V2_0_NNRTDEVICESERVICE_H
 #define OHOS_HDI_NNRT_V2_0_NNRTDEVICESERVICE_H
 
+#include <map>
 #include <memory>
+#include <utility>
+#include <sys/stat.h>
 
 #include "v2_0/innrt_device.h"
 #include "ashmem.h"
 #include "include/api/model.h"
 
 #include "mindspore_schema/model_generated.h"
+#include "shared_buffer_parser.h"
 
 namespace OHOS {
 namespace HDI {
@@ -68,9 +72,15 @@ public:
 private:
     NNRT_ReturnCode ValidateModelConfig(const ModelConfig& config) const;
     NNRT_ReturnCode ValidateModel(const Model& model) const;
-    std::shared_ptr<mindspore::schema::MetaGraphT> TransModelToGraph(const Model& model,
-        NNRT_ReturnCode& returnCode) const;
-    std::unique_ptr<mindspore::schema::TensorT> TransTensor(const Tensor& tensor, NNRT_ReturnCode& returnCode) const;
+    // Shared buffers holding constant tensor data, keyed by device and inode so that every fd duplicated from one
+    // buffer reuses a single mapping.
+    using WeightMappings = std::map<std::pair<dev_t, ino_t>, std::unique_ptr<SharedBufferParser>>;
+
+    NNRT_ReturnCode TransModelToBuffer(const Model& model, flatbuffers::FlatBufferBuilder& builder) const;
+    NNRT_ReturnCode TransTensor(const Tensor& tensor, WeightMappings& mappings, flatbuffers::FlatBufferBuilder& builder,
+        flatbuffers::Offset<mindspore::schema::Tensor>& tensorOffset) const;
+    NNRT_ReturnCode MapTensorData(const SharedBuffer& data, WeightMappings& mappings,
+        const uint8_t*& tensorData) const;
     std::unique_ptr<mindspore::schema::CNodeT> TransNode(const Node& node, NNRT_ReturnCode& returnCode) const;
     std::unique_ptr<mindspore::schema::SubGraphT> TransSubGraph(const SubGraph& graph, const size_t numTensor) const;
     std::shared_ptr<mindspore::Context> TransModelConfig(const ModelConfig& config) const;
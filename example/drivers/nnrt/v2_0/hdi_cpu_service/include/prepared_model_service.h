@@ -37,7 +37,8 @@ public:
 
     explicit PreparedModelService(std::shared_ptr<mindspore::Context> context);
 
-    NNRT_ReturnCode Compile(std::shared_ptr<mindspore::schema::MetaGraphT> graph);
+    // modelBuffer is a finished MetaGraph FlatBuffer, it is kept for ExportModelCache().
+    NNRT_ReturnCode Compile(flatbuffers::DetachedBuffer modelBuffer);
 
     NNRT_ReturnCode Compile(const void* modelBuffer, size_t length);
 
@@ -60,9 +61,8 @@ private:
     void ResetInputAndOutput();
 
 private:
-    std::shared_ptr<mindspore::schema::MetaGraphT> m_graph {nullptr};
     std::shared_ptr<mindspore::Context> m_context {nullptr};
-    flatbuffers::FlatBufferBuilder m_builder;
+    flatbuffers::DetachedBuffer m_modelBuffer;
     std::shared_ptr<mindspore::Model> m_model {nullptr};
     sptr<Ashmem> m_cacheBuffer {nullptr};
     std::vector<sptr<Ashmem>> m_inputAshmems;
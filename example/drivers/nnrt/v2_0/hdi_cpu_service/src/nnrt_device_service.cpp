@@ -15,10 +15,10 @@
 
 #include "nnrt_device_service.h"
 
+#include <unistd.h>
 #include <hdf_base.h>
 #include "hdf_log.h"
 #include "ashmem.h"
-#include "securec.h"
 
 #include "node_registry.h"
 #include "prepared_model_service.h"
@@ -112,8 +112,9 @@ int32_t NnrtDeviceService::PrepareModel(const Model& model, const ModelConfig& c
         return ret;
     }
 
-    auto graph = TransModelToGraph(model, ret);
-    if (graph == nullptr) {
+    flatbuffers::FlatBufferBuilder builder;
+    ret = TransModelToBuffer(model, builder);
+    if (ret != NNRT_ReturnCode::NNRT_SUCCESS) {
         HDF_LOGE("Transfrom model to graph failed.");
         return ret;
     }
@@ -137,7 +138,7 @@ int32_t NnrtDeviceService::PrepareModel(const Model& model, const ModelConfig& c
         return NNRT_ReturnCode::NNRT_OUT_OF_MEMORY;
     }
 
-    ret = service->Compile(graph);
+    ret = service->Compile(builder.Release());
     if (ret != NNRT_ReturnCode::NNRT_SUCCESS) {
         HDF_LOGE("Prepared model failed.");
         return ret;
@@ -319,97 +320,154 @@ NNRT_ReturnCode NnrtDeviceService::ValidateModel(const Model& model) const
     return NNRT_ReturnCode::NNRT_SUCCESS;
 }
 
-std::shared_ptr<mindspore::schema::MetaGraphT> NnrtDeviceService::TransModelToGraph(const Model& model,
-    NNRT_ReturnCode& returnCode) const
+NNRT_ReturnCode NnrtDeviceService::TransModelToBuffer(const Model& model, flatbuffers::FlatBufferBuilder& builder) const
 {
-    auto metaGraph = std::make_shared<mindspore::schema::MetaGraphT>();
-    metaGraph->name = model.name;
-    metaGraph->version = mindspore::Version();
-
-    std::unique_ptr<mindspore::schema::TensorT> transTensor {nullptr};
-    for (auto tensor : model.allTensors) {
-        transTensor = TransTensor(tensor, returnCode);
-        if (transTensor == nullptr) {
-            HDF_LOGE("Transform tensor failed.");
-            return nullptr;
+    // Constant data is serialized straight from the shared buffers, which stay mapped only until every tensor is
+    // written, so the model is never held as an intermediate MetaGraphT.
+    NNRT_ReturnCode returnCode {NNRT_ReturnCode::NNRT_SUCCESS};
+    std::vector<flatbuffers::Offset<mindspore::schema::Tensor>> allTensors;
+    allTensors.reserve(model.allTensors.size());
+    {
+        WeightMappings mappings;
+        flatbuffers::Offset<mindspore::schema::Tensor> tensorOffset;
+        for (auto& tensor : model.allTensors) {
+            returnCode = TransTensor(tensor, mappings, builder, tensorOffset);
+            if (returnCode != NNRT_ReturnCode::NNRT_SUCCESS) {
+                HDF_LOGE("Transform tensor failed.");
+                return returnCode;
+            }
+            allTensors.emplace_back(tensorOffset);
         }
-        metaGraph->allTensors.emplace_back(std::move(transTensor));
     }
-    metaGraph->inputIndex = model.inputIndex;
-    metaGraph->outputIndex = model.outputIndex;
 
     // Transform node
-    std::unique_ptr<mindspore::schema::CNodeT> transNode {nullptr};
+    std::vector<flatbuffers::Offset<mindspore::schema::CNode>> nodes;
+    nodes.reserve(model.nodes.size());
     for (auto& node : model.nodes) {
-        transNode = TransNode(node, returnCode);
+        auto transNode = TransNode(node, returnCode);
         if (transNode == nullptr) {
             HDF_LOGE("Transform node failed, node name=%{public}s", node.name.c_str());
-            return nullptr;
+            return returnCode;
         }
-        metaGraph->nodes.emplace_back(std::move(transNode));
+        nodes.emplace_back(mindspore::schema::CNode::Pack(builder, transNode.get()));
     }
 
     // Transform subgraph
     const size_t numTensor = model.allTensors.size();
-    for (auto graph : model.subGraph) {
-        metaGraph->subGraph.emplace_back(TransSubGraph(graph, numTensor));
-    }
-
-    returnCode = NNRT_ReturnCode::NNRT_SUCCESS;
-    return metaGraph;
+    std::vector<flatbuffers::Offset<mindspore::schema::SubGraph>> subGraphs;
+    subGraphs.reserve(model.subGraph.size());
+    for (auto& graph : model.subGraph) {
+        auto transSubGraph = TransSubGraph(graph, numTensor);
+        subGraphs.emplace_back(mindspore::schema::SubGraph::Pack(builder, transSubGraph.get()));
+    }
+
+    auto name = builder.CreateString(model.name);
+    auto version = builder.CreateString(mindspore::Version());
+    auto inputIndex = builder.CreateVector(model.inputIndex);
+    auto outputIndex = builder.CreateVector(model.outputIndex);
+    auto nodesOffset = builder.CreateVector(nodes);
+    auto allTensorsOffset = builder.CreateVector(allTensors);
+    auto subGraphsOffset = builder.CreateVector(subGraphs);
+
+    mindspore::schema::MetaGraphBuilder metaGraph(builder);
+    metaGraph.add_name(name);
+    metaGraph.add_version(version);
+    metaGraph.add_inputIndex(inputIndex);
+    metaGraph.add_outputIndex(outputIndex);
+    metaGraph.add_nodes(nodesOffset);
+    metaGraph.add_allTensors(allTensorsOffset);
+    metaGraph.add_subGraph(subGraphsOffset);
+    mindspore::schema::FinishMetaGraphBuffer(builder, metaGraph.Finish());
+    return NNRT_ReturnCode::NNRT_SUCCESS;
 }
 
-std::unique_ptr<mindspore::schema::TensorT> NnrtDeviceService::TransTensor(const Tensor& tensor,
-    NNRT_ReturnCode& returnCode) const
+NNRT_ReturnCode NnrtDeviceService::TransTensor(const Tensor& tensor, WeightMappings& mappings,
+    flatbuffers::FlatBufferBuilder& builder, flatbuffers::Offset<mindspore::schema::Tensor>& tensorOffset) const
 {
     if (!ValidateDataType(tensor.dataType)) {
         HDF_LOGE("DataType of tensor is invalid. dataType=%d", tensor.dataType);
-        returnCode = NNRT_ReturnCode::NNRT_INVALID_DATATYPE;
-        return nullptr;
+        return NNRT_ReturnCode::NNRT_INVALID_DATATYPE;
     }
 
     if (!ValidateFormat(tensor.format)) {
         HDF_LOGE("Format of tensor is invalid. format=%d", tensor.format);
-        returnCode = NNRT_ReturnCode::NNRT_INVALID_FORMAT;
-        return nullptr;
-    }
-
-    auto schemaTensor = std::make_unique<mindspore::schema::TensorT>();
-    schemaTensor->name = tensor.name;
-    schemaTensor->dataType = static_cast<int32_t>(tensor.dataType);
-    schemaTensor->format = static_cast<mindspore::schema::Format>(tensor.format);
-    schemaTensor->dims = tensor.dims;
-    for (auto param : tensor.quantParams) {
-        auto quantParam = std::make_unique<mindspore::schema::QuantParamT>();
-        quantParam->scale = param.scale;
-        quantParam->zeroPoint = param.zeroPoint;
-        quantParam->numBits = param.numBits;
-        quantParam->inited = true;
-        schemaTensor->quantParams.emplace_back(std::move(quantParam));
+        return NNRT_ReturnCode::NNRT_INVALID_FORMAT;
     }
 
+    // Vectors and strings of a table must be written to the builder before the table is started.
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> data;
     if (tensor.data.fd != INVALID_FD) {
-        SharedBufferParser parser;
-        auto ret = parser.Init(tensor.data);
-        if (ret != HDF_SUCCESS) {
+        const uint8_t* tensorData {nullptr};
+        auto ret = MapTensorData(tensor.data, mappings, tensorData);
+        if (ret != NNRT_ReturnCode::NNRT_SUCCESS) {
             HDF_LOGE("Parse tensor data failed.");
-            returnCode = NNRT_ReturnCode::NNRT_MEMORY_ERROR;
-            return nullptr;
+            return ret;
         }
+        data = builder.CreateVector(tensorData, tensor.data.dataSize);
+    }
+
+    std::vector<flatbuffers::Offset<mindspore::schema::QuantParam>> quantParams;
+    quantParams.reserve(tensor.quantParams.size());
+    for (auto& param : tensor.quantParams) {
+        mindspore::schema::QuantParamT quantParam;
+        quantParam.scale = param.scale;
+        quantParam.zeroPoint = param.zeroPoint;
+        quantParam.numBits = param.numBits;
+        quantParam.inited = true;
+        quantParams.emplace_back(mindspore::schema::QuantParam::Pack(builder, &quantParam));
+    }
+    auto quantParamsOffset = builder.CreateVector(quantParams);
+    auto dims = builder.CreateVector(tensor.dims);
+    auto name = builder.CreateString(tensor.name);
+
+    mindspore::schema::TensorBuilder schemaTensor(builder);
+    schemaTensor.add_name(name);
+    schemaTensor.add_dataType(static_cast<int32_t>(tensor.dataType));
+    schemaTensor.add_format(static_cast<mindspore::schema::Format>(tensor.format));
+    schemaTensor.add_dims(dims);
+    schemaTensor.add_quantParams(quantParamsOffset);
+    schemaTensor.add_data(data);
+    tensorOffset = schemaTensor.Finish();
+    return NNRT_ReturnCode::NNRT_SUCCESS;
+}
+
+NNRT_ReturnCode NnrtDeviceService::MapTensorData(const SharedBuffer& data, WeightMappings& mappings,
+    const uint8_t*& tensorData) const
+{
+    if (data.offset > data.bufferSize || data.dataSize > data.bufferSize - data.offset) {
+        HDF_LOGE("Invalid dataSize or offset of SharedBuffer.");
+        return NNRT_ReturnCode::NNRT_INVALID_BUFFER;
+    }
+
+    struct stat bufferStat;
+    if (fstat(data.fd, &bufferStat) != 0) {
+        HDF_LOGE("Get status of tensor buffer failed.");
+        return NNRT_ReturnCode::NNRT_MEMORY_ERROR;
+    }
 
-        auto data = parser.GetBufferPtr();
-        schemaTensor->data.resize(tensor.data.dataSize);
-        auto memRet = memcpy_s(const_cast<uint8_t*>(schemaTensor->data.data()),
-                               tensor.data.dataSize, data, tensor.data.dataSize);
-        if (memRet != EOK) {
-            HDF_LOGW("Copy tensor data failed.");
-            returnCode = NNRT_ReturnCode::NNRT_INVALID_BUFFER;
-            return nullptr;
+    auto key = std::make_pair(bufferStat.st_dev, bufferStat.st_ino);
+    auto iter = mappings.find(key);
+    if (iter == mappings.end()) {
+        // Map the whole buffer, the other tensors stored in it are read through the same mapping.
+        auto parser = std::make_unique<SharedBufferParser>();
+        auto ret = parser->Init(SharedBuffer {data.fd, data.bufferSize, 0, data.bufferSize});
+        if (ret != HDF_SUCCESS) {
+            HDF_LOGE("Map tensor buffer failed.");
+            return NNRT_ReturnCode::NNRT_MEMORY_ERROR;
         }
+        iter = mappings.emplace(key, std::move(parser)).first;
+    } else if (iter->second->GetBuffer().fd != data.fd) {
+        // The mapping holds its own fd, close this duplicate as the parser would do after reading it.
+        close(data.fd);
     }
 
-    returnCode = NNRT_ReturnCode::NNRT_SUCCESS;
-    return schemaTensor;
+    if (data.offset + data.dataSize > iter->second->GetBuffer().bufferSize) {
+        HDF_LOGE("Tensor data is out of the range of the shared buffer.");
+        return NNRT_ReturnCode::NNRT_INVALID_BUFFER;
+    }
+
+    tensorData = static_cast<const uint8_t*>(iter->second->GetBufferPtr()) + data.offset;
+    return NNRT_ReturnCode::NNRT_SUCCESS;
 }
 
 std::unique_ptr<mindspore::schema::CNodeT> NnrtDeviceService::TransNode(const Node& node,
@@ -63,10 +63,14 @@ int32_t PreparedModelService::ExportModelCache(std::vector<SharedBuffer>& modelC
         return HDF_SUCCESS;
     }
 
-    auto size = m_builder.GetSize();
-    auto buffer = m_builder.GetBufferPointer();
-    const char* name = m_graph != nullptr ? m_graph->name.c_str() : "CacheModel";
-    sptr<Ashmem> cache = Ashmem::CreateAshmem(name, size);
+    auto size = m_modelBuffer.size();
+    auto buffer = m_modelBuffer.data();
+    if (buffer == nullptr) {
+        HDF_LOGE("Model is not compiled from graph, there is no cache to export.");
+        return NNRT_ReturnCode::NNRT_FAILED;
+    }
+
+    sptr<Ashmem> cache = Ashmem::CreateAshmem("CacheModel", size);
     if (cache == nullptr) {
         HDF_LOGE("Create shared memory failed.");
         return NNRT_ReturnCode::NNRT_OUT_OF_MEMORY;
@@ -222,32 +226,35 @@ void PreparedModelService::ResetInputAndOutput()
     }
 }
 
-NNRT_ReturnCode PreparedModelService::Compile(std::shared_ptr<mindspore::schema::MetaGraphT> graph)
+NNRT_ReturnCode PreparedModelService::Compile(flatbuffers::DetachedBuffer modelBuffer)
 {
-    if (graph == nullptr) {
-        HDF_LOGE("Graph cannot be nullptr");
+    if (modelBuffer.data() == nullptr || modelBuffer.size() == 0) {
+        HDF_LOGE("Model is invalid.");
         return NNRT_ReturnCode::NNRT_INVALID_MODEL;
     }
-    for (auto i : graph->inputIndex) {
-        auto inputShape = graph->allTensors[i]->dims;
-        auto iter = std::find(inputShape.begin(), inputShape.end(), DYNAMIC_SHAPE_FLAG);
-        if (iter != inputShape.end()) {
-            m_isDynamicShape = true;
-            break;
+
+    auto graph = mindspore::schema::GetMetaGraph(modelBuffer.data());
+    if (graph->inputIndex() != nullptr && graph->allTensors() != nullptr) {
+        for (auto i : *graph->inputIndex()) {
+            if (i >= graph->allTensors()->size()) {
+                HDF_LOGE("Input index is invalid, index=%u", i);
+                return NNRT_ReturnCode::NNRT_INVALID_INPUT;
+            }
+            auto inputShape = graph->allTensors()->Get(i)->dims();
+            if (inputShape != nullptr &&
+                std::find(inputShape->begin(), inputShape->end(), DYNAMIC_SHAPE_FLAG) != inputShape->end()) {
+                m_isDynamicShape = true;
+                break;
+            }
         }
     }
-    auto offset = mindspore::schema::MetaGraph::Pack(m_builder, graph.get());
-    m_builder.Finish(offset);
-    mindspore::schema::FinishMetaGraphBuffer(m_builder, offset);
-    auto modelSize = m_builder.GetSize();
-    uint8_t* modelBuffer = m_builder.GetBufferPointer();
-    if (modelBuffer == nullptr) {
-        HDF_LOGE("Model is invalid.");
-        return NNRT_ReturnCode::NNRT_INVALID_MODEL;
-    }
+
+    m_modelBuffer = std::move(modelBuffer);
+    auto modelSize = m_modelBuffer.size();
+    uint8_t* modelData = m_modelBuffer.data();
 
     m_model = std::make_shared<mindspore::Model>();
-    mindspore::Status msRet = m_model->Build(modelBuffer, modelSize, mindspore::kMindIR, m_context);
+    mindspore::Status msRet = m_model->Build(modelData, modelSize, mindspore::kMindIR, m_context);
     if (msRet != mindspore::kSuccess) {
         HDF_LOGE("Prepare model failed, please make sure model is validate.");
         return NNRT_ReturnCode::NNRT_INVALID_MODEL;
@@ -19,6 +19,12 @@ namespace OHOS {
 namespace HDI {
 namespace Nnrt {
 namespace V2_0 {
+namespace {
+// bfloat16 and packed int4 keep their MindSpore TypeId values, DataType has no member for them.
+constexpr int32_t DATA_TYPE_BFLOAT16 = 45;
+constexpr int32_t DATA_TYPE_INT4 = 50;
+} // namespace
+
 int32_t ValidatePerformanceMode(PerformanceMode mode)
 {
     if (mode < PerformanceMode::PERFORMANCE_NONE || mode > PerformanceMode::PERFORMANCE_EXTREME) {
@@ -39,6 +45,10 @@ int32_t ValidatePriority(Priority priority)
 
 int32_t ValidateDataType(DataType dataType)
 {
+    if (static_cast<int32_t>(dataType) == DATA_TYPE_BFLOAT16 || static_cast<int32_t>(dataType) == DATA_TYPE_INT4) {
+        return true;
+    }
+
     if (dataType < DataType::DATA_TYPE_UNKNOWN || dataType > DataType::DATA_TYPE_FLOAT64) {
         return false;
     }
@@ -19,9 +19,11 @@
 #include <vector>
 #include <utility>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 
 #include "compiler.h"
+#include "executor_pool.h"
 #include "neural_network_runtime/neural_network_runtime_type.h"
 
 namespace OHOS {
@@ -44,6 +46,9 @@ struct Compilation {
     uint32_t hiaiModelId {0};
     bool isNeedModelLatency {false};
     size_t modelSize {0};
+    // Guards executorPool, which threads may create and look up concurrently.
+    std::mutex executorPoolMutex;
+    std::unique_ptr<ExecutorPool> executorPool;
 
     ~Compilation()
     {
@@ -47,6 +47,20 @@ struct Buffer {
     int fd = -1;
 };
 
+// Output outputIndex of a run is kept by the executor as input inputIndex of the next run.
+struct StateBinding {
+    uint32_t outputIndex {0};
+    uint32_t inputIndex {0};
+    // The output is appended to the state along this axis, or replaces the whole state if it is negative.
+    int32_t appendAxis {-1};
+};
+
+// Output outputIndex is written into the buffer of input inputIndex, which the model allows to be done in place.
+struct IoAlias {
+    uint32_t outputIndex {0};
+    uint32_t inputIndex {0};
+};
+
 struct ExtensionConfig {
     Buffer quantBuffer;
     std::string modelName;
@@ -59,6 +73,10 @@ struct ExtensionConfig {
     bool isNpuFmShared = false;
     bool isExceedRamLimit = false;
     std::string aippPath;
+    // Split the model across all registered backends when the compilation's device cannot run all of it.
+    bool isHeteroPartition = false;
+    std::vector<StateBinding> stateBindings;
+    std::vector<IoAlias> ioAliases;
 };
 
 struct ModelConfig {
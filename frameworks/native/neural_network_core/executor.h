@@ -23,6 +23,7 @@
 #include "tensor_desc.h"
 #include "executor_config.h"
 #include "neural_network_runtime/neural_network_runtime_type.h"
+#include "neural_network_runtime_inner.h"
 
 namespace OHOS {
 namespace NeuralNetworkRuntime {
@@ -77,6 +78,12 @@ public:
         return OH_NN_SUCCESS;
     }
 
+    // Hint that the executor is about to run, so a model unloaded while idle can be reloaded in the background.
+    virtual OH_NN_ReturnCode Prefetch()
+    {
+        return OH_NN_SUCCESS;
+    }
+
     virtual OH_NN_ReturnCode RunSyncWithAipp(NN_Tensor* inputTensors[],
                                             size_t inputSize,
                                             NN_Tensor* outputTensors[],
@@ -86,6 +93,51 @@ public:
         return OH_NN_SUCCESS;
     }
 
+    // Runs with the AIPP configuration registered under aippHandle by OH_NN_RegisterAippConfig().
+    virtual OH_NN_ReturnCode RunSyncWithAippHandle(NN_Tensor* inputTensors[],
+                                                  size_t inputSize,
+                                                  NN_Tensor* outputTensors[],
+                                                  size_t outputSize,
+                                                  uint32_t aippHandle)
+    {
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    // Runs like RunSync() and copies the shape of output i to outputShapes[i * maxRank], its rank to outputRanks[i].
+    virtual OH_NN_ReturnCode RunSyncWithOutputShapes(NN_Tensor* inputTensors[],
+                                                     size_t inputSize,
+                                                     NN_Tensor* outputTensors[],
+                                                     size_t outputSize,
+                                                     int32_t* outputShapes,
+                                                     size_t maxRank,
+                                                     uint32_t* outputRanks)
+    {
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    // Drops the state tensors kept between runs, so that the next run starts a new sequence.
+    virtual OH_NN_ReturnCode ResetState()
+    {
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    // Drops what a borrower of a pooled executor left behind, so that the next borrower gets it as if just constructed.
+    virtual OH_NN_ReturnCode Recycle()
+    {
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    // Lets the buffer of output outputIndex grow to at least sizeHint bytes when a run finds it too small.
+    virtual OH_NN_ReturnCode SetOutputSizeHint(uint32_t outputIndex, size_t sizeHint)
+    {
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    virtual OH_NN_ReturnCode GetOutputGrowthStats(OH_NN_OutputGrowthStats& stats)
+    {
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
     bool isAddSession = false;
 };
 }  // namespace NeuralNetworkRuntime
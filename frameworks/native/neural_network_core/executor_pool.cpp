@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "executor_pool.h"
+
+#include <chrono>
+#include <utility>
+
+#include "log.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+ExecutorPool::ExecutorPool(CreateFunc create, ResetFunc reset, DestroyFunc destroy)
+    : m_create(std::move(create)), m_reset(std::move(reset)), m_destroy(std::move(destroy)) {}
+
+ExecutorPool::~ExecutorPool()
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    if (!m_borrowed.empty() || !m_returning.empty()) {
+        LOGW("[ExecutorPool] %{public}zu executors are still borrowed when the pool is destroyed.",
+             m_borrowed.size() + m_returning.size());
+    }
+
+    for (OH_NNExecutor* executor : m_idle) {
+        m_destroy(executor);
+    }
+    for (OH_NNExecutor* executor : m_borrowed) {
+        m_destroy(executor);
+    }
+    m_idle.clear();
+    m_borrowed.clear();
+}
+
+OH_NN_ReturnCode ExecutorPool::Init(size_t minCount, size_t maxCount)
+{
+    if (maxCount == 0 || minCount > maxCount) {
+        LOGE("[ExecutorPool] Init failed, invalid executor count range [%{public}zu, %{public}zu].",
+             minCount, maxCount);
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    std::lock_guard<std::mutex> createLock(m_createMtx);
+    std::lock_guard<std::mutex> lock(m_mtx);
+    if (m_isInitialized) {
+        LOGE("[ExecutorPool] Init failed, the pool has been initialized.");
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    m_idle.reserve(maxCount);
+    m_borrowed.reserve(maxCount);
+    for (size_t i = 0; i < minCount; ++i) {
+        OH_NNExecutor* executor = m_create();
+        if (executor == nullptr) {
+            LOGE("[ExecutorPool] Init failed, fail to create executor %{public}zu.", i);
+            for (OH_NNExecutor* created : m_idle) {
+                m_destroy(created);
+            }
+            m_idle.clear();
+            return OH_NN_FAILED;
+        }
+        m_idle.emplace_back(executor);
+    }
+
+    m_executorCount = minCount;
+    m_maxCount = maxCount;
+    m_isInitialized = true;
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode ExecutorPool::Acquire(uint32_t timeoutMs, OH_NNExecutor** executor)
+{
+    if (executor == nullptr) {
+        LOGE("[ExecutorPool] Acquire failed, executor is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    std::unique_lock<std::mutex> lock(m_mtx);
+    if (!m_isInitialized) {
+        LOGE("[ExecutorPool] Acquire failed, the pool is not initialized.");
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    auto isAvailable = [this]() { return !m_idle.empty() || m_executorCount < m_maxCount; };
+    if (timeoutMs == 0) {
+        m_released.wait(lock, isAvailable);
+    } else if (!m_released.wait_for(lock, std::chrono::milliseconds(timeoutMs), isAvailable)) {
+        LOGE("[ExecutorPool] Acquire failed, all %{public}zu executors are still borrowed after %{public}u ms.",
+             m_maxCount, timeoutMs);
+        return OH_NN_TIMEOUT;
+    }
+
+    if (!m_idle.empty()) {
+        *executor = m_idle.back();
+        m_idle.pop_back();
+        m_borrowed.emplace(*executor);
+        return OH_NN_SUCCESS;
+    }
+
+    // Construct outside the lock, it registers the executor to the NNRt service and may take a while.
+    ++m_executorCount;
+    lock.unlock();
+    OH_NNExecutor* created = nullptr;
+    {
+        std::lock_guard<std::mutex> createLock(m_createMtx);
+        created = m_create();
+    }
+    lock.lock();
+    if (created == nullptr) {
+        --m_executorCount;
+        m_released.notify_one();
+        LOGE("[ExecutorPool] Acquire failed, fail to create executor.");
+        return OH_NN_FAILED;
+    }
+
+    m_borrowed.emplace(created);
+    *executor = created;
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode ExecutorPool::Release(OH_NNExecutor* executor)
+{
+    if (executor == nullptr) {
+        LOGE("[ExecutorPool] Release failed, executor is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        if (m_borrowed.erase(executor) == 0) {
+            LOGE("[ExecutorPool] Release failed, the executor is not borrowed from this pool.");
+            return OH_NN_INVALID_PARAMETER;
+        }
+        m_returning.emplace(executor);
+    }
+
+    // Reset outside the lock, it unregisters buffers from the device. The executor still counts in m_executorCount.
+    OH_NN_ReturnCode ret = m_reset(executor);
+    if (ret != OH_NN_SUCCESS) {
+        LOGW("[ExecutorPool] Fail to reset the released executor, destroy it instead of reusing it.");
+        std::lock_guard<std::mutex> createLock(m_createMtx);
+        m_destroy(executor);
+    }
+
+    // The executor stops counting as borrowed here, after which the owner may destroy the pool, so the pool is not
+    // touched once the lock is released.
+    std::lock_guard<std::mutex> lock(m_mtx);
+    m_returning.erase(executor);
+    if (ret != OH_NN_SUCCESS) {
+        --m_executorCount;
+    } else {
+        m_idle.emplace_back(executor);
+    }
+    m_released.notify_one();
+    return OH_NN_SUCCESS;
+}
+
+size_t ExecutorPool::GetExecutorCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    return m_executorCount;
+}
+
+size_t ExecutorPool::GetIdleCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    return m_idle.size();
+}
+
+size_t ExecutorPool::GetBorrowedCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    return m_borrowed.size() + m_returning.size();
+}
+}  // namespace NeuralNetworkRuntime
+}  // namespace OHOS
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NEURAL_NETWORK_CORE_EXECUTOR_POOL_H
+#define NEURAL_NETWORK_CORE_EXECUTOR_POOL_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+#include "neural_network_runtime/neural_network_runtime_type.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+/**
+ * A pool of executors of one compilation, which lets concurrent requests borrow a ready executor instead of
+ * constructing one per request or serializing on a shared one.
+ *
+ * Init() constructs minCount executors up front, so that their scheduling registration is done before the first
+ * request. Acquire() hands out an idle executor, constructs a new one while fewer than maxCount exist, and otherwise
+ * waits for a Release(). Release() resets the executor before handing it to the next borrower, an executor which
+ * fails to reset is destroyed instead. The executors of a compilation share its prepared model, a pooled executor only
+ * adds its own tensor descs and run state. Executors beyond minCount are kept until the pool is destroyed, since
+ * destroying one unloads the model from the NNRt service.
+ */
+class ExecutorPool {
+public:
+    using CreateFunc = std::function<OH_NNExecutor*()>;
+    using ResetFunc = std::function<OH_NN_ReturnCode(OH_NNExecutor*)>;
+    using DestroyFunc = std::function<void(OH_NNExecutor*)>;
+
+    ExecutorPool(CreateFunc create, ResetFunc reset, DestroyFunc destroy);
+    // Destroys every executor of the pool, the borrowed ones included, so the owner checks GetBorrowedCount() first.
+    ~ExecutorPool();
+
+    OH_NN_ReturnCode Init(size_t minCount, size_t maxCount);
+    // Waits at most timeoutMs for an executor when all maxCount executors are borrowed, 0 waits until one is released.
+    OH_NN_ReturnCode Acquire(uint32_t timeoutMs, OH_NNExecutor** executor);
+    OH_NN_ReturnCode Release(OH_NNExecutor* executor);
+
+    size_t GetExecutorCount() const;
+    size_t GetIdleCount() const;
+    // Includes the released executors whose reset has not finished yet.
+    size_t GetBorrowedCount() const;
+
+private:
+    ExecutorPool(const ExecutorPool&) = delete;
+    ExecutorPool& operator=(const ExecutorPool&) = delete;
+
+private:
+    CreateFunc m_create;
+    ResetFunc m_reset;
+    DestroyFunc m_destroy;
+    mutable std::mutex m_mtx;
+    // Executors are constructed one at a time, constructing one updates the model IDs kept in the compilation.
+    std::mutex m_createMtx;
+    std::condition_variable m_released;
+    std::vector<OH_NNExecutor*> m_idle;
+    std::unordered_set<OH_NNExecutor*> m_borrowed;
+    // Released executors being reset, they still count as borrowed until they are idle again or destroyed.
+    std::unordered_set<OH_NNExecutor*> m_returning;
+    // Counts the executors being constructed as well, so that concurrent Acquire() calls never exceed m_maxCount.
+    size_t m_executorCount {0};
+    size_t m_maxCount {0};
+    bool m_isInitialized {false};
+};
+}  // namespace NeuralNetworkRuntime
+}  // namespace OHOS
+#endif  // NEURAL_NETWORK_CORE_EXECUTOR_POOL_H
@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "latency_metrics.h"
+
+#include <algorithm>
+
+#include "log.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace {
+constexpr uint64_t NS_PER_US = 1000;
+constexpr size_t UINT64_BITS = 64;
+
+const char* const STAGE_NAMES[OH_NN_STAGE_NUM] = {
+    "build",
+    "cache_restore",
+    "tensor_alloc",
+    "io_translation",
+    "hdi_run",
+    "output_shape_update",
+};
+
+// Owns the histogram of one thread and hands it back to LatencyMetrics when the thread exits.
+class ThreadHistogramHolder {
+public:
+    ThreadHistogramHolder()
+    {
+        LatencyMetrics::GetInstance().Attach(&m_histogram);
+    }
+
+    ~ThreadHistogramHolder()
+    {
+        LatencyMetrics::GetInstance().Detach(&m_histogram);
+    }
+
+    LatencyMetrics::ThreadHistogram& Get()
+    {
+        return m_histogram;
+    }
+
+private:
+    LatencyMetrics::ThreadHistogram m_histogram;
+};
+
+void StoreMin(std::atomic<uint64_t>& target, uint64_t value)
+{
+    uint64_t current = target.load(std::memory_order_relaxed);
+    while (value < current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+}
+
+void StoreMax(std::atomic<uint64_t>& target, uint64_t value)
+{
+    uint64_t current = target.load(std::memory_order_relaxed);
+    while (value > current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+}
+
+void ClearCounters(LatencyMetrics::StageCounters& counters)
+{
+    counters.count.store(0, std::memory_order_relaxed);
+    counters.totalNs.store(0, std::memory_order_relaxed);
+    counters.minNs.store(UINT64_MAX, std::memory_order_relaxed);
+    counters.maxNs.store(0, std::memory_order_relaxed);
+    for (auto& bucket : counters.buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+}
+} // namespace
+
+LatencyMetrics& LatencyMetrics::GetInstance()
+{
+    // Never destroyed: detached threads may still exit and detach their histograms during static destruction.
+    static LatencyMetrics* instance = new LatencyMetrics();
+    return *instance;
+}
+
+size_t LatencyMetrics::GetBucketIndex(uint64_t durationNs)
+{
+    uint64_t durationUs = durationNs / NS_PER_US;
+    if (durationUs == 0) {
+        return 0;
+    }
+    // Bucket i holds [2^(i-1), 2^i) us, which is the bit width of durationUs.
+    size_t index = UINT64_BITS - static_cast<size_t>(__builtin_clzll(durationUs));
+    return std::min<size_t>(index, OH_NN_LATENCY_BUCKET_NUM - 1);
+}
+
+const char* LatencyMetrics::GetStageName(OH_NN_LatencyStage stage)
+{
+    if (stage < OH_NN_STAGE_BUILD || stage >= OH_NN_STAGE_NUM) {
+        return "unknown";
+    }
+    return STAGE_NAMES[stage];
+}
+
+void LatencyMetrics::Record(OH_NN_LatencyStage stage, uint64_t durationNs)
+{
+    if (stage < OH_NN_STAGE_BUILD || stage >= OH_NN_STAGE_NUM) {
+        return;
+    }
+
+    thread_local ThreadHistogramHolder holder;
+    StageCounters& counters = holder.Get().stages[stage];
+    counters.count.fetch_add(1, std::memory_order_relaxed);
+    counters.totalNs.fetch_add(durationNs, std::memory_order_relaxed);
+    counters.buckets[GetBucketIndex(durationNs)].fetch_add(1, std::memory_order_relaxed);
+    StoreMin(counters.minNs, durationNs);
+    StoreMax(counters.maxNs, durationNs);
+}
+
+void LatencyMetrics::Attach(ThreadHistogram* histogram)
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    m_threadHistograms.emplace_back(histogram);
+}
+
+void LatencyMetrics::Detach(ThreadHistogram* histogram)
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    for (size_t stage = 0; stage < OH_NN_STAGE_NUM; ++stage) {
+        const StageCounters& from = histogram->stages[stage];
+        StageCounters& to = m_retired.stages[stage];
+        to.count.fetch_add(from.count.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        to.totalNs.fetch_add(from.totalNs.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        StoreMin(to.minNs, from.minNs.load(std::memory_order_relaxed));
+        StoreMax(to.maxNs, from.maxNs.load(std::memory_order_relaxed));
+        for (size_t i = 0; i < OH_NN_LATENCY_BUCKET_NUM; ++i) {
+            to.buckets[i].fetch_add(from.buckets[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+    }
+
+    auto iter = std::find(m_threadHistograms.begin(), m_threadHistograms.end(), histogram);
+    if (iter != m_threadHistograms.end()) {
+        m_threadHistograms.erase(iter);
+    }
+}
+
+void LatencyMetrics::CollectLocked(OH_NN_LatencyStage stage, OH_NN_LatencyHistogram& histogram) const
+{
+    histogram = {};
+    uint64_t minNs = UINT64_MAX;
+    auto accumulate = [&histogram, &minNs](const StageCounters& counters) {
+        histogram.count += counters.count.load(std::memory_order_relaxed);
+        histogram.totalNs += counters.totalNs.load(std::memory_order_relaxed);
+        minNs = std::min(minNs, counters.minNs.load(std::memory_order_relaxed));
+        histogram.maxNs = std::max(histogram.maxNs, counters.maxNs.load(std::memory_order_relaxed));
+        for (size_t i = 0; i < OH_NN_LATENCY_BUCKET_NUM; ++i) {
+            histogram.buckets[i] += counters.buckets[i].load(std::memory_order_relaxed);
+        }
+    };
+
+    accumulate(m_retired.stages[stage]);
+    for (const ThreadHistogram* threadHistogram : m_threadHistograms) {
+        accumulate(threadHistogram->stages[stage]);
+    }
+    histogram.minNs = (histogram.count == 0) ? 0 : minNs;
+}
+
+OH_NN_ReturnCode LatencyMetrics::GetHistogram(OH_NN_LatencyStage stage, OH_NN_LatencyHistogram& histogram) const
+{
+    if (stage < OH_NN_STAGE_BUILD || stage >= OH_NN_STAGE_NUM) {
+        LOGE("[LatencyMetrics] GetHistogram failed, invalid stage %{public}d.", static_cast<int>(stage));
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mtx);
+    CollectLocked(stage, histogram);
+    return OH_NN_SUCCESS;
+}
+
+std::string LatencyMetrics::DumpToJson() const
+{
+    std::string json = "{\"bucketUnit\":\"us\",\"stages\":[";
+    std::lock_guard<std::mutex> lock(m_mtx);
+    for (int stage = OH_NN_STAGE_BUILD; stage < OH_NN_STAGE_NUM; ++stage) {
+        OH_NN_LatencyHistogram histogram;
+        CollectLocked(static_cast<OH_NN_LatencyStage>(stage), histogram);
+        if (stage != OH_NN_STAGE_BUILD) {
+            json += ",";
+        }
+        json += "{\"name\":\"" + std::string(STAGE_NAMES[stage]) + "\"";
+        json += ",\"count\":" + std::to_string(histogram.count);
+        json += ",\"totalNs\":" + std::to_string(histogram.totalNs);
+        json += ",\"minNs\":" + std::to_string(histogram.minNs);
+        json += ",\"maxNs\":" + std::to_string(histogram.maxNs);
+        json += ",\"buckets\":[";
+        for (size_t i = 0; i < OH_NN_LATENCY_BUCKET_NUM; ++i) {
+            if (i != 0) {
+                json += ",";
+            }
+            json += std::to_string(histogram.buckets[i]);
+        }
+        json += "]}";
+    }
+    json += "]}";
+    return json;
+}
+
+void LatencyMetrics::Reset()
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    for (size_t stage = 0; stage < OH_NN_STAGE_NUM; ++stage) {
+        ClearCounters(m_retired.stages[stage]);
+        for (ThreadHistogram* threadHistogram : m_threadHistograms) {
+            ClearCounters(threadHistogram->stages[stage]);
+        }
+    }
+}
+}  // namespace NeuralNetworkRuntime
+}  // namespace OHOS
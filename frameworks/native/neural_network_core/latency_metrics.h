@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NEURAL_NETWORK_CORE_LATENCY_METRICS_H
+#define NEURAL_NETWORK_CORE_LATENCY_METRICS_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "neural_network_runtime_inner.h"
+
+#define NNRT_LATENCY_CONCAT_IMPL(a, b) a##b
+#define NNRT_LATENCY_CONCAT(a, b) NNRT_LATENCY_CONCAT_IMPL(a, b)
+#define NNRT_LATENCY_SCOPE(stage) ScopedLatency NNRT_LATENCY_CONCAT(nnrtLatencyScope, __LINE__)(stage)
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+/**
+ * Process-wide latency histograms of the runtime stages listed in OH_NN_LatencyStage.
+ *
+ * Every thread records into its own histogram, so Record() never takes a lock. Readers sum up the histograms of all
+ * live threads plus the counts left behind by threads which have already exited.
+ */
+class LatencyMetrics {
+public:
+    static LatencyMetrics& GetInstance();
+
+    void Record(OH_NN_LatencyStage stage, uint64_t durationNs);
+    OH_NN_ReturnCode GetHistogram(OH_NN_LatencyStage stage, OH_NN_LatencyHistogram& histogram) const;
+    std::string DumpToJson() const;
+    void Reset();
+
+    static size_t GetBucketIndex(uint64_t durationNs);
+    static const char* GetStageName(OH_NN_LatencyStage stage);
+
+    struct StageCounters {
+        std::atomic<uint64_t> count {0};
+        std::atomic<uint64_t> totalNs {0};
+        std::atomic<uint64_t> minNs {UINT64_MAX};
+        std::atomic<uint64_t> maxNs {0};
+        std::atomic<uint64_t> buckets[OH_NN_LATENCY_BUCKET_NUM] {};
+    };
+
+    struct ThreadHistogram {
+        StageCounters stages[OH_NN_STAGE_NUM];
+    };
+
+    // Registers the histogram of the calling thread, called once per thread.
+    void Attach(ThreadHistogram* histogram);
+    // Folds the histogram of an exiting thread into m_retired and unregisters it.
+    void Detach(ThreadHistogram* histogram);
+
+private:
+    LatencyMetrics() = default;
+    LatencyMetrics(const LatencyMetrics&) = delete;
+    LatencyMetrics& operator=(const LatencyMetrics&) = delete;
+    ~LatencyMetrics() = default;
+
+    void CollectLocked(OH_NN_LatencyStage stage, OH_NN_LatencyHistogram& histogram) const;
+
+private:
+    mutable std::mutex m_mtx;
+    std::vector<ThreadHistogram*> m_threadHistograms;
+    ThreadHistogram m_retired;
+};
+
+class ScopedLatency {
+public:
+    explicit ScopedLatency(OH_NN_LatencyStage stage)
+        : m_stage(stage), m_start(std::chrono::steady_clock::now()) {}
+
+    ~ScopedLatency()
+    {
+        Finish();
+    }
+
+    // Records the time elapsed since construction. Only the first call records, later calls and the destructor
+    // are no-ops, which allows timing a stage that ends before the enclosing scope does.
+    void Finish()
+    {
+        if (m_isFinished) {
+            return;
+        }
+        m_isFinished = true;
+        auto duration = std::chrono::steady_clock::now() - m_start;
+        LatencyMetrics::GetInstance().Record(m_stage,
+            static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()));
+    }
+
+private:
+    OH_NN_LatencyStage m_stage;
+    std::chrono::steady_clock::time_point m_start;
+    bool m_isFinished {false};
+};
+}  // namespace NeuralNetworkRuntime
+}  // namespace OHOS
+#endif  // NEURAL_NETWORK_CORE_LATENCY_METRICS_H
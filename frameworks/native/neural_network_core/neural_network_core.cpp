@@ -939,6 +939,19 @@ NNRT_API void OH_NNCompilation_Destroy(OH_NNCompilation **compilation)
     }
 
     Compilation* compilationImpl = reinterpret_cast<Compilation*>(*compilation);
+    {
+        // Checked and reset under the lock the pool is created and looked up with.
+        std::lock_guard<std::mutex> lock(compilationImpl->executorPoolMutex);
+        size_t borrowedCount =
+            (compilationImpl->executorPool != nullptr) ? compilationImpl->executorPool->GetBorrowedCount() : 0;
+        if (borrowedCount > 0) {
+            LOGE("OH_NNCompilation_Destroy failed, %{public}zu executors of the pool are still borrowed.",
+                 borrowedCount);
+            return;
+        }
+        // The pooled executors are destroyed through the backend as well, release them before the compiler.
+        compilationImpl->executorPool.reset();
+    }
     if (compilationImpl->compiler != nullptr) {
         BackendManager& manager = BackendManager::GetInstance();
         std::shared_ptr<Backend> backend = manager.GetBackend(compilationImpl->backendID);
@@ -14,6 +14,9 @@
  */
 
 #include "tensor_desc.h"
+
+#include <algorithm>
+
 #include "validation.h"
 #include "log.h"
 
@@ -23,7 +26,7 @@ const uint32_t BIT8_TO_BYTE = 1;
 const uint32_t BIT16_TO_BYTE = 2;
 const uint32_t BIT32_TO_BYTE = 4;
 const uint32_t BIT64_TO_BYTE = 8;
-const size_t SHAPE_MAX_NUM = 10;
+const size_t INT4_PER_BYTE = 2;
 
 uint32_t GetTypeSize(OH_NN_DataType type)
 {
@@ -36,6 +39,7 @@ uint32_t GetTypeSize(OH_NN_DataType type)
         case OH_NN_INT16:
         case OH_NN_UINT16:
         case OH_NN_FLOAT16:
+        case OH_NN_BFLOAT16:
             return BIT16_TO_BYTE;
         case OH_NN_INT32:
         case OH_NN_UINT32:
@@ -104,8 +108,8 @@ OH_NN_ReturnCode TensorDesc::GetShape(int32_t** shape, size_t* shapeNum) const
         LOGE("GetShape failed, shapeNum is nullptr.");
         return OH_NN_INVALID_PARAMETER;
     }
-    *shape = const_cast<int32_t*>(m_shape.data());
-    *shapeNum = m_shape.size();
+    *shape = (m_shapeNum == 0) ? nullptr : const_cast<int32_t*>(m_shape.data());
+    *shapeNum = m_shapeNum;
     return OH_NN_SUCCESS;
 }
 
@@ -120,10 +124,8 @@ OH_NN_ReturnCode TensorDesc::SetShape(const int32_t* shape, size_t shapeNum)
         return OH_NN_INVALID_PARAMETER;
     }
 
-    m_shape.clear();
-    for (size_t i = 0; i < shapeNum; ++i) {
-        m_shape.emplace_back(shape[i]);
-    }
+    std::copy(shape, shape + shapeNum, m_shape.begin());
+    m_shapeNum = shapeNum;
     return OH_NN_SUCCESS;
 }
 
@@ -133,13 +135,12 @@ OH_NN_ReturnCode TensorDesc::GetElementNum(size_t* elementNum) const
         LOGE("GetElementNum failed, elementNum is nullptr.");
         return OH_NN_INVALID_PARAMETER;
     }
-    if (m_shape.empty()) {
+    if (m_shapeNum == 0) {
         LOGE("GetElementNum failed, shape is empty.");
         return OH_NN_INVALID_PARAMETER;
     }
     *elementNum = 1;
-    size_t shapeNum = m_shape.size();
-    for (size_t i = 0; i < shapeNum; ++i) {
+    for (size_t i = 0; i < m_shapeNum; ++i) {
         if (m_shape[i] <= 0) {
             LOGW("GetElementNum return 0 with dynamic shape, shape[%{public}zu] is %{public}d.", i, m_shape[i]);
             *elementNum = 0;
@@ -166,6 +167,11 @@ OH_NN_ReturnCode TensorDesc::GetByteSize(size_t* byteSize) const
         return ret;
     }
 
+    if (m_dataType == OH_NN_INT4) {
+        *byteSize = (elementNum + INT4_PER_BYTE - 1) / INT4_PER_BYTE;
+        return OH_NN_SUCCESS;
+    }
+
     uint32_t typeSize = GetTypeSize(m_dataType);
     if (typeSize == 0) {
         LOGE("GetByteSize failed, data type is invalid.");
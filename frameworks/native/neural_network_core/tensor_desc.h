@@ -16,14 +16,23 @@
 #ifndef NEURAL_NETWORK_RUNTIME_TENSOR_DESC_H
 #define NEURAL_NETWORK_RUNTIME_TENSOR_DESC_H
 
+#include <array>
+#include <cstdint>
 #include <string>
 #include <vector>
 #include "neural_network_runtime/neural_network_runtime_type.h"
 
 namespace OHOS {
 namespace NeuralNetworkRuntime {
+/**
+ * Describes a tensor. The shape is kept inline, since its rank is bounded by SHAPE_MAX_NUM, so that descs copied
+ * between the compilation, the executors and the user on the run path do not allocate for it. Only a name longer than
+ * the small string buffer of std::string still allocates when a desc is copied.
+ */
 class TensorDesc {
 public:
+    static constexpr size_t SHAPE_MAX_NUM = 10;
+
     TensorDesc() = default;
     ~TensorDesc() = default;
 
@@ -45,7 +54,8 @@ public:
 private:
     OH_NN_DataType m_dataType {OH_NN_UNKNOWN};
     OH_NN_Format m_format {OH_NN_FORMAT_NONE};
-    std::vector<int32_t> m_shape;
+    std::array<int32_t, SHAPE_MAX_NUM> m_shape {};
+    size_t m_shapeNum {0};
     std::string m_name;
 };
 }  // namespace NeuralNetworkRuntime
@@ -15,13 +15,85 @@
 
 #include "utils.h"
 
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
+#include <sstream>
+
 namespace OHOS {
 namespace NeuralNetworkRuntime {
+namespace {
+constexpr char PAIR_SEPARATOR = ';';
+constexpr char FIELD_SEPARATOR = ':';
+constexpr size_t PAIR_FIELDS = 2;
+constexpr int DECIMAL_BASE = 10;
+
+bool ParseIndex(const std::string& field, uint32_t& index)
+{
+    if (field.empty() || !std::isdigit(static_cast<unsigned char>(field[0]))) {
+        return false;
+    }
+    errno = 0;
+    char* end = nullptr;
+    unsigned long long parsed = std::strtoull(field.c_str(), &end, DECIMAL_BASE);
+    if (errno == ERANGE || end == nullptr || *end != '\0' || parsed > UINT32_MAX) {
+        return false;
+    }
+    index = static_cast<uint32_t>(parsed);
+    return true;
+}
+} // namespace
+
 std::string GenUniqueName(
     const std::string& deviceName, const std::string& vendorName, const std::string& version)
 {
     return deviceName + "_" + vendorName + "_" + version;
 }
 
+OH_NN_ReturnCode ParseIndexPairs(const std::string& value, size_t maxFields, std::vector<std::vector<uint32_t>>& pairs)
+{
+    pairs.clear();
+    std::istringstream pairStream(value);
+    std::string pairString;
+    while (std::getline(pairStream, pairString, PAIR_SEPARATOR)) {
+        if (pairString.empty()) {
+            continue;
+        }
+
+        std::vector<uint32_t> fields;
+        std::istringstream fieldStream(pairString);
+        std::string field;
+        while (std::getline(fieldStream, field, FIELD_SEPARATOR)) {
+            uint32_t index = 0;
+            if (!ParseIndex(field, index)) {
+                LOGE("ParseIndexPairs failed, %{public}s is not an index.", field.c_str());
+                return OH_NN_INVALID_PARAMETER;
+            }
+            fields.emplace_back(index);
+        }
+        if (fields.size() < PAIR_FIELDS || fields.size() > std::max(maxFields, PAIR_FIELDS)) {
+            LOGE("ParseIndexPairs failed, %{public}s does not hold 2 to %{public}zu indices.",
+                pairString.c_str(), std::max(maxFields, PAIR_FIELDS));
+            return OH_NN_INVALID_PARAMETER;
+        }
+
+        for (const std::vector<uint32_t>& other : pairs) {
+            if (other[0] == fields[0] || other[1] == fields[1]) {
+                LOGE("ParseIndexPairs failed, first index %{public}u or second index %{public}u is given twice.",
+                    fields[0], fields[1]);
+                return OH_NN_INVALID_PARAMETER;
+            }
+        }
+        pairs.emplace_back(std::move(fields));
+    }
+
+    if (pairs.empty()) {
+        LOGE("ParseIndexPairs failed, no pair is given.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+    return OH_NN_SUCCESS;
+}
+
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
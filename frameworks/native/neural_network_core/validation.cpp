@@ -20,7 +20,7 @@ namespace NeuralNetworkRuntime {
 namespace Validation {
 bool ValidateTensorDataType(OH_NN_DataType dataType)
 {
-    if (dataType >= OH_NN_UNKNOWN && dataType <= OH_NN_FLOAT64) {
+    if (dataType >= OH_NN_UNKNOWN && dataType <= OH_NN_INT4) {
         return true;
     }
     return false;
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "aipp_config_registry.h"
+
+#include "log.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+AippConfigRegistry& AippConfigRegistry::GetInstance()
+{
+    static AippConfigRegistry instance;
+    return instance;
+}
+
+OH_NN_ReturnCode AippConfigRegistry::Register(const std::string& aippStrings, uint32_t& aippHandle)
+{
+    if (aippStrings.empty()) {
+        LOGE("[AippConfigRegistry] Register failed, aippStrings is empty.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mtx);
+    auto handleIter = m_handles.find(aippStrings);
+    if (handleIter != m_handles.end()) {
+        ++m_configs[handleIter->second].refCount;
+        aippHandle = handleIter->second;
+        return OH_NN_SUCCESS;
+    }
+
+    // Skip the invalid handle and the handles still in use once the counter wraps around.
+    while (m_nextHandle == INVALID_HANDLE || m_configs.find(m_nextHandle) != m_configs.end()) {
+        ++m_nextHandle;
+    }
+
+    auto configStrings = std::make_shared<const std::string>(aippStrings);
+    m_configs[m_nextHandle] = ConfigEntry {configStrings, 1};
+    m_handles[aippStrings] = m_nextHandle;
+    aippHandle = m_nextHandle++;
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode AippConfigRegistry::Unregister(uint32_t aippHandle)
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    auto configIter = m_configs.find(aippHandle);
+    if (configIter == m_configs.end()) {
+        LOGE("[AippConfigRegistry] Unregister failed, aipp handle %{public}u is not registered.", aippHandle);
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    if (--configIter->second.refCount == 0) {
+        m_handles.erase(*configIter->second.aippStrings);
+        m_configs.erase(configIter);
+    }
+    return OH_NN_SUCCESS;
+}
+
+std::shared_ptr<const std::string> AippConfigRegistry::Get(uint32_t aippHandle) const
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    auto configIter = m_configs.find(aippHandle);
+    if (configIter == m_configs.end()) {
+        return nullptr;
+    }
+    return configIter->second.aippStrings;
+}
+}  // namespace NeuralNetworkRuntime
+}  // namespace OHOS
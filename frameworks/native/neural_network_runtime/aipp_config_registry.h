@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NEURAL_NETWORK_RUNTIME_AIPP_CONFIG_REGISTRY_H
+#define NEURAL_NETWORK_RUNTIME_AIPP_CONFIG_REGISTRY_H
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "neural_network_runtime/neural_network_runtime_type.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+/**
+ * Process-wide table of the AIPP configurations registered by OH_NN_RegisterAippConfig().
+ *
+ * A handle always names the same string, so a prepared model which has applied a handle does not need the string
+ * again for the next run with that handle. Registering an identical string returns the existing handle and adds a
+ * reference to it, the handle is released once it has been unregistered as often as it was registered.
+ */
+class AippConfigRegistry {
+public:
+    static constexpr uint32_t INVALID_HANDLE = 0;
+
+    static AippConfigRegistry& GetInstance();
+
+    OH_NN_ReturnCode Register(const std::string& aippStrings, uint32_t& aippHandle);
+    OH_NN_ReturnCode Unregister(uint32_t aippHandle);
+    std::shared_ptr<const std::string> Get(uint32_t aippHandle) const;
+
+private:
+    AippConfigRegistry() = default;
+    AippConfigRegistry(const AippConfigRegistry&) = delete;
+    AippConfigRegistry& operator=(const AippConfigRegistry&) = delete;
+    ~AippConfigRegistry() = default;
+
+    struct ConfigEntry {
+        std::shared_ptr<const std::string> aippStrings {nullptr};
+        uint32_t refCount {0};
+    };
+
+private:
+    mutable std::mutex m_mtx;
+    uint32_t m_nextHandle {INVALID_HANDLE + 1};
+    std::unordered_map<uint32_t, ConfigEntry> m_configs;
+    std::unordered_map<std::string, uint32_t> m_handles;
+};
+}  // namespace NeuralNetworkRuntime
+}  // namespace OHOS
+#endif  // NEURAL_NETWORK_RUNTIME_AIPP_CONFIG_REGISTRY_H
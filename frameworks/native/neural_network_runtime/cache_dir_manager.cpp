@@ -0,0 +1,468 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cache_dir_manager.h"
+
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "nlohmann/json.hpp"
+#include "securec.h"
+
+#include "log.h"
+#include "neural_network_runtime_inner.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace {
+const std::string INDEX_FILE_NAME = ".nncache_index";
+const std::string INDEX_HEADER = "nncache_index";
+const std::string CACHE_INFO_SUFFIX = "cache_info.nncache";
+constexpr uint32_t INDEX_FORMAT_VERSION = 1;
+constexpr int64_t FILE_NUMBER_MAX = 100;
+constexpr int64_t NS_PER_MS = 1000 * 1000;
+
+int64_t GetCurrentTime()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+int64_t GetModifyTime(const struct stat& fileStat)
+{
+    return static_cast<int64_t>(fileStat.st_mtim.tv_sec) * NS_PER_MS * 1000 + fileStat.st_mtim.tv_nsec;
+}
+
+std::string GetCacheInfoPath(const std::string& dir, const std::string& modelName)
+{
+    return dir + "/" + modelName + CACHE_INFO_SUFFIX;
+}
+
+std::string GetCacheModelPath(const std::string& dir, const std::string& modelName, int64_t index)
+{
+    return dir + "/" + modelName + std::to_string(index) + ".nncache";
+}
+
+OH_NN_ReturnCode ParseCacheInfo(const std::string& content, CacheIndexEntry& entry)
+{
+    if (!nlohmann::json::accept(content)) {
+        LOGE("[CacheDirManager] ReadCacheInfo JSON parse error.");
+        return OH_NN_INVALID_FILE;
+    }
+
+    nlohmann::json j = nlohmann::json::parse(content);
+    if (j.find("data") == j.end()) {
+        LOGE("[CacheDirManager] ReadCacheInfo read data from cache info file failed.");
+        return OH_NN_INVALID_FILE;
+    }
+
+    if (j["data"].find("deviceId") == j["data"].end()) {
+        LOGE("[CacheDirManager] ReadCacheInfo read deviceId from cache info file failed.");
+        return OH_NN_INVALID_FILE;
+    }
+    entry.deviceId = j["data"]["deviceId"].get<int64_t>();
+
+    if (j["data"].find("fileNumber") == j["data"].end()) {
+        LOGE("[CacheDirManager] ReadCacheInfo read fileNumber from cache info file failed.");
+        return OH_NN_INVALID_FILE;
+    }
+    entry.fileNumber = j["data"]["fileNumber"].get<int>();
+
+    if (j["data"].find("version") == j["data"].end()) {
+        LOGE("[CacheDirManager] ReadCacheInfo read version from cache info file failed.");
+        return OH_NN_INVALID_FILE;
+    }
+    entry.version = j["data"]["version"].get<int>();
+
+    if (j.find("CheckSum") == j.end()) {
+        LOGE("[CacheDirManager] ReadCacheInfo read CheckSum from cache info file failed.");
+        return OH_NN_INVALID_FILE;
+    }
+    const size_t dataLength = j["data"].dump().length();
+    char jData[dataLength + 1];
+
+    if (strncpy_s(jData, dataLength+1, j["data"].dump().c_str(), dataLength) != 0) {
+        LOGE("[CacheDirManager] ReadCacheInfo ParseStr failed due to strncpy_s error.");
+        return OH_NN_INVALID_FILE;
+    }
+
+    if (static_cast<int64_t>(CacheInfoGetCrc16(jData, dataLength)) != j["CheckSum"].get<int64_t>()) {
+        LOGE("[CacheDirManager] ReadCacheInfo cache_info CheckSum is not correct.");
+        return OH_NN_INVALID_FILE;
+    }
+
+    return OH_NN_SUCCESS;
+}
+} // namespace
+
+CacheDirManager& CacheDirManager::GetInstance()
+{
+    // Intentionally leaked, the background cache writes may still use it while static objects are destroyed at exit.
+    static CacheDirManager* instance = new CacheDirManager();
+    return *instance;
+}
+
+OH_NN_ReturnCode CacheDirManager::SetSizeLimit(const std::string& cacheDir, uint64_t sizeLimit)
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    std::string realDir;
+    DirIndex* index = GetDirIndex(cacheDir, realDir);
+    if (index == nullptr) {
+        LOGE("[CacheDirManager] SetSizeLimit failed, fail to get the real path of cacheDir.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    index->sizeLimit = sizeLimit;
+    EvictEntries(realDir, *index, "");
+    SaveIndexFile(realDir, *index);
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode CacheDirManager::GetEntry(const std::string& cacheDir, const std::string& modelName,
+                                           CacheIndexEntry& entry)
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    std::string realDir;
+    DirIndex* index = GetDirIndex(cacheDir, realDir);
+    if (index == nullptr) {
+        LOGE("[CacheDirManager] GetEntry failed, fail to get the real path of cacheDir.");
+        return OH_NN_INVALID_FILE;
+    }
+
+    bool isChanged = false;
+    OH_NN_ReturnCode ret = RefreshEntry(realDir, modelName, *index, isChanged);
+    if (isChanged) {
+        SaveIndexFile(realDir, *index);
+    }
+    if (ret != OH_NN_SUCCESS) {
+        return ret;
+    }
+
+    entry = index->entries[modelName];
+    return OH_NN_SUCCESS;
+}
+
+void CacheDirManager::OnCacheSaved(const std::string& cacheDir, const std::string& modelName)
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    std::string realDir;
+    DirIndex* index = GetDirIndex(cacheDir, realDir);
+    if (index == nullptr) {
+        LOGW("[CacheDirManager] OnCacheSaved failed, fail to get the real path of cacheDir.");
+        return;
+    }
+
+    bool isChanged = false;
+    if (RefreshEntry(realDir, modelName, *index, isChanged) == OH_NN_SUCCESS) {
+        index->entries[modelName].lastAccessTime = GetCurrentTime();
+    }
+    EvictEntries(realDir, *index, modelName);
+    SaveIndexFile(realDir, *index);
+}
+
+void CacheDirManager::OnCacheRestored(const std::string& cacheDir, const std::string& modelName)
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    std::string realDir;
+    DirIndex* index = GetDirIndex(cacheDir, realDir);
+    if (index == nullptr) {
+        return;
+    }
+
+    bool isChanged = false;
+    if (RefreshEntry(realDir, modelName, *index, isChanged) == OH_NN_SUCCESS) {
+        index->entries[modelName].lastAccessTime = GetCurrentTime();
+        isChanged = true;
+    }
+    if (isChanged) {
+        SaveIndexFile(realDir, *index);
+    }
+}
+
+void CacheDirManager::Pin(const std::string& cacheDir, const std::string& modelName)
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    std::string realDir;
+    DirIndex* index = GetDirIndex(cacheDir, realDir);
+    if (index == nullptr) {
+        LOGW("[CacheDirManager] Pin failed, fail to get the real path of cacheDir.");
+        return;
+    }
+    ++index->pinCounts[modelName];
+}
+
+void CacheDirManager::Unpin(const std::string& cacheDir, const std::string& modelName)
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    std::string realDir;
+    DirIndex* index = GetDirIndex(cacheDir, realDir);
+    if (index == nullptr) {
+        return;
+    }
+
+    auto iter = index->pinCounts.find(modelName);
+    if ((iter != index->pinCounts.end()) && (--iter->second == 0)) {
+        index->pinCounts.erase(iter);
+    }
+}
+
+void CacheDirManager::RemoveCache(const std::string& cacheDir, const std::string& modelName)
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    std::string realDir;
+    DirIndex* index = GetDirIndex(cacheDir, realDir);
+    if (index == nullptr) {
+        unlink(GetCacheInfoPath(cacheDir, modelName).c_str());
+        return;
+    }
+
+    // The model cache files are only known for an indexed cache, otherwise only the cache info is removed.
+    auto iter = index->entries.find(modelName);
+    int64_t fileNumber = (iter != index->entries.end()) ? iter->second.fileNumber : 0;
+    RemoveCacheFiles(realDir, modelName, fileNumber);
+    if (iter != index->entries.end()) {
+        index->entries.erase(iter);
+        SaveIndexFile(realDir, *index);
+    }
+}
+
+OH_NN_ReturnCode CacheDirManager::ReadCacheInfo(const std::string& cacheInfoPath, CacheIndexEntry& entry)
+{
+    char path[PATH_MAX];
+    if (realpath(cacheInfoPath.c_str(), path) == nullptr) {
+        LOGE("[CacheDirManager] ReadCacheInfo get real path of cache info failed.");
+        return OH_NN_INVALID_FILE;
+    }
+
+    std::ifstream ifs(path, std::ios::in | std::ios::binary);
+    if (!ifs) {
+        LOGE("[CacheDirManager] ReadCacheInfo open cache info file failed.");
+        return OH_NN_INVALID_FILE;
+    }
+
+    std::string content((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+    ifs.close();
+    return ParseCacheInfo(content, entry);
+}
+
+CacheDirManager::DirIndex* CacheDirManager::GetDirIndex(const std::string& cacheDir, std::string& realDir)
+{
+    char path[PATH_MAX];
+    if (realpath(cacheDir.c_str(), path) == nullptr) {
+        return nullptr;
+    }
+
+    realDir = path;
+    auto iter = m_dirs.find(realDir);
+    if (iter != m_dirs.end()) {
+        return &iter->second;
+    }
+
+    DirIndex& index = m_dirs[realDir];
+    if (!LoadIndexFile(realDir, index)) {
+        index = DirIndex {};
+        ScanDir(realDir, index);
+        SaveIndexFile(realDir, index);
+    }
+    return &index;
+}
+
+bool CacheDirManager::LoadIndexFile(const std::string& realDir, DirIndex& index) const
+{
+    std::ifstream indexFile(realDir + "/" + INDEX_FILE_NAME);
+    if (!indexFile.is_open()) {
+        return false;
+    }
+
+    std::string line;
+    std::string header;
+    uint32_t formatVersion = 0;
+    if (!std::getline(indexFile, line) || !(std::istringstream(line) >> header >> formatVersion >> index.sizeLimit) ||
+        (header != INDEX_HEADER) || (formatVersion != INDEX_FORMAT_VERSION)) {
+        LOGW("[CacheDirManager] The cache index of %{public}s is invalid, scan the directory.", realDir.c_str());
+        return false;
+    }
+
+    // Every line is "fileNumber version deviceId size lastAccessTime infoModifyTime infoSize modelName".
+    while (std::getline(indexFile, line)) {
+        std::istringstream fields(line);
+        CacheIndexEntry entry;
+        if (!(fields >> entry.fileNumber >> entry.version >> entry.deviceId >> entry.size >> entry.lastAccessTime >>
+            entry.infoModifyTime >> entry.infoSize) || (fields.get() != ' ')) {
+            LOGW("[CacheDirManager] The cache index of %{public}s is invalid, scan the directory.", realDir.c_str());
+            return false;
+        }
+        std::string modelName;
+        std::getline(fields, modelName);
+        index.entries[modelName] = entry;
+    }
+    return true;
+}
+
+void CacheDirManager::ScanDir(const std::string& realDir, DirIndex& index) const
+{
+    std::error_code errorCode;
+    for (const auto& dirEntry : std::filesystem::directory_iterator(realDir, errorCode)) {
+        std::string fileName = dirEntry.path().filename().string();
+        if ((fileName.size() < CACHE_INFO_SUFFIX.size()) ||
+            (fileName.compare(fileName.size() - CACHE_INFO_SUFFIX.size(), CACHE_INFO_SUFFIX.size(),
+                CACHE_INFO_SUFFIX) != 0)) {
+            continue;
+        }
+
+        // Caches written before the index existed count as used when they were written.
+        std::string modelName = fileName.substr(0, fileName.size() - CACHE_INFO_SUFFIX.size());
+        bool isChanged = false;
+        if (RefreshEntry(realDir, modelName, index, isChanged) == OH_NN_SUCCESS) {
+            CacheIndexEntry& entry = index.entries[modelName];
+            entry.lastAccessTime = entry.infoModifyTime / NS_PER_MS;
+        }
+    }
+    if (errorCode) {
+        LOGW("[CacheDirManager] Fail to scan %{public}s, the index may be incomplete.", realDir.c_str());
+    }
+}
+
+void CacheDirManager::SaveIndexFile(const std::string& realDir, const DirIndex& index) const
+{
+    // The index is written aside and renamed over the old one, a reader never sees it partly written.
+    std::string indexPath = realDir + "/" + INDEX_FILE_NAME;
+    std::string tempPath = indexPath + "." + std::to_string(getpid()) + ".tmp";
+    {
+        std::ofstream indexFile(tempPath, std::ios::out | std::ios::trunc);
+        if (!indexFile.is_open()) {
+            LOGW("[CacheDirManager] Fail to write the cache index of %{public}s.", realDir.c_str());
+            return;
+        }
+
+        indexFile << INDEX_HEADER << " " << INDEX_FORMAT_VERSION << " " << index.sizeLimit << "\n";
+        for (const auto& item : index.entries) {
+            // A name which would break the line is left out, its cache is read from the cache info again.
+            if (item.first.find('\n') != std::string::npos) {
+                continue;
+            }
+            const CacheIndexEntry& entry = item.second;
+            indexFile << entry.fileNumber << " " << entry.version << " " << entry.deviceId << " " << entry.size <<
+                " " << entry.lastAccessTime << " " << entry.infoModifyTime << " " << entry.infoSize << " " <<
+                item.first << "\n";
+        }
+        if (!indexFile.flush()) {
+            LOGW("[CacheDirManager] Fail to write the cache index of %{public}s.", realDir.c_str());
+            indexFile.close();
+            unlink(tempPath.c_str());
+            return;
+        }
+    }
+
+    if (rename(tempPath.c_str(), indexPath.c_str()) != 0) {
+        LOGW("[CacheDirManager] Fail to publish the cache index of %{public}s.", realDir.c_str());
+        unlink(tempPath.c_str());
+    }
+}
+
+OH_NN_ReturnCode CacheDirManager::RefreshEntry(const std::string& realDir, const std::string& modelName,
+                                               DirIndex& index, bool& isChanged) const
+{
+    auto iter = index.entries.find(modelName);
+    std::string cacheInfoPath = GetCacheInfoPath(realDir, modelName);
+    struct stat infoStat;
+    if (stat(cacheInfoPath.c_str(), &infoStat) != 0) {
+        if (iter != index.entries.end()) {
+            index.entries.erase(iter);
+            isChanged = true;
+        }
+        return OH_NN_INVALID_FILE;
+    }
+
+    int64_t infoModifyTime = GetModifyTime(infoStat);
+    if ((iter != index.entries.end()) && (iter->second.infoModifyTime == infoModifyTime) &&
+        (iter->second.infoSize == static_cast<uint64_t>(infoStat.st_size))) {
+        return OH_NN_SUCCESS;
+    }
+
+    isChanged = true;
+    CacheIndexEntry entry;
+    OH_NN_ReturnCode ret = ReadCacheInfo(cacheInfoPath, entry);
+    if (ret != OH_NN_SUCCESS) {
+        if (iter != index.entries.end()) {
+            index.entries.erase(iter);
+        }
+        return ret;
+    }
+
+    entry.infoModifyTime = infoModifyTime;
+    entry.infoSize = static_cast<uint64_t>(infoStat.st_size);
+    entry.size = entry.infoSize;
+    for (int64_t i = 0; i < entry.fileNumber; ++i) {
+        struct stat modelStat;
+        if (stat(GetCacheModelPath(realDir, modelName, i).c_str(), &modelStat) == 0) {
+            entry.size += static_cast<uint64_t>(modelStat.st_size);
+        }
+    }
+    entry.lastAccessTime = (iter != index.entries.end()) ? iter->second.lastAccessTime : infoModifyTime / NS_PER_MS;
+    index.entries[modelName] = entry;
+    return OH_NN_SUCCESS;
+}
+
+void CacheDirManager::EvictEntries(const std::string& realDir, DirIndex& index,
+                                   const std::string& keptModelName) const
+{
+    if (index.sizeLimit == 0) {
+        return;
+    }
+
+    uint64_t totalSize = 0;
+    for (const auto& item : index.entries) {
+        totalSize += item.second.size;
+    }
+
+    while (totalSize > index.sizeLimit) {
+        auto oldest = index.entries.end();
+        for (auto iter = index.entries.begin(); iter != index.entries.end(); ++iter) {
+            if ((iter->first != keptModelName) && (index.pinCounts.count(iter->first) == 0) &&
+                ((oldest == index.entries.end()) || (iter->second.lastAccessTime < oldest->second.lastAccessTime))) {
+                oldest = iter;
+            }
+        }
+        if (oldest == index.entries.end()) {
+            break;
+        }
+
+        LOGI("[CacheDirManager] Remove the cache of %{public}s, %{public}llu bytes, to fit into the size limit.",
+            oldest->first.c_str(), static_cast<unsigned long long>(oldest->second.size));
+        RemoveCacheFiles(realDir, oldest->first, oldest->second.fileNumber);
+        totalSize -= oldest->second.size;
+        index.entries.erase(oldest);
+    }
+}
+
+void CacheDirManager::RemoveCacheFiles(const std::string& realDir, const std::string& modelName,
+                                       int64_t fileNumber)
+{
+    // The cache info goes first, a cache which is partly removed is never taken as valid.
+    unlink(GetCacheInfoPath(realDir, modelName).c_str());
+    for (int64_t i = 0; i < std::min(fileNumber, FILE_NUMBER_MAX); ++i) {
+        unlink(GetCacheModelPath(realDir, modelName, i).c_str());
+    }
+}
+}  // namespace NeuralNetworkRuntime
+}  // namespace OHOS
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NEURAL_NETWORK_RUNTIME_CACHE_DIR_MANAGER_H
+#define NEURAL_NETWORK_RUNTIME_CACHE_DIR_MANAGER_H
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "neural_network_runtime/neural_network_runtime_type.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+struct CacheIndexEntry {
+    int64_t fileNumber {0};
+    int64_t version {0};
+    int64_t deviceId {0};
+    // Bytes of the cache info and all model cache files.
+    uint64_t size {0};
+    // Milliseconds since the epoch of the last save or restore of the cache.
+    int64_t lastAccessTime {0};
+    // Identify the cache info the entry has been read from, a rewritten cache info is read again.
+    int64_t infoModifyTime {0};
+    uint64_t infoSize {0};
+};
+
+/**
+ * Keeps an index of the model caches in every cache directory and bounds the bytes they take.
+ *
+ * The index is kept in the ".nncache_index" file of the directory, so that the caches of a directory are known
+ * without parsing their cache info. A directory without index is scanned once. Every cache is an entry with the
+ * time it was last saved or restored, and when a size limit is set the least recently used caches are removed as a
+ * whole until the directory fits into the limit. The cache which has just been saved is never removed, neither are
+ * the caches pinned by the compilations and executors which may still restore them.
+ */
+class CacheDirManager {
+public:
+    static CacheDirManager& GetInstance();
+
+    // Sets the limit of the bytes taken by the caches of cacheDir, 0 removes the limit.
+    OH_NN_ReturnCode SetSizeLimit(const std::string& cacheDir, uint64_t sizeLimit);
+    // Gets the entry of the cache of modelName. The cache info is only read if it has changed since it was indexed,
+    // OH_NN_INVALID_FILE is returned if it cannot be read.
+    OH_NN_ReturnCode GetEntry(const std::string& cacheDir, const std::string& modelName, CacheIndexEntry& entry);
+    // Indexes a cache which has just been written and removes the least recently used caches beyond the limit.
+    void OnCacheSaved(const std::string& cacheDir, const std::string& modelName);
+    void OnCacheRestored(const std::string& cacheDir, const std::string& modelName);
+    // Keeps the cache of modelName from being removed to fit into the size limit until it is unpinned as many times
+    // as it has been pinned.
+    void Pin(const std::string& cacheDir, const std::string& modelName);
+    void Unpin(const std::string& cacheDir, const std::string& modelName);
+    // Removes the cache info and the model cache files of modelName.
+    void RemoveCache(const std::string& cacheDir, const std::string& modelName);
+
+    static OH_NN_ReturnCode ReadCacheInfo(const std::string& cacheInfoPath, CacheIndexEntry& entry);
+
+private:
+    CacheDirManager() = default;
+    CacheDirManager(const CacheDirManager&) = delete;
+    CacheDirManager& operator=(const CacheDirManager&) = delete;
+    ~CacheDirManager() = default;
+
+    struct DirIndex {
+        uint64_t sizeLimit {0};
+        std::map<std::string, CacheIndexEntry> entries;
+        // Pin counts of the models, only kept in memory.
+        std::unordered_map<std::string, size_t> pinCounts;
+    };
+
+    DirIndex* GetDirIndex(const std::string& cacheDir, std::string& realDir);
+    bool LoadIndexFile(const std::string& realDir, DirIndex& index) const;
+    void ScanDir(const std::string& realDir, DirIndex& index) const;
+    void SaveIndexFile(const std::string& realDir, const DirIndex& index) const;
+    OH_NN_ReturnCode RefreshEntry(const std::string& realDir, const std::string& modelName, DirIndex& index,
+                                  bool& isChanged) const;
+    void EvictEntries(const std::string& realDir, DirIndex& index, const std::string& keptModelName) const;
+    static void RemoveCacheFiles(const std::string& realDir, const std::string& modelName, int64_t fileNumber);
+
+private:
+    std::mutex m_mtx;
+    std::unordered_map<std::string, DirIndex> m_dirs;
+};
+}  // namespace NeuralNetworkRuntime
+}  // namespace OHOS
+#endif  // NEURAL_NETWORK_RUNTIME_CACHE_DIR_MANAGER_H
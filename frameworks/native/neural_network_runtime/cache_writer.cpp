@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cache_writer.h"
+
+#include <chrono>
+
+#include "log.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+CacheWriter& CacheWriter::GetInstance()
+{
+    // Intentionally leaked, see the class comment.
+    static CacheWriter* instance = new CacheWriter();
+    return *instance;
+}
+
+void CacheWriter::Post(const std::string& cacheKey, const WriteTask& task)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        if (!m_worker.joinable()) {
+            m_worker = std::thread(&CacheWriter::WorkLoop, this);
+        }
+        m_tasks.emplace_back(cacheKey, task);
+        ++m_pendingCounts[cacheKey];
+    }
+    m_posted.notify_one();
+}
+
+void CacheWriter::Wait(const std::string& cacheKey)
+{
+    std::unique_lock<std::mutex> lock(m_mtx);
+    m_written.wait(lock, [this, &cacheKey]() { return m_pendingCounts.find(cacheKey) == m_pendingCounts.end(); });
+}
+
+OH_NN_ReturnCode CacheWriter::Flush(uint32_t timeoutMs)
+{
+    std::unique_lock<std::mutex> lock(m_mtx);
+    auto isFlushed = [this]() { return m_pendingCounts.empty(); };
+    if (timeoutMs == 0) {
+        m_written.wait(lock, isFlushed);
+        return OH_NN_SUCCESS;
+    }
+
+    if (!m_written.wait_for(lock, std::chrono::milliseconds(timeoutMs), isFlushed)) {
+        LOGW("[CacheWriter] Flush timed out, %{public}zu caches are still being written.", m_pendingCounts.size());
+        return OH_NN_TIMEOUT;
+    }
+    return OH_NN_SUCCESS;
+}
+
+std::string CacheWriter::GetCacheKey(const std::string& cacheDir, const std::string& modelName)
+{
+    return cacheDir + "/" + modelName;
+}
+
+void CacheWriter::WorkLoop()
+{
+    std::unique_lock<std::mutex> lock(m_mtx);
+    while (true) {
+        m_posted.wait(lock, [this]() { return !m_tasks.empty(); });
+        std::pair<std::string, WriteTask> task = std::move(m_tasks.front());
+        m_tasks.pop_front();
+        lock.unlock();
+        OH_NN_ReturnCode ret = task.second();
+        if (ret != OH_NN_SUCCESS) {
+            LOGE("[CacheWriter] Fail to write the cache of %{public}s.", task.first.c_str());
+        }
+        task.second = nullptr;
+        lock.lock();
+
+        auto iter = m_pendingCounts.find(task.first);
+        if ((iter != m_pendingCounts.end()) && (--iter->second == 0)) {
+            m_pendingCounts.erase(iter);
+        }
+        m_written.notify_all();
+    }
+}
+}  // namespace NeuralNetworkRuntime
+}  // namespace OHOS
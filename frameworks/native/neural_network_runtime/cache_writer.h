@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NEURAL_NETWORK_RUNTIME_CACHE_WRITER_H
+#define NEURAL_NETWORK_RUNTIME_CACHE_WRITER_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+#include "neural_network_runtime/neural_network_runtime_type.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+/**
+ * Writes model caches on a background thread, so that a build does not wait for the disk I/O of a cache which is
+ * only read by a later launch.
+ *
+ * Writes run one by one in the order they are posted. Every write is identified by the cache it writes, readers of a
+ * cache wait for the pending writes of that cache before opening it.
+ *
+ * The writer is never destroyed, since its writes use other singletons which may already be destroyed when static
+ * objects are destroyed at exit. Writes still pending when the process exits are lost, Flush() is the way to finish
+ * them before exiting.
+ */
+class CacheWriter {
+public:
+    using WriteTask = std::function<OH_NN_ReturnCode()>;
+
+    static CacheWriter& GetInstance();
+
+    void Post(const std::string& cacheKey, const WriteTask& task);
+    // Waits until the writes posted for cacheKey have ended.
+    void Wait(const std::string& cacheKey);
+    // Waits until all posted writes have ended, timeoutMs 0 waits without limit.
+    OH_NN_ReturnCode Flush(uint32_t timeoutMs);
+
+    static std::string GetCacheKey(const std::string& cacheDir, const std::string& modelName);
+
+private:
+    CacheWriter() = default;
+    CacheWriter(const CacheWriter&) = delete;
+    CacheWriter& operator=(const CacheWriter&) = delete;
+    ~CacheWriter() = default;
+
+    void WorkLoop();
+
+private:
+    std::mutex m_mtx;
+    std::condition_variable m_posted;
+    std::condition_variable m_written;
+    std::deque<std::pair<std::string, WriteTask>> m_tasks;
+    // Writes posted for every cache, including the running one.
+    std::unordered_map<std::string, size_t> m_pendingCounts;
+    std::thread m_worker;
+};
+}  // namespace NeuralNetworkRuntime
+}  // namespace OHOS
+#endif  // NEURAL_NETWORK_RUNTIME_CACHE_WRITER_H
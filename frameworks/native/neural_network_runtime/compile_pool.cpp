@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "compile_pool.h"
+
+#include <algorithm>
+#include <system_error>
+
+#include "backend_manager.h"
+#include "log.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace {
+// At least two threads, so that a long build does not hold back the builds of other backends.
+constexpr size_t MIN_COMPILE_THREADS = 2;
+constexpr size_t MAX_COMPILE_THREADS = 4;
+// Two builds per device let the host side of one build overlap with the device side of the other.
+constexpr size_t DEVICE_BUILD_LIMIT = 2;
+} // namespace
+
+CompilePool& CompilePool::GetInstance()
+{
+    // Intentionally leaked, see the class comment.
+    static CompilePool* instance = new CompilePool();
+    return *instance;
+}
+
+CompilePool::CompilePool()
+{
+    m_threadNum = std::clamp<size_t>(std::thread::hardware_concurrency(), MIN_COMPILE_THREADS, MAX_COMPILE_THREADS);
+}
+
+OH_NN_ReturnCode CompilePool::Post(size_t backendID, size_t backendLimit, OH_NN_Priority priority,
+                                   const BuildTask& task)
+{
+    if ((task == nullptr) || (backendLimit == 0)) {
+        LOGE("[CompilePool] Post failed, the task is empty or the backend limit is 0.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        QueuedTask queuedTask;
+        queuedTask.backendID = backendID;
+        queuedTask.backendLimit = backendLimit;
+        queuedTask.priority = priority;
+        queuedTask.sequence = m_sequence++;
+        queuedTask.task = task;
+        m_tasks.emplace_back(std::move(queuedTask));
+
+        // Threads are started as builds arrive, a process which never builds asynchronously owns none.
+        if (m_workers.size() < m_threadNum) {
+            try {
+                m_workers.emplace_back(&CompilePool::WorkLoop, this);
+            } catch (const std::system_error&) {
+                // The workers already started run the task later, without any the task would never run.
+                if (m_workers.empty()) {
+                    m_tasks.pop_back();
+                    LOGE("[CompilePool] Post failed, fail to start a compile thread.");
+                    return OH_NN_FAILED;
+                }
+                LOGW("[CompilePool] Fail to start another compile thread, keep %{public}zu threads.",
+                     m_workers.size());
+            }
+        }
+    }
+    m_runnable.notify_one();
+    return OH_NN_SUCCESS;
+}
+
+size_t CompilePool::GetBackendLimit(size_t backendID)
+{
+    std::shared_ptr<Backend> backend = BackendManager::GetInstance().GetBackend(backendID);
+    if (backend == nullptr) {
+        return 1;
+    }
+
+    OH_NN_DeviceType backendType {OH_NN_OTHERS};
+    if ((backend->GetBackendType(backendType) == OH_NN_SUCCESS) && (backendType == OH_NN_CPU)) {
+        return MAX_COMPILE_THREADS;
+    }
+    return DEVICE_BUILD_LIMIT;
+}
+
+bool CompilePool::PopRunnableTask(QueuedTask& task)
+{
+    auto best = m_tasks.end();
+    for (auto iter = m_tasks.begin(); iter != m_tasks.end(); ++iter) {
+        auto running = m_runningCounts.find(iter->backendID);
+        if ((running != m_runningCounts.end()) && (running->second >= iter->backendLimit)) {
+            continue;
+        }
+        if ((best == m_tasks.end()) || (iter->priority > best->priority) ||
+            ((iter->priority == best->priority) && (iter->sequence < best->sequence))) {
+            best = iter;
+        }
+    }
+
+    if (best == m_tasks.end()) {
+        return false;
+    }
+    task = std::move(*best);
+    m_tasks.erase(best);
+    ++m_runningCounts[task.backendID];
+    return true;
+}
+
+void CompilePool::WorkLoop()
+{
+    std::unique_lock<std::mutex> lock(m_mtx);
+    while (true) {
+        QueuedTask task;
+        m_runnable.wait(lock, [this, &task]() { return PopRunnableTask(task); });
+
+        lock.unlock();
+        task.task();
+        task.task = nullptr;
+        lock.lock();
+
+        auto running = m_runningCounts.find(task.backendID);
+        if ((running != m_runningCounts.end()) && (--running->second == 0)) {
+            m_runningCounts.erase(running);
+        }
+        // The ended build may let a build of the same backend start on another thread.
+        m_runnable.notify_all();
+    }
+}
+}  // namespace NeuralNetworkRuntime
+}  // namespace OHOS
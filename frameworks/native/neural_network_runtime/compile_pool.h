@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NEURAL_NETWORK_RUNTIME_COMPILE_POOL_H
+#define NEURAL_NETWORK_RUNTIME_COMPILE_POOL_H
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "neural_network_runtime/neural_network_runtime_type.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+/**
+ * Runs the builds of OH_NNCompilation_BuildAsync on a few runtime owned threads.
+ *
+ * Builds on different backends run concurrently. Every backend runs at most as many builds at a time as its limit,
+ * further builds of the backend wait in the queue and do not block the builds of other backends. Among the builds
+ * that can start, the one of the highest priority starts first, builds of the same priority start in the order they
+ * are posted.
+ *
+ * The pool is never destroyed, since a build running while static objects are destroyed at exit would use singletons
+ * which are already gone. The builds still queued or running when the process exits are abandoned.
+ */
+class CompilePool {
+public:
+    using BuildTask = std::function<void()>;
+
+    static CompilePool& GetInstance();
+
+    OH_NN_ReturnCode Post(size_t backendID, size_t backendLimit, OH_NN_Priority priority, const BuildTask& task);
+
+    // Returns how many builds the backend runs at a time. CPU backends build on the host and may run as many builds
+    // as there are threads, the drivers of the other devices serialize most of the work.
+    static size_t GetBackendLimit(size_t backendID);
+
+private:
+    CompilePool();
+    CompilePool(const CompilePool&) = delete;
+    CompilePool& operator=(const CompilePool&) = delete;
+    ~CompilePool() = default;
+
+    struct QueuedTask {
+        size_t backendID {0};
+        size_t backendLimit {1};
+        OH_NN_Priority priority {OH_NN_PRIORITY_NONE};
+        uint64_t sequence {0};
+        BuildTask task;
+    };
+
+    bool PopRunnableTask(QueuedTask& task);
+    void WorkLoop();
+
+private:
+    std::mutex m_mtx;
+    std::condition_variable m_runnable;
+    std::vector<QueuedTask> m_tasks;
+    std::unordered_map<size_t, size_t> m_runningCounts;
+    std::vector<std::thread> m_workers;
+    size_t m_threadNum {0};
+    uint64_t m_sequence {0};
+};
+}  // namespace NeuralNetworkRuntime
+}  // namespace OHOS
+#endif  // NEURAL_NETWORK_RUNTIME_COMPILE_POOL_H
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NEURAL_NETWORK_RUNTIME_DISPATCH_TABLE_H
+#define NEURAL_NETWORK_RUNTIME_DISPATCH_TABLE_H
+
+#include <algorithm>
+#include <cstddef>
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+/**
+ * Dense table of function pointers indexed by an enum value. Tables are built from an X-macro list by a constexpr
+ * function, so they are constant-initialized and need no work when the library is loaded.
+ */
+template<typename Func, size_t N>
+class DispatchTable {
+public:
+    constexpr DispatchTable() = default;
+
+    constexpr void Set(size_t key, Func func)
+    {
+        m_entries[key] = func;
+    }
+
+    constexpr Func Find(size_t key) const
+    {
+        return (key < N) ? m_entries[key] : nullptr;
+    }
+
+private:
+    Func m_entries[N] {};
+};
+
+// Helpers to expand X-macro lists whose entries are (key, function).
+#define NNRT_DISPATCH_KEY(key, func) static_cast<size_t>(key),
+#define NNRT_DISPATCH_SET(key, func) table.Set(static_cast<size_t>(key), &func);
+
+// Size of a table able to hold every key in LIST.
+#define NNRT_DISPATCH_TABLE_SIZE(LIST) (std::max({LIST(NNRT_DISPATCH_KEY)}) + 1)
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
+#endif // NEURAL_NETWORK_RUNTIME_DISPATCH_TABLE_H
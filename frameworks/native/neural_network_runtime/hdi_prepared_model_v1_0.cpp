@@ -16,6 +16,7 @@
 #include "hdi_prepared_model_v1_0.h"
 
 #include "log.h"
+#include "latency_metrics.h"
 #include "memory_manager.h"
 #include "nntensor.h"
 
@@ -209,6 +210,7 @@ OH_NN_ReturnCode HDIPreparedModelV1_0::ExportModelCache(std::vector<Buffer>& mod
 OH_NN_ReturnCode HDIPreparedModelV1_0::Run(const std::vector<IOTensor>& inputs, const std::vector<IOTensor>& outputs,
     std::vector<std::vector<int32_t>>& outputsDims, std::vector<bool>& isOutputBufferEnough)
 {
+    ScopedLatency ioLatency(OH_NN_STAGE_IO_TRANSLATION);
     V1_0::IOTensor iTensor;
     std::vector<V1_0::IOTensor> iInputTensors;
     for (const auto& input: inputs) {
@@ -230,7 +232,10 @@ OH_NN_ReturnCode HDIPreparedModelV1_0::Run(const std::vector<IOTensor>& inputs,
         iOutputTensors.emplace_back(iTensor);
     }
 
+    ioLatency.Finish();
+    ScopedLatency hdiLatency(OH_NN_STAGE_HDI_RUN);
     auto ret = m_hdiPreparedModel->Run(iInputTensors, iOutputTensors, outputsDims, isOutputBufferEnough);
+    hdiLatency.Finish();
     if (ret != HDF_SUCCESS || outputsDims.empty()) {
         LOGE("Run model failed. ErrorCode=%d", ret);
         return OH_NN_UNAVAILABLE_DEVICE;
@@ -243,6 +248,7 @@ OH_NN_ReturnCode HDIPreparedModelV1_0::Run(const std::vector<NN_Tensor*>& inputs
     const std::vector<NN_Tensor*>& outputs, std::vector<std::vector<int32_t>>& outputsDims,
     std::vector<bool>& isOutputBufferEnough)
 {
+    ScopedLatency ioLatency(OH_NN_STAGE_IO_TRANSLATION);
     V1_0::IOTensor iTensor;
     std::vector<V1_0::IOTensor> iInputTensors;
     for (const auto& input: inputs) {
@@ -272,7 +278,10 @@ OH_NN_ReturnCode HDIPreparedModelV1_0::Run(const std::vector<NN_Tensor*>& inputs
         iOutputTensors.emplace_back(iTensor);
     }
 
+    ioLatency.Finish();
+    ScopedLatency hdiLatency(OH_NN_STAGE_HDI_RUN);
     auto ret = m_hdiPreparedModel->Run(iInputTensors, iOutputTensors, outputsDims, isOutputBufferEnough);
+    hdiLatency.Finish();
     if (ret != HDF_SUCCESS || outputsDims.empty()) {
         LOGE("Run model failed. ErrorCode=%d", ret);
         return OH_NN_UNAVAILABLE_DEVICE;
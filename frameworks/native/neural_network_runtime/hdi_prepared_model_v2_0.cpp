@@ -17,8 +17,10 @@
 
 #include "log.h"
 #include "hdi_returncode_utils.h"
+#include "latency_metrics.h"
 #include "memory_manager.h"
 #include "nntensor.h"
+#include "transform.h"
 
 namespace OHOS {
 namespace NeuralNetworkRuntime {
@@ -50,6 +52,10 @@ V2_0::DataType TransDataType(const OH_NN_DataType& dataType)
             return V2_0::DataType::DATA_TYPE_FLOAT32;
         case OH_NN_FLOAT64:
             return V2_0::DataType::DATA_TYPE_FLOAT64;
+        case OH_NN_BFLOAT16:
+        case OH_NN_INT4:
+            // The HDI data types share the MindSpore numbering, which has these types but no member for them here.
+            return static_cast<V2_0::DataType>(NNToMS::TransformDataType(dataType));
         default:
             return V2_0::DataType::DATA_TYPE_UNKNOWN;
     }
@@ -209,6 +215,7 @@ OH_NN_ReturnCode HDIPreparedModelV2_0::ExportModelCache(std::vector<Buffer>& mod
 OH_NN_ReturnCode HDIPreparedModelV2_0::Run(const std::vector<IOTensor>& inputs, const std::vector<IOTensor>& outputs,
     std::vector<std::vector<int32_t>>& outputsDims, std::vector<bool>& isOutputBufferEnough)
 {
+    ScopedLatency ioLatency(OH_NN_STAGE_IO_TRANSLATION);
     V2_0::IOTensor iTensor;
     std::vector<V2_0::IOTensor> iInputTensors;
     for (const auto& input: inputs) {
@@ -230,7 +237,15 @@ OH_NN_ReturnCode HDIPreparedModelV2_0::Run(const std::vector<IOTensor>& inputs,
         iOutputTensors.emplace_back(iTensor);
     }
 
+    ioLatency.Finish();
+    ScopedLatency hdiLatency(OH_NN_STAGE_HDI_RUN);
     auto ret = m_hdiPreparedModel->Run(iInputTensors, iOutputTensors, outputsDims);
+    hdiLatency.Finish();
+    if (ret == V2_0::NNRT_ReturnCode::NNRT_INSUFFICIENT_BUFFER) {
+        // The device does not tell which output is short, the executor checks outputsDims if they are returned.
+        isOutputBufferEnough.assign(outputs.size(), false);
+        return CheckReturnCode(ret, OH_NN_MEMORY_ERROR, "Run model failed, output buffer is not enough");
+    }
     if (ret != V2_0::NNRT_ReturnCode::NNRT_SUCCESS) {
         return CheckReturnCode(ret, OH_NN_UNAVAILABLE_DEVICE, "Run model failed");
     }
@@ -246,6 +261,7 @@ OH_NN_ReturnCode HDIPreparedModelV2_0::Run(const std::vector<NN_Tensor*>& inputs
     const std::vector<NN_Tensor*>& outputs, std::vector<std::vector<int32_t>>& outputsDims,
     std::vector<bool>& isOutputBufferEnough)
 {
+    ScopedLatency ioLatency(OH_NN_STAGE_IO_TRANSLATION);
     V2_0::IOTensor iTensor;
     std::vector<V2_0::IOTensor> iInputTensors;
     for (const auto& input: inputs) {
@@ -275,7 +291,15 @@ OH_NN_ReturnCode HDIPreparedModelV2_0::Run(const std::vector<NN_Tensor*>& inputs
         iOutputTensors.emplace_back(iTensor);
     }
 
+    ioLatency.Finish();
+    ScopedLatency hdiLatency(OH_NN_STAGE_HDI_RUN);
     auto ret = m_hdiPreparedModel->Run(iInputTensors, iOutputTensors, outputsDims);
+    hdiLatency.Finish();
+    if (ret == V2_0::NNRT_ReturnCode::NNRT_INSUFFICIENT_BUFFER) {
+        // The device does not tell which output is short, the executor checks outputsDims if they are returned.
+        isOutputBufferEnough.assign(outputs.size(), false);
+        return CheckReturnCode(ret, OH_NN_MEMORY_ERROR, "Run model failed, output buffer is not enough");
+    }
     if (ret != V2_0::NNRT_ReturnCode::NNRT_SUCCESS) {
         return CheckReturnCode(ret, OH_NN_UNAVAILABLE_DEVICE, "Run model failed");
     }
@@ -0,0 +1,339 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hetero_partitioner.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+#include "backend_manager.h"
+#include "log.h"
+#include "nnbackend.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace MSLITE = mindspore::lite;
+namespace {
+constexpr int64_t NO_NODE = -1;
+
+constexpr int ACCELERATOR_RANK = 0;
+constexpr int GPU_RANK = 1;
+constexpr int CPU_RANK = 2;
+constexpr int OTHERS_RANK = 3;
+
+int GetDeviceTypeRank(const std::shared_ptr<Device>& device)
+{
+    OH_NN_DeviceType deviceType {OH_NN_OTHERS};
+    if (device->GetDeviceType(deviceType) != OH_NN_SUCCESS) {
+        return OTHERS_RANK;
+    }
+
+    switch (deviceType) {
+        case OH_NN_ACCELERATOR:
+            return ACCELERATOR_RANK;
+        case OH_NN_GPU:
+            return GPU_RANK;
+        case OH_NN_CPU:
+            return CPU_RANK;
+        default:
+            return OTHERS_RANK;
+    }
+}
+
+// Releases what a subgraph owns, the primitives and tensors belong to the whole graph.
+class HeteroLiteGraphDeleter {
+public:
+    explicit HeteroLiteGraphDeleter(std::shared_ptr<MSLITE::LiteGraph> wholeGraph)
+        : m_wholeGraph(std::move(wholeGraph)) {}
+
+    void operator()(MSLITE::LiteGraph* liteGraph) const
+    {
+        for (MSLITE::LiteGraph::Node* node : liteGraph->all_nodes_) {
+            delete node;
+        }
+        for (MSLITE::LiteGraph::SubGraph* subGraph : liteGraph->sub_graphs_) {
+            delete subGraph;
+        }
+        delete liteGraph;
+    }
+
+private:
+    std::shared_ptr<MSLITE::LiteGraph> m_wholeGraph;
+};
+
+uint32_t GetLocalIndex(uint32_t tensorIndex, std::unordered_map<uint32_t, uint32_t>& localIndices,
+    MSLITE::LiteGraph& wholeGraph, MSLITE::LiteGraph& subGraph)
+{
+    auto iter = localIndices.find(tensorIndex);
+    if (iter != localIndices.end()) {
+        return iter->second;
+    }
+
+    uint32_t localIndex = static_cast<uint32_t>(subGraph.all_tensors_.size());
+    subGraph.all_tensors_.emplace_back(wholeGraph.all_tensors_[tensorIndex]);
+    localIndices.emplace(tensorIndex, localIndex);
+    return localIndex;
+}
+} // namespace
+
+HeteroPartitioner::HeteroPartitioner(size_t primaryBackendID, std::shared_ptr<Device> primaryDevice)
+    : m_primaryBackendID(primaryBackendID),
+    m_primaryDevice(primaryDevice) {}
+
+OH_NN_ReturnCode HeteroPartitioner::CollectCandidates(const std::shared_ptr<MSLITE::LiteGraph>& liteGraph,
+    std::vector<Candidate>& candidates) const
+{
+    std::vector<Candidate> others;
+    BackendManager& backendManager = BackendManager::GetInstance();
+    std::vector<size_t> backendIDs = backendManager.GetAllBackendsID();
+    for (size_t backendID : backendIDs) {
+        if (backendID == m_primaryBackendID) {
+            continue;
+        }
+        std::shared_ptr<Backend> backend = backendManager.GetBackend(backendID);
+        if (backend == nullptr) {
+            continue;
+        }
+        DeviceStatus status {UNKNOWN};
+        if ((backend->GetBackendStatus(status) != OH_NN_SUCCESS) || (status != AVAILABLE)) {
+            LOGW("[HeteroPartitioner] Skip backend %{public}zu, it is not available.", backendID);
+            continue;
+        }
+        std::shared_ptr<Device> device = std::reinterpret_pointer_cast<NNBackend>(backend)->GetDevice();
+        if (device != nullptr) {
+            others.push_back({backendID, device, {}});
+        }
+    }
+    std::stable_sort(others.begin(), others.end(), [](const Candidate& left, const Candidate& right) {
+        return GetDeviceTypeRank(left.device) < GetDeviceTypeRank(right.device);
+    });
+
+    candidates.clear();
+    candidates.push_back({m_primaryBackendID, m_primaryDevice, {}});
+    candidates.insert(candidates.end(), others.begin(), others.end());
+
+    size_t nodeCount = liteGraph->all_nodes_.size();
+    for (auto iter = candidates.begin(); iter != candidates.end();) {
+        OH_NN_ReturnCode ret = iter->device->GetSupportedOperation(liteGraph, iter->supportedOps);
+        if ((ret != OH_NN_SUCCESS) || (iter->supportedOps.size() != nodeCount)) {
+            LOGW("[HeteroPartitioner] Skip backend %{public}zu, failed to get its supported operations.",
+                iter->backendID);
+            iter = candidates.erase(iter);
+            continue;
+        }
+        ++iter;
+    }
+
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode HeteroPartitioner::AssignNodes(size_t nodeCount, const std::vector<Candidate>& candidates,
+    std::vector<size_t>& assignment) const
+{
+    assignment.assign(nodeCount, 0);
+    for (size_t i = 0; i < nodeCount; ++i) {
+        auto iter = std::find_if(candidates.begin(), candidates.end(), [i](const Candidate& candidate) {
+            return candidate.supportedOps[i];
+        });
+        if (iter == candidates.end()) {
+            LOGE("[HeteroPartitioner] Partition failed, node %{public}zu is not supported by any backend.", i);
+            return OH_NN_FAILED;
+        }
+        assignment[i] = static_cast<size_t>(iter - candidates.begin());
+    }
+
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode HeteroPartitioner::GetTensorUsage(const MSLITE::LiteGraph& liteGraph, TensorUsage& usage) const
+{
+    size_t tensorCount = liteGraph.all_tensors_.size();
+    usage.producer.assign(tensorCount, NO_NODE);
+    usage.lastConsumer.assign(tensorCount, NO_NODE);
+    usage.isGraphInput.assign(tensorCount, false);
+    usage.isGraphOutput.assign(tensorCount, false);
+
+    for (uint32_t index : liteGraph.input_indices_) {
+        if (index >= tensorCount) {
+            LOGE("[HeteroPartitioner] Partition failed, graph input %{public}u is out of range.", index);
+            return OH_NN_INVALID_PARAMETER;
+        }
+        usage.isGraphInput[index] = true;
+    }
+    for (uint32_t index : liteGraph.output_indices_) {
+        if (index >= tensorCount) {
+            LOGE("[HeteroPartitioner] Partition failed, graph output %{public}u is out of range.", index);
+            return OH_NN_INVALID_PARAMETER;
+        }
+        usage.isGraphOutput[index] = true;
+    }
+
+    size_t nodeCount = liteGraph.all_nodes_.size();
+    for (size_t i = 0; i < nodeCount; ++i) {
+        const MSLITE::LiteGraph::Node* node = liteGraph.all_nodes_[i];
+        for (uint32_t index : node->input_indices_) {
+            if (index >= tensorCount) {
+                LOGE("[HeteroPartitioner] Partition failed, input %{public}u of node %{public}zu is out of range.",
+                    index, i);
+                return OH_NN_INVALID_PARAMETER;
+            }
+            usage.lastConsumer[index] = static_cast<int64_t>(i);
+        }
+        for (uint32_t index : node->output_indices_) {
+            if (index >= tensorCount) {
+                LOGE("[HeteroPartitioner] Partition failed, output %{public}u of node %{public}zu is out of range.",
+                    index, i);
+                return OH_NN_INVALID_PARAMETER;
+            }
+            usage.producer[index] = static_cast<int64_t>(i);
+        }
+    }
+
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode HeteroPartitioner::BuildSubgraph(const std::shared_ptr<MSLITE::LiteGraph>& liteGraph,
+    const TensorUsage& usage, size_t nodeBegin, size_t nodeEnd, HeteroSubgraph& subgraph) const
+{
+    int64_t begin = static_cast<int64_t>(nodeBegin);
+    int64_t end = static_cast<int64_t>(nodeEnd);
+    subgraph.inputIndices.clear();
+    subgraph.outputIndices.clear();
+    for (size_t i = nodeBegin; i < nodeEnd; ++i) {
+        for (uint32_t index : liteGraph->all_nodes_[i]->input_indices_) {
+            int64_t producer = usage.producer[index];
+            if (producer >= end) {
+                LOGE("[HeteroPartitioner] Partition failed, nodes are not in topological order, tensor %{public}u "
+                    "is consumed by node %{public}zu before it is produced.", index, i);
+                return OH_NN_INVALID_PARAMETER;
+            }
+            // Tensors which are neither graph inputs nor produced by any node are constants and stay local.
+            bool isExternal = (producer == NO_NODE) ? usage.isGraphInput[index] : (producer < begin);
+            if (isExternal && std::find(subgraph.inputIndices.begin(), subgraph.inputIndices.end(), index) ==
+                subgraph.inputIndices.end()) {
+                subgraph.inputIndices.emplace_back(index);
+            }
+        }
+        for (uint32_t index : liteGraph->all_nodes_[i]->output_indices_) {
+            if (usage.isGraphOutput[index] || usage.lastConsumer[index] >= end) {
+                subgraph.outputIndices.emplace_back(index);
+            }
+        }
+    }
+
+    MSLITE::LiteGraph* pLiteGraph = new (std::nothrow) MSLITE::LiteGraph();
+    if (pLiteGraph == nullptr) {
+        LOGE("[HeteroPartitioner] Partition failed, error happened when creating LiteGraph.");
+        return OH_NN_MEMORY_ERROR;
+    }
+    subgraph.liteGraph.reset(pLiteGraph, HeteroLiteGraphDeleter(liteGraph));
+    pLiteGraph->name_ = liteGraph->name_ + "_" + std::to_string(nodeBegin);
+
+    std::unordered_map<uint32_t, uint32_t> localIndices;
+    for (uint32_t index : subgraph.inputIndices) {
+        pLiteGraph->input_indices_.emplace_back(GetLocalIndex(index, localIndices, *liteGraph, *pLiteGraph));
+    }
+    for (size_t i = nodeBegin; i < nodeEnd; ++i) {
+        MSLITE::LiteGraph::Node* node = new (std::nothrow) MSLITE::LiteGraph::Node(*liteGraph->all_nodes_[i]);
+        if (node == nullptr) {
+            LOGE("[HeteroPartitioner] Partition failed, error happened when creating LiteGraph node.");
+            return OH_NN_MEMORY_ERROR;
+        }
+        pLiteGraph->all_nodes_.emplace_back(node);
+        for (uint32_t& index : node->input_indices_) {
+            index = GetLocalIndex(index, localIndices, *liteGraph, *pLiteGraph);
+        }
+        for (uint32_t& index : node->output_indices_) {
+            index = GetLocalIndex(index, localIndices, *liteGraph, *pLiteGraph);
+        }
+    }
+    for (uint32_t index : subgraph.outputIndices) {
+        pLiteGraph->output_indices_.emplace_back(localIndices.at(index));
+    }
+
+    MSLITE::LiteGraph::SubGraph* subGraph = new (std::nothrow) MSLITE::LiteGraph::SubGraph();
+    if (subGraph == nullptr) {
+        LOGE("[HeteroPartitioner] Partition failed, error happened when creating subgraph.");
+        return OH_NN_MEMORY_ERROR;
+    }
+    subGraph->name_ = "NNRt_SubGraph";
+    subGraph->input_indices_ = pLiteGraph->input_indices_;
+    subGraph->output_indices_ = pLiteGraph->output_indices_;
+    uint32_t nodeCount = static_cast<uint32_t>(pLiteGraph->all_nodes_.size());
+    for (uint32_t i = 0; i < nodeCount; ++i) {
+        subGraph->node_indices_.emplace_back(i);
+    }
+    pLiteGraph->sub_graphs_.emplace_back(subGraph);
+
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode HeteroPartitioner::Partition(const std::shared_ptr<MSLITE::LiteGraph>& liteGraph,
+    std::vector<HeteroSubgraph>& subgraphs) const
+{
+    if ((liteGraph == nullptr) || (m_primaryDevice == nullptr)) {
+        LOGE("[HeteroPartitioner] Partition failed, liteGraph or primary device is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+    size_t nodeCount = liteGraph->all_nodes_.size();
+    if (nodeCount == 0) {
+        LOGE("[HeteroPartitioner] Partition failed, the graph has no node.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    std::vector<Candidate> candidates;
+    OH_NN_ReturnCode ret = CollectCandidates(liteGraph, candidates);
+    if (ret != OH_NN_SUCCESS) {
+        return ret;
+    }
+
+    std::vector<size_t> assignment;
+    ret = AssignNodes(nodeCount, candidates, assignment);
+    if (ret != OH_NN_SUCCESS) {
+        return ret;
+    }
+
+    TensorUsage usage;
+    ret = GetTensorUsage(*liteGraph, usage);
+    if (ret != OH_NN_SUCCESS) {
+        return ret;
+    }
+
+    subgraphs.clear();
+    size_t nodeBegin = 0;
+    while (nodeBegin < nodeCount) {
+        size_t nodeEnd = nodeBegin + 1;
+        while ((nodeEnd < nodeCount) && (assignment[nodeEnd] == assignment[nodeBegin])) {
+            ++nodeEnd;
+        }
+
+        HeteroSubgraph subgraph;
+        subgraph.backendID = candidates[assignment[nodeBegin]].backendID;
+        subgraph.device = candidates[assignment[nodeBegin]].device;
+        ret = BuildSubgraph(liteGraph, usage, nodeBegin, nodeEnd, subgraph);
+        if (ret != OH_NN_SUCCESS) {
+            subgraphs.clear();
+            return ret;
+        }
+        LOGI("[HeteroPartitioner] Nodes [%{public}zu, %{public}zu) are assigned to backend %{public}zu.",
+            nodeBegin, nodeEnd, subgraph.backendID);
+        subgraphs.emplace_back(std::move(subgraph));
+        nodeBegin = nodeEnd;
+    }
+
+    return OH_NN_SUCCESS;
+}
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
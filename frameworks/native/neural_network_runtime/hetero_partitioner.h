@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NEURAL_NETWORK_RUNTIME_HETERO_PARTITIONER_H
+#define NEURAL_NETWORK_RUNTIME_HETERO_PARTITIONER_H
+
+#include <memory>
+#include <vector>
+
+#include "mindir.h"
+#include "device.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+// A run of consecutive LiteGraph nodes which is compiled and executed on one backend.
+struct HeteroSubgraph {
+    size_t backendID {0};
+    std::shared_ptr<Device> device {nullptr};
+    // Shares the primitives and tensors of the whole graph, and keeps the whole graph alive.
+    std::shared_ptr<mindspore::lite::LiteGraph> liteGraph {nullptr};
+    // Indices of the subgraph inputs and outputs in all_tensors_ of the whole graph, in the same order as
+    // input_indices_ and output_indices_ of the subgraph.
+    std::vector<uint32_t> inputIndices;
+    std::vector<uint32_t> outputIndices;
+};
+
+/**
+ * Splits a LiteGraph into subgraphs which can each run on a single registered backend.
+ *
+ * Every node goes to the first backend supporting it, the compilation's own backend is tried first and the others
+ * in the order accelerator, GPU, CPU, others. Consecutive nodes on the same backend form one subgraph, so the nodes
+ * of the LiteGraph must be in topological order.
+ */
+class HeteroPartitioner {
+public:
+    HeteroPartitioner(size_t primaryBackendID, std::shared_ptr<Device> primaryDevice);
+    ~HeteroPartitioner() = default;
+
+    OH_NN_ReturnCode Partition(const std::shared_ptr<mindspore::lite::LiteGraph>& liteGraph,
+                               std::vector<HeteroSubgraph>& subgraphs) const;
+
+private:
+    struct Candidate {
+        size_t backendID {0};
+        std::shared_ptr<Device> device {nullptr};
+        std::vector<bool> supportedOps;
+    };
+
+    // Producer and last consumer node of every tensor in the whole graph, -1 if there is none.
+    struct TensorUsage {
+        std::vector<int64_t> producer;
+        std::vector<int64_t> lastConsumer;
+        std::vector<bool> isGraphInput;
+        std::vector<bool> isGraphOutput;
+    };
+
+    OH_NN_ReturnCode CollectCandidates(const std::shared_ptr<mindspore::lite::LiteGraph>& liteGraph,
+                                       std::vector<Candidate>& candidates) const;
+    OH_NN_ReturnCode AssignNodes(size_t nodeCount, const std::vector<Candidate>& candidates,
+                                 std::vector<size_t>& assignment) const;
+    OH_NN_ReturnCode GetTensorUsage(const mindspore::lite::LiteGraph& liteGraph, TensorUsage& usage) const;
+    OH_NN_ReturnCode BuildSubgraph(const std::shared_ptr<mindspore::lite::LiteGraph>& liteGraph,
+                                   const TensorUsage& usage, size_t nodeBegin, size_t nodeEnd,
+                                   HeteroSubgraph& subgraph) const;
+
+private:
+    size_t m_primaryBackendID {0};
+    std::shared_ptr<Device> m_primaryDevice {nullptr};
+};
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
+#endif // NEURAL_NETWORK_RUNTIME_HETERO_PARTITIONER_H
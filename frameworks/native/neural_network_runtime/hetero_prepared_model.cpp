@@ -0,0 +1,345 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hetero_prepared_model.h"
+
+#include <algorithm>
+
+#include "log.h"
+#include "transform.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace MSLITE = mindspore::lite;
+
+HeteroPreparedModel::HeteroPreparedModel(const std::vector<uint32_t>& modelInputIndices,
+    const std::vector<uint32_t>& modelOutputIndices)
+    : m_modelInputIndices(modelInputIndices),
+    m_modelOutputIndices(modelOutputIndices) {}
+
+OH_NN_ReturnCode HeteroPreparedModel::AddBoundary(const HeteroSubgraph& subgraph, size_t outputIndex,
+    TensorLocation& location)
+{
+    MSLITE::TensorPtr tensor = subgraph.liteGraph->all_tensors_[subgraph.liteGraph->output_indices_[outputIndex]];
+    std::vector<int32_t> dims = MSLITE::MindIR_Tensor_GetDims(tensor);
+    bool isDynamic = std::any_of(dims.begin(), dims.end(), [](int32_t dim) {
+        return dim <= 0;
+    });
+    if (isDynamic) {
+        LOGE("[HeteroPreparedModel] AddStage failed, tensor %{public}u passed between subgraphs has dynamic shape.",
+            subgraph.outputIndices[outputIndex]);
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    BoundaryInfo boundary;
+    boundary.backendID = subgraph.backendID;
+    OH_NN_DataType dataType = MSToNN::TransformDataType(MSLITE::MindIR_Tensor_GetDataType(tensor));
+    OH_NN_ReturnCode ret = boundary.desc.SetDataType(dataType);
+    if (ret == OH_NN_SUCCESS) {
+        ret = boundary.desc.SetFormat(MSToNN::TransformFormat(MSLITE::MindIR_Tensor_GetFormat(tensor)));
+    }
+    if (ret == OH_NN_SUCCESS) {
+        ret = boundary.desc.SetShape(dims.data(), dims.size());
+    }
+    if (ret == OH_NN_SUCCESS) {
+        ret = boundary.desc.SetName(MSLITE::MindIR_Tensor_GetName(tensor).c_str());
+    }
+    if (ret != OH_NN_SUCCESS) {
+        LOGE("[HeteroPreparedModel] AddStage failed, error happened when creating boundary tensor desc.");
+        return ret;
+    }
+
+    location = {TensorSource::BOUNDARY, m_boundaries.size()};
+    m_boundaries.emplace_back(std::move(boundary));
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode HeteroPreparedModel::AddStage(const HeteroSubgraph& subgraph,
+    std::shared_ptr<PreparedModel> preparedModel)
+{
+    if ((preparedModel == nullptr) || (subgraph.liteGraph == nullptr)) {
+        LOGE("[HeteroPreparedModel] AddStage failed, preparedModel or liteGraph is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+    if ((subgraph.inputIndices.size() != subgraph.liteGraph->input_indices_.size()) ||
+        (subgraph.outputIndices.size() != subgraph.liteGraph->output_indices_.size())) {
+        LOGE("[HeteroPreparedModel] AddStage failed, subgraph inputs or outputs do not match its LiteGraph.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    Stage stage;
+    stage.backendID = subgraph.backendID;
+    stage.preparedModel = preparedModel;
+    for (uint32_t index : subgraph.inputIndices) {
+        auto produced = std::find_if(m_producedTensors.begin(), m_producedTensors.end(),
+            [index](const std::pair<uint32_t, TensorLocation>& item) { return item.first == index; });
+        if (produced != m_producedTensors.end()) {
+            stage.inputs.emplace_back(produced->second);
+            continue;
+        }
+
+        auto modelInput = std::find(m_modelInputIndices.begin(), m_modelInputIndices.end(), index);
+        if (modelInput == m_modelInputIndices.end()) {
+            LOGE("[HeteroPreparedModel] AddStage failed, input tensor %{public}u is neither a model input nor "
+                "produced by an earlier stage.", index);
+            return OH_NN_INVALID_PARAMETER;
+        }
+        stage.inputs.push_back({TensorSource::MODEL_INPUT,
+            static_cast<size_t>(modelInput - m_modelInputIndices.begin())});
+    }
+
+    for (size_t i = 0; i < subgraph.outputIndices.size(); ++i) {
+        uint32_t index = subgraph.outputIndices[i];
+        TensorLocation location;
+        auto modelOutput = std::find(m_modelOutputIndices.begin(), m_modelOutputIndices.end(), index);
+        if (modelOutput != m_modelOutputIndices.end()) {
+            location = {TensorSource::MODEL_OUTPUT, static_cast<size_t>(modelOutput - m_modelOutputIndices.begin())};
+        } else {
+            OH_NN_ReturnCode ret = AddBoundary(subgraph, i, location);
+            if (ret != OH_NN_SUCCESS) {
+                return ret;
+            }
+        }
+        stage.outputs.emplace_back(location);
+        m_producedTensors.emplace_back(index, location);
+    }
+
+    m_stages.emplace_back(std::move(stage));
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode HeteroPreparedModel::Finish() const
+{
+    if (m_stages.empty()) {
+        LOGE("[HeteroPreparedModel] Finish failed, no stage has been added.");
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    for (size_t i = 0; i < m_modelOutputIndices.size(); ++i) {
+        bool isProduced = std::any_of(m_producedTensors.begin(), m_producedTensors.end(),
+            [i](const std::pair<uint32_t, TensorLocation>& item) {
+                return (item.second.source == TensorSource::MODEL_OUTPUT) && (item.second.index == i);
+            });
+        if (!isProduced) {
+            LOGE("[HeteroPreparedModel] Finish failed, model output %{public}zu is not produced by any stage.", i);
+            return OH_NN_INVALID_PARAMETER;
+        }
+    }
+
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode HeteroPreparedModel::ExportModelCache(std::vector<Buffer>& modelCache)
+{
+    LOGE("[HeteroPreparedModel] ExportModelCache failed, a model partitioned across backends cannot be cached.");
+    return OH_NN_OPERATION_FORBIDDEN;
+}
+
+OH_NN_ReturnCode HeteroPreparedModel::AcquireBoundaries(std::unique_ptr<BoundaryTensors>& boundaries)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_poolMutex);
+        if (!m_idleBoundaries.empty()) {
+            boundaries = std::move(m_idleBoundaries.back());
+            m_idleBoundaries.pop_back();
+            return OH_NN_SUCCESS;
+        }
+    }
+
+    boundaries.reset(new (std::nothrow) BoundaryTensors());
+    if (boundaries == nullptr) {
+        LOGE("[HeteroPreparedModel] Run failed, error happened when creating boundary tensors.");
+        return OH_NN_MEMORY_ERROR;
+    }
+    for (const BoundaryInfo& boundary : m_boundaries) {
+        std::unique_ptr<NNTensor2_0> tensor(new (std::nothrow) NNTensor2_0(boundary.backendID));
+        if (tensor == nullptr) {
+            LOGE("[HeteroPreparedModel] Run failed, error happened when creating boundary tensor.");
+            return OH_NN_MEMORY_ERROR;
+        }
+        OH_NN_ReturnCode ret = tensor->SetTensorDesc(&boundary.desc);
+        if (ret == OH_NN_SUCCESS) {
+            ret = tensor->CreateData();
+        }
+        if (ret != OH_NN_SUCCESS) {
+            LOGE("[HeteroPreparedModel] Run failed, error happened when allocating boundary tensor on backend "
+                "%{public}zu.", boundary.backendID);
+            return ret;
+        }
+        boundaries->emplace_back(std::move(tensor));
+    }
+
+    return OH_NN_SUCCESS;
+}
+
+void HeteroPreparedModel::ReleaseBoundaries(std::unique_ptr<BoundaryTensors> boundaries)
+{
+    std::lock_guard<std::mutex> lock(m_poolMutex);
+    m_idleBoundaries.emplace_back(std::move(boundaries));
+}
+
+NN_Tensor* HeteroPreparedModel::Resolve(const TensorLocation& location, const std::vector<NN_Tensor*>& inputs,
+    const std::vector<NN_Tensor*>& outputs, const BoundaryTensors& boundaries) const
+{
+    switch (location.source) {
+        case TensorSource::MODEL_INPUT:
+            return inputs[location.index];
+        case TensorSource::MODEL_OUTPUT:
+            return outputs[location.index];
+        default:
+            return reinterpret_cast<NN_Tensor*>(boundaries[location.index].get());
+    }
+}
+
+OH_NN_ReturnCode HeteroPreparedModel::Run(const std::vector<IOTensor>& inputs, const std::vector<IOTensor>& outputs,
+    std::vector<std::vector<int32_t>>& outputsDims, std::vector<bool>& isOutputBufferEnough)
+{
+    LOGE("[HeteroPreparedModel] Run failed, a model partitioned across backends only runs with NN_Tensor.");
+    return OH_NN_OPERATION_FORBIDDEN;
+}
+
+OH_NN_ReturnCode HeteroPreparedModel::Run(const std::vector<NN_Tensor*>& inputs,
+    const std::vector<NN_Tensor*>& outputs, std::vector<std::vector<int32_t>>& outputsDims,
+    std::vector<bool>& isOutputBufferEnough)
+{
+    if ((inputs.size() != m_modelInputIndices.size()) || (outputs.size() != m_modelOutputIndices.size())) {
+        LOGE("[HeteroPreparedModel] Run failed, the number of inputs or outputs does not match the model.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    std::unique_ptr<BoundaryTensors> boundaries;
+    OH_NN_ReturnCode ret = AcquireBoundaries(boundaries);
+    if (ret != OH_NN_SUCCESS) {
+        return ret;
+    }
+
+    outputsDims.assign(outputs.size(), {});
+    isOutputBufferEnough.assign(outputs.size(), true);
+    std::vector<NN_Tensor*> stageInputs;
+    std::vector<NN_Tensor*> stageOutputs;
+    std::vector<std::vector<int32_t>> stageOutputsDims;
+    std::vector<bool> isStageBufferEnough;
+    for (size_t i = 0; (i < m_stages.size()) && (ret == OH_NN_SUCCESS); ++i) {
+        const Stage& stage = m_stages[i];
+        stageInputs.clear();
+        stageOutputs.clear();
+        for (const TensorLocation& location : stage.inputs) {
+            stageInputs.emplace_back(Resolve(location, inputs, outputs, *boundaries));
+        }
+        for (const TensorLocation& location : stage.outputs) {
+            stageOutputs.emplace_back(Resolve(location, inputs, outputs, *boundaries));
+        }
+
+        stageOutputsDims.clear();
+        isStageBufferEnough.clear();
+        ret = stage.preparedModel->Run(stageInputs, stageOutputs, stageOutputsDims, isStageBufferEnough);
+        if (ret != OH_NN_SUCCESS) {
+            LOGE("[HeteroPreparedModel] Run failed, stage %{public}zu on backend %{public}zu failed.",
+                i, stage.backendID);
+            break;
+        }
+        if (stageOutputsDims.size() != stage.outputs.size()) {
+            LOGE("[HeteroPreparedModel] Run failed, stage %{public}zu returned %{public}zu output dims, "
+                "expect %{public}zu.", i, stageOutputsDims.size(), stage.outputs.size());
+            ret = OH_NN_INVALID_PARAMETER;
+            break;
+        }
+
+        for (size_t j = 0; j < stage.outputs.size(); ++j) {
+            if (stage.outputs[j].source != TensorSource::MODEL_OUTPUT) {
+                continue;
+            }
+            size_t outputIndex = stage.outputs[j].index;
+            outputsDims[outputIndex] = std::move(stageOutputsDims[j]);
+            if (j < isStageBufferEnough.size()) {
+                isOutputBufferEnough[outputIndex] = isStageBufferEnough[j];
+            }
+        }
+    }
+
+    ReleaseBoundaries(std::move(boundaries));
+    return ret;
+}
+
+OH_NN_ReturnCode HeteroPreparedModel::GetModelID(uint32_t& modelId) const
+{
+    if (m_stages.empty()) {
+        LOGE("[HeteroPreparedModel] GetModelID failed, no stage has been added.");
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+    return m_stages[0].preparedModel->GetModelID(modelId);
+}
+
+OH_NN_ReturnCode HeteroPreparedModel::ReleaseBuiltModel()
+{
+    OH_NN_ReturnCode result = OH_NN_SUCCESS;
+    for (const Stage& stage : m_stages) {
+        OH_NN_ReturnCode ret = stage.preparedModel->ReleaseBuiltModel();
+        if (ret != OH_NN_SUCCESS) {
+            LOGW("[HeteroPreparedModel] ReleaseBuiltModel failed on backend %{public}zu.", stage.backendID);
+            result = ret;
+        }
+    }
+    return result;
+}
+
+OH_NN_ReturnCode HeteroPreparedModel::GetInputDimRanges(std::vector<std::vector<uint32_t>>& minInputDims,
+    std::vector<std::vector<uint32_t>>& maxInputDims)
+{
+    minInputDims.assign(m_modelInputIndices.size(), {});
+    maxInputDims.assign(m_modelInputIndices.size(), {});
+    std::vector<bool> isFound(m_modelInputIndices.size(), false);
+    std::vector<std::vector<uint32_t>> stageMinDims;
+    std::vector<std::vector<uint32_t>> stageMaxDims;
+    for (const Stage& stage : m_stages) {
+        // The first stage reading a model input decides its dim range.
+        bool isNeeded = std::any_of(stage.inputs.begin(), stage.inputs.end(), [&isFound](const TensorLocation& item) {
+            return (item.source == TensorSource::MODEL_INPUT) && !isFound[item.index];
+        });
+        if (!isNeeded) {
+            continue;
+        }
+
+        stageMinDims.clear();
+        stageMaxDims.clear();
+        OH_NN_ReturnCode ret = stage.preparedModel->GetInputDimRanges(stageMinDims, stageMaxDims);
+        if (ret != OH_NN_SUCCESS) {
+            return ret;
+        }
+        if ((stageMinDims.size() != stage.inputs.size()) || (stageMaxDims.size() != stage.inputs.size())) {
+            LOGE("[HeteroPreparedModel] GetInputDimRanges failed, stage on backend %{public}zu returned "
+                "%{public}zu ranges, expect %{public}zu.", stage.backendID, stageMinDims.size(), stage.inputs.size());
+            return OH_NN_INVALID_PARAMETER;
+        }
+        for (size_t i = 0; i < stage.inputs.size(); ++i) {
+            const TensorLocation& location = stage.inputs[i];
+            if ((location.source == TensorSource::MODEL_INPUT) && !isFound[location.index]) {
+                minInputDims[location.index] = std::move(stageMinDims[i]);
+                maxInputDims[location.index] = std::move(stageMaxDims[i]);
+                isFound[location.index] = true;
+            }
+        }
+    }
+
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode HeteroPreparedModel::SetAippString(const std::string& aippStrings)
+{
+    LOGE("[HeteroPreparedModel] SetAippString failed, AIPP is not supported by a model partitioned across backends.");
+    return OH_NN_OPERATION_FORBIDDEN;
+}
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NEURAL_NETWORK_RUNTIME_HETERO_PREPARED_MODEL_H
+#define NEURAL_NETWORK_RUNTIME_HETERO_PREPARED_MODEL_H
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "hetero_partitioner.h"
+#include "nntensor.h"
+#include "prepared_model.h"
+#include "tensor_desc.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+/**
+ * Runs the subgraphs produced by HeteroPartitioner one after another as a single prepared model.
+ *
+ * Tensors passed between two subgraphs are allocated on the backend of the producing subgraph and handed to the
+ * consuming one by file descriptor, so no data is copied at the boundaries. Every request takes its own set of
+ * boundary tensors from a pool, which lets executors sharing this model run different subgraphs at the same time.
+ */
+class HeteroPreparedModel : public PreparedModel {
+public:
+    HeteroPreparedModel(const std::vector<uint32_t>& modelInputIndices,
+                        const std::vector<uint32_t>& modelOutputIndices);
+    ~HeteroPreparedModel() override = default;
+
+    // Stages must be added in execution order, Finish() checks that they produce every model output.
+    OH_NN_ReturnCode AddStage(const HeteroSubgraph& subgraph, std::shared_ptr<PreparedModel> preparedModel);
+    OH_NN_ReturnCode Finish() const;
+
+    OH_NN_ReturnCode ExportModelCache(std::vector<Buffer>& modelCache) override;
+
+    OH_NN_ReturnCode Run(const std::vector<IOTensor>& inputs,
+                         const std::vector<IOTensor>& outputs,
+                         std::vector<std::vector<int32_t>>& outputsDims,
+                         std::vector<bool>& isOutputBufferEnough) override;
+
+    OH_NN_ReturnCode Run(const std::vector<NN_Tensor*>& inputs,
+                         const std::vector<NN_Tensor*>& outputs,
+                         std::vector<std::vector<int32_t>>& outputsDims,
+                         std::vector<bool>& isOutputBufferEnough) override;
+
+    OH_NN_ReturnCode GetModelID(uint32_t& modelId) const override;
+
+    OH_NN_ReturnCode ReleaseBuiltModel() override;
+
+    OH_NN_ReturnCode GetInputDimRanges(std::vector<std::vector<uint32_t>>& minInputDims,
+                                       std::vector<std::vector<uint32_t>>& maxInputDims) override;
+
+    OH_NN_ReturnCode SetAippString(const std::string& aippStrings) override;
+
+private:
+    enum class TensorSource {
+        MODEL_INPUT,
+        MODEL_OUTPUT,
+        BOUNDARY
+    };
+
+    struct TensorLocation {
+        TensorSource source {TensorSource::BOUNDARY};
+        size_t index {0};
+    };
+
+    struct Stage {
+        size_t backendID {0};
+        std::shared_ptr<PreparedModel> preparedModel {nullptr};
+        std::vector<TensorLocation> inputs;
+        std::vector<TensorLocation> outputs;
+    };
+
+    struct BoundaryInfo {
+        size_t backendID {0};
+        TensorDesc desc;
+    };
+
+    using BoundaryTensors = std::vector<std::unique_ptr<NNTensor2_0>>;
+
+    OH_NN_ReturnCode AddBoundary(const HeteroSubgraph& subgraph, size_t outputIndex, TensorLocation& location);
+    OH_NN_ReturnCode AcquireBoundaries(std::unique_ptr<BoundaryTensors>& boundaries);
+    void ReleaseBoundaries(std::unique_ptr<BoundaryTensors> boundaries);
+    NN_Tensor* Resolve(const TensorLocation& location, const std::vector<NN_Tensor*>& inputs,
+                       const std::vector<NN_Tensor*>& outputs, const BoundaryTensors& boundaries) const;
+
+private:
+    std::vector<uint32_t> m_modelInputIndices;
+    std::vector<uint32_t> m_modelOutputIndices;
+    std::vector<Stage> m_stages;
+    std::vector<BoundaryInfo> m_boundaries;
+    // Whole graph tensor index of every tensor already produced by an added stage.
+    std::vector<std::pair<uint32_t, TensorLocation>> m_producedTensors;
+
+    std::mutex m_poolMutex;
+    std::vector<std::unique_ptr<BoundaryTensors>> m_idleBoundaries;
+};
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
+#endif // NEURAL_NETWORK_RUNTIME_HETERO_PREPARED_MODEL_H
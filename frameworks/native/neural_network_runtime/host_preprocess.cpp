@@ -0,0 +1,416 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "host_preprocess.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#elif defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "log.h"
+#include "securec.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace {
+constexpr size_t INPUT_DIM_NUM = 4;
+constexpr size_t COLOR_CHANNEL_NUM = 3;
+constexpr size_t RED = 0;
+constexpr size_t GREEN = 1;
+constexpr size_t BLUE = 2;
+
+struct PixelLayout {
+    size_t channelNum {0};
+    // Byte offset of the red, green and blue components inside a pixel.
+    size_t colorOffsets[COLOR_CHANNEL_NUM] {0, 0, 0};
+};
+
+struct SampleMap {
+    size_t index0 {0};
+    size_t index1 {0};
+    float weight {0.0f};
+};
+
+bool GetPixelLayout(OH_NN_PixelFormat format, PixelLayout& layout)
+{
+    switch (format) {
+        case OH_NN_PIXEL_FORMAT_RGB888:
+            layout = {3, {0, 1, 2}};
+            return true;
+        case OH_NN_PIXEL_FORMAT_BGR888:
+            layout = {3, {2, 1, 0}};
+            return true;
+        case OH_NN_PIXEL_FORMAT_RGBA8888:
+            layout = {4, {0, 1, 2}};
+            return true;
+        case OH_NN_PIXEL_FORMAT_BGRA8888:
+            layout = {4, {2, 1, 0}};
+            return true;
+        case OH_NN_PIXEL_FORMAT_GRAY8:
+            layout = {1, {0, 0, 0}};
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Byte offsets inside a source pixel of every channel written to the tensor, in tensor channel order.
+OH_NN_ReturnCode GetChannelOffsets(const OH_NN_PreprocessConfig& config, const PixelLayout& srcLayout,
+                                   std::vector<size_t>& offsets)
+{
+    switch (config.dstFormat) {
+        case OH_NN_PIXEL_FORMAT_RGB888:
+            offsets = {srcLayout.colorOffsets[RED], srcLayout.colorOffsets[GREEN], srcLayout.colorOffsets[BLUE]};
+            return OH_NN_SUCCESS;
+        case OH_NN_PIXEL_FORMAT_BGR888:
+            offsets = {srcLayout.colorOffsets[BLUE], srcLayout.colorOffsets[GREEN], srcLayout.colorOffsets[RED]};
+            return OH_NN_SUCCESS;
+        case OH_NN_PIXEL_FORMAT_GRAY8:
+            if (config.srcFormat != OH_NN_PIXEL_FORMAT_GRAY8) {
+                LOGE("[HostPreprocess] Converting a color image to gray is not supported.");
+                return OH_NN_INVALID_PARAMETER;
+            }
+            offsets = {0};
+            return OH_NN_SUCCESS;
+        default:
+            LOGE("[HostPreprocess] Unsupported dstFormat %{public}d, only RGB888, BGR888 and GRAY8 are supported.",
+                 config.dstFormat);
+            return OH_NN_INVALID_PARAMETER;
+    }
+}
+
+// Bilinear sample positions with half pixel centers, the same convention as AIPP and OpenCV INTER_LINEAR.
+std::vector<SampleMap> BuildSampleMap(size_t srcSize, size_t dstSize)
+{
+    std::vector<SampleMap> maps(dstSize);
+    if (srcSize == dstSize) {
+        for (size_t i = 0; i < dstSize; ++i) {
+            maps[i].index0 = i;
+            maps[i].index1 = i;
+        }
+        return maps;
+    }
+
+    float ratio = static_cast<float>(srcSize) / static_cast<float>(dstSize);
+    float maxPos = static_cast<float>(srcSize - 1);
+    for (size_t i = 0; i < dstSize; ++i) {
+        float pos = (static_cast<float>(i) + 0.5f) * ratio - 0.5f;
+        pos = std::min(std::max(pos, 0.0f), maxPos);
+        size_t index0 = static_cast<size_t>(pos);
+        maps[i].index0 = index0;
+        maps[i].index1 = std::min(index0 + 1, srcSize - 1);
+        maps[i].weight = pos - static_cast<float>(index0);
+    }
+    return maps;
+}
+
+template<typename T>
+void StoreQuantRow(const float* src, size_t count, int32_t zeroPoint, T* dst)
+{
+    const float lowest = static_cast<float>(std::numeric_limits<T>::lowest());
+    const float highest = static_cast<float>(std::numeric_limits<T>::max());
+    const float offset = static_cast<float>(zeroPoint);
+    for (size_t i = 0; i < count; ++i) {
+        float value = std::min(std::max(std::round(src[i]) + offset, lowest), highest);
+        dst[i] = static_cast<T>(value);
+    }
+}
+
+void StoreRow(const float* src, size_t count, OH_NN_DataType dataType, int32_t zeroPoint, void* data,
+              size_t elementOffset)
+{
+    switch (dataType) {
+        case OH_NN_FLOAT32:
+            std::copy(src, src + count, static_cast<float*>(data) + elementOffset);
+            break;
+        case OH_NN_FLOAT16: {
+            uint16_t* dst = static_cast<uint16_t*>(data) + elementOffset;
+            for (size_t i = 0; i < count; ++i) {
+                dst[i] = HostPreprocess::FloatToHalf(src[i]);
+            }
+            break;
+        }
+        case OH_NN_INT8:
+            StoreQuantRow(src, count, zeroPoint, static_cast<int8_t*>(data) + elementOffset);
+            break;
+        default:
+            StoreQuantRow(src, count, zeroPoint, static_cast<uint8_t*>(data) + elementOffset);
+            break;
+    }
+}
+
+OH_NN_ReturnCode CheckTensor(const TensorDesc& tensorDesc, size_t channelNum, size_t length,
+                             OH_NN_DataType& dataType, OH_NN_Format& format, size_t& height, size_t& width)
+{
+    tensorDesc.GetDataType(&dataType);
+    if (dataType != OH_NN_FLOAT32 && dataType != OH_NN_FLOAT16 && dataType != OH_NN_INT8 &&
+        dataType != OH_NN_UINT8) {
+        LOGE("[HostPreprocess] Unsupported tensor data type %{public}d.", dataType);
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    tensorDesc.GetFormat(&format);
+    if (format != OH_NN_FORMAT_NHWC && format != OH_NN_FORMAT_NCHW) {
+        LOGE("[HostPreprocess] Tensor format must be NHWC or NCHW, but got %{public}d.", format);
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    int32_t* shape = nullptr;
+    size_t shapeNum = 0;
+    tensorDesc.GetShape(&shape, &shapeNum);
+    if (shape == nullptr || shapeNum != INPUT_DIM_NUM) {
+        LOGE("[HostPreprocess] Tensor must have %{public}zu dimensions, but got %{public}zu.", INPUT_DIM_NUM,
+             shapeNum);
+        return OH_NN_INVALID_PARAMETER;
+    }
+    if (std::any_of(shape, shape + shapeNum, [](int32_t dim) { return dim <= 0; })) {
+        LOGE("[HostPreprocess] Tensor shape must be fixed before it is filled.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    const size_t channelIndex = (format == OH_NN_FORMAT_NHWC) ? 3 : 1;
+    const size_t heightIndex = (format == OH_NN_FORMAT_NHWC) ? 1 : 2;
+    const size_t widthIndex = (format == OH_NN_FORMAT_NHWC) ? 2 : 3;
+    if (shape[0] != 1 || static_cast<size_t>(shape[channelIndex]) != channelNum) {
+        LOGE("[HostPreprocess] Tensor must hold one image of %{public}zu channels.", channelNum);
+        return OH_NN_INVALID_PARAMETER;
+    }
+    height = static_cast<size_t>(shape[heightIndex]);
+    width = static_cast<size_t>(shape[widthIndex]);
+
+    size_t byteSize = 0;
+    auto ret = tensorDesc.GetByteSize(&byteSize);
+    if (ret != OH_NN_SUCCESS || byteSize > length) {
+        LOGE("[HostPreprocess] Tensor memory of %{public}zu bytes is smaller than the tensor.", length);
+        return OH_NN_INVALID_PARAMETER;
+    }
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode CheckImage(const OH_NN_PreprocessConfig& config, const PixelLayout& srcLayout, size_t imageLength,
+                            size_t& stride, size_t& cropWidth, size_t& cropHeight)
+{
+    if (config.srcWidth == 0 || config.srcHeight == 0) {
+        LOGE("[HostPreprocess] Image size must be positive.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    const size_t rowBytes = static_cast<size_t>(config.srcWidth) * srcLayout.channelNum;
+    stride = (config.srcStride == 0) ? rowBytes : config.srcStride;
+    if (stride < rowBytes) {
+        LOGE("[HostPreprocess] srcStride %{public}zu is smaller than a row of %{public}zu bytes.", stride, rowBytes);
+        return OH_NN_INVALID_PARAMETER;
+    }
+    if (imageLength < stride * (config.srcHeight - 1) + rowBytes) {
+        LOGE("[HostPreprocess] imageLength %{public}zu is smaller than the image.", imageLength);
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    if (config.cropX >= config.srcWidth || config.cropY >= config.srcHeight) {
+        LOGE("[HostPreprocess] Crop origin is out of the image.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+    cropWidth = (config.cropWidth == 0) ? config.srcWidth - config.cropX : config.cropWidth;
+    cropHeight = (config.cropHeight == 0) ? config.srcHeight - config.cropY : config.cropHeight;
+    if (cropWidth > config.srcWidth - config.cropX || cropHeight > config.srcHeight - config.cropY) {
+        LOGE("[HostPreprocess] Crop area is out of the image.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+    return OH_NN_SUCCESS;
+}
+} // namespace
+
+OH_NN_ReturnCode HostPreprocess::Run(const OH_NN_PreprocessConfig& config, const void* image, size_t imageLength,
+                                     const TensorDesc& tensorDesc, void* data, size_t length)
+{
+    if (image == nullptr || data == nullptr) {
+        LOGE("[HostPreprocess] Image or tensor data is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    PixelLayout srcLayout;
+    if (!GetPixelLayout(config.srcFormat, srcLayout)) {
+        LOGE("[HostPreprocess] Unsupported srcFormat %{public}d.", config.srcFormat);
+        return OH_NN_INVALID_PARAMETER;
+    }
+    std::vector<size_t> channelOffsets;
+    auto ret = GetChannelOffsets(config, srcLayout, channelOffsets);
+    if (ret != OH_NN_SUCCESS) {
+        return ret;
+    }
+
+    size_t stride = 0;
+    size_t cropWidth = 0;
+    size_t cropHeight = 0;
+    ret = CheckImage(config, srcLayout, imageLength, stride, cropWidth, cropHeight);
+    if (ret != OH_NN_SUCCESS) {
+        return ret;
+    }
+
+    const size_t channelNum = channelOffsets.size();
+    OH_NN_DataType dataType {OH_NN_UNKNOWN};
+    OH_NN_Format format {OH_NN_FORMAT_NONE};
+    size_t height = 0;
+    size_t width = 0;
+    ret = CheckTensor(tensorDesc, channelNum, length, dataType, format, height, width);
+    if (ret != OH_NN_SUCCESS) {
+        return ret;
+    }
+
+    // Quantization divides by quantScale, fold it into the normalization scale so the row is normalized once.
+    float quantScale = 1.0f;
+    if (dataType == OH_NN_INT8 || dataType == OH_NN_UINT8) {
+        if (config.quantScale == 0.0f || !std::isfinite(config.quantScale)) {
+            LOGE("[HostPreprocess] quantScale must be a finite non-zero value for quantized tensors.");
+            return OH_NN_INVALID_PARAMETER;
+        }
+        quantScale = config.quantScale;
+    }
+
+    const bool isNhwc = (format == OH_NN_FORMAT_NHWC);
+    const size_t rowSize = width * channelNum;
+    std::vector<float> meanRow(rowSize);
+    std::vector<float> scaleRow(rowSize);
+    for (size_t x = 0; x < width; ++x) {
+        for (size_t c = 0; c < channelNum; ++c) {
+            size_t index = isNhwc ? x * channelNum + c : c * width + x;
+            meanRow[index] = config.mean[c];
+            scaleRow[index] = config.scale[c] / quantScale;
+        }
+    }
+
+    const std::vector<SampleMap> xMaps = BuildSampleMap(cropWidth, width);
+    const std::vector<SampleMap> yMaps = BuildSampleMap(cropHeight, height);
+    const uint8_t* origin = static_cast<const uint8_t*>(image) + config.cropY * stride +
+        config.cropX * srcLayout.channelNum;
+    std::vector<float> row(rowSize);
+    for (size_t y = 0; y < height; ++y) {
+        const SampleMap& yMap = yMaps[y];
+        const uint8_t* srcRow0 = origin + yMap.index0 * stride;
+        const uint8_t* srcRow1 = origin + yMap.index1 * stride;
+        for (size_t x = 0; x < width; ++x) {
+            const SampleMap& xMap = xMaps[x];
+            const uint8_t* p00 = srcRow0 + xMap.index0 * srcLayout.channelNum;
+            const uint8_t* p01 = srcRow0 + xMap.index1 * srcLayout.channelNum;
+            const uint8_t* p10 = srcRow1 + xMap.index0 * srcLayout.channelNum;
+            const uint8_t* p11 = srcRow1 + xMap.index1 * srcLayout.channelNum;
+            for (size_t c = 0; c < channelNum; ++c) {
+                size_t offset = channelOffsets[c];
+                float top = p00[offset] + (p01[offset] - p00[offset]) * xMap.weight;
+                float bottom = p10[offset] + (p11[offset] - p10[offset]) * xMap.weight;
+                row[isNhwc ? x * channelNum + c : c * width + x] = top + (bottom - top) * yMap.weight;
+            }
+        }
+
+        NormalizeRow(row.data(), meanRow.data(), scaleRow.data(), row.data(), rowSize);
+
+        if (isNhwc) {
+            StoreRow(row.data(), rowSize, dataType, config.quantZeroPoint, data, y * rowSize);
+            continue;
+        }
+        for (size_t c = 0; c < channelNum; ++c) {
+            StoreRow(row.data() + c * width, width, dataType, config.quantZeroPoint, data, (c * height + y) * width);
+        }
+    }
+    return OH_NN_SUCCESS;
+}
+
+void HostPreprocess::NormalizeRow(const float* src, const float* mean, const float* scale, float* dst, size_t count)
+{
+    size_t i = 0;
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    constexpr size_t lanes = 4;
+    for (; i + lanes <= count; i += lanes) {
+        float32x4_t value = vsubq_f32(vld1q_f32(src + i), vld1q_f32(mean + i));
+        vst1q_f32(dst + i, vmulq_f32(value, vld1q_f32(scale + i)));
+    }
+#elif defined(__AVX2__)
+    constexpr size_t lanes = 8;
+    for (; i + lanes <= count; i += lanes) {
+        __m256 value = _mm256_sub_ps(_mm256_loadu_ps(src + i), _mm256_loadu_ps(mean + i));
+        _mm256_storeu_ps(dst + i, _mm256_mul_ps(value, _mm256_loadu_ps(scale + i)));
+    }
+#elif defined(__SSE2__)
+    constexpr size_t lanes = 4;
+    for (; i + lanes <= count; i += lanes) {
+        __m128 value = _mm_sub_ps(_mm_loadu_ps(src + i), _mm_loadu_ps(mean + i));
+        _mm_storeu_ps(dst + i, _mm_mul_ps(value, _mm_loadu_ps(scale + i)));
+    }
+#endif
+    NormalizeRowScalar(src + i, mean + i, scale + i, dst + i, count - i);
+}
+
+void HostPreprocess::NormalizeRowScalar(const float* src, const float* mean, const float* scale, float* dst,
+                                        size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        dst[i] = (src[i] - mean[i]) * scale[i];
+    }
+}
+
+uint16_t HostPreprocess::FloatToHalf(float value)
+{
+    uint32_t bits = 0;
+    if (memcpy_s(&bits, sizeof(bits), &value, sizeof(value)) != EOK) {
+        LOGE("[HostPreprocess] FloatToHalf failed, fail to copy the bits of the value.");
+        return 0;
+    }
+    const uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000);
+    const int32_t exponent = static_cast<int32_t>((bits >> 23) & 0xff);
+    uint32_t mantissa = bits & 0x7fffff;
+
+    if (exponent == 0xff) {
+        return sign | 0x7c00 | (mantissa != 0 ? 0x200 : 0);
+    }
+    const int32_t halfExponent = exponent - 127 + 15;
+    if (halfExponent >= 0x1f) {
+        return sign | 0x7c00;
+    }
+
+    uint32_t half = 0;
+    uint32_t remainder = 0;
+    uint32_t halfway = 0;
+    if (halfExponent <= 0) {
+        // Subnormal half, or zero once the value is below half of the smallest subnormal.
+        if (halfExponent < -10) {
+            return sign;
+        }
+        mantissa |= 0x800000;
+        const uint32_t shift = static_cast<uint32_t>(14 - halfExponent);
+        half = mantissa >> shift;
+        remainder = mantissa & ((1u << shift) - 1);
+        halfway = 1u << (shift - 1);
+    } else {
+        half = (static_cast<uint32_t>(halfExponent) << 10) | (mantissa >> 13);
+        remainder = mantissa & 0x1fff;
+        halfway = 0x1000;
+    }
+    // Round to nearest even, a carry out of the mantissa correctly bumps the exponent, up to infinity.
+    if (remainder > halfway || (remainder == halfway && (half & 1) != 0)) {
+        ++half;
+    }
+    return sign | static_cast<uint16_t>(half);
+}
+}  // namespace NeuralNetworkRuntime
+}  // namespace OHOS
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NEURAL_NETWORK_RUNTIME_HOST_PREPROCESS_H
+#define NEURAL_NETWORK_RUNTIME_HOST_PREPROCESS_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "neural_network_runtime_inner.h"
+#include "tensor_desc.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+/**
+ * Host side replacement of AIPP for devices that do not support it.
+ *
+ * Crop, bilinear resize, channel reordering, normalization, quantization and the NHWC/NCHW layout change are done
+ * row by row in a single pass that writes straight into the tensor memory. Only one row of floats is kept as
+ * intermediate. The per element normalization runs on NEON, AVX2 or SSE2 when the target provides them, the
+ * resampling stays scalar because its gather pattern does not vectorize without a shuffle per pixel.
+ */
+class HostPreprocess {
+public:
+    static OH_NN_ReturnCode Run(const OH_NN_PreprocessConfig& config, const void* image, size_t imageLength,
+                                const TensorDesc& tensorDesc, void* data, size_t length);
+
+    // dst[i] = (src[i] - mean[i]) * scale[i], vectorized when the target supports it.
+    static void NormalizeRow(const float* src, const float* mean, const float* scale, float* dst, size_t count);
+    static void NormalizeRowScalar(const float* src, const float* mean, const float* scale, float* dst,
+                                   size_t count);
+
+    static uint16_t FloatToHalf(float value);
+};
+}  // namespace NeuralNetworkRuntime
+}  // namespace OHOS
+#endif  // NEURAL_NETWORK_RUNTIME_HOST_PREPROCESS_H
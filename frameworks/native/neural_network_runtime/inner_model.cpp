@@ -15,8 +15,11 @@
 
 #include "inner_model.h"
 
+#include <algorithm>
 #include <new>
+#include <type_traits>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "securec.h"
@@ -47,6 +50,103 @@ public:
     }
 };
 
+// Weights up to this size are digested as a whole, larger ones by evenly spaced samples which include both ends.
+constexpr size_t FULL_DIGEST_LENGTH = 4096;
+constexpr size_t DIGEST_SAMPLE_COUNT = 16;
+constexpr size_t DIGEST_SAMPLE_LENGTH = 64;
+constexpr uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+constexpr uint64_t FNV_PRIME = 0x100000001b3ULL;
+
+// 64-bit FNV-1a over everything fed in, finished with the murmur3 mixer so that close models spread over all bits.
+class FingerprintHasher {
+public:
+    void Update(const void* data, size_t length)
+    {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < length; ++i) {
+            m_state = (m_state ^ bytes[i]) * FNV_PRIME;
+        }
+    }
+
+    template<typename T>
+    void Update(T value)
+    {
+        static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value, "Only scalars are hashed by value.");
+        Update(&value, sizeof(T));
+    }
+
+    template<typename T>
+    void Update(const std::vector<T>& values)
+    {
+        Update(values.size());
+        Update(values.data(), values.size() * sizeof(T));
+    }
+
+    void Update(const std::string& value)
+    {
+        Update(value.size());
+        Update(value.data(), value.size());
+    }
+
+    void UpdateData(const void* data, size_t length)
+    {
+        Update(length);
+        if ((data == nullptr) || (length <= FULL_DIGEST_LENGTH)) {
+            Update(data, (data == nullptr) ? 0 : length);
+            return;
+        }
+
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        size_t stride = (length - DIGEST_SAMPLE_LENGTH) / (DIGEST_SAMPLE_COUNT - 1);
+        for (size_t i = 0; i < DIGEST_SAMPLE_COUNT - 1; ++i) {
+            Update(bytes + i * stride, DIGEST_SAMPLE_LENGTH);
+        }
+        Update(bytes + length - DIGEST_SAMPLE_LENGTH, DIGEST_SAMPLE_LENGTH);
+    }
+
+    void UpdateQuantParams(const std::vector<QuantParam>& quantParams)
+    {
+        Update(quantParams.size());
+        for (const QuantParam& quantParam : quantParams) {
+            Update(quantParam.numBits);
+            Update(quantParam.scale);
+            Update(quantParam.zeroPoint);
+        }
+    }
+
+    void UpdateGroupQuantParam(const std::shared_ptr<const GroupQuantParam>& groupQuantParam)
+    {
+        Update(groupQuantParam != nullptr);
+        if (groupQuantParam == nullptr) {
+            return;
+        }
+
+        Update(groupQuantParam->axis);
+        Update(groupQuantParam->groupSize);
+        Update(groupQuantParam->numBits);
+        size_t groupCount = groupQuantParam->GetGroupCount();
+        Update(groupCount);
+        for (size_t i = 0; i < groupCount; ++i) {
+            Update(groupQuantParam->GetScale(i));
+            Update(groupQuantParam->GetZeroPoint(i));
+        }
+    }
+
+    size_t Digest() const
+    {
+        uint64_t digest = m_state;
+        digest ^= digest >> 33;
+        digest *= 0xff51afd7ed558ccdULL;
+        digest ^= digest >> 33;
+        digest *= 0xc4ceb93fe53e88d3ULL;
+        digest ^= digest >> 33;
+        return static_cast<size_t>(digest);
+    }
+
+private:
+    uint64_t m_state {FNV_OFFSET_BASIS};
+};
+
 std::shared_ptr<NNTensor> ConstructNNTensorFromLiteGraphTensor(const MSLITE::TensorPtr msTensor)
 {
     MSLITE::DataType msDataType = MSLITE::MindIR_Tensor_GetDataType(msTensor);
@@ -147,6 +247,7 @@ OH_NN_ReturnCode InnerModel::BuildFromLiteGraph(const MSLITE::LiteGraph* liteGra
     m_liteGraph->name_ = LOADED_NNR_MODEL;
 
     m_extensionConfig = extensionConfig;
+    ComputeLiteGraphFingerprint();
 
     return OH_NN_SUCCESS;
 }
@@ -585,8 +686,11 @@ OH_NN_ReturnCode InnerModel::Build()
 
     m_liteGraph->name_ = NNR_MODEL;
 
+    std::vector<bool> isTensorUsed;
+    OptimizeGraph(isTensorUsed);
+
     std::unordered_map<uint32_t, uint32_t> modelIDToGraphID;
-    AddTensorsToLiteGraph(modelIDToGraphID);
+    AddTensorsToLiteGraph(modelIDToGraphID, isTensorUsed);
 
     OH_NN_ReturnCode ret = AddNodesToLiteGraph(modelIDToGraphID);
     if (ret != OH_NN_SUCCESS) {
@@ -603,24 +707,172 @@ OH_NN_ReturnCode InnerModel::Build()
     subGraph->name_ = "NNRt_SubGraph"; // Name of subGraph
     subGraph->input_indices_ = m_liteGraph->input_indices_;
     subGraph->output_indices_ = m_liteGraph->output_indices_;
-    uint32_t nodeCount = static_cast<uint32_t>(m_ops.size()); // m_ops.size() smaller than UINT32_MAX
+    uint32_t nodeCount = static_cast<uint32_t>(m_emittedOps.size()); // m_ops.size() smaller than UINT32_MAX
     for (uint32_t i = 0; i < nodeCount; i++) {
         subGraph->node_indices_.emplace_back(i);
     }
     m_liteGraph->sub_graphs_.emplace_back(subGraph);
 
+    ComputeFingerprint();
     return OH_NN_SUCCESS;
 }
 
-void InnerModel::AddTensorsToLiteGraph(std::unordered_map<uint32_t, uint32_t>& modelIDToGraphID)
+/* Hashes what decides the compiled model: operation types, attributes, tensor shapes and sampled weights. Names are
+ * left out, they neither change the model nor tell models apart. */
+void InnerModel::ComputeFingerprint()
+{
+    FingerprintHasher hasher;
+    hasher.Update(m_allTensors.size());
+    for (const std::shared_ptr<NNTensor>& tensor : m_allTensors) {
+        hasher.Update(tensor->GetType());
+        hasher.Update(tensor->GetDataType());
+        hasher.Update(tensor->GetFormat());
+        hasher.Update(tensor->GetDimensions());
+        hasher.UpdateQuantParams(tensor->GetQuantParam());
+        hasher.UpdateGroupQuantParam(tensor->GetGroupQuantParam());
+        // Operation parameters carry the attributes of their operation, they are small and always hashed whole.
+        hasher.UpdateData(tensor->GetBuffer(), tensor->GetDataLength());
+    }
+
+    hasher.Update(m_emittedOps.size());
+    for (size_t i : m_emittedOps) {
+        const std::unique_ptr<Ops::OpsBuilder>& op = m_ops[i];
+        hasher.Update(op->GetName());
+        hasher.Update(op->GetQuantType());
+        hasher.Update(op->GetInputsIndex());
+        hasher.Update(op->GetOutputsIndex());
+    }
+    hasher.Update(m_inputIndices);
+    hasher.Update(m_outputIndices);
+    m_fingerprint = hasher.Digest();
+}
+
+/* The attributes of a loaded liteGraph are hidden in its primitives, only the types of the nodes are hashed. Reading
+ * the data of a tensor copies it, so only the small constants are hashed by value and the weights by size. */
+void InnerModel::ComputeLiteGraphFingerprint()
+{
+    FingerprintHasher hasher;
+    hasher.Update(m_liteGraph->all_tensors_.size());
+    for (const MSLITE::TensorPtr tensor : m_liteGraph->all_tensors_) {
+        hasher.Update(MSLITE::MindIR_Tensor_GetDataType(tensor));
+        hasher.Update(MSLITE::MindIR_Tensor_GetFormat(tensor));
+        std::vector<int32_t> dims = MSLITE::MindIR_Tensor_GetDims(tensor);
+        hasher.Update(dims);
+        // A grouped tensor comes with one entry per group, so every group scale is hashed here as well.
+        hasher.UpdateQuantParams(MSToNN::TransformQuantParams(MSLITE::MindIR_Tensor_GetQuantParams(tensor)));
+
+        size_t elementCount = 1;
+        for (int32_t dim : dims) {
+            elementCount *= static_cast<size_t>(std::max(dim, 1));
+        }
+        if (elementCount * sizeof(int64_t) > FULL_DIGEST_LENGTH) {
+            hasher.Update(elementCount);
+            continue;
+        }
+        std::vector<uint8_t> data = MSLITE::MindIR_Tensor_GetData(tensor);
+        hasher.UpdateData(data.data(), data.size());
+    }
+
+    hasher.Update(m_liteGraph->all_nodes_.size());
+    for (const MSLITE::LiteGraph::Node* node : m_liteGraph->all_nodes_) {
+        if (node == nullptr) {
+            continue;
+        }
+        hasher.Update((node->primitive_ == nullptr) ? static_cast<int64_t>(-1) :
+            static_cast<int64_t>(MSLITE::MindIR_Primitive_GetType(node->primitive_)));
+        hasher.Update(static_cast<int64_t>(node->quant_type_));
+        hasher.Update(node->input_indices_);
+        hasher.Update(node->output_indices_);
+    }
+    hasher.Update(m_liteGraph->input_indices_);
+    hasher.Update(m_liteGraph->output_indices_);
+    m_fingerprint = hasher.Digest();
+}
+
+/* Folds the operations which only depend on constants and drops the operations whose outputs are never used. */
+void InnerModel::OptimizeGraph(std::vector<bool>& isTensorUsed)
+{
+    size_t opCount = m_ops.size();
+    std::unordered_set<uint32_t> modelOutputs(m_outputIndices.begin(), m_outputIndices.end());
+    auto producesModelOutput = [&modelOutputs](const std::unique_ptr<Ops::OpsBuilder>& op) {
+        const std::vector<uint32_t>& outputs = op->GetOutputsIndex();
+        return std::any_of(outputs.begin(), outputs.end(),
+            [&modelOutputs](uint32_t index) {return modelOutputs.count(index) != 0;});
+    };
+
+    // A folded output is a constant for the operations using it, so repeat until nothing more folds. Operations are
+    // usually added in topological order, in which case the second pass finds nothing.
+    std::vector<bool> isFolded(opCount, false);
+    size_t foldedCount = 0;
+    for (bool hasFolded = true; hasFolded;) {
+        hasFolded = false;
+        for (size_t i = 0; i < opCount; ++i) {
+            if (isFolded[i] || producesModelOutput(m_ops[i]) ||
+                (m_ops[i]->Fold(m_allTensors, m_inputIndices) != OH_NN_SUCCESS)) {
+                continue;
+            }
+            isFolded[i] = true;
+            hasFolded = true;
+            ++foldedCount;
+        }
+    }
+
+    // Walk back from the model outputs, an operation is kept if one of its outputs is used.
+    isTensorUsed.assign(m_allTensors.size(), false);
+    for (uint32_t index : m_outputIndices) {
+        isTensorUsed[index] = true;
+    }
+    std::vector<bool> isEmitted(opCount, false);
+    for (bool hasEmitted = true; hasEmitted;) {
+        hasEmitted = false;
+        for (size_t i = opCount; i-- > 0;) {
+            const std::vector<uint32_t>& outputs = m_ops[i]->GetOutputsIndex();
+            if (isFolded[i] || isEmitted[i] ||
+                std::none_of(outputs.begin(), outputs.end(), [&isTensorUsed](uint32_t index) {
+                    return isTensorUsed[index];
+                })) {
+                continue;
+            }
+            isEmitted[i] = true;
+            hasEmitted = true;
+            for (uint32_t index : m_ops[i]->GetInputsIndex()) {
+                isTensorUsed[index] = true;
+            }
+        }
+    }
+
+    m_emittedOps.clear();
+    for (size_t i = 0; i < opCount; ++i) {
+        if (!isEmitted[i]) {
+            continue;
+        }
+        m_emittedOps.emplace_back(i);
+        // Unused outputs of a kept operation are still outputs of its node.
+        for (uint32_t index : m_ops[i]->GetOutputsIndex()) {
+            isTensorUsed[index] = true;
+        }
+    }
+    for (uint32_t index : m_inputIndices) {
+        isTensorUsed[index] = true;
+    }
+
+    if (m_emittedOps.size() != opCount) {
+        LOGI("Build folded %{public}zu operations into constants and removed %{public}zu unused operations.",
+             foldedCount, opCount - foldedCount - m_emittedOps.size());
+    }
+}
+
+void InnerModel::AddTensorsToLiteGraph(std::unordered_map<uint32_t, uint32_t>& modelIDToGraphID,
+                                       const std::vector<bool>& isTensorUsed)
 {
     uint32_t graphID = 0;
     LiteGraphTensorPtr tensor(nullptr, DestroyLiteGraphTensor);
     size_t tensorCount = m_allTensors.size();
     for (size_t i = 0; i < tensorCount; i++) {
         const std::shared_ptr<NNTensor>& nnTensor = m_allTensors[i];
-        // If the tensor is used as operation parameter, it will not convert to the tensor of LiteGraph.
-        if (nnTensor->IsOpParameter()) {
+        // If the tensor is used as operation parameter, it will not convert to the tensor of LiteGraph. Neither will
+        // the tensors left without user by OptimizeGraph().
+        if (nnTensor->IsOpParameter() || !isTensorUsed[i]) {
             continue;
         }
 
@@ -643,9 +895,8 @@ void InnerModel::AddTensorsToLiteGraph(std::unordered_map<uint32_t, uint32_t>& m
 OH_NN_ReturnCode InnerModel::AddNodesToLiteGraph(const std::unordered_map<uint32_t, uint32_t>& modelIDToGraphID)
 {
     MSLITE::LiteGraph::Node* node{nullptr};
-    size_t opCount = m_ops.size();
     Ops::LiteGraphPrimitvePtr primitive = {nullptr, DestroyLiteGraphTensor};
-    for (size_t i = 0; i < opCount; i++) {
+    for (size_t i : m_emittedOps) {
         std::unique_ptr<Ops::OpsBuilder>& op = m_ops[i];
         // node will be released by LiteGraph if it is added into instance of LiteGraph.
         node = new(std::nothrow) MSLITE::LiteGraph::Node();
@@ -698,7 +949,16 @@ OH_NN_ReturnCode InnerModel::GetSupportedOperations(size_t deviceID, const bool*
     }
 
     m_supportedOperations.clear();
-    std::copy(supportedOperations.begin(), supportedOperations.end(), std::back_inserter(m_supportedOperations));
+    if (m_ops.empty()) {
+        std::copy(supportedOperations.begin(), supportedOperations.end(), std::back_inserter(m_supportedOperations));
+    } else {
+        // Report in the order of AddOperation(). Folded and removed operations never reach the device.
+        m_supportedOperations.assign(m_ops.size(), true);
+        size_t nodeCount = std::min(m_emittedOps.size(), supportedOperations.size());
+        for (size_t i = 0; i < nodeCount; ++i) {
+            m_supportedOperations[m_emittedOps[i]] = supportedOperations[i];
+        }
+    }
 
     *isSupported = reinterpret_cast<bool*>(m_supportedOperations.data());
     opCount = m_supportedOperations.size();
@@ -763,5 +1023,10 @@ ExtensionConfig InnerModel::GetExtensionConfig() const
 {
     return m_extensionConfig;
 }
+
+size_t InnerModel::GetFingerprint() const
+{
+    return m_fingerprint;
+}
 }  // namespace NeuralNetworkRuntime
 }  // namespace OHOS
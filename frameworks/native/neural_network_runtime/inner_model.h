@@ -60,26 +60,35 @@ public:
     }
     void* GetMetaGraph() const;
     ExtensionConfig GetExtensionConfig() const;
+    // Structural fingerprint of the built model, 0 before the model is built from tensors and operations or a
+    // liteGraph.
+    size_t GetFingerprint() const;
 
 private:
-    void AddTensorsToLiteGraph(std::unordered_map<uint32_t, uint32_t>& modelIDToGraphID);
+    void OptimizeGraph(std::vector<bool>& isTensorUsed);
+    void AddTensorsToLiteGraph(std::unordered_map<uint32_t, uint32_t>& modelIDToGraphID,
+                               const std::vector<bool>& isTensorUsed);
     OH_NN_ReturnCode AddNodesToLiteGraph(const std::unordered_map<uint32_t, uint32_t>& modelIDToGraphID);
     OH_NN_ReturnCode ValidateInputAndOutput(
         const OH_NN_UInt32Array& inputIndices, const OH_NN_UInt32Array& outputIndices) const;
     OH_NN_ReturnCode ValidateTensorArray(const OH_NN_UInt32Array& indices) const;
     OH_NN_ReturnCode CheckParameters() const;
+    void ComputeFingerprint();
+    void ComputeLiteGraphFingerprint();
 
 private:
     std::vector<char> m_supportedOperations; // std::vector<bool> not support data(), use std::vector<char> instead.
     std::vector<uint32_t> m_inputIndices;
     std::vector<uint32_t> m_outputIndices;
     std::vector<std::unique_ptr<Ops::OpsBuilder>> m_ops;
+    std::vector<size_t> m_emittedOps; // Indices of m_ops which are emitted as nodes, in the order of the nodes.
     std::vector<std::shared_ptr<NNTensor>> m_allTensors;
     std::vector<std::shared_ptr<NNTensor>> m_inputTensors; // Used to pass input tensors to compilation.
     std::vector<std::shared_ptr<NNTensor>> m_outputTensors; // Used to pass output tensors to compilation.
     std::shared_ptr<mindspore::lite::LiteGraph> m_liteGraph {nullptr};
     void* m_metaGraph {nullptr};
     ExtensionConfig m_extensionConfig;
+    size_t m_fingerprint {0};
 };
 }  // namespace NeuralNetworkRuntime
 }  // namespace OHOS
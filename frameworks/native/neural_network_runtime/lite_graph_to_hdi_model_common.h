@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NEURAL_NETWORK_RUNTIME_LITEGRAPH_TO_HDIMODEL_COMMON_H
+#define NEURAL_NETWORK_RUNTIME_LITEGRAPH_TO_HDIMODEL_COMMON_H
+
+#include <algorithm>
+#include <atomic>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "message_parcel.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+// Graphs smaller than this are converted on the calling thread, the thread start-up cost is not worth it.
+constexpr size_t PARALLEL_CONVERT_MIN_NODES = 256;
+constexpr size_t PARALLEL_CONVERT_MAX_THREADS = 8;
+
+// Node converters shared by every HDI version, as (node type, converter function) entries. The names are
+// resolved in the namespace of the including lite_graph_to_hdi_model_v*.cpp.
+#define NNRT_HDI_NODE_CONVERTER_LIST_V1(X) \
+    X(NODE_TYPE_ACTIVATION, ConvertActivation) \
+    X(NODE_TYPE_ADD_FUSION, ConvertAddFusion) \
+    X(NODE_TYPE_ARGMAX_FUSION, ConvertArgMaxFusion) \
+    X(NODE_TYPE_AVGPOOL_FUSION, ConvertAvgPoolFusion) \
+    X(NODE_TYPE_BATCH_TO_SPACE_ND, ConvertBatchToSpaceND) \
+    X(NODE_TYPE_BIAS_ADD, ConvertBiasAdd) \
+    X(NODE_TYPE_CAST, ConvertCast) \
+    X(NODE_TYPE_CONCAT, ConvertConcat) \
+    X(NODE_TYPE_CONV2D_FUSION, ConvertConv2DFusion) \
+    X(NODE_TYPE_CONV2D_TRANSPOSE_FUSION, ConvertConv2dTransposeFusion) \
+    X(NODE_TYPE_DIV_FUSION, ConvertDivFusion) \
+    X(NODE_TYPE_ELTWISE, ConvertEltwise) \
+    X(NODE_TYPE_EXPAND_DIMS, ConvertExpandDims) \
+    X(NODE_TYPE_FILL, ConvertFill) \
+    X(NODE_TYPE_FULL_CONNECTION, ConvertFullConnection) \
+    X(NODE_TYPE_FUSED_BATCH_NORM, ConvertFusedBatchNorm) \
+    X(NODE_TYPE_GATHER, ConvertGather) \
+    X(NODE_TYPE_LAYER_NORM_FUSION, ConvertLayerNormFusion) \
+    X(NODE_TYPE_LESS_EQUAL, ConvertLessEqual) \
+    X(NODE_TYPE_MATMUL_FUSION, ConvertMatMulFusion) \
+    X(NODE_TYPE_MAXIMUM, ConvertMaximum) \
+    X(NODE_TYPE_MAX_POOL_FUSION, ConvertMaxPoolFusion) \
+    X(NODE_TYPE_MUL_FUSION, ConvertMulFusion) \
+    X(NODE_TYPE_ONE_HOT, ConvertOneHot) \
+    X(NODE_TYPE_PAD_FUSION, ConvertPadFusion) \
+    X(NODE_TYPE_POW_FUSION, ConvertPowFusion) \
+    X(NODE_TYPE_PRELU_FUSION, ConvertPReLUFusion) \
+    X(NODE_TYPE_QUANT_DTYPE_CAST, ConvertQuantDTypeCast) \
+    X(NODE_TYPE_REDUCE_FUSION, ConvertReduceFusion) \
+    X(NODE_TYPE_RESHAPE, ConvertReshape) \
+    X(NODE_TYPE_RESIZE, ConvertResize) \
+    X(NODE_TYPE_RSQRT, ConvertRsqrt) \
+    X(NODE_TYPE_SCALE_FUSION, ConvertScaleFusion) \
+    X(NODE_TYPE_SHAPE, ConvertShape) \
+    X(NODE_TYPE_SLICE_FUSION, ConvertSliceFusion) \
+    X(NODE_TYPE_SOFTMAX, ConvertSoftmax) \
+    X(NODE_TYPE_SPACE_TO_BATCH_ND, ConvertSpaceToBatchND) \
+    X(NODE_TYPE_SPLIT, ConvertSplit) \
+    X(NODE_TYPE_SQRT, ConvertSqrt) \
+    X(NODE_TYPE_SQUARED_DIFFERENCE, ConvertSquaredDifference) \
+    X(NODE_TYPE_SQUEEZE, ConvertSqueeze) \
+    X(NODE_TYPE_STACK, ConvertStack) \
+    X(NODE_TYPE_STRIDED_SLICE, ConvertStridedSlice) \
+    X(NODE_TYPE_SUB_FUSION, ConvertSubFusion) \
+    X(NODE_TYPE_TILE_FUSION, ConvertTileFusion) \
+    X(NODE_TYPE_TOPK_FUSION, ConvertTopKFusion) \
+    X(NODE_TYPE_TRANSPOSE, ConvertTranspose) \
+    X(NODE_TYPE_UNSQUEEZE, ConvertUnsqueeze)
+
+// Node converters added in HDI v2.1.
+#define NNRT_HDI_NODE_CONVERTER_LIST_V2_1_EXTENSION(X) \
+    X(NODE_TYPE_ALL, ConvertAll) \
+    X(NODE_TYPE_ASSERT, ConvertAssert) \
+    X(NODE_TYPE_BROADCAST_TO, ConvertBroadcastTo) \
+    X(NODE_TYPE_CEIL, ConvertCeil) \
+    X(NODE_TYPE_CLIP, ConvertClip) \
+    X(NODE_TYPE_COS, ConvertCos) \
+    X(NODE_TYPE_CONSTANT_OF_SHAPE, ConvertConstantOfShape) \
+    X(NODE_TYPE_CROP, ConvertCrop) \
+    X(NODE_TYPE_DEPTH_TO_SPACE, ConvertDepthToSpace) \
+    X(NODE_TYPE_DETECTION_POST_PROCESS, ConvertDetectionPostProcess) \
+    X(NODE_TYPE_EQUAL, ConvertEqual) \
+    X(NODE_TYPE_EXPFUSION, ConvertExpFusion) \
+    X(NODE_TYPE_FLATTEN, ConvertFlatten) \
+    X(NODE_TYPE_FLOOR, ConvertFloor) \
+    X(NODE_TYPE_GATHER_ND, ConvertGatherNd) \
+    X(NODE_TYPE_GREATER, ConvertGreater) \
+    X(NODE_TYPE_GREATER_EQUAL, ConvertGreaterEqual) \
+    X(NODE_TYPE_INSTANCE_NORM, ConvertInstanceNorm) \
+    X(NODE_TYPE_LESS, ConvertLess) \
+    X(NODE_TYPE_LOG, ConvertLog) \
+    X(NODE_TYPE_LOGICAL_AND, ConvertLogicalAnd) \
+    X(NODE_TYPE_LOGICAL_NOT, ConvertLogicalNot) \
+    X(NODE_TYPE_LOGICAL_OR, ConvertLogicalOr) \
+    X(NODE_TYPE_LRN, ConvertLRN) \
+    X(NODE_TYPE_LSTM, ConvertLSTM) \
+    X(NODE_TYPE_L2_NORMALIZE_FUSION, ConvertL2NormalizeFusion) \
+    X(NODE_TYPE_MINIMUM, ConvertMinimum) \
+    X(NODE_TYPE_MOD, ConvertMod) \
+    X(NODE_TYPE_NEG, ConvertNeg) \
+    X(NODE_TYPE_NOT_EQUAL, ConvertNotEqual) \
+    X(NODE_TYPE_RANK, ConvertRank) \
+    X(NODE_TYPE_RANGE, ConvertRange) \
+    X(NODE_TYPE_RECIPROCAL, ConvertReciprocal) \
+    X(NODE_TYPE_ROUND, ConvertRound) \
+    X(NODE_TYPE_SCATTER_ND, ConvertScatterNd) \
+    X(NODE_TYPE_SIN, ConvertSin) \
+    X(NODE_TYPE_SPACE_TO_DEPTH, ConvertSpaceToDepth) \
+    X(NODE_TYPE_SPARSE_TO_DENSE, ConvertSparseToDense) \
+    X(NODE_TYPE_SQUARE, ConvertSquare) \
+    X(NODE_TYPE_UNSTACK, ConvertUnstack) \
+    X(NODE_TYPE_WHERE, ConvertWhere) \
+    X(NODE_TYPE_SELECT, ConvertSelect) \
+    X(NODE_TYPE_ERF, ConvertErf) \
+    X(NODE_TYPE_LOG_SOFTMAX, ConvertLogSoftmax)
+
+/**
+ * Returns a MessageParcel owned by the calling thread, rewound to an empty state. The parcel keeps its buffer
+ * between calls, so marshalling node attributes does not reallocate it for every node.
+ */
+inline OHOS::MessageParcel& GetReusableParcel()
+{
+    thread_local OHOS::MessageParcel parcel;
+    (void)parcel.RewindWrite(0);
+    (void)parcel.RewindRead(0);
+    return parcel;
+}
+
+/**
+ * Calls convertFunc(index) for every index in [0, total). Large ranges are split into contiguous chunks which are
+ * processed by worker threads, so convertFunc must only write to the output slot of its own index.
+ * Returns false if any call of convertFunc returns false.
+ */
+template<typename ConvertFunc>
+bool ParallelConvert(size_t total, const ConvertFunc& convertFunc)
+{
+    size_t threadNum = std::min<size_t>(std::thread::hardware_concurrency(), PARALLEL_CONVERT_MAX_THREADS);
+    if (total < PARALLEL_CONVERT_MIN_NODES || threadNum <= 1) {
+        for (size_t i = 0; i < total; ++i) {
+            if (!convertFunc(i)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::atomic<bool> isSuccess {true};
+    size_t chunkSize = (total + threadNum - 1) / threadNum;
+    auto convertChunk = [&isSuccess, &convertFunc, total, chunkSize](size_t chunkIndex) {
+        size_t end = std::min(total, (chunkIndex + 1) * chunkSize);
+        for (size_t i = chunkIndex * chunkSize; i < end && isSuccess.load(std::memory_order_relaxed); ++i) {
+            if (!convertFunc(i)) {
+                isSuccess.store(false, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    // The calling thread takes the first chunk itself, and every chunk no thread could be started for.
+    std::vector<std::thread> workers;
+    workers.reserve(threadNum - 1);
+    size_t chunkIndex = 1;
+    for (; chunkIndex < threadNum; ++chunkIndex) {
+        try {
+            workers.emplace_back(convertChunk, chunkIndex);
+        } catch (const std::system_error&) {
+            break;
+        }
+    }
+    for (; chunkIndex < threadNum; ++chunkIndex) {
+        convertChunk(chunkIndex);
+    }
+    convertChunk(0);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    return isSuccess.load();
+}
+} // NeuralNetworkRuntime
+} // OHOS
+
+#endif // NEURAL_NETWORK_RUNTIME_LITEGRAPH_TO_HDIMODEL_COMMON_H
@@ -17,6 +17,8 @@
 #include <vector>
 #include <algorithm>
 #include <sys/mman.h>
+#include "dispatch_table.h"
+#include "lite_graph_to_hdi_model_common.h"
 #include "log.h"
 #include "message_parcel.h"
 #include "nnrt/v1_0/nnrt_types.h"
@@ -44,7 +46,7 @@ std::vector<int8_t> ConvertActivation(PrimitivePtr primitive)
     activation.maxVal = mindspore::lite::MindIR_Activation_GetMaxVal(primitive);
     activation.approximate = mindspore::lite::MindIR_Activation_GetApproximate(primitive);
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)ActivationBlockMarshalling(data, activation);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -62,7 +64,7 @@ std::vector<int8_t> ConvertAddFusion(PrimitivePtr primitive)
     addFusion.activationType = static_cast<HDI::Nnrt::V1_0::ActivationType>(
         mindspore::lite::MindIR_Activation_GetActivationType(primitive));
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)AddFusionBlockMarshalling(data, addFusion);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -82,7 +84,7 @@ std::vector<int8_t> ConvertArgMaxFusion(PrimitivePtr primitive)
     argMaxFusion.keepDims = mindspore::lite::MindIR_ArgMaxFusion_GetKeepDims(primitive);
     argMaxFusion.outMaxValue = mindspore::lite::MindIR_ArgMaxFusion_GetOutMaxValue(primitive);
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)ArgMaxFusionBlockMarshalling(data, argMaxFusion);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -107,7 +109,7 @@ std::vector<int8_t> ConvertAvgPoolFusion(PrimitivePtr primitive)
     avgPoolFusion.activationType =
         static_cast<ActivationType>(mindspore::lite::MindIR_AvgPoolFusion_GetActivationType(primitive));
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)AvgPoolFusionBlockMarshalling(data, avgPoolFusion);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -125,7 +127,7 @@ std::vector<int8_t> ConvertBatchToSpaceND(PrimitivePtr primitive)
     batchToSpaceND.blockShape = mindspore::lite::MindIR_BatchToSpaceND_GetBlockShape(primitive);
     batchToSpaceND.crops = mindspore::lite::MindIR_BatchToSpaceND_GetCrops(primitive);
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)BatchToSpaceNDBlockMarshalling(data, batchToSpaceND);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -140,7 +142,7 @@ std::vector<int8_t> ConvertBiasAdd(const PrimitivePtr primitive)
     }
 
     BiasAdd biasAdd{};
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)BiasAddBlockMarshalling(data, biasAdd);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -155,7 +157,7 @@ std::vector<int8_t> ConvertCast(const PrimitivePtr primitive)
     }
 
     Cast cast{};
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)CastBlockMarshalling(data, cast);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -171,7 +173,7 @@ std::vector<int8_t> ConvertConcat(PrimitivePtr primitive)
 
     Concat concat{};
     concat.axis = mindspore::lite::MindIR_Concat_GetAxis(primitive);
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)ConcatBlockMarshalling(data, concat);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -197,7 +199,7 @@ std::vector<int8_t> ConvertConv2DFusion(PrimitivePtr primitive)
     conv2DFusion.activationType = static_cast<ActivationType>(
         mindspore::lite::MindIR_Conv2DFusion_GetActivationType(primitive));
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)Conv2DFusionBlockMarshalling(data, conv2DFusion);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -225,7 +227,7 @@ std::vector<int8_t> ConvertConv2dTransposeFusion(PrimitivePtr primitive)
         mindspore::lite::MindIR_Conv2dTransposeFusion_GetActivationType(primitive));
     conv2dTransposeFusion.outputPaddings = mindspore::lite::MindIR_Conv2dTransposeFusion_GetOutputPaddings(primitive);
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)Conv2dTransposeFusionBlockMarshalling(data, conv2dTransposeFusion);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -242,7 +244,7 @@ std::vector<int8_t> ConvertDivFusion(PrimitivePtr primitive)
     DivFusion divFusion{};
     divFusion.activationType = static_cast<ActivationType>(
         mindspore::lite::MindIR_DivFusion_GetActivationType(primitive));
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)DivFusionBlockMarshalling(data, divFusion);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -258,7 +260,7 @@ std::vector<int8_t> ConvertEltwise(PrimitivePtr primitive)
 
     Eltwise eltwise{};
     eltwise.mode = static_cast<EltwiseMode>(mindspore::lite::MindIR_Eltwise_GetMode(primitive));
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)EltwiseBlockMarshalling(data, eltwise);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -273,7 +275,7 @@ std::vector<int8_t> ConvertExpandDims(const PrimitivePtr primitive)
     }
 
     ExpandDims expandDims{};
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)ExpandDimsBlockMarshalling(data, expandDims);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -288,7 +290,7 @@ std::vector<int8_t> ConvertFill(const PrimitivePtr primitive)
     }
 
     Fill fill{};
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)FillBlockMarshalling(data, fill);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -309,7 +311,7 @@ std::vector<int8_t> ConvertFullConnection(PrimitivePtr primitive)
     fullConnection.activationType = static_cast<ActivationType>(
         mindspore::lite::MindIR_FullConnection_GetActivationType(primitive));
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)FullConnectionBlockMarshalling(data, fullConnection);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -325,7 +327,7 @@ std::vector<int8_t> ConvertFusedBatchNorm(PrimitivePtr primitive)
 
     FusedBatchNorm fusedBatchNorm{};
     fusedBatchNorm.epsilon = mindspore::lite::MindIR_FusedBatchNorm_GetEpsilon(primitive);
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)FusedBatchNormBlockMarshalling(data, fusedBatchNorm);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -340,7 +342,7 @@ std::vector<int8_t> ConvertGather(const PrimitivePtr primitive)
     }
 
     Gather gather{};
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)GatherBlockMarshalling(data, gather);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -360,7 +362,7 @@ std::vector<int8_t> ConvertLayerNormFusion(PrimitivePtr primitive)
     layerNormFusion.elementwiseAffine = mindspore::lite::MindIR_LayerNormFusion_GetElementwiseAffine(primitive);
     layerNormFusion.beginParamsAxis = mindspore::lite::MindIR_LayerNormFusion_GetBeginParamsAxis(primitive);
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)LayerNormFusionBlockMarshalling(data, layerNormFusion);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -375,7 +377,7 @@ std::vector<int8_t> ConvertLessEqual(const PrimitivePtr primitive)
     }
 
     LessEqual lessEqual{};
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)LessEqualBlockMarshalling(data, lessEqual);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -395,7 +397,7 @@ std::vector<int8_t> ConvertMatMulFusion(PrimitivePtr primitive)
     matMulFusion.activationType = static_cast<ActivationType>(
         mindspore::lite::MindIR_MatMulFusion_GetActivationType(primitive));
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)MatMulFusionBlockMarshalling(data, matMulFusion);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -410,7 +412,7 @@ std::vector<int8_t> ConvertMaximum(const PrimitivePtr primitive)
     }
 
     Maximum maximum{};
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)MaximumBlockMarshalling(data, maximum);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -434,7 +436,7 @@ std::vector<int8_t> ConvertMaxPoolFusion(PrimitivePtr primitive)
     maxPoolFusion.activationType = static_cast<ActivationType>(
         mindspore::lite::MindIR_MaxPoolFusion_GetActivationType(primitive));
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)MaxPoolFusionBlockMarshalling(data, maxPoolFusion);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -451,7 +453,7 @@ std::vector<int8_t> ConvertMulFusion(PrimitivePtr primitive)
     MulFusion mulFusion{};
     mulFusion.activationType = static_cast<ActivationType>(
         mindspore::lite::MindIR_MulFusion_GetActivationType(primitive));
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)MulFusionBlockMarshalling(data, mulFusion);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -467,7 +469,7 @@ std::vector<int8_t> ConvertOneHot(PrimitivePtr primitive)
 
     OneHot oneHot{};
     oneHot.axis = mindspore::lite::MindIR_OneHot_GetAxis(primitive);
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)OneHotBlockMarshalling(data, oneHot);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -485,7 +487,7 @@ std::vector<int8_t> ConvertPadFusion(PrimitivePtr primitive)
     padFusion.paddings = mindspore::lite::MindIR_PadFusion_GetPaddings(primitive);
     padFusion.paddingMode = static_cast<PaddingMode>(mindspore::lite::MindIR_PadFusion_GetPaddingMode(primitive));
     padFusion.constantValue = mindspore::lite::MindIR_PadFusion_GetConstantValue(primitive);
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)PadFusionBlockMarshalling(data, padFusion);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -502,7 +504,7 @@ std::vector<int8_t> ConvertPowFusion(PrimitivePtr primitive)
     PowFusion powFusion{};
     powFusion.scale = mindspore::lite::MindIR_PowFusion_GetScale(primitive);
     powFusion.shift = mindspore::lite::MindIR_PowFusion_GetShift(primitive);
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)PowFusionBlockMarshalling(data, powFusion);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -518,7 +520,7 @@ std::vector<int8_t> ConvertPReLUFusion(PrimitivePtr primitive)
 
     PReLUFusion pReLUFusion{};
     pReLUFusion.channelShared = mindspore::lite::MindIR_PReLUFusion_GetChannelShared(primitive);
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)PReLUFusionBlockMarshalling(data, pReLUFusion);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -535,7 +537,7 @@ std::vector<int8_t> ConvertQuantDTypeCast(PrimitivePtr primitive)
     QuantDTypeCast quantDTypeCast{};
     quantDTypeCast.srcT = mindspore::lite::MindIR_QuantDTypeCast_GetSrcT(primitive);
     quantDTypeCast.dstT = mindspore::lite::MindIR_QuantDTypeCast_GetDstT(primitive);
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)QuantDTypeCastBlockMarshalling(data, quantDTypeCast);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -554,7 +556,7 @@ std::vector<int8_t> ConvertReduceFusion(PrimitivePtr primitive)
     reduceFusion.mode = static_cast<ReduceMode>(mindspore::lite::MindIR_ReduceFusion_GetMode(primitive));
     reduceFusion.reduceToEnd = mindspore::lite::MindIR_ReduceFusion_GetReduceToEnd(primitive);
     reduceFusion.coeff = mindspore::lite::MindIR_ReduceFusion_GetCoeff(primitive);
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)ReduceFusionBlockMarshalling(data, reduceFusion);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -569,7 +571,7 @@ std::vector<int8_t> ConvertReshape(const PrimitivePtr primitive)
     }
 
     Reshape reshape{};
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)ReshapeBlockMarshalling(data, reshape);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -594,7 +596,7 @@ std::vector<int8_t> ConvertResize(PrimitivePtr primitive)
     resize.excludeOutside = mindspore::lite::MindIR_Resize_GetExcludeOutside(primitive);
     resize.extrapolationValue = mindspore::lite::MindIR_Resize_GetExtrapolationValue(primitive);
     resize.nearestMode = static_cast<NearestMode>(mindspore::lite::MindIR_Resize_GetNearestMode(primitive));
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)ResizeBlockMarshalling(data, resize);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -609,7 +611,7 @@ std::vector<int8_t> ConvertRsqrt(const PrimitivePtr primitive)
     }
 
     Rsqrt rsqrt{};
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)RsqrtBlockMarshalling(data, rsqrt);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -627,7 +629,7 @@ std::vector<int8_t> ConvertScaleFusion(PrimitivePtr primitive)
     scaleFusion.axis = mindspore::lite::MindIR_ScaleFusion_GetAxis(primitive);
     scaleFusion.activationType = static_cast<ActivationType>(
         mindspore::lite::MindIR_ScaleFusion_GetActivationType(primitive));
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)ScaleFusionBlockMarshalling(data, scaleFusion);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -642,7 +644,7 @@ std::vector<int8_t> ConvertShape(const PrimitivePtr primitive)
     }
 
     Shape shape{};
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)ShapeBlockMarshalling(data, shape);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -657,7 +659,7 @@ std::vector<int8_t> ConvertSliceFusion(PrimitivePtr primitive)
 
     SliceFusion sliceFusion{};
     sliceFusion.axes = mindspore::lite::MindIR_SliceFusion_GetAxes(primitive);
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)SliceFusionBlockMarshalling(data, sliceFusion);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -673,7 +675,7 @@ std::vector<int8_t> ConvertSoftmax(PrimitivePtr primitive)
 
     Softmax softmax{};
     softmax.axis = mindspore::lite::MindIR_Softmax_GetAxis(primitive);
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)SoftmaxBlockMarshalling(data, softmax);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -690,7 +692,7 @@ std::vector<int8_t> ConvertSpaceToBatchND(PrimitivePtr primitive)
     SpaceToBatchND spaceToBatchND{};
     spaceToBatchND.blockShape = mindspore::lite::MindIR_SpaceToBatchND_GetBlockShape(primitive);
     spaceToBatchND.paddings = mindspore::lite::MindIR_SpaceToBatchND_GetPaddings(primitive);
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)SpaceToBatchNDBlockMarshalling(data, spaceToBatchND);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -708,7 +710,7 @@ std::vector<int8_t> ConvertSplit(PrimitivePtr primitive)
     split.outputNum = mindspore::lite::MindIR_Split_GetOutputNum(primitive);
     split.sizeSplits = mindspore::lite::MindIR_Split_GetSizeSplits(primitive);
     split.axis = mindspore::lite::MindIR_Split_GetAxis(primitive);
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)SplitBlockMarshalling(data, split);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -723,7 +725,7 @@ std::vector<int8_t> ConvertSqrt(const PrimitivePtr primitive)
     }
 
     Sqrt sqrt{};
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)SqrtBlockMarshalling(data, sqrt);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -737,7 +739,7 @@ std::vector<int8_t> ConvertSquaredDifference(const PrimitivePtr primitive)
     }
 
     SquaredDifference squaredDifference{};
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)SquaredDifferenceBlockMarshalling(data, squaredDifference);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -753,7 +755,7 @@ std::vector<int8_t> ConvertSqueeze(PrimitivePtr primitive)
 
     Squeeze squeeze{};
     squeeze.axis = mindspore::lite::MindIR_Squeeze_GetAxis(primitive);
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)SqueezeBlockMarshalling(data, squeeze);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -769,7 +771,7 @@ std::vector<int8_t> ConvertStack(PrimitivePtr primitive)
 
     Stack stack{};
     stack.axis = mindspore::lite::MindIR_Stack_GetAxis(primitive);
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)StackBlockMarshalling(data, stack);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -789,7 +791,7 @@ std::vector<int8_t> ConvertStridedSlice(PrimitivePtr primitive)
     stridedSlice.ellipsisMask = mindspore::lite::MindIR_StridedSlice_GetEllipsisMask(primitive);
     stridedSlice.newAxisMask = mindspore::lite::MindIR_StridedSlice_GetNewAxisMask(primitive);
     stridedSlice.shrinkAxisMask = mindspore::lite::MindIR_StridedSlice_GetShrinkAxisMask(primitive);
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)StridedSliceBlockMarshalling(data, stridedSlice);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -806,7 +808,7 @@ std::vector<int8_t> ConvertSubFusion(PrimitivePtr primitive)
     SubFusion subFusion{};
     subFusion.activationType = static_cast<ActivationType>(
         mindspore::lite::MindIR_SubFusion_GetActivationType(primitive));
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)SubFusionBlockMarshalling(data, subFusion);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -822,7 +824,7 @@ std::vector<int8_t> ConvertTileFusion(PrimitivePtr primitive)
 
     TileFusion tileFusion{};
     tileFusion.dims = mindspore::lite::MindIR_TileFusion_GetDims(primitive);
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)TileFusionBlockMarshalling(data, tileFusion);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -839,7 +841,7 @@ std::vector<int8_t> ConvertTopKFusion(PrimitivePtr primitive)
     TopKFusion topKFusion{};
     topKFusion.sorted = mindspore::lite::MindIR_TopKFusion_GetSorted(primitive);
     topKFusion.axis = mindspore::lite::MindIR_TopKFusion_GetAxis(primitive);
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)TopKFusionBlockMarshalling(data, topKFusion);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -854,7 +856,7 @@ std::vector<int8_t> ConvertTranspose(const PrimitivePtr primitive)
     }
 
     Transpose transpose{};
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)TransposeBlockMarshalling(data, transpose);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -870,67 +872,31 @@ std::vector<int8_t> ConvertUnsqueeze(PrimitivePtr primitive)
 
     Unsqueeze unsqueeze{};
     unsqueeze.axis = mindspore::lite::MindIR_Unsqueeze_GetAxis(primitive);
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)UnsqueezeBlockMarshalling(data, unsqueeze);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
     return ret;
 }
 
-std::unordered_map<NodeType, std::vector<int8_t>(*)(PrimitivePtr)> convertOpMap = {
-    {NODE_TYPE_ACTIVATION, &ConvertActivation},
-    {NODE_TYPE_ADD_FUSION, &ConvertAddFusion},
-    {NODE_TYPE_ARGMAX_FUSION, &ConvertArgMaxFusion},
-    {NODE_TYPE_AVGPOOL_FUSION, &ConvertAvgPoolFusion},
-    {NODE_TYPE_BATCH_TO_SPACE_ND, &ConvertBatchToSpaceND},
-    {NODE_TYPE_BIAS_ADD, &ConvertBiasAdd},
-    {NODE_TYPE_CAST, &ConvertCast},
-    {NODE_TYPE_CONCAT, &ConvertConcat},
-    {NODE_TYPE_CONV2D_FUSION, &ConvertConv2DFusion},
-    {NODE_TYPE_CONV2D_TRANSPOSE_FUSION, &ConvertConv2dTransposeFusion},
-    {NODE_TYPE_DIV_FUSION, &ConvertDivFusion},
-    {NODE_TYPE_ELTWISE, &ConvertEltwise},
-    {NODE_TYPE_EXPAND_DIMS, &ConvertExpandDims},
-    {NODE_TYPE_FILL, &ConvertFill},
-    {NODE_TYPE_FULL_CONNECTION, &ConvertFullConnection},
-    {NODE_TYPE_FUSED_BATCH_NORM, &ConvertFusedBatchNorm},
-    {NODE_TYPE_GATHER, &ConvertGather},
-    {NODE_TYPE_LAYER_NORM_FUSION, &ConvertLayerNormFusion},
-    {NODE_TYPE_LESS_EQUAL, &ConvertLessEqual},
-    {NODE_TYPE_MATMUL_FUSION, &ConvertMatMulFusion},
-    {NODE_TYPE_MAXIMUM, &ConvertMaximum},
-    {NODE_TYPE_MAX_POOL_FUSION, &ConvertMaxPoolFusion},
-    {NODE_TYPE_MUL_FUSION, &ConvertMulFusion},
-    {NODE_TYPE_ONE_HOT, &ConvertOneHot},
-    {NODE_TYPE_PAD_FUSION, &ConvertPadFusion},
-    {NODE_TYPE_POW_FUSION, &ConvertPowFusion},
-    {NODE_TYPE_PRELU_FUSION, &ConvertPReLUFusion},
-    {NODE_TYPE_QUANT_DTYPE_CAST, &ConvertQuantDTypeCast},
-    {NODE_TYPE_REDUCE_FUSION, &ConvertReduceFusion},
-    {NODE_TYPE_RESHAPE, &ConvertReshape},
-    {NODE_TYPE_RESIZE, &ConvertResize},
-    {NODE_TYPE_RSQRT, &ConvertRsqrt},
-    {NODE_TYPE_SCALE_FUSION, &ConvertScaleFusion},
-    {NODE_TYPE_SHAPE, &ConvertShape},
-    {NODE_TYPE_SLICE_FUSION, &ConvertSliceFusion},
-    {NODE_TYPE_SOFTMAX, &ConvertSoftmax},
-    {NODE_TYPE_SPACE_TO_BATCH_ND, &ConvertSpaceToBatchND},
-    {NODE_TYPE_SPLIT, &ConvertSplit},
-    {NODE_TYPE_SQRT, &ConvertSqrt},
-    {NODE_TYPE_SQUARED_DIFFERENCE, &ConvertSquaredDifference},
-    {NODE_TYPE_SQUEEZE, &ConvertSqueeze},
-    {NODE_TYPE_STACK, &ConvertStack},
-    {NODE_TYPE_STRIDED_SLICE, &ConvertStridedSlice},
-    {NODE_TYPE_SUB_FUSION, &ConvertSubFusion},
-    {NODE_TYPE_TILE_FUSION, &ConvertTileFusion},
-    {NODE_TYPE_TOPK_FUSION, &ConvertTopKFusion},
-    {NODE_TYPE_TRANSPOSE, &ConvertTranspose},
-    {NODE_TYPE_UNSQUEEZE, &ConvertUnsqueeze}};
+using ConvertFunc = std::vector<int8_t>(*)(const PrimitivePtr);
+#define NNRT_HDI_NODE_CONVERTER_LIST(X) NNRT_HDI_NODE_CONVERTER_LIST_V1(X)
+constexpr size_t CONVERT_TABLE_SIZE = NNRT_DISPATCH_TABLE_SIZE(NNRT_HDI_NODE_CONVERTER_LIST);
+
+constexpr DispatchTable<ConvertFunc, CONVERT_TABLE_SIZE> BuildConvertTable()
+{
+    DispatchTable<ConvertFunc, CONVERT_TABLE_SIZE> table {};
+    NNRT_HDI_NODE_CONVERTER_LIST(NNRT_DISPATCH_SET)
+    return table;
+}
+
+constexpr DispatchTable<ConvertFunc, CONVERT_TABLE_SIZE> CONVERT_TABLE = BuildConvertTable();
 
 std::vector<int8_t> Convert(NodeType type, PrimitivePtr primitive)
 {
-    if (convertOpMap.find(type) != convertOpMap.end()) {
-        return convertOpMap[type](primitive);
+    ConvertFunc convertFunc = CONVERT_TABLE.Find(static_cast<size_t>(type));
+    if (convertFunc != nullptr) {
+        return convertFunc(primitive);
     }
     LOGE("MindIR_LiteGraph_To_Model v1_0 failed, nodeType invalid, type =%d", type);
     return {};
@@ -945,6 +911,7 @@ inline std::vector<OHOS::HDI::Nnrt::V1_0::QuantParam> MindIR_Tensor_GetQuantPara
             return {};
         }
         size_t size = src.size();
+        result.reserve(size);
         for (size_t i = 0; i < size; i++) {
             OHOS::HDI::Nnrt::V1_0::QuantParam quantParam{src[i].numBits, src[i].zeroPoint, src[i].scale};
             result.emplace_back(quantParam);
@@ -1010,23 +977,29 @@ OHOS::HDI::Nnrt::V1_0::Model *LiteGraph_To_HDIModel(const mindspore::lite::LiteG
     std::vector<OHOS::HDI::Nnrt::V1_0::SubGraph> subGraph;
 
     // nodes
-    for (auto node : liteGraph->all_nodes_) {
+    const auto &liteNodes = liteGraph->all_nodes_;
+    nodes.resize(liteNodes.size());
+    auto convertNode = [&liteNodes, &nodes](size_t index) -> bool {
+        auto node = liteNodes[index];
         if (node == nullptr) {
             LOGE("MindIR_LiteGraph_To_Model v1 failed, node is nullptr.");
-            return nullptr;
+            return false;
         }
-        OHOS::HDI::Nnrt::V1_0::Node tmp;
-        tmp.name = node->name_;
         if (node->primitive_ == nullptr) {
             LOGE("MindIR_LiteGraph_To_Model v1 failed, node primitive is nullptr.");
-            return nullptr;
+            return false;
         }
+        OHOS::HDI::Nnrt::V1_0::Node &tmp = nodes[index];
+        tmp.name = node->name_;
         tmp.nodeType = static_cast<NodeType>(mindspore::lite::MindIR_Primitive_GetType(node->primitive_));
         tmp.nodeAttr = Convert(tmp.nodeType, node->primitive_);
         tmp.inputIndex = node->input_indices_;
         tmp.outputIndex = node->output_indices_;
         tmp.quantType = static_cast<QuantType>(node->quant_type_);
-        nodes.emplace_back(tmp);
+        return true;
+    };
+    if (!ParallelConvert(liteNodes.size(), convertNode)) {
+        return nullptr;
     }
 
     // Tensor
@@ -1040,6 +1013,7 @@ OHOS::HDI::Nnrt::V1_0::Model *LiteGraph_To_HDIModel(const mindspore::lite::LiteG
             return nullptr;
         }
     }
+    allTensors.reserve(liteGraph->all_tensors_.size());
     for (auto tensor : liteGraph->all_tensors_) {
         OHOS::HDI::Nnrt::V1_0::Tensor tmp;
         tmp.name = mindspore::lite::MindIR_Tensor_GetName(tensor);
@@ -1048,8 +1022,8 @@ OHOS::HDI::Nnrt::V1_0::Model *LiteGraph_To_HDIModel(const mindspore::lite::LiteG
         tmp.format = static_cast<Format>(mindspore::lite::MindIR_Tensor_GetFormat(tensor));
         tmp.data = Copy_MindIR_Tensor_Data_To_HDIBuffer(tensor, buffer, mmapPtr, tensorBufferOffset);
         tmp.quantParams = MindIR_Tensor_GetQuantParams_OHOS(tensor);
-        allTensors.emplace_back(tmp);
         tensorBufferOffset = tmp.data.offset + tmp.data.dataSize;
+        allTensors.emplace_back(std::move(tmp));
     }
     if (buffer.fd != -1) {
         auto munmapRes = munmap(mmapPtr, buffer.bufferSize);
@@ -1060,13 +1034,14 @@ OHOS::HDI::Nnrt::V1_0::Model *LiteGraph_To_HDIModel(const mindspore::lite::LiteG
     }
 
     // SubGraph
+    subGraph.reserve(liteGraph->sub_graphs_.size());
     for (auto graph : liteGraph->sub_graphs_) {
         OHOS::HDI::Nnrt::V1_0::SubGraph tmp;
         tmp.name = graph->name_;
         tmp.inputIndices = std::vector<uint32_t>(graph->input_indices_);
         tmp.outputIndices = std::vector<uint32_t>(graph->output_indices_);
         tmp.nodeIndices = std::vector<uint32_t>(graph->node_indices_);
-        subGraph.emplace_back(tmp);
+        subGraph.emplace_back(std::move(tmp));
     }
 
     auto *retModel = new (std::nothrow) Model();
@@ -1077,9 +1052,9 @@ OHOS::HDI::Nnrt::V1_0::Model *LiteGraph_To_HDIModel(const mindspore::lite::LiteG
     retModel->name = liteGraph->name_;
     retModel->inputIndex = liteGraph->input_indices_;
     retModel->outputIndex = liteGraph->output_indices_;
-    retModel->nodes = nodes;
-    retModel->allTensors = allTensors;
-    retModel->subGraph = subGraph;
+    retModel->nodes = std::move(nodes);
+    retModel->allTensors = std::move(allTensors);
+    retModel->subGraph = std::move(subGraph);
     return retModel;
 }
 
@@ -17,6 +17,8 @@
 #include <vector>
 #include <algorithm>
 #include <sys/mman.h>
+#include "dispatch_table.h"
+#include "lite_graph_to_hdi_model_common.h"
 #include "log.h"
 #include "message_parcel.h"
 #include "nnrt/v2_1/nnrt_types.h"
@@ -44,7 +46,7 @@ std::vector<int8_t> ConvertActivation(const PrimitivePtr primitive)
     activation.maxVal = mindspore::lite::MindIR_Activation_GetMaxVal(primitive);
     activation.approximate = mindspore::lite::MindIR_Activation_GetApproximate(primitive);
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)ActivationBlockMarshalling(data, activation);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -62,7 +64,7 @@ std::vector<int8_t> ConvertAddFusion(const PrimitivePtr primitive)
     addFusion.activationType = static_cast<HDI::Nnrt::V2_1::ActivationType>(
         mindspore::lite::MindIR_Activation_GetActivationType(primitive));
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)AddFusionBlockMarshalling(data, addFusion);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -79,7 +81,7 @@ std::vector<int8_t> ConvertAll(const PrimitivePtr primitive)
     All all{};
     all.keepDims = mindspore::lite::MindIR_All_GetKeepDims(primitive);
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)AllBlockMarshalling(data, all);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -99,7 +101,7 @@ std::vector<int8_t> ConvertArgMaxFusion(const PrimitivePtr primitive)
     argMaxFusion.keepDims = mindspore::lite::MindIR_ArgMaxFusion_GetKeepDims(primitive);
     argMaxFusion.outMaxValue = mindspore::lite::MindIR_ArgMaxFusion_GetOutMaxValue(primitive);
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)ArgMaxFusionBlockMarshalling(data, argMaxFusion);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -116,7 +118,7 @@ std::vector<int8_t> ConvertAssert(const PrimitivePtr primitive)
     Assert assert{};
     assert.summarize = mindspore::lite::MindIR_Assert_GetSummarize(primitive);
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)AssertBlockMarshalling(data, assert);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -141,7 +143,7 @@ std::vector<int8_t> ConvertAvgPoolFusion(const PrimitivePtr primitive)
     avgPoolFusion.activationType =
         static_cast<ActivationType>(mindspore::lite::MindIR_AvgPoolFusion_GetActivationType(primitive));
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)AvgPoolFusionBlockMarshalling(data, avgPoolFusion);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -159,7 +161,7 @@ std::vector<int8_t> ConvertBatchToSpaceND(const PrimitivePtr primitive)
     batchToSpaceND.blockShape = mindspore::lite::MindIR_BatchToSpaceND_GetBlockShape(primitive);
     batchToSpaceND.crops = mindspore::lite::MindIR_BatchToSpaceND_GetCrops(primitive);
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)BatchToSpaceNDBlockMarshalling(data, batchToSpaceND);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -174,7 +176,7 @@ std::vector<int8_t> ConvertBiasAdd(const PrimitivePtr primitive)
     }
 
     BiasAdd biasAdd{};
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)BiasAddBlockMarshalling(data, biasAdd);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -191,7 +193,7 @@ std::vector<int8_t> ConvertBroadcastTo(const PrimitivePtr primitive)
     BroadcastTo broadcastTo{};
     broadcastTo.shape = mindspore::lite::MindIR_BroadcastTo_GetShape(primitive);
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)BroadcastToBlockMarshalling(data, broadcastTo);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -206,7 +208,7 @@ std::vector<int8_t> ConvertCast(const PrimitivePtr primitive)
     }
 
     Cast cast{};
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)CastBlockMarshalling(data, cast);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -221,7 +223,7 @@ std::vector<int8_t> ConvertCeil(const PrimitivePtr primitive)
     }
 
     Ceil ceil{};
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)CeilBlockMarshalling(data, ceil);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -239,7 +241,7 @@ std::vector<int8_t> ConvertClip(const PrimitivePtr primitive)
     clip.max = mindspore::lite::MindIR_Clip_GetMax(primitive);
     clip.min = mindspore::lite::MindIR_Clip_GetMin(primitive);
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)ClipBlockMarshalling(data, clip);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -255,7 +257,7 @@ std::vector<int8_t> ConvertConcat(const PrimitivePtr primitive)
 
     Concat concat{};
     concat.axis = mindspore::lite::MindIR_Concat_GetAxis(primitive);
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)ConcatBlockMarshalling(data, concat);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -281,7 +283,7 @@ std::vector<int8_t> ConvertConv2DFusion(const PrimitivePtr primitive)
     conv2DFusion.activationType = static_cast<ActivationType>(
         mindspore::lite::MindIR_Conv2DFusion_GetActivationType(primitive));
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)Conv2DFusionBlockMarshalling(data, conv2DFusion);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -309,7 +311,7 @@ std::vector<int8_t> ConvertConv2dTransposeFusion(const PrimitivePtr primitive)
         mindspore::lite::MindIR_Conv2dTransposeFusion_GetActivationType(primitive));
     conv2dTransposeFusion.outputPaddings = mindspore::lite::MindIR_Conv2dTransposeFusion_GetOutputPaddings(primitive);
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)Conv2dTransposeFusionBlockMarshalling(data, conv2dTransposeFusion);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -325,7 +327,7 @@ std::vector<int8_t> ConvertCos(const PrimitivePtr primitive)
 
     Cos cos{};
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)CosBlockMarshalling(data, cos);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -343,7 +345,7 @@ std::vector<int8_t> ConvertConstantOfShape(const PrimitivePtr primitive)
     constantOfShape.dataType = mindspore::lite::MindIR_ConstantOfShape_GetDataType(primitive);
     constantOfShape.value = mindspore::lite::MindIR_ConstantOfShape_GetValue(primitive);
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)ConstantOfShapeBlockMarshalling(data, constantOfShape);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -361,7 +363,7 @@ std::vector<int8_t> ConvertCrop(const PrimitivePtr primitive)
     crop.axis = mindspore::lite::MindIR_Crop_GetAxis(primitive);
     crop.offset = mindspore::lite::MindIR_Crop_GetOffsets(primitive);
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)CropBlockMarshalling(data, crop);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -381,7 +383,7 @@ std::vector<int8_t> ConvertDepthToSpace(const PrimitivePtr primitive)
         mindspore::lite::MindIR_DepthToSpace_GetFormat(primitive));
     depthToSpace.mode = mindspore::lite::MindIR_DepthToSpace_GetMode(primitive);
     
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)DepthToSpaceBlockMarshalling(data, depthToSpace);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -412,7 +414,7 @@ std::vector<int8_t> ConvertDetectionPostProcess(const PrimitivePtr primitive)
     detectionPostProcess.useRegularNms = mindspore::lite::MindIR_DetectionPostProcess_GetUseRegularNms(primitive);
     detectionPostProcess.outQuantized = mindspore::lite::MindIR_DetectionPostProcess_GetOutQuantized(primitive);
     
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)DetectionPostProcessBlockMarshalling(data, detectionPostProcess);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -429,7 +431,7 @@ std::vector<int8_t> ConvertDivFusion(const PrimitivePtr primitive)
     DivFusion divFusion{};
     divFusion.activationType = static_cast<ActivationType>(
         mindspore::lite::MindIR_DivFusion_GetActivationType(primitive));
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)DivFusionBlockMarshalling(data, divFusion);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -445,7 +447,7 @@ std::vector<int8_t> ConvertEltwise(const PrimitivePtr primitive)
 
     Eltwise eltwise{};
     eltwise.mode = static_cast<EltwiseMode>(mindspore::lite::MindIR_Eltwise_GetMode(primitive));
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)EltwiseBlockMarshalling(data, eltwise);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -460,7 +462,7 @@ std::vector<int8_t> ConvertEqual(const PrimitivePtr primitive)
     }
 
     Equal equal{};
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)EqualBlockMarshalling(data, equal);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -479,7 +481,7 @@ std::vector<int8_t> ConvertExpFusion(const PrimitivePtr primitive)
     exp.scale = mindspore::lite::MindIR_ExpFusion_GetScale(primitive);
     exp.shift = mindspore::lite::MindIR_ExpFusion_GetShift(primitive);
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)ExpFusionBlockMarshalling(data, exp);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -494,7 +496,7 @@ std::vector<int8_t> ConvertExpandDims(const PrimitivePtr primitive)
     }
 
     ExpandDims expandDims{};
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)ExpandDimsBlockMarshalling(data, expandDims);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -511,7 +513,7 @@ std::vector<int8_t> ConvertFlatten(const PrimitivePtr primitive)
     Flatten faltten{};
     faltten.axis = mindspore::lite::MindIR_Flatten_GetAxis(primitive);
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)FlattenBlockMarshalling(data, faltten);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -527,7 +529,7 @@ std::vector<int8_t> ConvertFloor(const PrimitivePtr primitive)
 
     Floor floor{};
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)FloorBlockMarshalling(data, floor);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -542,7 +544,7 @@ std::vector<int8_t> ConvertFill(const PrimitivePtr primitive)
     }
 
     Fill fill{};
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)FillBlockMarshalling(data, fill);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -563,7 +565,7 @@ std::vector<int8_t> ConvertFullConnection(const PrimitivePtr primitive)
     fullConnection.activationType = static_cast<ActivationType>(
         mindspore::lite::MindIR_FullConnection_GetActivationType(primitive));
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)FullConnectionBlockMarshalling(data, fullConnection);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -579,7 +581,7 @@ std::vector<int8_t> ConvertFusedBatchNorm(const PrimitivePtr primitive)
 
     FusedBatchNorm fusedBatchNorm{};
     fusedBatchNorm.epsilon = mindspore::lite::MindIR_FusedBatchNorm_GetEpsilon(primitive);
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)FusedBatchNormBlockMarshalling(data, fusedBatchNorm);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -594,7 +596,7 @@ std::vector<int8_t> ConvertGather(const PrimitivePtr primitive)
     }
 
     Gather gather{};
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)GatherBlockMarshalling(data, gather);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -609,7 +611,7 @@ std::vector<int8_t> ConvertGatherNd(const PrimitivePtr primitive)
     }
 
     GatherNd gatherNd{};
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)GatherNdBlockMarshalling(data, gatherNd);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -624,7 +626,7 @@ std::vector<int8_t> ConvertGreater(const PrimitivePtr primitive)
     }
 
     Greater greater{};
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)GreaterBlockMarshalling(data, greater);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -639,7 +641,7 @@ std::vector<int8_t> ConvertGreaterEqual(const PrimitivePtr primitive)
     }
 
     GreaterEqual greaterEqual{};
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)GreaterEqualBlockMarshalling(data, greaterEqual);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -656,7 +658,7 @@ std::vector<int8_t> ConvertInstanceNorm(const PrimitivePtr primitive)
     InstanceNorm instanceNorm{};
     instanceNorm.epsilon = mindspore::lite::MindIR_InstanceNorm_GetEpsilon(primitive);
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)InstanceNormBlockMarshalling(data, instanceNorm);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -676,7 +678,7 @@ std::vector<int8_t> ConvertLayerNormFusion(const PrimitivePtr primitive)
     layerNormFusion.elementwiseAffine = mindspore::lite::MindIR_LayerNormFusion_GetElementwiseAffine(primitive);
     layerNormFusion.beginParamsAxis = mindspore::lite::MindIR_LayerNormFusion_GetBeginParamsAxis(primitive);
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)LayerNormFusionBlockMarshalling(data, layerNormFusion);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -691,7 +693,7 @@ std::vector<int8_t> ConvertLess(const PrimitivePtr primitive)
     }
 
     Less less{};
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)LessBlockMarshalling(data, less);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -706,7 +708,7 @@ std::vector<int8_t> ConvertLessEqual(const PrimitivePtr primitive)
     }
 
     LessEqual lessEqual{};
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)LessEqualBlockMarshalling(data, lessEqual);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -722,7 +724,7 @@ std::vector<int8_t> ConvertLog(const PrimitivePtr primitive)
 
     Log log{};
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)LogBlockMarshalling(data, log);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -738,7 +740,7 @@ std::vector<int8_t> ConvertLogicalAnd(const PrimitivePtr primitive)
 
     LogicalAnd logicalAnd{};
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)LogicalAndBlockMarshalling(data, logicalAnd);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -754,7 +756,7 @@ std::vector<int8_t> ConvertLogicalNot(const PrimitivePtr primitive)
 
     LogicalNot logicalNot{};
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)LogicalNotBlockMarshalling(data, logicalNot);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -770,7 +772,7 @@ std::vector<int8_t> ConvertLogicalOr(const PrimitivePtr primitive)
 
     LogicalOr logicalOr{};
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)LogicalOrBlockMarshalling(data, logicalOr);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -791,7 +793,7 @@ std::vector<int8_t> ConvertLRN(const PrimitivePtr primitive)
     lrn.beta = mindspore::lite::MindIR_LRN_GetBeta(primitive);
     lrn.normRegion = mindspore::lite::MindIR_LRN_GetNormRegion(primitive);
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)LRNBlockMarshalling(data, lrn);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -817,7 +819,7 @@ std::vector<int8_t> ConvertLSTM(const PrimitivePtr primitive)
     lstm.zoneoutHidden = mindspore::lite::MindIR_LSTM_GetZoneoutHidden(primitive);
     lstm.projSize = mindspore::lite::MindIR_LSTM_GetProjSize(primitive);
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)LSTMBlockMarshalling(data, lstm);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -837,7 +839,7 @@ std::vector<int8_t> ConvertL2NormalizeFusion(const PrimitivePtr primitive)
     l2NormalizeFusion.activationType = static_cast<ActivationType>(
         mindspore::lite::MindIR_L2NormalizeFusion_GetActivationType(primitive));
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)L2NormalizeFusionBlockMarshalling(data, l2NormalizeFusion);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -857,7 +859,7 @@ std::vector<int8_t> ConvertMatMulFusion(const PrimitivePtr primitive)
     matMulFusion.activationType = static_cast<ActivationType>(
         mindspore::lite::MindIR_MatMulFusion_GetActivationType(primitive));
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)MatMulFusionBlockMarshalling(data, matMulFusion);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -872,7 +874,7 @@ std::vector<int8_t> ConvertMaximum(const PrimitivePtr primitive)
     }
 
     Maximum maximum{};
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)MaximumBlockMarshalling(data, maximum);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -897,7 +899,7 @@ std::vector<int8_t> ConvertMaxPoolFusion(const PrimitivePtr primitive)
     maxPoolFusion.activationType = static_cast<ActivationType>(
         mindspore::lite::MindIR_MaxPoolFusion_GetActivationType(primitive));
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)MaxPoolFusionBlockMarshalling(data, maxPoolFusion);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -913,7 +915,7 @@ std::vector<int8_t> ConvertMinimum(const PrimitivePtr primitive)
 
     Minimum minimum{};
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)MinimumBlockMarshalling(data, minimum);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -929,7 +931,7 @@ std::vector<int8_t> ConvertMod(const PrimitivePtr primitive)
 
     Mod mod{};
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)ModBlockMarshalling(data, mod);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -946,7 +948,7 @@ std::vector<int8_t> ConvertMulFusion(const PrimitivePtr primitive)
     MulFusion mulFusion{};
     mulFusion.activationType = static_cast<ActivationType>(
         mindspore::lite::MindIR_MulFusion_GetActivationType(primitive));
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)MulFusionBlockMarshalling(data, mulFusion);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -962,7 +964,7 @@ std::vector<int8_t> ConvertNeg(const PrimitivePtr primitive)
 
     Neg neg{};
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)NegBlockMarshalling(data, neg);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -978,7 +980,7 @@ std::vector<int8_t> ConvertNotEqual(const PrimitivePtr primitive)
 
     NotEqual notEqual{};
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)NotEqualBlockMarshalling(data, notEqual);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -994,7 +996,7 @@ std::vector<int8_t> ConvertOneHot(const PrimitivePtr primitive)
 
     OneHot oneHot{};
     oneHot.axis = mindspore::lite::MindIR_OneHot_GetAxis(primitive);
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)OneHotBlockMarshalling(data, oneHot);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -1012,7 +1014,7 @@ std::vector<int8_t> ConvertPadFusion(const PrimitivePtr primitive)
     padFusion.paddings = mindspore::lite::MindIR_PadFusion_GetPaddings(primitive);
     padFusion.paddingMode = static_cast<PaddingMode>(mindspore::lite::MindIR_PadFusion_GetPaddingMode(primitive));
     padFusion.constantValue = mindspore::lite::MindIR_PadFusion_GetConstantValue(primitive);
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)PadFusionBlockMarshalling(data, padFusion);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -1029,7 +1031,7 @@ std::vector<int8_t> ConvertPowFusion(const PrimitivePtr primitive)
     PowFusion powFusion{};
     powFusion.scale = mindspore::lite::MindIR_PowFusion_GetScale(primitive);
     powFusion.shift = mindspore::lite::MindIR_PowFusion_GetShift(primitive);
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)PowFusionBlockMarshalling(data, powFusion);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -1045,7 +1047,7 @@ std::vector<int8_t> ConvertPReLUFusion(const PrimitivePtr primitive)
 
     PReLUFusion pReLUFusion{};
     pReLUFusion.channelShared = mindspore::lite::MindIR_PReLUFusion_GetChannelShared(primitive);
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)PReLUFusionBlockMarshalling(data, pReLUFusion);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -1064,7 +1066,7 @@ std::vector<int8_t> ConvertQuantDTypeCast(const PrimitivePtr primitive)
     quantDTypeCast.dstT = mindspore::lite::MindIR_QuantDTypeCast_GetDstT(primitive);
     quantDTypeCast.axis = mindspore::lite::MindIR_QuantDTypeCast_GetAxis(primitive);
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)QuantDTypeCastV2BlockMarshalling(data, quantDTypeCast);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -1080,7 +1082,7 @@ std::vector<int8_t> ConvertRank(const PrimitivePtr primitive)
 
     Rank rank{};
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)RankBlockMarshalling(data, rank);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -1100,7 +1102,7 @@ std::vector<int8_t> ConvertRange(const PrimitivePtr primitive)
     range.limit = mindspore::lite::MindIR_Range_GetLimit(primitive);
     range.delta = mindspore::lite::MindIR_Range_GetDelta(primitive);
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)RangeBlockMarshalling(data, range);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -1116,7 +1118,7 @@ std::vector<int8_t> ConvertReciprocal(const PrimitivePtr primitive)
 
     Reciprocal reciprocal{};
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)ReciprocalBlockMarshalling(data, reciprocal);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -1135,7 +1137,7 @@ std::vector<int8_t> ConvertReduceFusion(const PrimitivePtr primitive)
     reduceFusion.mode = static_cast<ReduceMode>(mindspore::lite::MindIR_ReduceFusion_GetMode(primitive));
     reduceFusion.reduceToEnd = mindspore::lite::MindIR_ReduceFusion_GetReduceToEnd(primitive);
     reduceFusion.coeff = mindspore::lite::MindIR_ReduceFusion_GetCoeff(primitive);
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)ReduceFusionBlockMarshalling(data, reduceFusion);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -1150,7 +1152,7 @@ std::vector<int8_t> ConvertReshape(const PrimitivePtr primitive)
     }
 
     Reshape reshape{};
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)ReshapeBlockMarshalling(data, reshape);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -1175,7 +1177,7 @@ std::vector<int8_t> ConvertResize(const PrimitivePtr primitive)
     resize.excludeOutside = mindspore::lite::MindIR_Resize_GetExcludeOutside(primitive);
     resize.extrapolationValue = mindspore::lite::MindIR_Resize_GetExtrapolationValue(primitive);
     resize.nearestMode = static_cast<NearestMode>(mindspore::lite::MindIR_Resize_GetNearestMode(primitive));
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)ResizeBlockMarshalling(data, resize);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -1191,7 +1193,7 @@ std::vector<int8_t> ConvertRound(const PrimitivePtr primitive)
  
     Round round{};
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)RoundBlockMarshalling(data, round);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -1206,7 +1208,7 @@ std::vector<int8_t> ConvertRsqrt(const PrimitivePtr primitive)
     }
 
     Rsqrt rsqrt{};
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)RsqrtBlockMarshalling(data, rsqrt);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -1224,7 +1226,7 @@ std::vector<int8_t> ConvertScaleFusion(const PrimitivePtr primitive)
     scaleFusion.axis = mindspore::lite::MindIR_ScaleFusion_GetAxis(primitive);
     scaleFusion.activationType = static_cast<ActivationType>(
         mindspore::lite::MindIR_ScaleFusion_GetActivationType(primitive));
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)ScaleFusionBlockMarshalling(data, scaleFusion);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -1240,7 +1242,7 @@ std::vector<int8_t> ConvertScatterNd(const PrimitivePtr primitive)
 
     ScatterNd scatterNd{};
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)ScatterNdBlockMarshalling(data, scatterNd);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -1255,7 +1257,7 @@ std::vector<int8_t> ConvertShape(const PrimitivePtr primitive)
     }
 
     Shape shape{};
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)ShapeBlockMarshalling(data, shape);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -1271,7 +1273,7 @@ std::vector<int8_t> ConvertSin(const PrimitivePtr primitive)
 
     Sin sin{};
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)SinBlockMarshalling(data, sin);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -1287,7 +1289,7 @@ std::vector<int8_t> ConvertSliceFusion(const PrimitivePtr primitive)
 
     SliceFusion sliceFusion{};
     sliceFusion.axes = mindspore::lite::MindIR_SliceFusion_GetAxes(primitive);
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)SliceFusionBlockMarshalling(data, sliceFusion);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -1303,7 +1305,7 @@ std::vector<int8_t> ConvertSoftmax(const PrimitivePtr primitive)
 
     Softmax softmax{};
     softmax.axis = mindspore::lite::MindIR_Softmax_GetAxis(primitive);
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)SoftmaxBlockMarshalling(data, softmax);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -1320,7 +1322,7 @@ std::vector<int8_t> ConvertSpaceToBatchND(const PrimitivePtr primitive)
     SpaceToBatchND spaceToBatchND{};
     spaceToBatchND.blockShape = mindspore::lite::MindIR_SpaceToBatchND_GetBlockShape(primitive);
     spaceToBatchND.paddings = mindspore::lite::MindIR_SpaceToBatchND_GetPaddings(primitive);
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)SpaceToBatchNDBlockMarshalling(data, spaceToBatchND);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -1338,7 +1340,7 @@ std::vector<int8_t> ConvertSpaceToDepth(const PrimitivePtr primitive)
     spaceToDepth.format = static_cast<Format>(mindspore::lite::MindIR_SpaceToDepth_GetFormat(primitive));
     spaceToDepth.blockSize = mindspore::lite::MindIR_SpaceToDepth_GetBlockSize(primitive);
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)SpaceToDepthBlockMarshalling(data, spaceToDepth);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -1353,7 +1355,7 @@ std::vector<int8_t> ConvertSparseToDense(const PrimitivePtr primitive)
     }
 
     SparseToDense sparseToDense{};
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)SparseToDenseBlockMarshalling(data, sparseToDense);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -1371,7 +1373,7 @@ std::vector<int8_t> ConvertSplit(const PrimitivePtr primitive)
     split.outputNum = mindspore::lite::MindIR_Split_GetOutputNum(primitive);
     split.sizeSplits = mindspore::lite::MindIR_Split_GetSizeSplits(primitive);
     split.axis = mindspore::lite::MindIR_Split_GetAxis(primitive);
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)SplitBlockMarshalling(data, split);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -1386,7 +1388,7 @@ std::vector<int8_t> ConvertSqrt(const PrimitivePtr primitive)
     }
 
     Sqrt sqrt{};
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)SqrtBlockMarshalling(data, sqrt);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -1401,7 +1403,7 @@ std::vector<int8_t> ConvertSquare(const PrimitivePtr primitive)
     }
 
     Square square{};
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)SquareBlockMarshalling(data, square);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -1416,7 +1418,7 @@ std::vector<int8_t> ConvertSquaredDifference(const PrimitivePtr primitive)
     }
 
     SquaredDifference squaredDifference{};
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)SquaredDifferenceBlockMarshalling(data, squaredDifference);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -1432,7 +1434,7 @@ std::vector<int8_t> ConvertSqueeze(const PrimitivePtr primitive)
 
     Squeeze squeeze{};
     squeeze.axis = mindspore::lite::MindIR_Squeeze_GetAxis(primitive);
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)SqueezeBlockMarshalling(data, squeeze);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -1448,7 +1450,7 @@ std::vector<int8_t> ConvertStack(const PrimitivePtr primitive)
 
     Stack stack{};
     stack.axis = mindspore::lite::MindIR_Stack_GetAxis(primitive);
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)StackBlockMarshalling(data, stack);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -1468,7 +1470,7 @@ std::vector<int8_t> ConvertStridedSlice(const PrimitivePtr primitive)
     stridedSlice.ellipsisMask = mindspore::lite::MindIR_StridedSlice_GetEllipsisMask(primitive);
     stridedSlice.newAxisMask = mindspore::lite::MindIR_StridedSlice_GetNewAxisMask(primitive);
     stridedSlice.shrinkAxisMask = mindspore::lite::MindIR_StridedSlice_GetShrinkAxisMask(primitive);
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)StridedSliceBlockMarshalling(data, stridedSlice);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -1485,7 +1487,7 @@ std::vector<int8_t> ConvertSubFusion(const PrimitivePtr primitive)
     SubFusion subFusion{};
     subFusion.activationType = static_cast<ActivationType>(
         mindspore::lite::MindIR_SubFusion_GetActivationType(primitive));
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)SubFusionBlockMarshalling(data, subFusion);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -1501,7 +1503,7 @@ std::vector<int8_t> ConvertTileFusion(const PrimitivePtr primitive)
 
     TileFusion tileFusion{};
     tileFusion.dims = mindspore::lite::MindIR_TileFusion_GetDims(primitive);
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)TileFusionBlockMarshalling(data, tileFusion);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -1518,7 +1520,7 @@ std::vector<int8_t> ConvertTopKFusion(const PrimitivePtr primitive)
     TopKFusion topKFusion{};
     topKFusion.sorted = mindspore::lite::MindIR_TopKFusion_GetSorted(primitive);
     topKFusion.axis = mindspore::lite::MindIR_TopKFusion_GetAxis(primitive);
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)TopKFusionBlockMarshalling(data, topKFusion);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -1533,7 +1535,7 @@ std::vector<int8_t> ConvertTranspose(const PrimitivePtr primitive)
     }
 
     Transpose transpose{};
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)TransposeBlockMarshalling(data, transpose);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -1549,7 +1551,7 @@ std::vector<int8_t> ConvertUnsqueeze(const PrimitivePtr primitive)
 
     Unsqueeze unsqueeze{};
     unsqueeze.axis = mindspore::lite::MindIR_Unsqueeze_GetAxis(primitive);
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)UnsqueezeBlockMarshalling(data, unsqueeze);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -1566,7 +1568,7 @@ std::vector<int8_t> ConvertUnstack(const PrimitivePtr primitive)
     Unstack unstack{};
     unstack.axis = mindspore::lite::MindIR_Unstack_GetAxis(primitive);
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)UnstackBlockMarshalling(data, unstack);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -1582,7 +1584,7 @@ std::vector<int8_t> ConvertWhere(const PrimitivePtr primitive)
 
     Where where{};
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)WhereBlockMarshalling(data, where);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -1598,7 +1600,7 @@ std::vector<int8_t> ConvertSelect(const PrimitivePtr primitive)
 
     Select select{};
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)SelectBlockMarshalling(data, select);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -1614,7 +1616,7 @@ std::vector<int8_t> ConvertErf(const PrimitivePtr primitive)
 
     Erf erf{};
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)ErfBlockMarshalling(data, erf);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
@@ -1631,111 +1633,31 @@ std::vector<int8_t> ConvertLogSoftmax(const PrimitivePtr primitive)
     LogSoftmax logSoftmax{};
     logSoftmax.axis = mindspore::lite::MindIR_LogSoftmax_GetAxis(primitive);
 
-    OHOS::MessageParcel data;
+    OHOS::MessageParcel &data = GetReusableParcel();
     (void)LogSoftmaxBlockMarshalling(data, logSoftmax);
     std::vector<int8_t> ret(reinterpret_cast<const int8_t *>(data.GetData()),
                             reinterpret_cast<const int8_t *>(data.GetData()) + data.GetDataSize());
     return ret;
 }
 
-std::unordered_map<NodeType, std::vector<int8_t>(*)(const PrimitivePtr)> convertOpMap = {
-    {NODE_TYPE_ACTIVATION, &ConvertActivation},
-    {NODE_TYPE_ADD_FUSION, &ConvertAddFusion},
-    {NODE_TYPE_ALL, &ConvertAll},
-    {NODE_TYPE_ARGMAX_FUSION, &ConvertArgMaxFusion},
-    {NODE_TYPE_ASSERT, &ConvertAssert},
-    {NODE_TYPE_AVGPOOL_FUSION, &ConvertAvgPoolFusion},
-    {NODE_TYPE_BATCH_TO_SPACE_ND, &ConvertBatchToSpaceND},
-    {NODE_TYPE_BIAS_ADD, &ConvertBiasAdd},
-    {NODE_TYPE_BROADCAST_TO, &ConvertBroadcastTo},
-    {NODE_TYPE_CAST, &ConvertCast},
-    {NODE_TYPE_CEIL, &ConvertCeil},
-    {NODE_TYPE_CLIP, &ConvertClip},
-    {NODE_TYPE_CONCAT, &ConvertConcat},
-    {NODE_TYPE_CONV2D_FUSION, &ConvertConv2DFusion},
-    {NODE_TYPE_CONV2D_TRANSPOSE_FUSION, &ConvertConv2dTransposeFusion},
-    {NODE_TYPE_COS, &ConvertCos},
-    {NODE_TYPE_CONSTANT_OF_SHAPE, &ConvertConstantOfShape},
-    {NODE_TYPE_CROP, &ConvertCrop},
-    {NODE_TYPE_DEPTH_TO_SPACE, &ConvertDepthToSpace},
-    {NODE_TYPE_DETECTION_POST_PROCESS, &ConvertDetectionPostProcess},
-    {NODE_TYPE_DIV_FUSION, &ConvertDivFusion},
-    {NODE_TYPE_ELTWISE, &ConvertEltwise},
-    {NODE_TYPE_EQUAL, &ConvertEqual},
-    {NODE_TYPE_EXPFUSION, &ConvertExpFusion},
-    {NODE_TYPE_EXPAND_DIMS, &ConvertExpandDims},
-    {NODE_TYPE_FLATTEN, &ConvertFlatten},
-    {NODE_TYPE_FLOOR, &ConvertFloor},
-    {NODE_TYPE_FILL, &ConvertFill},
-    {NODE_TYPE_FULL_CONNECTION, &ConvertFullConnection},
-    {NODE_TYPE_FUSED_BATCH_NORM, &ConvertFusedBatchNorm},
-    {NODE_TYPE_GATHER, &ConvertGather},
-    {NODE_TYPE_GATHER_ND, &ConvertGatherNd},
-    {NODE_TYPE_GREATER, &ConvertGreater},
-    {NODE_TYPE_GREATER_EQUAL, &ConvertGreaterEqual},
-    {NODE_TYPE_INSTANCE_NORM, &ConvertInstanceNorm},
-    {NODE_TYPE_LAYER_NORM_FUSION, &ConvertLayerNormFusion},
-    {NODE_TYPE_LESS, &ConvertLess},
-    {NODE_TYPE_LESS_EQUAL, &ConvertLessEqual},
-    {NODE_TYPE_LOG, &ConvertLog},
-    {NODE_TYPE_LOGICAL_AND, &ConvertLogicalAnd},
-    {NODE_TYPE_LOGICAL_NOT, &ConvertLogicalNot},
-    {NODE_TYPE_LOGICAL_OR, &ConvertLogicalOr},
-    {NODE_TYPE_LRN, &ConvertLRN},
-    {NODE_TYPE_LSTM, &ConvertLSTM},
-    {NODE_TYPE_L2_NORMALIZE_FUSION, &ConvertL2NormalizeFusion},
-    {NODE_TYPE_MATMUL_FUSION, &ConvertMatMulFusion},
-    {NODE_TYPE_MAXIMUM, &ConvertMaximum},
-    {NODE_TYPE_MAX_POOL_FUSION, &ConvertMaxPoolFusion},
-    {NODE_TYPE_MINIMUM, &ConvertMinimum},
-    {NODE_TYPE_MOD, &ConvertMod},
-    {NODE_TYPE_MUL_FUSION, &ConvertMulFusion},
-    {NODE_TYPE_NEG, &ConvertNeg},
-    {NODE_TYPE_NOT_EQUAL, &ConvertNotEqual},
-    {NODE_TYPE_ONE_HOT, &ConvertOneHot},
-    {NODE_TYPE_PAD_FUSION, &ConvertPadFusion},
-    {NODE_TYPE_POW_FUSION, &ConvertPowFusion},
-    {NODE_TYPE_PRELU_FUSION, &ConvertPReLUFusion},
-    {NODE_TYPE_QUANT_DTYPE_CAST, &ConvertQuantDTypeCast},
-    {NODE_TYPE_RANK, &ConvertRank},
-    {NODE_TYPE_RANGE, &ConvertRange},
-    {NODE_TYPE_RECIPROCAL, &ConvertReciprocal},
-    {NODE_TYPE_REDUCE_FUSION, &ConvertReduceFusion},
-    {NODE_TYPE_RESHAPE, &ConvertReshape},
-    {NODE_TYPE_RESIZE, &ConvertResize},
-    {NODE_TYPE_ROUND, &ConvertRound},
-    {NODE_TYPE_RSQRT, &ConvertRsqrt},
-    {NODE_TYPE_SCALE_FUSION, &ConvertScaleFusion},
-    {NODE_TYPE_SCATTER_ND, &ConvertScatterNd},
-    {NODE_TYPE_SHAPE, &ConvertShape},
-    {NODE_TYPE_SIN, &ConvertSin},
-    {NODE_TYPE_SLICE_FUSION, &ConvertSliceFusion},
-    {NODE_TYPE_SOFTMAX, &ConvertSoftmax},
-    {NODE_TYPE_SPACE_TO_BATCH_ND, &ConvertSpaceToBatchND},
-    {NODE_TYPE_SPACE_TO_DEPTH, &ConvertSpaceToDepth},
-    {NODE_TYPE_SPARSE_TO_DENSE, &ConvertSparseToDense},
-    {NODE_TYPE_SPLIT, &ConvertSplit},
-    {NODE_TYPE_SQRT, &ConvertSqrt},
-    {NODE_TYPE_SQUARED_DIFFERENCE, &ConvertSquaredDifference},
-    {NODE_TYPE_SQUEEZE, &ConvertSqueeze},
-    {NODE_TYPE_SQUARE, &ConvertSquare},
-    {NODE_TYPE_STACK, &ConvertStack},
-    {NODE_TYPE_STRIDED_SLICE, &ConvertStridedSlice},
-    {NODE_TYPE_SUB_FUSION, &ConvertSubFusion},
-    {NODE_TYPE_TILE_FUSION, &ConvertTileFusion},
-    {NODE_TYPE_TOPK_FUSION, &ConvertTopKFusion},
-    {NODE_TYPE_TRANSPOSE, &ConvertTranspose},
-    {NODE_TYPE_UNSQUEEZE, &ConvertUnsqueeze},
-    {NODE_TYPE_UNSTACK, &ConvertUnstack},
-    {NODE_TYPE_WHERE, &ConvertWhere},
-    {NODE_TYPE_SELECT, &ConvertSelect},
-    {NODE_TYPE_ERF, &ConvertErf},
-    {NODE_TYPE_LOG_SOFTMAX, &ConvertLogSoftmax}};
+using ConvertFunc = std::vector<int8_t>(*)(const PrimitivePtr);
+#define NNRT_HDI_NODE_CONVERTER_LIST(X) NNRT_HDI_NODE_CONVERTER_LIST_V1(X) NNRT_HDI_NODE_CONVERTER_LIST_V2_1_EXTENSION(X)
+constexpr size_t CONVERT_TABLE_SIZE = NNRT_DISPATCH_TABLE_SIZE(NNRT_HDI_NODE_CONVERTER_LIST);
+
+constexpr DispatchTable<ConvertFunc, CONVERT_TABLE_SIZE> BuildConvertTable()
+{
+    DispatchTable<ConvertFunc, CONVERT_TABLE_SIZE> table {};
+    NNRT_HDI_NODE_CONVERTER_LIST(NNRT_DISPATCH_SET)
+    return table;
+}
+
+constexpr DispatchTable<ConvertFunc, CONVERT_TABLE_SIZE> CONVERT_TABLE = BuildConvertTable();
 
 std::vector<int8_t> Convert(OHOS::HDI::Nnrt::V2_1::NodeType type, const PrimitivePtr primitive)
 {
-    if (convertOpMap.find(type) != convertOpMap.end()) {
-        return convertOpMap[type](primitive);
+    ConvertFunc convertFunc = CONVERT_TABLE.Find(static_cast<size_t>(type));
+    if (convertFunc != nullptr) {
+        return convertFunc(primitive);
     }
     LOGE("MindIR_LiteGraph_To_Model v2_1 failed, nodeType invalid, type =%d", type);
     return {};
@@ -1750,6 +1672,7 @@ inline std::vector<OHOS::HDI::Nnrt::V2_1::QuantParam> MindIR_Tensor_GetQuantPara
             return {};
         }
         size_t size = src.size();
+        result.reserve(size);
         for (size_t i = 0; i < size; i++) {
             OHOS::HDI::Nnrt::V2_1::QuantParam quantParam{src[i].numBits, src[i].zeroPoint, src[i].scale};
             result.emplace_back(quantParam);
@@ -1815,24 +1738,30 @@ OHOS::HDI::Nnrt::V2_1::Model *LiteGraph_To_HDIModel(const mindspore::lite::LiteG
     std::vector<OHOS::HDI::Nnrt::V2_1::SubGraph> subGraph;
 
     // nodes
-    for (auto node : liteGraph->all_nodes_) {
+    const auto &liteNodes = liteGraph->all_nodes_;
+    nodes.resize(liteNodes.size());
+    auto convertNode = [&liteNodes, &nodes](size_t index) -> bool {
+        auto node = liteNodes[index];
         if (node == nullptr) {
             LOGE("MindIR_LiteGraph_To_Model v2_1 failed, node is nullptr.");
-            return nullptr;
+            return false;
         }
-        OHOS::HDI::Nnrt::V2_1::Node tmp;
-        tmp.name = node->name_;
         if (node->primitive_ == nullptr) {
             LOGE("MindIR_LiteGraph_To_Model v2_1 failed, node primitive is nullptr.");
-            return nullptr;
+            return false;
         }
+        OHOS::HDI::Nnrt::V2_1::Node &tmp = nodes[index];
+        tmp.name = node->name_;
         tmp.nodeType = static_cast<OHOS::HDI::Nnrt::V2_1::NodeType>(
             mindspore::lite::MindIR_Primitive_GetType(node->primitive_));
         tmp.nodeAttr = Convert(tmp.nodeType, node->primitive_);
         tmp.inputIndex = node->input_indices_;
         tmp.outputIndex = node->output_indices_;
         tmp.quantType = static_cast<QuantType>(node->quant_type_);
-        nodes.emplace_back(tmp);
+        return true;
+    };
+    if (!ParallelConvert(liteNodes.size(), convertNode)) {
+        return nullptr;
     }
 
     // Tensor
@@ -1846,6 +1775,7 @@ OHOS::HDI::Nnrt::V2_1::Model *LiteGraph_To_HDIModel(const mindspore::lite::LiteG
             return nullptr;
         }
     }
+    allTensors.reserve(liteGraph->all_tensors_.size());
     for (auto tensor : liteGraph->all_tensors_) {
         OHOS::HDI::Nnrt::V2_1::Tensor tmp;
         tmp.name = mindspore::lite::MindIR_Tensor_GetName(tensor);
@@ -1854,8 +1784,8 @@ OHOS::HDI::Nnrt::V2_1::Model *LiteGraph_To_HDIModel(const mindspore::lite::LiteG
         tmp.format = static_cast<Format>(mindspore::lite::MindIR_Tensor_GetFormat(tensor));
         tmp.data = Copy_MindIR_Tensor_Data_To_HDIBuffer(tensor, buffer, mmapPtr, tensorBufferOffset);
         tmp.quantParams = MindIR_Tensor_GetQuantParams_OHOS(tensor);
-        allTensors.emplace_back(tmp);
         tensorBufferOffset = tmp.data.offset + tmp.data.dataSize;
+        allTensors.emplace_back(std::move(tmp));
     }
     if (buffer.fd != -1) {
         auto munmapRes = munmap(mmapPtr, buffer.bufferSize);
@@ -1866,13 +1796,14 @@ OHOS::HDI::Nnrt::V2_1::Model *LiteGraph_To_HDIModel(const mindspore::lite::LiteG
     }
 
     // SubGraph
+    subGraph.reserve(liteGraph->sub_graphs_.size());
     for (auto graph : liteGraph->sub_graphs_) {
         OHOS::HDI::Nnrt::V2_1::SubGraph tmp;
         tmp.name = graph->name_;
         tmp.inputIndices = std::vector<uint32_t>(graph->input_indices_);
         tmp.outputIndices = std::vector<uint32_t>(graph->output_indices_);
         tmp.nodeIndices = std::vector<uint32_t>(graph->node_indices_);
-        subGraph.emplace_back(tmp);
+        subGraph.emplace_back(std::move(tmp));
     }
 
     auto *retModel = new (std::nothrow) OHOS::HDI::Nnrt::V2_1::Model();
@@ -1883,9 +1814,9 @@ OHOS::HDI::Nnrt::V2_1::Model *LiteGraph_To_HDIModel(const mindspore::lite::LiteG
     retModel->name = liteGraph->name_;
     retModel->inputIndex = liteGraph->input_indices_;
     retModel->outputIndex = liteGraph->output_indices_;
-    retModel->nodes = nodes;
-    retModel->allTensors = allTensors;
-    retModel->subGraph = subGraph;
+    retModel->nodes = std::move(nodes);
+    retModel->allTensors = std::move(allTensors);
+    retModel->subGraph = std::move(subGraph);
     return retModel;
 }
 } // NNRt_V2_1
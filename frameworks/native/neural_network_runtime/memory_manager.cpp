@@ -16,14 +16,77 @@
 
 #include "memory_manager.h"
 
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+
 #include <sys/mman.h>
 #include <unistd.h>
 
 #include "cpp_type.h"
 #include "log.h"
+#include "securec.h"
 
 namespace OHOS {
 namespace NeuralNetworkRuntime {
+namespace {
+const char* const PROC_SELF_MAPS = "/proc/self/maps";
+const std::string ANON_NAME_PREFIX = "[anon:";
+const size_t PERMS_LENGTH = 4;
+const int HEX_BASE = 16;
+
+// Checks through /proc/self/maps that [buffer, buffer + length) is covered by private anonymous mappings without
+// holes. Only such pages can be replaced by the shared memory and given back to fresh private memory later without
+// changing what the pages are backed by.
+bool IsPrivateAnonymous(const void* buffer, size_t length)
+{
+    std::ifstream maps(PROC_SELF_MAPS);
+    if (!maps.is_open()) {
+        LOGE("Open %{public}s failed.", PROC_SELF_MAPS);
+        return false;
+    }
+
+    uintptr_t current = reinterpret_cast<uintptr_t>(buffer);
+    uintptr_t end = current + length;
+    std::string line;
+    while (current < end && std::getline(maps, line)) {
+        // Each line reads "start-end perms offset dev inode [path]".
+        std::istringstream fields(line);
+        std::string range;
+        std::string perms;
+        std::string offset;
+        std::string dev;
+        unsigned long inode = 0;
+        std::string path;
+        if (!(fields >> range >> perms >> offset >> dev >> inode)) {
+            continue;
+        }
+        std::getline(fields >> std::ws, path);
+
+        char* rangeEnd = nullptr;
+        uintptr_t start = static_cast<uintptr_t>(strtoull(range.c_str(), &rangeEnd, HEX_BASE));
+        if (rangeEnd == nullptr || *rangeEnd != '-') {
+            continue;
+        }
+        uintptr_t stop = static_cast<uintptr_t>(strtoull(rangeEnd + 1, nullptr, HEX_BASE));
+        if (stop <= current) {
+            continue;
+        }
+        if (start > current) {
+            return false;
+        }
+        bool isAnonymous = path.empty() || path == "[heap]" || path.compare(0, ANON_NAME_PREFIX.size(),
+            ANON_NAME_PREFIX) == 0;
+        if (perms.size() < PERMS_LENGTH || perms[PERMS_LENGTH - 1] != 'p' || inode != 0 || !isAnonymous) {
+            return false;
+        }
+        current = stop;
+    }
+    return current >= end;
+}
+} // namespace
+
 void* MemoryManager::MapMemory(int fd, size_t length)
 {
     if (fd < 0) {
@@ -61,6 +124,10 @@ OH_NN_ReturnCode MemoryManager::UnMapMemory(const void* buffer)
         LOGE("This buffer is not found, cannot release.");
         return OH_NN_INVALID_PARAMETER;
     }
+    if (m_userMemorys.find(buffer) != m_userMemorys.end()) {
+        LOGE("This buffer is owned by the user, restore it instead of releasing it.");
+        return OH_NN_INVALID_PARAMETER;
+    }
 
     auto& memory = m_memorys[buffer];
     auto unmapResult = munmap(const_cast<void*>(memory.data), memory.length);
@@ -94,5 +161,92 @@ OH_NN_ReturnCode MemoryManager::GetMemory(const void* buffer, Memory& memory)
 
     return OH_NN_SUCCESS;
 }
+
+bool MemoryManager::IsMapped(const void* buffer)
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    return m_memorys.find(buffer) != m_memorys.end();
+}
+
+OH_NN_ReturnCode MemoryManager::RemapUserMemory(void* buffer, size_t length, int fd)
+{
+    if (buffer == nullptr || fd < 0) {
+        LOGE("RemapUserMemory failed, buffer is nullptr or fd is invalid.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+    size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    if (length == 0 || length > ALLOCATE_BUFFER_LIMIT || length % pageSize != 0 ||
+        reinterpret_cast<uintptr_t>(buffer) % pageSize != 0) {
+        LOGE("RemapUserMemory failed, buffer and length=%zu must be page aligned.", length);
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mtx);
+    if (m_memorys.find(buffer) != m_memorys.end()) {
+        LOGE("RemapUserMemory failed, buffer is shared with the device already.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+    if (!IsPrivateAnonymous(buffer, length)) {
+        LOGE("RemapUserMemory failed, buffer must be private anonymous memory, such as memory from malloc or mmap "
+            "with MAP_PRIVATE | MAP_ANONYMOUS.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    void* shared = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (shared == MAP_FAILED) {
+        LOGE("RemapUserMemory failed, map fd to address failed.");
+        return OH_NN_MEMORY_ERROR;
+    }
+    if (memcpy_s(shared, length, buffer, length) != EOK) {
+        LOGE("RemapUserMemory failed, copy the content of buffer failed.");
+        munmap(shared, length);
+        return OH_NN_MEMORY_ERROR;
+    }
+    munmap(shared, length);
+
+    // Replacing the mapping does not unmap the buffer, but writes made to the buffer after the copy above are lost.
+    // The caller must not access the buffer until RemapUserMemory returns.
+    void* addr = mmap(buffer, length, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+    if (addr == MAP_FAILED) {
+        LOGE("RemapUserMemory failed, map fd to buffer failed.");
+        return OH_NN_MEMORY_ERROR;
+    }
+
+    Memory memory {fd, buffer, length};
+    m_memorys.emplace(buffer, memory);
+    m_userMemorys.emplace(buffer);
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode MemoryManager::RestoreUserMemory(const void* buffer, Memory& memory)
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    if (m_userMemorys.find(buffer) == m_userMemorys.end()) {
+        LOGE("RestoreUserMemory failed, buffer is not remapped.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    memory = m_memorys[buffer];
+    void* shared = mmap(nullptr, memory.length, PROT_READ, MAP_SHARED, memory.fd, 0);
+    if (shared == MAP_FAILED) {
+        LOGE("RestoreUserMemory failed, map fd to address failed.");
+        return OH_NN_MEMORY_ERROR;
+    }
+    // The buffer reads as zeros until the content is copied back. The caller must not access the buffer until
+    // RestoreUserMemory returns.
+    void* data = const_cast<void*>(buffer);
+    void* addr = mmap(data, memory.length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0);
+    if (addr == MAP_FAILED) {
+        LOGE("RestoreUserMemory failed, map private memory to buffer failed.");
+        munmap(shared, memory.length);
+        return OH_NN_MEMORY_ERROR;
+    }
+    (void)memcpy_s(data, memory.length, shared, memory.length);
+    munmap(shared, memory.length);
+
+    m_memorys.erase(buffer);
+    m_userMemorys.erase(buffer);
+    return OH_NN_SUCCESS;
+}
 } // NeuralNetworkRuntime
 } // OHOS
\ No newline at end of file
@@ -17,6 +17,7 @@
 #define NEURAL_NETWORK_RUNTIME_MEMORY_MANAGER_H
 
 #include <unordered_map>
+#include <unordered_set>
 #include <mutex>
 
 #include "neural_network_runtime/neural_network_runtime_type.h"
@@ -38,6 +39,16 @@ public:
     void* MapMemory(int fd, size_t length);
     OH_NN_ReturnCode UnMapMemory(const void* buffer);
     OH_NN_ReturnCode GetMemory(const void* buffer, Memory& memory);
+    // Unlike GetMemory(), does not log when the buffer is not shared with the device.
+    bool IsMapped(const void* buffer);
+
+    // Backs the pages of a page aligned user buffer with fd in place, so that the device reads and writes the buffer
+    // without a copy. The content of the buffer is kept. The buffer must be private anonymous memory and must not be
+    // accessed until the call returns.
+    OH_NN_ReturnCode RemapUserMemory(void* buffer, size_t length, int fd);
+    // Gives the pages of a remapped user buffer back to private memory, and returns the shared memory that backed
+    // them. The content of the buffer is kept. The buffer must not be accessed until the call returns.
+    OH_NN_ReturnCode RestoreUserMemory(const void* buffer, Memory& memory);
 
     static MemoryManager* GetInstance()
     {
@@ -53,6 +64,8 @@ private:
 private:
     // key: OH_NN_Memory, value: fd
     std::unordered_map<const void*, Memory> m_memorys;
+    // Buffers of m_memorys which are owned by the user and only remapped.
+    std::unordered_set<const void*> m_userMemorys;
     std::mutex m_mtx;
 };
 } // namespace NeuralNetworkRuntime
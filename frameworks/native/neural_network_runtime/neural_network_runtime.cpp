@@ -16,11 +16,19 @@
 #include "neural_network_runtime_inner.h"
 #include "neural_network_runtime/neural_network_runtime.h"
 
+#include "aipp_config_registry.h"
+#include "cache_dir_manager.h"
+#include "cache_writer.h"
 #include "compilation.h"
+#include "compile_pool.h"
 #include "executor.h"
+#include "executor_pool.h"
+#include "host_preprocess.h"
 #include "inner_model.h"
+#include "latency_metrics.h"
 #include "log.h"
 #include "quant_param.h"
+#include "tensor.h"
 #include "validation.h"
 #include "syspara/parameter.h"
 #include "nnrt_client.h"
@@ -28,6 +36,7 @@
 #include <cstring>
 #include <fstream>
 #include <filesystem>
+#include <functional>
 #include <thread>
 #include <sys/stat.h>
 #include <unistd.h>
@@ -586,85 +595,6 @@ NNRT_API OH_NN_ReturnCode OH_NNModel_BuildFromLiteGraph(OH_NNModel *model, const
 }
 
 namespace {
-OH_NN_ReturnCode CheckCacheFileExtension(const std::string& content, int64_t& fileNumber,
-                                         int64_t& cacheVersion, int64_t& deviceId)
-{
-    if (!nlohmann::json::accept(content)) {
-        LOGE("OH_NNModel_HasCache CheckCacheFile JSON parse error");
-        return OH_NN_INVALID_FILE;
-    }
-
-    nlohmann::json j = nlohmann::json::parse(content);
-    if (j.find("data") == j.end()) {
-        LOGE("OH_NNModel_HasCache read data from cache info file failed.");
-        return OH_NN_INVALID_FILE;
-    }
-
-    if (j["data"].find("deviceId") == j["data"].end()) {
-        LOGE("OH_NNModel_HasCache read deviceId from cache info file failed.");
-        return OH_NN_INVALID_FILE;
-    }
-    deviceId = j["data"]["deviceId"].get<int64_t>();
-
-    if (j["data"].find("fileNumber") == j["data"].end()) {
-        LOGE("OH_NNModel_HasCache read fileNumber from cache info file failed.");
-        return OH_NN_INVALID_FILE;
-    }
-    fileNumber = j["data"]["fileNumber"].get<int>();
-
-    if (j["data"].find("version") == j["data"].end()) {
-        LOGE("OH_NNModel_HasCache read version from cache info file failed.");
-        return OH_NN_INVALID_FILE;
-    }
-    cacheVersion = j["data"]["version"].get<int>();
-
-    if (j.find("CheckSum") == j.end()) {
-        LOGE("OH_NNModel_HasCache read CheckSum from cache info file failed.");
-        return OH_NN_INVALID_FILE;
-    }
-    const size_t dataLength = j["data"].dump().length();
-    char jData[dataLength + 1];
-
-    if (strncpy_s(jData, dataLength+1, j["data"].dump().c_str(), dataLength) != 0) {
-        LOGE("OH_NNModel_HasCache ParseStr failed due to strncpy_s error.");
-        return OH_NN_INVALID_FILE;
-    }
-
-    if (static_cast<int64_t>(CacheInfoGetCrc16(jData, dataLength)) != j["CheckSum"].get<int64_t>()) {
-        LOGE("OH_NNModel_HasCache cache_info CheckSum is not correct.");
-        return OH_NN_INVALID_FILE;
-    }
-
-    return OH_NN_SUCCESS;
-}
-
-OH_NN_ReturnCode CheckCacheFile(const std::string& cacheInfoPath, int64_t& fileNumber,
-                                int64_t& cacheVersion, int64_t& deviceId)
-{
-    char path[PATH_MAX];
-    if (realpath(cacheInfoPath.c_str(), path) == nullptr) {
-        LOGE("OH_NNModel_HasCache get real path of cache info failed.");
-        return OH_NN_INVALID_FILE;
-    }
-
-    if (access(path, F_OK) != 0) {
-        LOGE("OH_NNModel_HasCache access cache info file failed.");
-        return OH_NN_INVALID_FILE;
-    }
-
-    std::ifstream ifs(path, std::ios::in | std::ios::binary);
-    if (!ifs) {
-        LOGE("OH_NNModel_HasCache open cache info file failed.");
-        return OH_NN_INVALID_FILE;
-    }
-
-    // Read the entire file into a string
-    std::string content((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
-    ifs.close();
-
-    return CheckCacheFileExtension(content, fileNumber, cacheVersion, deviceId);
-}
-
 OH_NN_ReturnCode CheckDeviceId(int64_t& deviceId)
 {
     std::string deviceName;
@@ -694,6 +624,9 @@ NNRT_API bool OH_NNModel_HasCache(const char *cacheDir, const char *modelName, u
 
     std::string cacheInfoPath = std::string(cacheDir) + "/" + std::string(modelName) + "cache_info.nncache";
 
+    // a cache which is still being written by this process is published when the write ends
+    CacheWriter::GetInstance().Wait(CacheWriter::GetCacheKey(cacheDir, modelName));
+
     // determine whether cache info file exists
     struct stat buffer;
     bool exist = (stat(cacheInfoPath.c_str(), &buffer) == 0);
@@ -701,26 +634,28 @@ NNRT_API bool OH_NNModel_HasCache(const char *cacheDir, const char *modelName, u
         return false;
     }
 
-    int64_t deviceId{0};
-    int64_t fileNumber{0};
-    int64_t cacheVersion{0};
-    OH_NN_ReturnCode returnCode = CheckCacheFile(cacheInfoPath, fileNumber, cacheVersion, deviceId);
+    // the cache info is only parsed again when it has changed since the cache directory was indexed
+    CacheIndexEntry entry;
+    OH_NN_ReturnCode returnCode = CacheDirManager::GetInstance().GetEntry(cacheDir, modelName, entry);
     if (returnCode != OH_NN_SUCCESS) {
         LOGE("OH_NNModel_HasCache get fileNumber or cacheVersion fail.");
-        std::filesystem::remove_all(cacheInfoPath);
+        CacheDirManager::GetInstance().RemoveCache(cacheDir, modelName);
         return false;
     }
+    int64_t deviceId = entry.deviceId;
+    int64_t fileNumber = entry.fileNumber;
+    int64_t cacheVersion = entry.version;
 
     returnCode = CheckDeviceId(deviceId);
     if (returnCode != OH_NN_SUCCESS) {
         LOGE("OH_NNModel_HasCache check deviceId fail.");
-        std::filesystem::remove_all(cacheInfoPath);
+        CacheDirManager::GetInstance().RemoveCache(cacheDir, modelName);
         return false;
     }
 
     if (fileNumber <= 0 || static_cast<size_t>(fileNumber) > FILE_NUMBER_MAX) {
         LOGE("OH_NNModel_HasCache fileNumber is invalid or more than 100");
-        std::filesystem::remove_all(cacheInfoPath);
+        CacheDirManager::GetInstance().RemoveCache(cacheDir, modelName);
         return false;
     }
 
@@ -731,7 +666,7 @@ NNRT_API bool OH_NNModel_HasCache(const char *cacheDir, const char *modelName, u
         exist = (exist && (stat(cacheModelPath.c_str(), &buffer) == 0));
         if (!exist) {
             LOGE("OH_NNModel_HasCache cacheModelPath is not existed.");
-            std::filesystem::remove_all(cacheInfoPath);
+            CacheDirManager::GetInstance().RemoveCache(cacheDir, modelName);
             return false;
         }
     }
@@ -744,6 +679,125 @@ NNRT_API bool OH_NNModel_HasCache(const char *cacheDir, const char *modelName, u
     return exist;
 }
 
+NNRT_API OH_NN_ReturnCode OH_NNCompilation_BuildAsync(OH_NNCompilation *compilation, NN_OnBuildDone onBuildDone,
+    void *userData)
+{
+    if (compilation == nullptr) {
+        LOGE("OH_NNCompilation_BuildAsync failed, compilation is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    if (onBuildDone == nullptr) {
+        LOGE("OH_NNCompilation_BuildAsync failed, onBuildDone is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    Compilation* compilationImpl = reinterpret_cast<Compilation*>(compilation);
+    size_t backendID = compilationImpl->backendID;
+    return CompilePool::GetInstance().Post(backendID, CompilePool::GetBackendLimit(backendID),
+        compilationImpl->priority, [compilation, onBuildDone, userData]() {
+            OH_NN_ReturnCode ret = OH_NNCompilation_Build(compilation);
+            onBuildDone(userData, ret, compilation);
+        });
+}
+
+namespace {
+ExecutorPool* GetExecutorPool(Compilation* compilationImpl)
+{
+    std::lock_guard<std::mutex> lock(compilationImpl->executorPoolMutex);
+    return compilationImpl->executorPool.get();
+}
+}
+
+NNRT_API OH_NN_ReturnCode OH_NNCompilation_CreateExecutorPool(OH_NNCompilation *compilation, size_t minCount,
+    size_t maxCount)
+{
+    if (compilation == nullptr) {
+        LOGE("OH_NNCompilation_CreateExecutorPool failed, compilation is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    Compilation* compilationImpl = reinterpret_cast<Compilation*>(compilation);
+    if (compilationImpl->compiler == nullptr || !compilationImpl->compiler->IsBuild()) {
+        LOGE("OH_NNCompilation_CreateExecutorPool failed, the compilation has not been built.");
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    // Held while the first executors are constructed, so that a concurrent call neither creates a second pool nor
+    // borrows from a pool which is not initialized yet.
+    std::lock_guard<std::mutex> lock(compilationImpl->executorPoolMutex);
+    if (compilationImpl->executorPool != nullptr) {
+        LOGE("OH_NNCompilation_CreateExecutorPool failed, the compilation already has an executor pool.");
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    std::unique_ptr<ExecutorPool> pool = std::make_unique<ExecutorPool>(
+        [compilation]() { return OH_NNExecutor_Construct(compilation); },
+        [](OH_NNExecutor* executor) { return reinterpret_cast<Executor*>(executor)->Recycle(); },
+        [](OH_NNExecutor* executor) { OH_NNExecutor_Destroy(&executor); });
+    OH_NN_ReturnCode ret = pool->Init(minCount, maxCount);
+    if (ret != OH_NN_SUCCESS) {
+        LOGE("OH_NNCompilation_CreateExecutorPool failed, fail to create %{public}zu executors.", minCount);
+        return ret;
+    }
+
+    compilationImpl->executorPool = std::move(pool);
+    return OH_NN_SUCCESS;
+}
+
+NNRT_API OH_NN_ReturnCode OH_NNCompilation_AcquireExecutor(OH_NNCompilation *compilation, uint32_t timeoutMs,
+    OH_NNExecutor **executor)
+{
+    if (compilation == nullptr) {
+        LOGE("OH_NNCompilation_AcquireExecutor failed, compilation is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    if (executor == nullptr) {
+        LOGE("OH_NNCompilation_AcquireExecutor failed, executor is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    ExecutorPool* pool = GetExecutorPool(reinterpret_cast<Compilation*>(compilation));
+    if (pool == nullptr) {
+        LOGE("OH_NNCompilation_AcquireExecutor failed, the compilation has no executor pool.");
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    return pool->Acquire(timeoutMs, executor);
+}
+
+NNRT_API OH_NN_ReturnCode OH_NNCompilation_ReleaseExecutor(OH_NNCompilation *compilation, OH_NNExecutor *executor)
+{
+    if (compilation == nullptr) {
+        LOGE("OH_NNCompilation_ReleaseExecutor failed, compilation is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    ExecutorPool* pool = GetExecutorPool(reinterpret_cast<Compilation*>(compilation));
+    if (pool == nullptr) {
+        LOGE("OH_NNCompilation_ReleaseExecutor failed, the compilation has no executor pool.");
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    return pool->Release(executor);
+}
+
+NNRT_API OH_NN_ReturnCode OH_NN_FlushCacheWrites(uint32_t timeoutMs)
+{
+    return CacheWriter::GetInstance().Flush(timeoutMs);
+}
+
+NNRT_API OH_NN_ReturnCode OH_NN_SetCacheSizeLimit(const char *cacheDir, uint64_t sizeLimit)
+{
+    if (cacheDir == nullptr) {
+        LOGE("OH_NN_SetCacheSizeLimit failed, passed nullptr to cacheDir.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    return CacheDirManager::GetInstance().SetSizeLimit(cacheDir, sizeLimit);
+}
+
 NNRT_API OH_NN_ReturnCode OH_NNModel_BuildFromMetaGraph(OH_NNModel *model, const void *metaGraph,
     const OH_NN_Extension *extensions, size_t extensionSize)
 {
@@ -934,12 +988,7 @@ OH_NN_ReturnCode UpdateModelLatency(const ExecutorConfig* config, int32_t modelL
     return OH_NN_SUCCESS;
 }
 
-OH_NN_ReturnCode RunSyncWithAipp(Executor *executor,
-                                 NN_Tensor *inputTensor[],
-                                 size_t inputCount,
-                                 NN_Tensor *outputTensor[],
-                                 size_t outputCount,
-                                 const char* aippStrings)
+OH_NN_ReturnCode RunSyncWithAipp(Executor *executor, const std::function<OH_NN_ReturnCode()>& runExecutor)
 {
     ExecutorConfig* configPtr = executor->GetExecutorConfig();
     if (configPtr == nullptr) {
@@ -953,7 +1002,7 @@ OH_NN_ReturnCode RunSyncWithAipp(Executor *executor,
             std::chrono::system_clock::now().time_since_epoch()).count();
     }
 
-    OH_NN_ReturnCode ret = executor->RunSyncWithAipp(inputTensor, inputCount, outputTensor, outputCount, aippStrings);
+    OH_NN_ReturnCode ret = runExecutor();
     if (ret != OH_NN_SUCCESS) {
         LOGE("OH_NNExecutor_RunSyncWithAipp failed, fail to run executor.");
         return ret;
@@ -1019,5 +1068,270 @@ NNRT_API OH_NN_ReturnCode OH_NNExecutor_RunSyncWithAipp(OH_NNExecutor *executor,
     }
 
     Executor *executorImpl = reinterpret_cast<Executor *>(executor);
-    return RunSyncWithAipp(executorImpl, inputTensor, inputCount, outputTensor, outputCount, aippString);
-}
\ No newline at end of file
+    return RunSyncWithAipp(executorImpl, [=]() {
+        return executorImpl->RunSyncWithAipp(inputTensor, inputCount, outputTensor, outputCount, aippString);
+    });
+}
+
+NNRT_API OH_NN_ReturnCode OH_NN_RegisterAippConfig(const char *aippString, uint32_t *aippHandle)
+{
+    if (aippString == nullptr || aippString[0] == '\0') {
+        LOGE("OH_NN_RegisterAippConfig failed, aippString is empty.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    if (aippHandle == nullptr) {
+        LOGE("OH_NN_RegisterAippConfig failed, aippHandle is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    return AippConfigRegistry::GetInstance().Register(aippString, *aippHandle);
+}
+
+NNRT_API OH_NN_ReturnCode OH_NN_UnregisterAippConfig(uint32_t aippHandle)
+{
+    return AippConfigRegistry::GetInstance().Unregister(aippHandle);
+}
+
+NNRT_API OH_NN_ReturnCode OH_NNExecutor_RunSyncWithAippHandle(OH_NNExecutor *executor,
+                                                              NN_Tensor *inputTensor[],
+                                                              size_t inputCount,
+                                                              NN_Tensor *outputTensor[],
+                                                              size_t outputCount,
+                                                              uint32_t aippHandle)
+{
+    if (executor == nullptr) {
+        LOGE("OH_NNExecutor_RunSyncWithAippHandle failed, executor is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    if (inputTensor == nullptr) {
+        LOGE("OH_NNExecutor_RunSyncWithAippHandle failed, inputTensor is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    if ((inputCount == 0) || (inputCount > INPUT_OUTPUT_MAX_INDICES)) {
+        LOGE("OH_NNExecutor_RunSyncWithAippHandle failed, inputCount is 0 or more than 200.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    if (outputTensor == nullptr) {
+        LOGE("OH_NNExecutor_RunSyncWithAippHandle failed, outputTensor is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    if ((outputCount == 0) || (outputCount > INPUT_OUTPUT_MAX_INDICES)) {
+        LOGE("OH_NNExecutor_RunSyncWithAippHandle failed, outputCount is 0 or more than 200.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    Executor *executorImpl = reinterpret_cast<Executor *>(executor);
+    return RunSyncWithAipp(executorImpl, [=]() {
+        return executorImpl->RunSyncWithAippHandle(inputTensor, inputCount, outputTensor, outputCount, aippHandle);
+    });
+}
+
+NNRT_API OH_NN_ReturnCode OH_NNQuantParam_SetGroup(NN_QuantParam *quantParams, int32_t axis, uint32_t groupSize)
+{
+    if (quantParams == nullptr) {
+        LOGE("OH_NNQuantParam_SetGroup failed, passed nullptr to quantParams.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    auto* quantParamImpl = reinterpret_cast<QuantParams*>(quantParams);
+    quantParamImpl->SetGroup(axis, groupSize);
+
+    return OH_NN_SUCCESS;
+}
+
+NNRT_API OH_NN_ReturnCode OH_NNQuantParam_SetHalfScales(NN_QuantParam *quantParams, const uint16_t *scales,
+                                                        size_t quantCount)
+{
+    if (quantParams == nullptr) {
+        LOGE("OH_NNQuantParam_SetHalfScales failed, passed nullptr to quantParams.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    if (scales == nullptr) {
+        LOGE("OH_NNQuantParam_SetHalfScales failed, passed nullptr to scales.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    if (quantCount == 0) {
+        LOGE("OH_NNQuantParam_SetHalfScales failed, passed 0 to quantCount.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    auto* quantParamImpl = reinterpret_cast<QuantParams*>(quantParams);
+    std::vector<uint16_t> scaleVector(scales, scales + quantCount);
+    quantParamImpl->SetHalfScales(scaleVector);
+
+    return OH_NN_SUCCESS;
+}
+
+NNRT_API OH_NN_ReturnCode OH_NNTensor_FillWithPreprocess(NN_Tensor *tensor, const void *image, size_t imageLength,
+                                                         const OH_NN_PreprocessConfig *config)
+{
+    if (tensor == nullptr) {
+        LOGE("OH_NNTensor_FillWithPreprocess failed, tensor is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    if (image == nullptr || imageLength == 0) {
+        LOGE("OH_NNTensor_FillWithPreprocess failed, image is nullptr or imageLength is 0.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    if (config == nullptr) {
+        LOGE("OH_NNTensor_FillWithPreprocess failed, config is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    Tensor *tensorImpl = reinterpret_cast<Tensor *>(tensor);
+    TensorDesc *tensorDesc = tensorImpl->GetTensorDesc();
+    if (tensorDesc == nullptr) {
+        LOGE("OH_NNTensor_FillWithPreprocess failed, tensor desc is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    return HostPreprocess::Run(*config, image, imageLength, *tensorDesc, tensorImpl->GetData(),
+                               tensorImpl->GetSize());
+}
+
+NNRT_API OH_NN_ReturnCode OH_NNExecutor_Prefetch(OH_NNExecutor *executor)
+{
+    if (executor == nullptr) {
+        LOGE("OH_NNExecutor_Prefetch failed, executor is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    Executor *executorImpl = reinterpret_cast<Executor *>(executor);
+    return executorImpl->Prefetch();
+}
+
+NNRT_API OH_NN_ReturnCode OH_NNExecutor_ResetState(OH_NNExecutor *executor)
+{
+    if (executor == nullptr) {
+        LOGE("OH_NNExecutor_ResetState failed, executor is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    Executor *executorImpl = reinterpret_cast<Executor *>(executor);
+    return executorImpl->ResetState();
+}
+
+NNRT_API OH_NN_ReturnCode OH_NNExecutor_RunSyncWithOutputShapes(OH_NNExecutor *executor,
+                                                                NN_Tensor *inputTensor[],
+                                                                size_t inputCount,
+                                                                NN_Tensor *outputTensor[],
+                                                                size_t outputCount,
+                                                                int32_t *outputShapes,
+                                                                size_t maxRank,
+                                                                uint32_t *outputRanks)
+{
+    if (executor == nullptr) {
+        LOGE("OH_NNExecutor_RunSyncWithOutputShapes failed, executor is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    if (inputTensor == nullptr) {
+        LOGE("OH_NNExecutor_RunSyncWithOutputShapes failed, inputTensor is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    if ((inputCount == 0) || (inputCount > INPUT_OUTPUT_MAX_INDICES)) {
+        LOGE("OH_NNExecutor_RunSyncWithOutputShapes failed, inputCount is 0 or more than 200.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    if (outputTensor == nullptr) {
+        LOGE("OH_NNExecutor_RunSyncWithOutputShapes failed, outputTensor is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    if ((outputCount == 0) || (outputCount > INPUT_OUTPUT_MAX_INDICES)) {
+        LOGE("OH_NNExecutor_RunSyncWithOutputShapes failed, outputCount is 0 or more than 200.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    if (outputShapes == nullptr || outputRanks == nullptr || maxRank == 0) {
+        LOGE("OH_NNExecutor_RunSyncWithOutputShapes failed, outputShapes or outputRanks is nullptr, or maxRank is 0.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    Executor *executorImpl = reinterpret_cast<Executor *>(executor);
+    return RunSyncWithAipp(executorImpl, [=]() {
+        return executorImpl->RunSyncWithOutputShapes(inputTensor, inputCount, outputTensor, outputCount,
+            outputShapes, maxRank, outputRanks);
+    });
+}
+
+NNRT_API OH_NN_ReturnCode OH_NNExecutor_SetOutputSizeHint(OH_NNExecutor *executor, uint32_t outputIndex,
+                                                          size_t sizeHint)
+{
+    if (executor == nullptr) {
+        LOGE("OH_NNExecutor_SetOutputSizeHint failed, executor is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    Executor *executorImpl = reinterpret_cast<Executor *>(executor);
+    return executorImpl->SetOutputSizeHint(outputIndex, sizeHint);
+}
+
+NNRT_API OH_NN_ReturnCode OH_NNExecutor_GetOutputGrowthStats(OH_NNExecutor *executor, OH_NN_OutputGrowthStats *stats)
+{
+    if (executor == nullptr) {
+        LOGE("OH_NNExecutor_GetOutputGrowthStats failed, executor is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    if (stats == nullptr) {
+        LOGE("OH_NNExecutor_GetOutputGrowthStats failed, stats is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    Executor *executorImpl = reinterpret_cast<Executor *>(executor);
+    return executorImpl->GetOutputGrowthStats(*stats);
+}
+
+NNRT_API OH_NN_ReturnCode OH_NN_GetLatencyHistogram(OH_NN_LatencyStage stage, OH_NN_LatencyHistogram *histogram)
+{
+    if (histogram == nullptr) {
+        LOGE("OH_NN_GetLatencyHistogram failed, histogram is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    return LatencyMetrics::GetInstance().GetHistogram(stage, *histogram);
+}
+
+NNRT_API OH_NN_ReturnCode OH_NN_DumpLatencyHistograms(char *buffer, size_t length, size_t *dumpLength)
+{
+    if (dumpLength == nullptr) {
+        LOGE("OH_NN_DumpLatencyHistograms failed, dumpLength is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    std::string json = LatencyMetrics::GetInstance().DumpToJson();
+    *dumpLength = json.size() + 1;
+    if (buffer == nullptr) {
+        return OH_NN_SUCCESS;
+    }
+
+    if (length < *dumpLength) {
+        LOGE("OH_NN_DumpLatencyHistograms failed, buffer length %{public}zu is less than %{public}zu.",
+            length, *dumpLength);
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    auto secureRet = strcpy_s(buffer, length, json.c_str());
+    if (secureRet != EOK) {
+        LOGE("OH_NN_DumpLatencyHistograms failed, failed to copy json.");
+        return OH_NN_MEMORY_ERROR;
+    }
+    return OH_NN_SUCCESS;
+}
+
+NNRT_API void OH_NN_ResetLatencyHistograms()
+{
+    LatencyMetrics::GetInstance().Reset();
+}
@@ -28,6 +28,7 @@
 namespace OHOS {
 namespace NeuralNetworkRuntime {
 const uint32_t SUPPORT_NUM_BIT = 8; // Currently support 8-bit quantization only
+const uint32_t SUPPORT_INT4_NUM_BIT = 4; // Except for OH_NN_INT4 tensors, which are quantized with 4 bits
 constexpr size_t DIM_MAX_NUM = 200;
 
 void DestroyLiteGraphTensor(void* tensor)
@@ -59,6 +60,7 @@ NNTensor& NNTensor::operator=(NNTensor&& tensor) noexcept
     m_name = std::move(tensor.m_name);
     m_dimensions = std::move(tensor.m_dimensions);
     m_quantParams = std::move(tensor.m_quantParams);
+    m_groupQuantParam = std::move(tensor.m_groupQuantParam);
     m_elementCount = tensor.m_elementCount;
     m_isDynamicShape = tensor.m_isDynamicShape;
     m_isOpParameter = tensor.m_isOpParameter;
@@ -207,6 +209,25 @@ OH_NN_ReturnCode NNTensor::SetQuantParam(const NN_QuantParam* quantParam)
 
     const auto* quantParamImpl = reinterpret_cast<const OHOS::NeuralNetworkRuntime::QuantParams*>(quantParam);
     m_quantParams.clear();
+    m_groupQuantParam.reset();
+    if (quantParamImpl->IsGroupQuant()) {
+        // Kept as contiguous arrays, it is only expanded to one QuantParam per group when the LiteGraph is built.
+        auto groupQuantParam = std::make_shared<GroupQuantParam>();
+        OH_NN_ReturnCode ret = quantParamImpl->CopyToGroup(*groupQuantParam);
+        if (ret != OH_NN_SUCCESS) {
+            LOGE("SetQuantParam failed, error happened when converting group quantization parameters.");
+            return ret;
+        }
+
+        ret = ValidateGroupQuantParam(*groupQuantParam);
+        if (ret != OH_NN_SUCCESS) {
+            LOGE("SetQuantParam failed, error happened when validating group quantization parameters.");
+            return ret;
+        }
+        m_groupQuantParam = std::move(groupQuantParam);
+        return OH_NN_SUCCESS;
+    }
+
     OH_NN_ReturnCode returnCode = quantParamImpl->CopyToCompat(m_quantParams);
     if (returnCode != OH_NN_SUCCESS) {
         LOGE("SetQuantParam failed, error happened when converting quantization parameters.");
@@ -233,7 +254,7 @@ OH_NN_ReturnCode NNTensor::ValidateDimensions(const std::vector<int32_t>& dimens
     // Temporary variable to check overflow.
     uint64_t absoluteDim {0};
     uint64_t elementCount {1};
-    uint64_t dataLength {static_cast<uint64_t>(GetTypeSize(m_dataType))};
+    uint64_t dataLength {GetDataByteSize(m_dataType, elementCount)};
     m_isDynamicShape = false;
     if (dimensions.size() > DIM_MAX_NUM) {
         LOGE("ParseDimension failed, dimensions more than 200.");
@@ -249,7 +270,7 @@ OH_NN_ReturnCode NNTensor::ValidateDimensions(const std::vector<int32_t>& dimens
         m_isDynamicShape = m_isDynamicShape || (dim == -1);
         absoluteDim = static_cast<uint64_t>(abs(dim));
         elementCount *= absoluteDim;
-        dataLength *= absoluteDim;
+        dataLength = GetDataByteSize(m_dataType, elementCount);
 
         if (dataLength > UINT32_MAX) {
             LOGE("ParseDimension failed, expected data length of tensor exceed limit %u.", UINT32_MAX);
@@ -323,17 +344,59 @@ OH_NN_ReturnCode NNTensor::ParseQuantParams(const OH_NN_QuantParam* quantParam)
 OH_NN_ReturnCode NNTensor::ValidateQuantParams(const std::vector<QuantParam>& quantParams)
 {
     // Only support 8-bit quantization in NNR version 1.0
-    auto paramIt = std::find_if(quantParams.begin(), quantParams.end(), [](QuantParam quant) {
-        return  quant.numBits != SUPPORT_NUM_BIT;
+    const uint32_t supportNumBits = GetSupportNumBits();
+    auto paramIt = std::find_if(quantParams.begin(), quantParams.end(), [supportNumBits](QuantParam quant) {
+        return  quant.numBits != supportNumBits;
     });
     if (paramIt != quantParams.end()) {
             LOGE("ValidateQuantParams failed, get invalid numBits %d.", paramIt->numBits);
             return OH_NN_INVALID_PARAMETER;
     }
 
+    // Packed 4-bit weights are quantized per group of consecutive elements, the groups must be of equal size.
+    if ((m_dataType == OH_NN_INT4) && !quantParams.empty() && !m_isDynamicShape &&
+        (m_elementCount % quantParams.size() != 0)) {
+        LOGE("ValidateQuantParams failed, %zu quantization groups do not split %u elements evenly.",
+             quantParams.size(), m_elementCount);
+        return OH_NN_INVALID_PARAMETER;
+    }
+
     return OH_NN_SUCCESS;
 }
 
+OH_NN_ReturnCode NNTensor::ValidateGroupQuantParam(const GroupQuantParam& groupQuantParam) const
+{
+    if (groupQuantParam.numBits != GetSupportNumBits()) {
+        LOGE("ValidateGroupQuantParam failed, get invalid numBits %u.", groupQuantParam.numBits);
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    if (m_isDynamicShape) {
+        LOGE("ValidateGroupQuantParam failed, group quantization needs a tensor with a fixed shape.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    size_t groupCount = GroupQuantParam::CountGroups(m_dimensions, groupQuantParam.axis, groupQuantParam.groupSize);
+    if (groupCount == 0) {
+        LOGE("ValidateGroupQuantParam failed, axis %d is out of the %zu dimensions of the tensor.",
+             groupQuantParam.axis, m_dimensions.size());
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    if (groupQuantParam.GetGroupCount() != groupCount) {
+        LOGE("ValidateGroupQuantParam failed, get %zu scales but the tensor has %zu groups.",
+             groupQuantParam.GetGroupCount(), groupCount);
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    return OH_NN_SUCCESS;
+}
+
+uint32_t NNTensor::GetSupportNumBits() const
+{
+    return (m_dataType == OH_NN_INT4) ? SUPPORT_INT4_NUM_BIT : SUPPORT_NUM_BIT;
+}
+
 void NNTensor::IdentifyOpParameter()
 {
     m_isOpParameter = true;
@@ -427,6 +490,11 @@ std::vector<QuantParam> NNTensor::GetQuantParam() const
     return m_quantParams;
 }
 
+std::shared_ptr<const GroupQuantParam> NNTensor::GetGroupQuantParam() const
+{
+    return m_groupQuantParam;
+}
+
 LiteGraphTensorPtr NNTensor::ConvertToLiteGraphTensor() const
 {
     mindspore::lite::DataType dataType = NNToMS::TransformDataType(m_dataType);
@@ -434,11 +502,23 @@ LiteGraphTensorPtr NNTensor::ConvertToLiteGraphTensor() const
     const uint8_t* buffer = static_cast<const uint8_t*>(m_buffer);
     std::vector<uint8_t> data = ConstructVectorFromArray(buffer, m_dataLength);
 
+    // MindIR has no group layout, a grouped tensor passes one entry per group in the order of GroupQuantParam.
     std::vector<mindspore::lite::QuantParam> quantParams;
     mindspore::lite::QuantParam msQuantParam;
-    for (const QuantParam& param : m_quantParams) {
-        msQuantParam = {param.zeroPoint, param.scale, param.numBits};
-        quantParams.emplace_back(std::move(msQuantParam));
+    if (m_groupQuantParam != nullptr) {
+        size_t groupCount = m_groupQuantParam->GetGroupCount();
+        quantParams.reserve(groupCount);
+        for (size_t i = 0; i < groupCount; ++i) {
+            msQuantParam = {m_groupQuantParam->GetZeroPoint(i), m_groupQuantParam->GetScale(i),
+                m_groupQuantParam->numBits};
+            quantParams.emplace_back(std::move(msQuantParam));
+        }
+    } else {
+        quantParams.reserve(m_quantParams.size());
+        for (const QuantParam& param : m_quantParams) {
+            msQuantParam = {param.zeroPoint, param.scale, param.numBits};
+            quantParams.emplace_back(std::move(msQuantParam));
+        }
     }
 
     mindspore::lite::TensorPtr tensor = mindspore::lite::MindIR_Tensor_Create(
@@ -477,7 +557,7 @@ bool NNTensor::IsDynamicShape() const
 
 bool NNTensor::IsQuantTensor() const
 {
-    return (m_quantParams.size() > 0);
+    return (m_quantParams.size() > 0) || (m_groupQuantParam != nullptr);
 }
 
 bool NNTensor::IsScalar() const
@@ -16,10 +16,12 @@
 #ifndef NEURAL_NETWORK_RUNTIME_NN_TENSOR_H
 #define NEURAL_NETWORK_RUNTIME_NN_TENSOR_H
 
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "cpp_type.h"
+#include "quant_param.h"
 #include "tensor_desc.h"
 #include "neural_network_runtime/neural_network_runtime_type.h"
 #include "neural_network_runtime_inner.h"
@@ -69,6 +71,8 @@ public:
     std::vector<int32_t> GetDimensions() const;
     OH_NN_Format GetFormat() const;
     std::vector<QuantParam> GetQuantParam() const;
+    // Set instead of GetQuantParam() when the tensor is quantized per group, nullptr otherwise.
+    std::shared_ptr<const GroupQuantParam> GetGroupQuantParam() const;
     LiteGraphTensorPtr ConvertToLiteGraphTensor() const;
     void ConvertToIOTensor(IOTensor& tensor) const;
     void ConvertToTensorDesc(TensorDesc& desc) const;
@@ -83,6 +87,8 @@ private:
     OH_NN_ReturnCode ParseQuantParams(const OH_NN_QuantParam* quantParams);
     OH_NN_ReturnCode ParseDimensions(const int32_t* dimensions, uint32_t dimensionCount);
     OH_NN_ReturnCode ValidateQuantParams(const std::vector<QuantParam>& quantParams);
+    OH_NN_ReturnCode ValidateGroupQuantParam(const GroupQuantParam& groupQuantParam) const;
+    uint32_t GetSupportNumBits() const;
     OH_NN_ReturnCode ValidateDimensions(const std::vector<int32_t>& dimensions);
 
 private:
@@ -92,6 +98,7 @@ private:
     std::string m_name;
     std::vector<int32_t> m_dimensions;
     std::vector<QuantParam> m_quantParams;
+    std::shared_ptr<const GroupQuantParam> m_groupQuantParam {nullptr};
     uint32_t m_elementCount {0};
     bool m_isDynamicShape {false};
     bool m_isOpParameter {false};
@@ -15,7 +15,12 @@
 
 #include "nncompiled_cache.h"
 
+#include <signal.h>
 #include <unistd.h>
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <filesystem>
 #include <functional>
 #include <memory>
 #include <limits>
@@ -24,6 +29,7 @@
 
 #include "utils.h"
 #include "backend_manager.h"
+#include "cache_dir_manager.h"
 #include "nnbackend.h"
 
 namespace OHOS {
@@ -32,6 +38,7 @@ constexpr int32_t NULL_PTR_LENGTH = 0;
 constexpr int32_t NUMBER_CACHE_INFO_MEMBERS = 3;
 constexpr int32_t NUMBER_CACHE_INFO_EXTENSION_MEMBERS = 2;
 constexpr int32_t HEX_UNIT = 16;
+constexpr int32_t DECIMAL_UNIT = 10;
 constexpr size_t MAX_CACHE_SIZE = 2 * 1024 * 1024; // 限制最大校验内存为2MB
 constexpr char ROOT_DIR_STR = '/';
 constexpr char DOUBLE_SLASH_STR[] = "//";
@@ -50,12 +57,109 @@ OH_NN_ReturnCode NNCompiledCache::Save(const std::vector<OHOS::NeuralNetworkRunt
         return OH_NN_INVALID_PARAMETER;
     }
 
-    OH_NN_ReturnCode ret = GenerateCacheFiles(caches, cacheDir, version);
+    // The files are written into a private directory and renamed into cacheDir afterwards, so that a reader never
+    // sees a cache which is partly written.
+    std::string tempDir;
+    OH_NN_ReturnCode ret = CreateTempDir(cacheDir, tempDir);
     if (ret != OH_NN_SUCCESS) {
-        LOGE("[NNCompiledCache] Save failed, error happened when calling GenerateCacheFiles.");
+        LOGE("[NNCompiledCache] Save failed, fail to create the temporary cache directory.");
         return ret;
     }
 
+    ret = GenerateCacheFiles(caches, tempDir, version);
+    if (ret != OH_NN_SUCCESS) {
+        LOGE("[NNCompiledCache] Save failed, error happened when calling GenerateCacheFiles.");
+    } else {
+        ret = PublishCacheFiles(tempDir, cacheDir, caches.size());
+    }
+    if (ret == OH_NN_SUCCESS) {
+        CacheDirManager::GetInstance().OnCacheSaved(cacheDir, m_modelName);
+    }
+
+    std::error_code errorCode;
+    std::filesystem::remove_all(tempDir, errorCode);
+    return ret;
+}
+
+OH_NN_ReturnCode NNCompiledCache::CreateTempDir(const std::string& cacheDir, std::string& tempDir) const
+{
+    static std::atomic<uint32_t> tempDirCount {0};
+
+    char path[PATH_MAX];
+    if (realpath(cacheDir.c_str(), path) == nullptr) {
+        LOGE("[NNCompiledCache] CreateTempDir failed, fail to get the real path of cacheDir.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    RemoveStaleTempDirs(path);
+
+    // The process id and a counter keep the directories of concurrent writers apart.
+    tempDir = std::string(path) + "/." + m_modelName + "tmp_" + std::to_string(getpid()) + "_" +
+        std::to_string(tempDirCount.fetch_add(1, std::memory_order_relaxed));
+    if (mkdir(tempDir.c_str(), S_IRWXU) != 0) {
+        LOGE("[NNCompiledCache] CreateTempDir failed, errno is %{public}d.", errno);
+        return OH_NN_SAVE_CACHE_EXCEPTION;
+    }
+    return OH_NN_SUCCESS;
+}
+
+void NNCompiledCache::RemoveStaleTempDirs(const std::string& cacheDir) const
+{
+    // A writer which crashed leaves its directory ".<model>tmp_<pid>_<count>" behind, remove those of dead writers.
+    std::string prefix = "." + m_modelName + "tmp_";
+    std::error_code errorCode;
+    for (const auto& entry : std::filesystem::directory_iterator(cacheDir, errorCode)) {
+        std::string name = entry.path().filename().string();
+        if ((name.compare(0, prefix.size(), prefix) != 0) || !entry.is_directory(errorCode)) {
+            continue;
+        }
+
+        std::string pidStr = name.substr(prefix.size(), name.find('_', prefix.size()) - prefix.size());
+        char* pidEnd = nullptr;
+        long pid = strtol(pidStr.c_str(), &pidEnd, DECIMAL_UNIT);
+        if (pidStr.empty() || (*pidEnd != '\0') || (pid <= 0) || (pid > std::numeric_limits<pid_t>::max())) {
+            continue;
+        }
+        if ((kill(static_cast<pid_t>(pid), 0) != 0) && (errno == ESRCH)) {
+            LOGI("[NNCompiledCache] Remove the temporary cache directory %{public}s left by a dead writer.",
+                name.c_str());
+            std::filesystem::remove_all(entry.path(), errorCode);
+        }
+    }
+}
+
+OH_NN_ReturnCode NNCompiledCache::PublishCacheFiles(const std::string& tempDir, const std::string& cacheDir,
+                                                    size_t cacheNumber) const
+{
+    char path[PATH_MAX];
+    if (realpath(cacheDir.c_str(), path) == nullptr) {
+        LOGE("[NNCompiledCache] PublishCacheFiles failed, fail to get the real path of cacheDir.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    // Readers open the cache info first. Unpublish the old one before replacing the model files, and publish the
+    // new one last, so that an interrupted publish leaves no cache rather than a mismatched one.
+    std::string cachePath = path;
+    std::string cacheInfoName = m_modelName + "cache_info.nncache";
+    if ((unlink((cachePath + "/" + cacheInfoName).c_str()) != 0) && (errno != ENOENT)) {
+        LOGE("[NNCompiledCache] PublishCacheFiles failed, fail to remove the old cache info, errno is %{public}d.",
+            errno);
+        return OH_NN_SAVE_CACHE_EXCEPTION;
+    }
+
+    for (size_t i = 0; i < cacheNumber; ++i) {
+        std::string cacheModelName = m_modelName + std::to_string(i) + ".nncache";
+        if (rename((tempDir + "/" + cacheModelName).c_str(), (cachePath + "/" + cacheModelName).c_str()) != 0) {
+            LOGE("[NNCompiledCache] PublishCacheFiles failed, fail to publish model cache, errno is %{public}d.",
+                errno);
+            return OH_NN_SAVE_CACHE_EXCEPTION;
+        }
+    }
+
+    if (rename((tempDir + "/" + cacheInfoName).c_str(), (cachePath + "/" + cacheInfoName).c_str()) != 0) {
+        LOGE("[NNCompiledCache] PublishCacheFiles failed, fail to publish cache info, errno is %{public}d.", errno);
+        return OH_NN_SAVE_CACHE_EXCEPTION;
+    }
     return OH_NN_SUCCESS;
 }
 
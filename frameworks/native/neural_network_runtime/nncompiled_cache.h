@@ -71,6 +71,11 @@ private:
     OH_NN_ReturnCode CheckCache(const std::string& cacheDir,
                                 uint32_t version,
                                 std::vector<OHOS::NeuralNetworkRuntime::Buffer>& caches);
+    OH_NN_ReturnCode CreateTempDir(const std::string& cacheDir, std::string& tempDir) const;
+    void RemoveStaleTempDirs(const std::string& cacheDir) const;
+    OH_NN_ReturnCode PublishCacheFiles(const std::string& tempDir,
+                                       const std::string& cacheDir,
+                                       size_t cacheNumber) const;
     OH_NN_ReturnCode GenerateCacheFiles(const std::vector<Buffer>& caches,
                                         const std::string& cacheDir,
                                         uint32_t version) const;
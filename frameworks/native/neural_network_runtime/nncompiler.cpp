@@ -17,12 +17,22 @@
 #include "neural_network_runtime/neural_network_runtime.h"
 
 #include <sys/stat.h>
+#include <algorithm>
 #include <fstream>
 #include <climits>
+#include <sstream>
 #include <securec.h>
 
 #include "validation.h"
+#include "hetero_partitioner.h"
+#include "hetero_prepared_model.h"
+#include "latency_metrics.h"
+#include "cache_dir_manager.h"
+#include "cache_writer.h"
 #include "nncompiled_cache.h"
+#include "prepared_model_registry.h"
+#include "state_tensors.h"
+#include "transform.h"
 #include "utils.h"
 #include "nlohmann/json.hpp"
 
@@ -36,15 +46,42 @@ constexpr int32_t NUMBER_CACHE_INFO_EXTENSION_MEMBERS = 2;
 const std::string EXTENSION_KEY_MODEL_NAME = "ModelName";
 const std::string EXTENSION_KEY_FM_SHARED = "NPU_FM_SHARED";
 const std::string EXTENSION_KEY_IS_EXCEED_RAMLIMIT = "isExceedRamLimit";
+const std::string EXTENSION_KEY_HETERO_PARTITION = "HeteroPartition";
+const std::string EXTENSION_KEY_STATE_TENSORS = "StateTensors";
+const std::string EXTENSION_KEY_IO_ALIAS = "IoAlias";
+constexpr size_t IO_ALIAS_FIELDS = 2;
 constexpr size_t INPUT_OUTPUT_MAX_NUM = 200;
 constexpr size_t MORE_MODEL_MAX_LIMIT = 201 * 1024 * 1024; // 201MB
 constexpr size_t MODEL_MAX_LIMIT = 200 * 1024 * 1024; // 200MB
 constexpr size_t CHECK_SUM_ZERO = 0;
 constexpr size_t CHECK_SUM_ONE = 1;
 constexpr size_t CHECK_SUM_TWO = 2;
-constexpr size_t EXTRACT_NODE_LAYER = 3;
 constexpr int32_t MINDSPORE_CONST_NODE_TYPE = 0;
 
+// Parses aliases written as "output:input" and separated by ';', such as "0:0;1:2".
+OH_NN_ReturnCode ParseIoAliases(const std::string& value, std::vector<IoAlias>& ioAliases)
+{
+    ioAliases.clear();
+    std::vector<std::vector<uint32_t>> pairs;
+    OH_NN_ReturnCode ret = ParseIndexPairs(value, IO_ALIAS_FIELDS, pairs);
+    if (ret != OH_NN_SUCCESS) {
+        LOGE("[NNCompiler] ParseIoAliases failed, %{public}s is not output:input.", value.c_str());
+        return ret;
+    }
+
+    for (const std::vector<uint32_t>& fields : pairs) {
+        if (fields[0] >= INPUT_OUTPUT_MAX_NUM || fields[1] >= INPUT_OUTPUT_MAX_NUM) {
+            LOGE("[NNCompiler] ParseIoAliases failed, output %{public}u or input %{public}u is out of range.",
+                fields[0], fields[1]);
+            ioAliases.clear();
+            return OH_NN_INVALID_PARAMETER;
+        }
+        IoAlias ioAlias {fields[0], fields[1]};
+        ioAliases.emplace_back(ioAlias);
+    }
+    return OH_NN_SUCCESS;
+}
+
 struct SerializedTensorDesc {
 public:
     SerializedTensorDesc() = default;
@@ -146,6 +183,9 @@ NNCompiler::NNCompiler(const void* model, std::shared_ptr<Device> device, size_t
 
 NNCompiler::~NNCompiler()
 {
+    if (m_isCachePinned) {
+        CacheDirManager::GetInstance().Unpin(m_cachePath, m_extensionConfig.modelName);
+    }
     if (m_preparedModel != nullptr) {
         m_preparedModel.reset();
     }
@@ -349,10 +389,57 @@ OH_NN_ReturnCode NNCompiler::IsOfflineModel(bool& isOfflineModel) const
     return OH_NN_SUCCESS;
 }
 
+std::string NNCompiler::GetSharingKey(const std::string& source) const
+{
+    // A quant buffer is only valid during the build, its content is not known here.
+    if (source.empty() || (m_extensionConfig.quantBuffer.data != nullptr)) {
+        return "";
+    }
+
+    // State bindings and io aliases are handled by the executors and do not change the prepared model.
+    std::ostringstream key;
+    key << source << "|backend:" << m_backendID << "|fp16:" << m_enableFp16 << "|performance:" << m_performance
+        << "|priority:" << m_priority << "|cache:" << m_cachePath << "|name:" << m_extensionConfig.modelName
+        << "|profiling:" << m_extensionConfig.isProfiling
+        << "|tuning:" << static_cast<int>(m_extensionConfig.tuningStrategy)
+        << "|fmShared:" << m_extensionConfig.isNpuFmShared << "|exceedRam:" << m_extensionConfig.isExceedRamLimit
+        << "|aipp:" << m_extensionConfig.aippPath << "|layout:";
+    for (const auto& layout : m_extensionConfig.opLayout) {
+        key << layout.first << "=" << layout.second << ";";
+    }
+    for (const auto* dimsList : {&m_extensionConfig.inputDims, &m_extensionConfig.dynamicDims}) {
+        key << "|dims:";
+        for (const auto& dims : *dimsList) {
+            for (int32_t dim : dims) {
+                key << dim << ",";
+            }
+            key << ";";
+        }
+    }
+    return key.str();
+}
+
+OH_NN_ReturnCode NNCompiler::PrepareSharedModel(const std::string& key, const std::shared_ptr<const void>& owner,
+    const PreparedModelRegistry::PrepareFunc& prepare, bool& isPrepared)
+{
+    if (key.empty()) {
+        isPrepared = true;
+        return prepare(m_preparedModel);
+    }
+    return PreparedModelRegistry::GetInstance().Acquire(key, owner, prepare, m_preparedModel, isPrepared);
+}
+
 OH_NN_ReturnCode NNCompiler::BuildOfflineModel()
 {
     ModelConfig config {m_enableFp16, m_performance, m_priority};
-    OH_NN_ReturnCode ret = m_device->PrepareOfflineModel(m_liteGraph, config, m_preparedModel);
+    // The offline model buffer lives in the lite graph, whose identity stands for the model.
+    std::ostringstream source;
+    source << "offline:" << static_cast<const void*>(m_liteGraph.get());
+    bool isPrepared = false;
+    OH_NN_ReturnCode ret = PrepareSharedModel(GetSharingKey(source.str()), m_liteGraph,
+        [this, &config](std::shared_ptr<PreparedModel>& preparedModel) {
+            return m_device->PrepareOfflineModel(m_liteGraph, config, preparedModel);
+        }, isPrepared);
     if (ret != OH_NN_SUCCESS) {
         LOGE("[NNCompiler] Preparing model failed when building from offline model.");
         return ret;
@@ -361,6 +448,72 @@ OH_NN_ReturnCode NNCompiler::BuildOfflineModel()
     return OH_NN_SUCCESS;
 }
 
+OH_NN_ReturnCode NNCompiler::BuildHeteroModel(const ModelConfig& config, bool& isHeteroModel)
+{
+    isHeteroModel = false;
+    HeteroPartitioner partitioner(m_backendID, m_device);
+    std::vector<HeteroSubgraph> subgraphs;
+    OH_NN_ReturnCode ret = partitioner.Partition(m_liteGraph, subgraphs);
+    if (ret != OH_NN_SUCCESS) {
+        LOGE("[NNCompiler] BuildHeteroModel failed, fail to partition the model.");
+        return ret;
+    }
+
+    // The whole model runs on the compilation's own device, build it as usual.
+    if ((subgraphs.size() == 1) && (subgraphs[0].backendID == m_backendID)) {
+        return OH_NN_SUCCESS;
+    }
+
+    std::shared_ptr<HeteroPreparedModel> heteroModel =
+        CreateSharedPtr<HeteroPreparedModel>(m_liteGraph->input_indices_, m_liteGraph->output_indices_);
+    if (heteroModel == nullptr) {
+        LOGE("[NNCompiler] BuildHeteroModel failed, error happened when creating HeteroPreparedModel.");
+        return OH_NN_MEMORY_ERROR;
+    }
+
+    for (const HeteroSubgraph& subgraph : subgraphs) {
+        // Options the subgraph device cannot honour are dropped instead of failing the whole build.
+        ModelConfig subgraphConfig = config;
+        subgraphConfig.cachePath.clear();
+        bool isSupported {false};
+        if ((subgraph.device->IsFloat16PrecisionSupported(isSupported) != OH_NN_SUCCESS) || !isSupported) {
+            subgraphConfig.enableFloat16 = false;
+        }
+        if ((subgraph.device->IsPerformanceModeSupported(isSupported) != OH_NN_SUCCESS) || !isSupported) {
+            subgraphConfig.mode = OH_NN_PERFORMANCE_NONE;
+        }
+        if ((subgraph.device->IsPrioritySupported(isSupported) != OH_NN_SUCCESS) || !isSupported) {
+            subgraphConfig.priority = OH_NN_PRIORITY_NONE;
+        }
+
+        std::shared_ptr<PreparedModel> preparedModel;
+        ret = subgraph.device->PrepareModel(subgraph.liteGraph, subgraphConfig, preparedModel);
+        if (ret != OH_NN_SUCCESS) {
+            LOGE("[NNCompiler] BuildHeteroModel failed, fail to prepare subgraph on backend %{public}zu.",
+                subgraph.backendID);
+            return ret;
+        }
+
+        ret = heteroModel->AddStage(subgraph, preparedModel);
+        if (ret != OH_NN_SUCCESS) {
+            LOGE("[NNCompiler] BuildHeteroModel failed, fail to add the subgraph of backend %{public}zu.",
+                subgraph.backendID);
+            return ret;
+        }
+    }
+
+    ret = heteroModel->Finish();
+    if (ret != OH_NN_SUCCESS) {
+        LOGE("[NNCompiler] BuildHeteroModel failed, the subgraphs do not cover all model outputs.");
+        return ret;
+    }
+
+    LOGI("[NNCompiler] Model is partitioned into %{public}zu subgraphs.", subgraphs.size());
+    m_preparedModel = heteroModel;
+    isHeteroModel = true;
+    return OH_NN_SUCCESS;
+}
+
 OH_NN_ReturnCode NNCompiler::NormalBuild()
 {
     if ((m_liteGraph == nullptr) && (m_metaGraph == nullptr)) {
@@ -373,38 +526,62 @@ OH_NN_ReturnCode NNCompiler::NormalBuild()
         return OH_NN_INVALID_PARAMETER;
     }
 
-    // 判断是否支持模型
-    bool isSupportedModel = true;
-    OH_NN_ReturnCode ret = IsSupportedModel(m_liteGraph, isSupportedModel);
-    if (ret != OH_NN_SUCCESS) {
-        LOGE("[NNCompiler] Build failed, error happened when judge if support the model.");
-        return ret;
-    } else if (!isSupportedModel) {
-        LOGE("[NNCompiler] Build failed, current device not support the model.");
-        return OH_NN_FAILED;
-    }
-
     ModelConfig config {m_enableFp16, static_cast<OH_NN_PerformanceMode>(m_performance),
         static_cast<OH_NN_Priority>(m_priority), m_cachePath, m_extensionConfig};
-    if (m_liteGraph != nullptr) {
-        ret = m_device->PrepareModel(m_liteGraph, config, m_preparedModel);
-    }
-    if (m_metaGraph != nullptr) {
-        ret = m_device->PrepareModel(m_metaGraph, config, m_preparedModel);
+    bool isHeteroModel = false;
+    bool isPrepared = true;
+    OH_NN_ReturnCode ret = OH_NN_SUCCESS;
+    if ((m_liteGraph != nullptr) && m_extensionConfig.isHeteroPartition) {
+        ret = BuildHeteroModel(config, isHeteroModel);
+        if (ret != OH_NN_SUCCESS) {
+            LOGE("[NNCompiler] Build failed, fail to build the model across backends.");
+            return ret;
+        }
     }
-    if (ret != OH_NN_SUCCESS) {
-        LOGE("[NNCompiler] Build failed, fail to prepare model when normally building.");
-        return ret;
+
+    if (!isHeteroModel) {
+        // 判断是否支持模型
+        bool isSupportedModel = true;
+        ret = IsSupportedModel(m_liteGraph, isSupportedModel);
+        if (ret != OH_NN_SUCCESS) {
+            LOGE("[NNCompiler] Build failed, error happened when judge if support the model.");
+            return ret;
+        } else if (!isSupportedModel) {
+            LOGE("[NNCompiler] Build failed, current device not support the model.");
+            return OH_NN_FAILED;
+        }
+
+        if (m_liteGraph != nullptr) {
+            // Compilations of the same lite graph with the same options share one prepared model.
+            std::ostringstream source;
+            source << "online:" << static_cast<const void*>(m_liteGraph.get());
+            ret = PrepareSharedModel(GetSharingKey(source.str()), m_liteGraph,
+                [this, &config](std::shared_ptr<PreparedModel>& preparedModel) {
+                    return m_device->PrepareModel(m_liteGraph, config, preparedModel);
+                }, isPrepared);
+        }
+        if (m_metaGraph != nullptr) {
+            ret = m_device->PrepareModel(m_metaGraph, config, m_preparedModel);
+        }
+        if (ret != OH_NN_SUCCESS) {
+            LOGE("[NNCompiler] Build failed, fail to prepare model when normally building.");
+            return ret;
+        }
     }
     m_isBuild = true;
 
-    // 保存cache
-    if (!m_cachePath.empty()) {
-        ret = SaveToCacheFile();
+    // 保存cache，跨设备切分的模型不支持cache，共享的模型已由首次编译保存
+    if (!m_cachePath.empty() && isHeteroModel) {
+        LOGW("[NNCompiler] Build success, but a model partitioned across backends is not saved to cache.");
+    } else if (!m_cachePath.empty() && isPrepared) {
+        // cache只在下次启动时使用，在后台写入，构图不等待磁盘IO
+        CacheWriter::WriteTask task;
+        ret = CreateCacheWriteTask(task);
         if (ret != OH_NN_SUCCESS) {
             LOGE("[NNCompiler] Build success, but fail to save cache to file.");
             return ret;
         }
+        CacheWriter::GetInstance().Post(CacheWriter::GetCacheKey(m_cachePath, m_extensionConfig.modelName), task);
     }
 
     return OH_NN_SUCCESS;
@@ -412,6 +589,7 @@ OH_NN_ReturnCode NNCompiler::NormalBuild()
 
 OH_NN_ReturnCode NNCompiler::Build()
 {
+    NNRT_LATENCY_SCOPE(OH_NN_STAGE_BUILD);
     if (m_isBuild) {
         LOGE("[NNCompiler] Build failed, cannot build again.");
         return OH_NN_OPERATION_FORBIDDEN;
@@ -453,6 +631,11 @@ OH_NN_ReturnCode NNCompiler::Build()
         return ret;
     }
 
+    // The executors of the compilation reload the model from the cache after unloading it.
+    if (!m_cachePath.empty()) {
+        CacheDirManager::GetInstance().Pin(m_cachePath, m_extensionConfig.modelName);
+        m_isCachePinned = true;
+    }
     return OH_NN_SUCCESS;
 }
 
@@ -471,7 +654,7 @@ OH_NN_ReturnCode NNCompiler::OnlineBuild()
         std::string cacheInfo = cachePath + "/" + m_extensionConfig.modelName + "cache_info.nncache";
         if (std::filesystem::exists(cacheInfo)) {
             LOGW("[NNCompiler] cache file is failed, fail to delete cache file.");
-            std::filesystem::remove_all(cacheInfo);
+            CacheDirManager::GetInstance().RemoveCache(cachePath, m_extensionConfig.modelName);
         }
     }
 
@@ -496,7 +679,7 @@ OH_NN_ReturnCode NNCompiler::OnlineBuild()
     return OH_NN_SUCCESS;
 }
 
-void NNCompiler::ReleaseBuffer(std::vector<Buffer>& buffers) const
+void NNCompiler::ReleaseBuffer(std::vector<Buffer>& buffers)
 {
     for (size_t i = 0; i < buffers.size(); ++i) {
         // release tensor buffer which is allocated by new method.
@@ -506,6 +689,18 @@ void NNCompiler::ReleaseBuffer(std::vector<Buffer>& buffers) const
 }
 
 OH_NN_ReturnCode NNCompiler::SaveToCacheFile() const
+{
+    CacheWriter::WriteTask task;
+    OH_NN_ReturnCode ret = CreateCacheWriteTask(task);
+    if (ret != OH_NN_SUCCESS) {
+        LOGE("[NNCompiler] SaveToCacheFile failed, fail to create the cache write task.");
+        return ret;
+    }
+
+    return task();
+}
+
+OH_NN_ReturnCode NNCompiler::CreateCacheWriteTask(CacheWriter::WriteTask& task) const
 {
     if (m_cachePath.empty()) {
         LOGE("[NNCompiler] SaveToCacheFile failed, m_cachePath is empty.");
@@ -522,22 +717,13 @@ OH_NN_ReturnCode NNCompiler::SaveToCacheFile() const
         return OH_NN_FAILED;
     }
 
-    std::vector<Buffer> caches;
-    std::vector<Buffer> tensorBuffers;
-    OH_NN_ReturnCode ret = m_preparedModel->ExportModelCache(caches);
-    if (ret != OH_NN_SUCCESS) {
-        LOGE("[NNCompiler] SaveToCacheFile failed, error happened when exporting model cache.");
-        return ret;
+    std::shared_ptr<NNCompiledCache> compiledCache = CreateSharedPtr<NNCompiledCache>();
+    if (compiledCache == nullptr) {
+        LOGE("[NNCompiler] SaveToCacheFile failed, error happened when creating NNCompiledCache.");
+        return OH_NN_MEMORY_ERROR;
     }
 
-    size_t cacheNumber = caches.size();
-    if (cacheNumber == 0 || cacheNumber > NN_CACHE_FILE_NUMBER_MAX) {
-        LOGE("[NNCompiler] Caches size is equal 0 or greater than 100.");
-        return OH_NN_FAILED;
-    }
-
-    NNCompiledCache compiledCache;
-    ret = compiledCache.SetBackend(m_backendID);
+    OH_NN_ReturnCode ret = compiledCache->SetBackend(m_backendID);
     if (ret != OH_NN_SUCCESS) {
         LOGE("[NNCompiler] SaveToCacheFile failed, fail to set backend.");
         return ret;
@@ -548,13 +734,14 @@ OH_NN_ReturnCode NNCompiler::SaveToCacheFile() const
         return OH_NN_INVALID_PARAMETER;
     }
 
+    // The tensor descs are serialized here, the executors may change them while the cache is being written.
+    std::vector<Buffer> tensorBuffers;
     Buffer inputTensorDescBuffer;
     ret = SerializeTensorsToBuffer(m_inputTensorDescs, inputTensorDescBuffer);
     if (ret != OH_NN_SUCCESS) {
         LOGE("[NNCompiler] SaveToCacheFile failed, error happened when serializing input tensor desc.");
         return ret;
     }
-    caches.emplace_back(inputTensorDescBuffer);
     tensorBuffers.emplace_back(inputTensorDescBuffer);
 
     Buffer outputTensorDescBuffer;
@@ -564,20 +751,59 @@ OH_NN_ReturnCode NNCompiler::SaveToCacheFile() const
         ReleaseBuffer(tensorBuffers);
         return ret;
     }
-    caches.emplace_back(outputTensorDescBuffer);
     tensorBuffers.emplace_back(outputTensorDescBuffer);
 
-    compiledCache.SetModelName(m_extensionConfig.modelName);
-    compiledCache.SetIsExceedRamLimit(m_extensionConfig.isExceedRamLimit);
-    ret = compiledCache.Save(caches, m_cachePath, m_cacheVersion);
+    compiledCache->SetModelName(m_extensionConfig.modelName);
+    compiledCache->SetIsExceedRamLimit(m_extensionConfig.isExceedRamLimit);
+
+    // The buffers are released with the task, whether it has run or not.
+    auto releaseBuffers = [](std::vector<Buffer>* buffers) {
+        if (buffers != nullptr) {
+            ReleaseBuffer(*buffers);
+            delete buffers;
+        }
+    };
+    std::shared_ptr<std::vector<Buffer>> ownedBuffers(new (std::nothrow) std::vector<Buffer>(tensorBuffers),
+        releaseBuffers);
+    if (ownedBuffers == nullptr) {
+        LOGE("[NNCompiler] SaveToCacheFile failed, fail to create the tensor buffers of the write task.");
+        ReleaseBuffer(tensorBuffers);
+        return OH_NN_MEMORY_ERROR;
+    }
+
+    // The task holds everything it needs, it may run after the compilation has been destroyed.
+    task = [preparedModel = m_preparedModel, compiledCache, ownedBuffers, cachePath = m_cachePath,
+        cacheVersion = m_cacheVersion]() {
+        return WriteCacheFile(preparedModel, *compiledCache, *ownedBuffers, cachePath, cacheVersion);
+    };
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode NNCompiler::WriteCacheFile(const std::shared_ptr<PreparedModel>& preparedModel,
+    NNCompiledCache& compiledCache, const std::vector<Buffer>& tensorBuffers, const std::string& cachePath,
+    uint32_t cacheVersion)
+{
+    std::vector<Buffer> caches;
+    OH_NN_ReturnCode ret = preparedModel->ExportModelCache(caches);
+    if (ret != OH_NN_SUCCESS) {
+        LOGE("[NNCompiler] SaveToCacheFile failed, error happened when exporting model cache.");
+        return ret;
+    }
+
+    size_t cacheNumber = caches.size();
+    if (cacheNumber == 0 || cacheNumber > NN_CACHE_FILE_NUMBER_MAX) {
+        LOGE("[NNCompiler] Caches size is equal 0 or greater than 100.");
+        return OH_NN_FAILED;
+    }
+
+    caches.insert(caches.end(), tensorBuffers.begin(), tensorBuffers.end());
+    ret = compiledCache.Save(caches, cachePath, cacheVersion);
     if (ret != OH_NN_SUCCESS) {
         LOGE("[NNCompiler] SaveToCacheFile failed, error happened when saving model cache.");
-        ReleaseBuffer(tensorBuffers);
         return ret;
     }
 
-    ReleaseBuffer(tensorBuffers);
-    ret = m_preparedModel->ReleaseBuiltModel();
+    ret = preparedModel->ReleaseBuiltModel();
     if (ret != OH_NN_SUCCESS) {
         LOGE("[NNCompiler] ReleaseBuiltModel failed, error happened when release model cache.");
         return ret;
@@ -589,6 +815,7 @@ OH_NN_ReturnCode NNCompiler::SaveToCacheFile() const
 
 OH_NN_ReturnCode NNCompiler::RestoreFromCacheFile()
 {
+    NNRT_LATENCY_SCOPE(OH_NN_STAGE_CACHE_RESTORE);
     if (m_cachePath.empty()) {
         LOGE("[NNCompiler] RestoreFromCacheFile failed, path is empty.");
         return OH_NN_INVALID_PARAMETER;
@@ -604,6 +831,9 @@ OH_NN_ReturnCode NNCompiler::RestoreFromCacheFile()
         return OH_NN_FAILED;
     }
 
+    // A cache which an earlier build of this process is still writing is read after it has been published.
+    CacheWriter::GetInstance().Wait(CacheWriter::GetCacheKey(m_cachePath, m_extensionConfig.modelName));
+
     NNCompiledCache compiledCache;
     OH_NN_ReturnCode ret = compiledCache.SetBackend(m_backendID);
     if (ret != OH_NN_SUCCESS) {
@@ -644,7 +874,13 @@ OH_NN_ReturnCode NNCompiler::RestoreFromCacheFile()
     config.extensionConfig.isNpuFmShared = m_extensionConfig.isNpuFmShared;
     std::vector<Buffer> modelOnlyCaches(caches.begin(), caches.end() - CACHE_INPUT_TENSORDESC_OFFSET);
     bool isUpdatable = false;
-    ret = m_device->PrepareModelFromModelCache(modelOnlyCaches, config, m_preparedModel, isUpdatable);
+    bool isPrepared = false;
+    std::ostringstream source;
+    source << "restore:" << m_cacheVersion;
+    ret = PrepareSharedModel(GetSharingKey(source.str()), nullptr,
+        [this, &modelOnlyCaches, &config, &isUpdatable](std::shared_ptr<PreparedModel>& preparedModel) {
+            return m_device->PrepareModelFromModelCache(modelOnlyCaches, config, preparedModel, isUpdatable);
+        }, isPrepared);
     if (ret != OH_NN_SUCCESS) {
         LOGE("[NNCompiler] RestoreFromCacheFile failed, error happened when preparing model from cache.");
         compiledCache.ReleaseCacheBuffer(caches);
@@ -708,6 +944,7 @@ OH_NN_ReturnCode NNCompiler::RestoreFromCacheFile()
     }
 
     compiledCache.ReleaseCacheBuffer(caches);
+    CacheDirManager::GetInstance().OnCacheRestored(m_cachePath, m_extensionConfig.modelName);
 
     m_inputTensorDescs = inputTensorDescs;
     m_outputTensorDescs = outputTensorDescs;
@@ -753,6 +990,35 @@ OH_NN_ReturnCode NNCompiler::SetExtensionConfig(const std::unordered_map<std::st
             m_extensionConfig.isExceedRamLimit = false;
         }
     }
+    if (configs.find(EXTENSION_KEY_HETERO_PARTITION) != configs.end()) {
+        std::vector<char> value = configs.at(EXTENSION_KEY_HETERO_PARTITION);
+        if (value.empty()) {
+            LOGE("[NNCompiler] SetExtensionConfig get empty hetero partition value from configs");
+            return OH_NN_INVALID_PARAMETER;
+        }
+        m_extensionConfig.isHeteroPartition = (value[0] == '1');
+    }
+    if (configs.find(EXTENSION_KEY_STATE_TENSORS) != configs.end()) {
+        std::vector<char> value = configs.at(EXTENSION_KEY_STATE_TENSORS);
+        std::string bindings(value.data(), value.data() + value.size());
+        // The value may be passed with its terminating null character.
+        bindings.erase(std::find(bindings.begin(), bindings.end(), '\0'), bindings.end());
+        OH_NN_ReturnCode ret = StateTensors::ParseBindings(bindings, m_extensionConfig.stateBindings);
+        if (ret != OH_NN_SUCCESS) {
+            LOGE("[NNCompiler] SetExtensionConfig get invalid state tensors from configs");
+            return ret;
+        }
+    }
+    if (configs.find(EXTENSION_KEY_IO_ALIAS) != configs.end()) {
+        std::vector<char> value = configs.at(EXTENSION_KEY_IO_ALIAS);
+        std::string ioAliases(value.data(), value.data() + value.size());
+        ioAliases.erase(std::find(ioAliases.begin(), ioAliases.end(), '\0'), ioAliases.end());
+        OH_NN_ReturnCode ret = ParseIoAliases(ioAliases, m_extensionConfig.ioAliases);
+        if (ret != OH_NN_SUCCESS) {
+            LOGE("[NNCompiler] SetExtensionConfig get invalid io aliases from configs");
+            return ret;
+        }
+    }
     return OH_NN_SUCCESS;
 }
 
@@ -893,27 +1159,21 @@ OH_NN_ReturnCode NNCompiler::SerializeTensorsToBuffer(
     return OH_NN_SUCCESS;
 }
 
-void ReleaseDescShape(std::vector<SerializedTensorDesc>& immediateTensorDescs)
-{
-    for (auto desc : immediateTensorDescs) {
-        delete[] desc.m_shape;
-    }
-    immediateTensorDescs.clear();
-}
-
 OH_NN_ReturnCode NNCompiler::DeserializedTensorsFromBuffer(
     const Buffer& buffer, std::vector<std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType>>& tensorDescs)
 {
-    std::vector<SerializedTensorDesc> immediateTensorDescs;
     const char* ptr = static_cast<const char*>(buffer.data);
     const char* end = ptr + buffer.length;
     while (ptr < end) {
         SerializedTensorDesc desc;
+        // The shape is copied out of the cache buffer, which is not aligned for int32_t, into a stack array instead
+        // of a heap one, TensorDesc keeps it inline.
+        int32_t shape[TensorDesc::SHAPE_MAX_NUM] {0};
 
         auto memRet = memcpy_s(&desc.m_dataType, SIZE_OF_DATATYPE, ptr, sizeof(desc.m_dataType));
         if (memRet != EOK) {
             LOGE("[NNCompiler] DeserializedTensorsFromBuffer failed, failed to memcpy_s data type.");
-            ReleaseDescShape(immediateTensorDescs);
+            tensorDescs.clear();
             return OH_NN_MEMORY_ERROR;
         }
         ptr += sizeof(desc.m_dataType);
@@ -921,7 +1181,7 @@ OH_NN_ReturnCode NNCompiler::DeserializedTensorsFromBuffer(
         memRet = memcpy_s(&desc.m_format, SIZE_OF_FORMAT, ptr, sizeof(desc.m_format));
         if (memRet != EOK) {
             LOGE("[NNCompiler] DeserializedTensorsFromBuffer failed, failed to memcpy_s format.");
-            ReleaseDescShape(immediateTensorDescs);
+            tensorDescs.clear();
             return OH_NN_MEMORY_ERROR;
         }
         ptr += sizeof(desc.m_format);
@@ -929,7 +1189,7 @@ OH_NN_ReturnCode NNCompiler::DeserializedTensorsFromBuffer(
         memRet = memcpy_s(&desc.m_tensorType, SIZE_OF_TENSOR_TYPE, ptr, sizeof(desc.m_tensorType));
         if (memRet != EOK) {
             LOGE("[NNCompiler] DeserializedTensorsFromBuffer failed, failed to memcpy_s tensor type.");
-            ReleaseDescShape(immediateTensorDescs);
+            tensorDescs.clear();
             return OH_NN_MEMORY_ERROR;
         }
         ptr += sizeof(desc.m_tensorType);
@@ -937,56 +1197,43 @@ OH_NN_ReturnCode NNCompiler::DeserializedTensorsFromBuffer(
         memRet = memcpy_s(&desc.m_shapeNum, SIZE_OF_SHAPE_NUM, ptr, sizeof(desc.m_shapeNum));
         if (memRet != EOK) {
             LOGE("[NNCompiler] DeserializedTensorsFromBuffer failed, failed to memcpy_s shape num.");
-            ReleaseDescShape(immediateTensorDescs);
+            tensorDescs.clear();
             return OH_NN_MEMORY_ERROR;
         }
         ptr += sizeof(desc.m_shapeNum);
 
-        desc.m_shape = new (std::nothrow) int32_t[desc.m_shapeNum];
-        if (desc.m_shape == nullptr) {
-            LOGE("[NNCompiler] DeserializedTensorsFromBuffer failed, failed to create shape buffer.");
-            ReleaseDescShape(immediateTensorDescs);
-            return OH_NN_NULL_PTR;
-        }
-        memRet = memcpy_s(desc.m_shape, desc.m_shapeNum * sizeof(int32_t), ptr, desc.m_shapeNum * sizeof(int32_t));
+        memRet = memcpy_s(shape, sizeof(shape), ptr, desc.m_shapeNum * sizeof(int32_t));
         if (memRet != EOK) {
             LOGE("[NNCompiler] DeserializedTensorsFromBuffer failed, failed to memcpy_s shape.");
-            ReleaseDescShape(immediateTensorDescs);
+            tensorDescs.clear();
             return OH_NN_MEMORY_ERROR;
         }
         ptr += desc.m_shapeNum * sizeof(int32_t);
+        desc.m_shape = shape;
 
         desc.m_name = ptr;
         ptr += std::strlen(desc.m_name) + 1; // +1 for null terminator
 
-        immediateTensorDescs.push_back(desc);
-    }
-
-    OH_NN_ReturnCode ret {OH_NN_SUCCESS};
-    for (const auto& immediateTensorDesc : immediateTensorDescs) {
         std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType> tensorDescPair;
         tensorDescPair.first = CreateSharedPtr<TensorDesc>();
         if (tensorDescPair.first == nullptr) {
             LOGE("[NNCompiler] DeserializedTensorsFromBuffer failed, failed to create tensor desc.");
             tensorDescs.clear();
-            ReleaseDescShape(immediateTensorDescs);
             return OH_NN_NULL_PTR;
         }
-        ret = immediateTensorDesc.CopyToTensorDesc(*(tensorDescPair.first.get()));
+        OH_NN_ReturnCode ret = desc.CopyToTensorDesc(*(tensorDescPair.first.get()));
         if (ret != OH_NN_SUCCESS) {
             LOGE("[NNCompiler] DeserializedTensorsFromBuffer failed, error happened when copying "
                  "SerializedTensorDesc to TensorDesc.");
             tensorDescs.clear();
-            ReleaseDescShape(immediateTensorDescs);
             return ret;
         }
-        tensorDescPair.second = immediateTensorDesc.m_tensorType;
+        tensorDescPair.second = desc.m_tensorType;
 
         tensorDescs.emplace_back(tensorDescPair);
     }
 
-    ReleaseDescShape(immediateTensorDescs);
-    return ret;
+    return OH_NN_SUCCESS;
 }
 
 size_t NNCompiler::DataTypeSize(mindspore::lite::DataType dataType)
@@ -1018,6 +1265,9 @@ size_t NNCompiler::DataTypeSize(mindspore::lite::DataType dataType)
         case mindspore::lite::DATA_TYPE_UNKNOWN:
             return 0;
         default:
+            if (dataType == MS_DATA_TYPE_BFLOAT16) {
+                return sizeof(uint16_t);
+            }
             LOGE("Not support the type: %{public}d", dataType);
             return 0;
     }
@@ -1075,7 +1325,8 @@ size_t NNCompiler::GetModelSizeFromModel(InnerModel* innerModel)
             LOGE("model size exceed max limit size, please check.");
             return 0;
         }
-        modelSize +=  (tensorSize * DataTypeSize(dtype));
+        modelSize += (dtype == MS_DATA_TYPE_INT4) ? GetDataByteSize(OH_NN_INT4, tensorSize) :
+            (tensorSize * DataTypeSize(dtype));
     }
 
     LOGD("GetModelSizeFromModel, modelSize: %{public}zu.", modelSize);
@@ -1167,53 +1418,6 @@ size_t NNCompiler::GetModelSize()
     return modelSize;
 }
 
-std::vector<mindspore::lite::LiteGraph::Node*> NNCompiler::GetNodeIndices(
-    const std::shared_ptr<mindspore::lite::LiteGraph>& liteGraph, size_t layer)
-{
-    std::vector<mindspore::lite::LiteGraph::Node*> nodes;
-    size_t inputTensorSize = liteGraph->input_indices_.size();
-    size_t outputTensorSize = liteGraph->output_indices_.size();
-
-    size_t allnodeSize = liteGraph->all_nodes_.size();
-    if (((inputTensorSize + outputTensorSize) * layer) >= allnodeSize) {
-        LOGI("The all node size in model is too small, return all nodes.");
-        return liteGraph->all_nodes_;
-    }
-
-    for (size_t i = 0; i < inputTensorSize * layer; ++i) {
-        nodes.emplace_back(liteGraph->all_nodes_[i]);
-    }
-
-    for (size_t j = allnodeSize - 1; j >= (allnodeSize - (outputTensorSize * layer)); --j) {
-        nodes.emplace_back(liteGraph->all_nodes_[j]);
-    }
-
-    LOGD("nodes size : %{public}zu.", nodes.size());
-    return nodes;
-}
-
-size_t NNCompiler::GetOnlineModelID(const std::shared_ptr<mindspore::lite::LiteGraph>& liteGraph)
-{
-    size_t inputSize = liteGraph->input_indices_.size();
-    size_t outputSize = liteGraph->output_indices_.size();
-    size_t allTensorSize = liteGraph->all_tensors_.size();
-    size_t allNodesSize = liteGraph->all_nodes_.size();
-
-    std::string onlineModelId = "";
-    onlineModelId.append(std::to_string(inputSize));
-    onlineModelId.append(std::to_string(outputSize));
-    onlineModelId.append(std::to_string(allTensorSize));
-    onlineModelId.append(std::to_string(allNodesSize));
-
-    std::vector<mindspore::lite::LiteGraph::Node*> nodes = GetNodeIndices(liteGraph, EXTRACT_NODE_LAYER);
-
-    for (auto node : nodes) {
-        onlineModelId.append(node->name_);
-    }
-
-    return std::hash<std::string>{}(onlineModelId);
-}
-
 OH_NN_ReturnCode NNCompiler::GetNNRtModelIDFromModel(InnerModel* innerModel, size_t& nnrtModelID)
 {
     if (innerModel == nullptr) {
@@ -1227,7 +1431,7 @@ OH_NN_ReturnCode NNCompiler::GetNNRtModelIDFromModel(InnerModel* innerModel, siz
         return OH_NN_INVALID_PARAMETER;
     }
 
-    nnrtModelID = GetOnlineModelID(liteGraph);
+    nnrtModelID = innerModel->GetFingerprint();
     return OH_NN_SUCCESS;
 }
 
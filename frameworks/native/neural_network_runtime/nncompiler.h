@@ -19,9 +19,12 @@
 #include "compiler.h"
 
 #include "mindir.h"
+#include "cache_writer.h"
 #include "device.h"
 #include "inner_model.h"
+#include "nncompiled_cache.h"
 #include "prepared_model.h"
+#include "prepared_model_registry.h"
 #include "nnexecutor.h"
 
 namespace OHOS {
@@ -58,7 +61,7 @@ public:
     NNExecutor* CreateExecutor();
 
 private:
-    void ReleaseBuffer(std::vector<Buffer>& buffers) const;
+    static void ReleaseBuffer(std::vector<Buffer>& buffers);
     void ReleaseBufferByDevice(std::vector<Buffer>& buffers) const;
     OH_NN_ReturnCode SerializeTensorsToBuffer(
         const std::vector<std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType>>& tensorDescs,
@@ -66,9 +69,19 @@ private:
     OH_NN_ReturnCode DeserializedTensorsFromBuffer(
         const Buffer& buffer, std::vector<std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType>>& tensorDescs);
 
+    OH_NN_ReturnCode CreateCacheWriteTask(CacheWriter::WriteTask& task) const;
+    static OH_NN_ReturnCode WriteCacheFile(const std::shared_ptr<PreparedModel>& preparedModel,
+                                           NNCompiledCache& compiledCache, const std::vector<Buffer>& tensorBuffers,
+                                           const std::string& cachePath, uint32_t cacheVersion);
+
     OH_NN_ReturnCode OnlineBuild();
     OH_NN_ReturnCode NormalBuild();
     OH_NN_ReturnCode BuildOfflineModel();
+    OH_NN_ReturnCode BuildHeteroModel(const ModelConfig& config, bool& isHeteroModel);
+    // Returns the key under which the prepared model of source is shared, or an empty key if it cannot be shared.
+    std::string GetSharingKey(const std::string& source) const;
+    OH_NN_ReturnCode PrepareSharedModel(const std::string& key, const std::shared_ptr<const void>& owner,
+                                        const PreparedModelRegistry::PrepareFunc& prepare, bool& isPrepared);
     OH_NN_ReturnCode CheckModelParameter() const;
     OH_NN_ReturnCode IsOfflineModel(bool& isOfflineModel) const;
     OH_NN_ReturnCode IsSupportedModel(const std::shared_ptr<mindspore::lite::LiteGraph>& liteGraph,
@@ -80,15 +93,13 @@ private:
     OH_NN_ReturnCode GetNNRtModelIDFromCache(const std::string& path, const std::string& modelName,
         size_t& nnrtModelID);
     OH_NN_ReturnCode GetNNRtModelIDFromModel(InnerModel* innerModel, size_t& nnrtModelID);
-    size_t GetOnlineModelID(const std::shared_ptr<mindspore::lite::LiteGraph>& liteGraph);
-    std::vector<mindspore::lite::LiteGraph::Node*> GetNodeIndices(
-        const std::shared_ptr<mindspore::lite::LiteGraph>& liteGraph, size_t layer);
     size_t DataTypeSize(mindspore::lite::DataType dataType);
     size_t GetFileSize(const char* fileName);
 
 private:
     bool m_isBuild {false};
     bool m_enableFp16 {false};
+    bool m_isCachePinned {false};
     std::string m_cachePath;
     uint32_t m_cacheVersion {0};
     std::shared_ptr<Device> m_device {nullptr};
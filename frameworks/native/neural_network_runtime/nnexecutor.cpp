@@ -15,6 +15,12 @@
 
 
 #include "nnexecutor.h"
+
+#include <algorithm>
+
+#include "aipp_config_registry.h"
+#include "cache_dir_manager.h"
+#include "memory_manager.h"
 #include "nntensor.h"
 #include "nncompiled_cache.h"
 #include "cpp_type.h"
@@ -25,11 +31,11 @@
 #include "securec.h"
 #include "utils.h"
 #include "scoped_trace.h"
+#include "latency_metrics.h"
 #include "transform.h"
 
 namespace OHOS {
 constexpr size_t EXTENSION_MAX_SIZE = 200;
-constexpr int AUTOUNLOAD_TIME = 10 * 60 * 1000;
 
 namespace NeuralNetworkRuntime {
 constexpr int CACHE_INPUT_TENSORDESC_OFFSET = 2;
@@ -38,6 +44,8 @@ constexpr size_t CHECK_SUM_ZERO = 0;
 constexpr size_t CHECK_SUM_ONE = 1;
 constexpr size_t CHECK_SUM_TWO = 2;
 constexpr int32_t  NUMBER_CACHE_INFO_MEMBERS = 3;
+constexpr uint32_t MAX_OUTPUT_GROWTH_RERUNS = 3;
+constexpr size_t OUTPUT_GROWTH_FACTOR = 2;
 
 struct SerializedTensorDesc {
 public:
@@ -164,20 +172,20 @@ NNExecutor::NNExecutor(size_t backendID, std::shared_ptr<Device> device, std::sh
     m_extensionConfig(extensionConfig),
     m_enableFp16(enableFp16),
     m_performance(performance),
-    m_priority(priority) {
+    m_priority(priority),
+    m_stateTensors(backendID, extensionConfig.stateBindings) {
         m_executorid = GenRandom();
         m_autoUnloadRunner = OHOS::AppExecFwk::EventRunner::Create
             ("nnexecutor_autounload" + std::to_string(m_executorid));
         m_autoUnloadHandler = std::make_shared<OHOS::AppExecFwk::EventHandler>(m_autoUnloadRunner);
-        auto autoUnloadTask = [this]() {
-            DeinitModel("DelayUnload");
-        };
-        if (m_autoUnloadHandler != nullptr) {
-            m_autoUnloadHandler->PostTask(autoUnloadTask,
-                "nnexecutor_autounload" + std::to_string(m_executorid), AUTOUNLOAD_TIME);
-        }
+        PostAutoUnloadTask();
 
         GetModelID(m_originHiaiModelId);
+
+        // The model is reloaded from the cache after being unloaded, the cache must outlive the executor.
+        if (!m_cachePath.empty()) {
+            CacheDirManager::GetInstance().Pin(m_cachePath, m_extensionConfig.modelName);
+        }
     }
 
 OH_NN_ReturnCode NNExecutor::GetInputDimVec() const
@@ -264,6 +272,18 @@ OH_NN_ReturnCode NNExecutor::GetOutputShape(uint32_t outputIndex, int32_t** shap
         return OH_NN_INVALID_PARAMETER;
     }
 
+    // After a run the shape comes from the storage of this executor, the tensor desc is shared with the compilation
+    // and every other executor built from it.
+    if (outputIndex < m_outputShapes.size() && !m_outputShapes[outputIndex].empty()) {
+        if (shape == nullptr || *shape != nullptr || shapeNum == nullptr) {
+            LOGE("NNExecutor::GetOutputShape failed, shape or shapeNum is nullptr, or *shape is not nullptr.");
+            return OH_NN_INVALID_PARAMETER;
+        }
+        *shape = const_cast<int32_t*>(m_outputShapes[outputIndex].data());
+        *shapeNum = static_cast<uint32_t>(m_outputShapes[outputIndex].size());
+        return OH_NN_SUCCESS;
+    }
+
     auto tensorDesc = m_outputTensorDescs[outputIndex].first;
     size_t shapeNumTmp = 0;
     auto ret = tensorDesc->GetShape(shape, &shapeNumTmp);
@@ -328,6 +348,9 @@ NN_TensorDesc* NNExecutor::CreateOutputTensorDesc(size_t index) const
 
     // Copy the member attributes to new tensor description
     *tensorDescImpl = *(m_outputTensorDescs[index].first.get());
+    if (index < m_outputShapes.size() && !m_outputShapes[index].empty()) {
+        tensorDescImpl->SetShape(m_outputShapes[index].data(), m_outputShapes[index].size());
+    }
 
     return reinterpret_cast<NN_TensorDesc*>(tensorDescImpl);
 }
@@ -392,15 +415,16 @@ OH_NN_ReturnCode NNExecutor::SetOnServiceDied(NN_OnServiceDied onServiceDied)
 }
 
 
-OH_NN_ReturnCode NNExecutor::ReloadAippModel(uint32_t modelId)
+OH_NN_ReturnCode NNExecutor::ReloadModel()
 {
     if (Reload() != OH_NN_SUCCESS) {
         return OH_NN_INVALID_PARAMETER;
     }
-    
+
+    uint32_t modelId {0};
     auto _ret = GetModelID(modelId);
-    LOGI("AutoReload pid=%{public}d originHiaiModelId=%{public}d hiaiModelId=%{public}d",
-        getpid(), m_originHiaiModelId, modelId);
+    LOGI("AutoReload pid=%{public}ld originHiaiModelId=%{public}u hiaiModelId=%{public}u",
+        static_cast<long>(getpid()), m_originHiaiModelId, modelId);
     if (_ret != OH_NN_SUCCESS) {
         LOGW("GetModelID failed, some error happen when get model id for device.");
     }
@@ -418,8 +442,8 @@ OH_NN_ReturnCode NNExecutor::ReloadAippModel(uint32_t modelId)
     return OH_NN_SUCCESS;
 }
 
-OH_NN_ReturnCode NNExecutor::RunAippModel(NN_Tensor* inputTensors[], size_t inputSize,
-                                          NN_Tensor* outputTensors[], size_t outputSize, const char* aippStrings)
+OH_NN_ReturnCode NNExecutor::RunAippModel(NN_Tensor* inputTensors[], size_t inputSize, NN_Tensor* outputTensors[],
+                                          size_t outputSize, uint32_t aippHandle, const std::string& aippStrings)
 {
     std::vector<NN_Tensor*> inputTensorsVec;
     for (size_t i = 0; i < inputSize; ++i) {
@@ -441,15 +465,11 @@ OH_NN_ReturnCode NNExecutor::RunAippModel(NN_Tensor* inputTensors[], size_t inpu
 
     std::vector<std::vector<int32_t>> outputsDims;
     std::vector<bool> isSufficientDataBuffer;
-    OH_NN_ReturnCode ret = m_preparedModel->SetAippString(aippStrings);
-    if (ret != OH_NN_SUCCESS) {
-        LOGE("RunSyncWithAipp failed, failed to set aipp para in prepared model.");
-        return ret;
-    }
-
-    ret = m_preparedModel->Run(inputTensorsVec, outputTensorsVec, outputsDims, isSufficientDataBuffer);
+    // Executors of one compilation share the prepared model, the aipp para has to stay applied until the run is done.
+    OH_NN_ReturnCode ret = m_preparedModel->RunWithAippConfig(aippHandle, aippStrings, inputTensorsVec,
+        outputTensorsVec, outputsDims, isSufficientDataBuffer);
     if (ret != OH_NN_SUCCESS) {
-        LOGE("RunSyncWithAipp failed, failed to run in prepared model.");
+        LOGE("RunSyncWithAipp failed, failed to set aipp para or run in prepared model.");
         return ret;
     }
 
@@ -460,13 +480,10 @@ OH_NN_ReturnCode NNExecutor::RunAippModel(NN_Tensor* inputTensors[], size_t inpu
         return OH_NN_INVALID_PARAMETER;
     }
 
-    for (size_t i = 0; i < outputSize; ++i) {
-        ret = m_outputTensorDescs[i].first->SetShape(outputsDims[i].data(), outputsDims[i].size());
-        if (ret != OH_NN_SUCCESS) {
-            LOGE("RunSyncWithAipp failed, error happened when setting inner output tensor's dimensions,"
-                " output id: %zu.", i);
-            return ret;
-        }
+    ret = UpdateOutputShapes(outputsDims);
+    if (ret != OH_NN_SUCCESS) {
+        LOGE("RunSyncWithAipp failed, error happened when keeping the output shapes.");
+        return ret;
     }
 
     return OH_NN_SUCCESS;
@@ -474,12 +491,31 @@ OH_NN_ReturnCode NNExecutor::RunAippModel(NN_Tensor* inputTensors[], size_t inpu
 
 OH_NN_ReturnCode NNExecutor::RunSyncWithAipp(NN_Tensor* inputTensors[], size_t inputSize,
                                              NN_Tensor* outputTensors[], size_t outputSize, const char* aippStrings)
+{
+    return RunSyncWithAippConfig(inputTensors, inputSize, outputTensors, outputSize,
+        AippConfigRegistry::INVALID_HANDLE, aippStrings);
+}
+
+OH_NN_ReturnCode NNExecutor::RunSyncWithAippHandle(NN_Tensor* inputTensors[], size_t inputSize,
+                                                   NN_Tensor* outputTensors[], size_t outputSize, uint32_t aippHandle)
+{
+    std::shared_ptr<const std::string> aippStrings = AippConfigRegistry::GetInstance().Get(aippHandle);
+    if (aippStrings == nullptr) {
+        LOGE("RunSyncWithAippHandle failed, aipp handle %{public}u is not registered.", aippHandle);
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    return RunSyncWithAippConfig(inputTensors, inputSize, outputTensors, outputSize, aippHandle, *aippStrings);
+}
+
+OH_NN_ReturnCode NNExecutor::RunSyncWithAippConfig(NN_Tensor* inputTensors[], size_t inputSize,
+    NN_Tensor* outputTensors[], size_t outputSize, uint32_t aippHandle, const std::string& aippStrings)
 {
     std::lock_guard<std::mutex> lock(m_mutex);
     {
-        uint32_t modelId;
-        GetModelID(modelId);
         m_autoUnloadHandler->RemoveTask("nnexecutor_autounload" + std::to_string(m_executorid));
+        m_autoUnloadHandler->RemoveTask("nnexecutor_warmreload" + std::to_string(m_executorid));
+        m_unloadPolicy.RecordArrival(UnloadPolicy::Clock::now());
         if (m_inputTensorDescs.size() != inputSize) {
             LOGE("RunSyncWithAipp failed, inputSize:%{public}zu is not equal to model inputsize:%{public}zu",
                 inputSize, m_inputTensorDescs.size());
@@ -493,7 +529,7 @@ OH_NN_ReturnCode NNExecutor::RunSyncWithAipp(NN_Tensor* inputTensors[], size_t i
 
         OH_NN_ReturnCode ret {OH_NN_FAILED};
         if (m_preparedModel == nullptr) {
-            ret = ReloadAippModel(modelId);
+            ret = ReloadModel();
             if (ret != OH_NN_SUCCESS) {
                 return ret;
             }
@@ -505,41 +541,31 @@ OH_NN_ReturnCode NNExecutor::RunSyncWithAipp(NN_Tensor* inputTensors[], size_t i
             return ret;
         }
 
-        ret = RunAippModel(inputTensors, inputSize, outputTensors, outputSize, aippStrings);
+        ret = RunAippModel(inputTensors, inputSize, outputTensors, outputSize, aippHandle, aippStrings);
         if (ret != OH_NN_SUCCESS) {
             return ret;
         }
+        PostAutoUnloadTask();
     }
-    auto autoUnloadTask = [this]() {
-        DeinitModel("DelayUnload");
-    };
-    m_autoUnloadHandler->PostTask(autoUnloadTask,
-        "nnexecutor_autounload" + std::to_string(m_executorid), AUTOUNLOAD_TIME);
 
     return OH_NN_SUCCESS;
 }
 
-void ReleaseDescShape(std::vector<SerializedTensorDesc>& immediateTensorDescs)
-{
-    for (auto desc : immediateTensorDescs) {
-        delete[] desc.m_shape;
-    }
-    immediateTensorDescs.clear();
-}
-
 OH_NN_ReturnCode NNExecutor::DeserializedTensorsFromBuffer(
     const Buffer& buffer, std::vector<std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType>>& tensorDescs)
 {
-    std::vector<SerializedTensorDesc> immediateTensorDescs;
     const char* ptr = static_cast<const char*>(buffer.data);
     const char* end = ptr + buffer.length;
     while (ptr < end) {
         SerializedTensorDesc desc;
+        // The shape is copied out of the cache buffer, which is not aligned for int32_t, into a stack array instead
+        // of a heap one, TensorDesc keeps it inline.
+        int32_t shape[TensorDesc::SHAPE_MAX_NUM] {0};
 
         auto memRet = memcpy_s(&desc.m_dataType, SIZE_OF_DATATYPE, ptr, sizeof(desc.m_dataType));
         if (memRet != EOK) {
             LOGE("[NNExecutor] DeserializedTensorsFromBuffer failed, failed to memcpy_s data type.");
-            ReleaseDescShape(immediateTensorDescs);
+            tensorDescs.clear();
             return OH_NN_MEMORY_ERROR;
         }
         ptr += sizeof(desc.m_dataType);
@@ -547,7 +573,7 @@ OH_NN_ReturnCode NNExecutor::DeserializedTensorsFromBuffer(
         memRet = memcpy_s(&desc.m_format, SIZE_OF_FORMAT, ptr, sizeof(desc.m_format));
         if (memRet != EOK) {
             LOGE("[NNExecutor] DeserializedTensorsFromBuffer failed, failed to memcpy_s format.");
-            ReleaseDescShape(immediateTensorDescs);
+            tensorDescs.clear();
             return OH_NN_MEMORY_ERROR;
         }
         ptr += sizeof(desc.m_format);
@@ -555,7 +581,7 @@ OH_NN_ReturnCode NNExecutor::DeserializedTensorsFromBuffer(
         memRet = memcpy_s(&desc.m_tensorType, SIZE_OF_TENSOR_TYPE, ptr, sizeof(desc.m_tensorType));
         if (memRet != EOK) {
             LOGE("[NNExecutor] DeserializedTensorsFromBuffer failed, failed to memcpy_s tensor type.");
-            ReleaseDescShape(immediateTensorDescs);
+            tensorDescs.clear();
             return OH_NN_MEMORY_ERROR;
         }
         ptr += sizeof(desc.m_tensorType);
@@ -563,60 +589,48 @@ OH_NN_ReturnCode NNExecutor::DeserializedTensorsFromBuffer(
         memRet = memcpy_s(&desc.m_shapeNum, SIZE_OF_SHAPE_NUM, ptr, sizeof(desc.m_shapeNum));
         if (memRet != EOK) {
             LOGE("[NNExecutor] DeserializedTensorsFromBuffer failed, failed to memcpy_s shape num.");
-            ReleaseDescShape(immediateTensorDescs);
+            tensorDescs.clear();
             return OH_NN_MEMORY_ERROR;
         }
         ptr += sizeof(desc.m_shapeNum);
 
-        desc.m_shape = new (std::nothrow) int32_t[desc.m_shapeNum];
-        if (desc.m_shape == nullptr) {
-            LOGE("[NNExecutor] DeserializedTensorsFromBuffer failed, failed to create shape buffer.");
-            ReleaseDescShape(immediateTensorDescs);
-            return OH_NN_NULL_PTR;
-        }
-        memRet = memcpy_s(desc.m_shape, desc.m_shapeNum * sizeof(int32_t), ptr, desc.m_shapeNum * sizeof(int32_t));
+        memRet = memcpy_s(shape, sizeof(shape), ptr, desc.m_shapeNum * sizeof(int32_t));
         if (memRet != EOK) {
             LOGE("[NNExecutor] DeserializedTensorsFromBuffer failed, failed to memcpy_s shape.");
-            ReleaseDescShape(immediateTensorDescs);
+            tensorDescs.clear();
             return OH_NN_MEMORY_ERROR;
         }
         ptr += desc.m_shapeNum * sizeof(int32_t);
+        desc.m_shape = shape;
 
         desc.m_name = ptr;
         ptr += std::strlen(desc.m_name) + 1; // +1 for null terminator
 
-        immediateTensorDescs.push_back(desc);
-    }
-
-    OH_NN_ReturnCode ret {OH_NN_SUCCESS};
-    for (const auto& immediateTensorDesc : immediateTensorDescs) {
         std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType> tensorDescPair;
         tensorDescPair.first = CreateSharedPtr<TensorDesc>();
         if (tensorDescPair.first == nullptr) {
             LOGE("[NNExecutor] DeserializedTensorsFromBuffer failed, failed to create tensor desc.");
             tensorDescs.clear();
-            ReleaseDescShape(immediateTensorDescs);
             return OH_NN_NULL_PTR;
         }
-        ret = immediateTensorDesc.CopyToTensorDesc(*(tensorDescPair.first.get()));
+        OH_NN_ReturnCode ret = desc.CopyToTensorDesc(*(tensorDescPair.first.get()));
         if (ret != OH_NN_SUCCESS) {
             LOGE("[NNExecutor] DeserializedTensorsFromBuffer failed, error happened when copying "
                  "SerializedTensorDesc to TensorDesc.");
             tensorDescs.clear();
-            ReleaseDescShape(immediateTensorDescs);
             return ret;
         }
-        tensorDescPair.second = immediateTensorDesc.m_tensorType;
+        tensorDescPair.second = desc.m_tensorType;
 
         tensorDescs.emplace_back(tensorDescPair);
     }
 
-    ReleaseDescShape(immediateTensorDescs);
-    return ret;
+    return OH_NN_SUCCESS;
 }
 
 OH_NN_ReturnCode NNExecutor::Reload()
 {
+    NNRT_LATENCY_SCOPE(OH_NN_STAGE_CACHE_RESTORE);
     if (m_cachePath.empty()) {
         LOGE("[NNExecutor] RestoreFromCacheFile failed, path is empty.");
         return OH_NN_INVALID_PARAMETER;
@@ -680,6 +694,7 @@ OH_NN_ReturnCode NNExecutor::Reload()
     }
 
     compiledCache.ReleaseCacheBuffer(caches);
+    CacheDirManager::GetInstance().OnCacheRestored(m_cachePath, m_extensionConfig.modelName);
 
     m_inputTensorDescs = inputTensorDescs;
     m_outputTensorDescs = outputTensorDescs;
@@ -691,110 +706,491 @@ OH_NN_ReturnCode NNExecutor::RunSync(NN_Tensor* inputTensors[], size_t inputSize
     NN_Tensor* outputTensors[], size_t outputSize)
 {
     std::lock_guard<std::mutex> lock(m_mutex);
-    {
-        uint32_t modelId;
-        GetModelID(modelId);
-        m_autoUnloadHandler->RemoveTask("nnexecutor_autounload" + std::to_string(m_executorid));
-        if (m_inputTensorDescs.size() != inputSize) {
-            LOGE("NNExecutor::RunSync failed, inputSize:%{public}zu is not equal to model input size:%{public}zu",
-                inputSize, m_inputTensorDescs.size());
+    return RunSyncLocked(inputTensors, inputSize, outputTensors, outputSize);
+}
+
+OH_NN_ReturnCode NNExecutor::RunSyncWithOutputShapes(NN_Tensor* inputTensors[], size_t inputSize,
+    NN_Tensor* outputTensors[], size_t outputSize, int32_t* outputShapes, size_t maxRank, uint32_t* outputRanks)
+{
+    if (outputShapes == nullptr || outputRanks == nullptr || maxRank == 0) {
+        LOGE("NNExecutor::RunSyncWithOutputShapes failed, outputShapes or outputRanks is nullptr, or maxRank is 0.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    OH_NN_ReturnCode ret = RunSyncLocked(inputTensors, inputSize, outputTensors, outputSize);
+    if (ret != OH_NN_SUCCESS) {
+        return ret;
+    }
+
+    // Copied while holding m_mutex, so the shapes belong to this run even if another thread runs right after it.
+    for (size_t i = 0; i < outputSize; ++i) {
+        const std::vector<int32_t>& shape = m_outputShapes[i];
+        if (shape.size() > maxRank) {
+            LOGE("NNExecutor::RunSyncWithOutputShapes failed, rank %{public}zu of output %{public}zu is greater than "
+                "maxRank %{public}zu.", shape.size(), i, maxRank);
             return OH_NN_INVALID_PARAMETER;
         }
-        if (m_outputTensorDescs.size() != outputSize) {
-            LOGE("NNExecutor::RunSync failed, outputSize:%{public}zu is not equal to model output size:%{public}zu",
-                outputSize, m_outputTensorDescs.size());
+        std::copy(shape.begin(), shape.end(), outputShapes + i * maxRank);
+        outputRanks[i] = static_cast<uint32_t>(shape.size());
+    }
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode NNExecutor::RunSyncLocked(NN_Tensor* inputTensors[], size_t inputSize,
+    NN_Tensor* outputTensors[], size_t outputSize)
+{
+    m_autoUnloadHandler->RemoveTask("nnexecutor_autounload" + std::to_string(m_executorid));
+    m_autoUnloadHandler->RemoveTask("nnexecutor_warmreload" + std::to_string(m_executorid));
+    m_unloadPolicy.RecordArrival(UnloadPolicy::Clock::now());
+    if (m_inputTensorDescs.size() != inputSize) {
+        LOGE("NNExecutor::RunSync failed, inputSize:%{public}zu is not equal to model input size:%{public}zu",
+            inputSize, m_inputTensorDescs.size());
+        return OH_NN_INVALID_PARAMETER;
+    }
+    if (m_outputTensorDescs.size() != outputSize) {
+        LOGE("NNExecutor::RunSync failed, outputSize:%{public}zu is not equal to model output size:%{public}zu",
+            outputSize, m_outputTensorDescs.size());
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    if (m_preparedModel == nullptr) {
+        if (ReloadModel() != OH_NN_SUCCESS) {
             return OH_NN_INVALID_PARAMETER;
         }
+    }
 
-        if (m_preparedModel == nullptr) {
-            if (Reload() != OH_NN_SUCCESS) {
-                return OH_NN_INVALID_PARAMETER;
-            }
-            auto _ret = GetModelID(modelId);
-            LOGI("AutoReload pid=%{public}ld originHiaiModelId=%{public}u hiaiModelId=%{public}u",
-                static_cast<long>(getpid()), m_originHiaiModelId, modelId);
-            if (_ret != OH_NN_SUCCESS) {
-                LOGW("GetModelID failed, some error happen when get model id for device.");
-            }
-            _ret = ReinitScheduling(modelId, &m_executorConfig->isNeedModelLatency, m_cachePath.c_str());
-            if (_ret != OH_NN_SUCCESS) {
-                LOGW("ReinitScheduling failed, some error happen when ReinitScheduling model.");
-            }
-            _ret = SetDeinitModelCallBack();
-            if (_ret != OH_NN_SUCCESS) {
-                LOGW("SetDeinitModelCallBack failed, some error happen when ReinitScheduling model.");
-            }
+    OH_NN_ReturnCode ret {OH_NN_FAILED};
+    // Slots of aliased outputs and state tensors are filled by the executor.
+    NN_Tensor** userOutputs = outputTensors;
+    std::vector<NN_Tensor*> boundInputs;
+    std::vector<NN_Tensor*> boundOutputs;
+    if (!m_extensionConfig.ioAliases.empty() || !m_stateTensors.IsEmpty()) {
+        boundInputs.assign(inputTensors, inputTensors + inputSize);
+        boundOutputs.assign(outputTensors, outputTensors + outputSize);
+        ret = BindIoAliases(boundInputs, boundOutputs);
+        if (ret != OH_NN_SUCCESS) {
+            LOGE("NNExecutor::RunSync failed, failed to bind aliased outputs.");
+            return ret;
         }
-
-        OH_NN_ReturnCode ret {OH_NN_FAILED};
-        ret = CheckInputDimRanges(inputTensors, inputSize);
-        if (ret != OH_NN_OPERATION_FORBIDDEN && ret != OH_NN_SUCCESS) {
-            LOGE("NNExecutor::RunSync failed, failed to check input dim ranges.");
+        ret = BindStateTensors(boundInputs, boundOutputs);
+        if (ret != OH_NN_SUCCESS) {
+            LOGE("NNExecutor::RunSync failed, failed to bind state tensors.");
             return ret;
         }
+        inputTensors = boundInputs.data();
+        outputTensors = boundOutputs.data();
+    }
 
-        OHOS::NeuralNetworkRuntime::IOTensor tensor;
-        std::vector<NN_Tensor*> inputTensorsVec;
-        for (size_t i = 0; i < inputSize; ++i) {
-            if (inputTensors[i] == nullptr) {
-                LOGE("NNExecutor::RunSync failed, input[%{public}zu] is nullptr.", i);
-                return OH_NN_INVALID_PARAMETER;
-            }
+    ret = CheckInputDimRanges(inputTensors, inputSize);
+    if (ret != OH_NN_OPERATION_FORBIDDEN && ret != OH_NN_SUCCESS) {
+        LOGE("NNExecutor::RunSync failed, failed to check input dim ranges.");
+        return ret;
+    }
 
-            inputTensorsVec.emplace_back(inputTensors[i]);
+    OHOS::NeuralNetworkRuntime::IOTensor tensor;
+    std::vector<NN_Tensor*> inputTensorsVec;
+    for (size_t i = 0; i < inputSize; ++i) {
+        if (inputTensors[i] == nullptr) {
+            LOGE("NNExecutor::RunSync failed, input[%{public}zu] is nullptr.", i);
+            return OH_NN_INVALID_PARAMETER;
         }
 
-        std::vector<NN_Tensor*> outputTensorsVec;
-        for (size_t i = 0; i < outputSize; ++i) {
-            if (outputTensors[i] == nullptr) {
-                LOGE("NNExecutor::RunSync failed, output[%{public}zu] is nullptr.", i);
-                return OH_NN_INVALID_PARAMETER;
-            }
-            outputTensorsVec.emplace_back(outputTensors[i]);
+        inputTensorsVec.emplace_back(inputTensors[i]);
+    }
+
+    std::vector<NN_Tensor*> outputTensorsVec;
+    for (size_t i = 0; i < outputSize; ++i) {
+        if (outputTensors[i] == nullptr) {
+            LOGE("NNExecutor::RunSync failed, output[%{public}zu] is nullptr.", i);
+            return OH_NN_INVALID_PARAMETER;
         }
+        outputTensorsVec.emplace_back(outputTensors[i]);
+    }
 
-        std::vector<std::vector<int32_t>> outputsDims;
-        std::vector<bool> isSufficientDataBuffer;
+    std::vector<std::vector<int32_t>> outputsDims;
+    ret = RunWithOutputGrowth(inputTensorsVec, outputTensorsVec, userOutputs, outputsDims);
+    if (ret != OH_NN_SUCCESS) {
+        LOGE("NNExecutor::RunSync failed, failed to run in prepared model.");
+        return ret;
+    }
 
-        ret = m_preparedModel->Run(inputTensorsVec, outputTensorsVec, outputsDims, isSufficientDataBuffer);
+    // Set the output NNTensor2_0's dimensions from output IOTensor if it is dynamic.
+    // NNTensor2_0::SetDimensions will check if the tensor buffer is enough for the new dimensions.
+    if (outputsDims.size() != outputSize) {
+        LOGE("NNExecutor::RunSync failed, size of outputsDims is not equal to outputTensors.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+    NNRT_LATENCY_SCOPE(OH_NN_STAGE_OUTPUT_SHAPE_UPDATE);
+    for (size_t i = 0; i < outputSize; ++i) {
+        NNTensor2_0* nnTensor = reinterpret_cast<NNTensor2_0*>(outputTensors[i]);
+        TensorDesc* nnTensorDesc = nnTensor->GetTensorDesc();
+        if (nnTensorDesc == nullptr) {
+            LOGE("NNExecutor::RunSync failed, failed to get desc from tensor.");
+            return OH_NN_NULL_PTR;
+        }
+        ret = nnTensorDesc->SetShape(outputsDims[i].data(), outputsDims[i].size());
         if (ret != OH_NN_SUCCESS) {
-            LOGE("NNExecutor::RunSync failed, failed to run in prepared model.");
+            LOGE("NNExecutor::RunSync failed, error happened when setting output tensor's dimensions,"
+                " output id: %zu.", i);
             return ret;
         }
+    }
+    ret = UpdateOutputShapes(outputsDims);
+    if (ret != OH_NN_SUCCESS) {
+        LOGE("NNExecutor::RunSync failed, error happened when keeping the output shapes.");
+        return ret;
+    }
+    if (!m_stateTensors.IsEmpty()) {
+        ret = m_stateTensors.Commit(outputsDims);
+        if (ret != OH_NN_SUCCESS) {
+            LOGE("NNExecutor::RunSync failed, failed to keep the state tensors for the next run.");
+            return ret;
+        }
+    }
+    PostAutoUnloadTask();
+    return OH_NN_SUCCESS;
+}
 
-        // Set the output NNTensor2_0's dimensions from output IOTensor if it is dynamic.
-        // NNTensor2_0::SetDimensions will check if the tensor buffer is enough for the new dimensions.
-        if (outputsDims.size() != outputSize) {
-            LOGE("NNExecutor::RunSync failed, size of outputsDims is not equal to outputTensors.");
+OH_NN_ReturnCode NNExecutor::UpdateOutputShapes(const std::vector<std::vector<int32_t>>& outputsDims)
+{
+    if (m_outputShapes.size() != outputsDims.size()) {
+        m_outputShapes.resize(outputsDims.size());
+    }
+    for (size_t i = 0; i < outputsDims.size(); ++i) {
+        if (outputsDims[i].empty()) {
+            LOGE("NNExecutor::UpdateOutputShapes failed, the device returns no dimensions of output %{public}zu.", i);
             return OH_NN_INVALID_PARAMETER;
         }
-        for (size_t i = 0; i < outputSize; ++i) {
-            NNTensor2_0* nnTensor = reinterpret_cast<NNTensor2_0*>(outputTensors[i]);
-            TensorDesc* nnTensorDesc = nnTensor->GetTensorDesc();
-            if (nnTensorDesc == nullptr) {
-                LOGE("NNExecutor::RunSync failed, failed to get desc from tensor.");
-                return OH_NN_NULL_PTR;
+        // Reuses the storage of the previous run, so that a run only allocates when the rank of an output grows.
+        m_outputShapes[i].assign(outputsDims[i].begin(), outputsDims[i].end());
+    }
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode NNExecutor::RunWithOutputGrowth(const std::vector<NN_Tensor*>& inputs,
+    const std::vector<NN_Tensor*>& outputs, NN_Tensor* userOutputs[], std::vector<std::vector<int32_t>>& outputsDims)
+{
+    std::vector<bool> isSufficientDataBuffer;
+    OH_NN_ReturnCode ret = m_preparedModel->Run(inputs, outputs, outputsDims, isSufficientDataBuffer);
+    for (uint32_t rerun = 0; !m_outputSizeHints.empty(); ++rerun) {
+        bool isBufferShort = (ret == OH_NN_SUCCESS || ret == OH_NN_MEMORY_ERROR) &&
+            std::find(isSufficientDataBuffer.begin(), isSufficientDataBuffer.end(), false) !=
+            isSufficientDataBuffer.end();
+        if (!isBufferShort) {
+            break;
+        }
+        if (rerun == MAX_OUTPUT_GROWTH_RERUNS) {
+            LOGE("NNExecutor::RunWithOutputGrowth failed, output buffer is still not enough after %{public}u reruns.",
+                rerun);
+            ++m_outputGrowthStats.failedRunCount;
+            return OH_NN_MEMORY_ERROR;
+        }
+
+        size_t grownCount = 0;
+        OH_NN_ReturnCode growRet = GrowOutputs(outputs, userOutputs, outputsDims, isSufficientDataBuffer, grownCount);
+        if (growRet != OH_NN_SUCCESS) {
+            LOGE("NNExecutor::RunWithOutputGrowth failed, failed to grow the output buffers.");
+            return growRet;
+        }
+        if (grownCount == 0) {
+            // None of the short outputs is allowed to grow, the result of the device is returned as before.
+            break;
+        }
+
+        ++m_outputGrowthStats.rerunCount;
+        outputsDims.clear();
+        isSufficientDataBuffer.clear();
+        ret = m_preparedModel->Run(inputs, outputs, outputsDims, isSufficientDataBuffer);
+    }
+    return ret;
+}
+
+OH_NN_ReturnCode NNExecutor::GrowOutputs(const std::vector<NN_Tensor*>& outputs, NN_Tensor* userOutputs[],
+    const std::vector<std::vector<int32_t>>& outputsDims, const std::vector<bool>& isSufficientDataBuffer,
+    size_t& grownCount)
+{
+    for (size_t i = 0; i < outputs.size() && i < isSufficientDataBuffer.size(); ++i) {
+        auto hint = m_outputSizeHints.find(static_cast<uint32_t>(i));
+        // Aliased outputs and state tensors are bound by the executor, their buffers are never grown.
+        if (isSufficientDataBuffer[i] || hint == m_outputSizeHints.end() || outputs[i] != userOutputs[i]) {
+            continue;
+        }
+
+        // Buffers created from user fds belong to the user, the insufficient size is reported instead.
+        NNTensor2_0* nnTensor = reinterpret_cast<NNTensor2_0*>(outputs[i]);
+        if (nnTensor->IsUserData()) {
+            continue;
+        }
+
+        size_t currentSize = nnTensor->GetSize();
+        size_t targetSize = std::max(hint->second, currentSize * OUTPUT_GROWTH_FACTOR);
+        if (outputsDims.size() == outputs.size() && nnTensor->GetTensorDesc() != nullptr) {
+            OH_NN_DataType dataType {OH_NN_UNKNOWN};
+            nnTensor->GetTensorDesc()->GetDataType(&dataType);
+            uint64_t elementCount = 1;
+            for (int32_t dim : outputsDims[i]) {
+                elementCount *= static_cast<uint64_t>(std::max(dim, 0));
             }
-            ret = nnTensorDesc->SetShape(outputsDims[i].data(), outputsDims[i].size());
-            if (ret != OH_NN_SUCCESS) {
-                LOGE("NNExecutor::RunSync failed, error happened when setting output tensor's dimensions,"
-                    " output id: %zu.", i);
-                return ret;
+            size_t requiredSize = static_cast<size_t>(GetDataByteSize(dataType, elementCount));
+            if (requiredSize != 0) {
+                // The device reports the shape of the output, so the exact size is known and no doubling is needed.
+                targetSize = std::max(hint->second, requiredSize);
             }
-            ret = m_outputTensorDescs[i].first->SetShape(outputsDims[i].data(), outputsDims[i].size());
-            if (ret != OH_NN_SUCCESS) {
-                LOGE("NNExecutor::RunSync failed, error happened when setting inner output tensor's dimensions,"
-                    " output id: %zu.", i);
-                return ret;
+        }
+        if (targetSize <= currentSize) {
+            continue;
+        }
+
+        OH_NN_ReturnCode ret = nnTensor->GrowData(targetSize);
+        if (ret != OH_NN_SUCCESS) {
+            LOGE("NNExecutor::GrowOutputs failed, failed to grow output %{public}zu to %{public}zu bytes.",
+                i, targetSize);
+            return ret;
+        }
+        LOGI("NNExecutor::GrowOutputs, output %{public}zu grows from %{public}zu to %{public}zu bytes.",
+            i, currentSize, targetSize);
+        ++grownCount;
+        ++m_outputGrowthStats.grownTensorCount;
+        m_outputGrowthStats.grownBytes += targetSize - currentSize;
+    }
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode NNExecutor::BindIoAliases(std::vector<NN_Tensor*>& inputs, std::vector<NN_Tensor*>& outputs)
+{
+    const std::vector<IoAlias>& ioAliases = m_extensionConfig.ioAliases;
+    if (m_aliasTensors.size() != ioAliases.size()) {
+        m_aliasTensors.resize(ioAliases.size());
+    }
+
+    for (size_t i = 0; i < ioAliases.size(); ++i) {
+        const IoAlias& ioAlias = ioAliases[i];
+        if (ioAlias.inputIndex >= inputs.size() || ioAlias.outputIndex >= outputs.size()) {
+            LOGE("NNExecutor::BindIoAliases failed, output %{public}u or input %{public}u does not exist.",
+                ioAlias.outputIndex, ioAlias.inputIndex);
+            return OH_NN_INVALID_PARAMETER;
+        }
+        const NNTensor2_0* input = reinterpret_cast<const NNTensor2_0*>(inputs[ioAlias.inputIndex]);
+        if (input == nullptr || input->GetTensorDesc() == nullptr || outputs[ioAlias.outputIndex] != nullptr) {
+            LOGE("NNExecutor::BindIoAliases failed, output %{public}u is written into input %{public}u, pass the "
+                "input and leave the output nullptr.", ioAlias.outputIndex, ioAlias.inputIndex);
+            return OH_NN_INVALID_PARAMETER;
+        }
+
+        // The output takes the shape of the input unless the model gives a static one.
+        TensorDesc outputDesc = *m_outputTensorDescs[ioAlias.outputIndex].first;
+        size_t outputByteSize = 0;
+        size_t elementNum = 0;
+        if (outputDesc.GetElementNum(&elementNum) != OH_NN_SUCCESS) {
+            int32_t* shape = nullptr;
+            size_t shapeNum = 0;
+            input->GetTensorDesc()->GetShape(&shape, &shapeNum);
+            outputDesc.SetShape(shape, shapeNum);
+        }
+        OH_NN_ReturnCode ret = outputDesc.GetByteSize(&outputByteSize);
+        if (ret != OH_NN_SUCCESS || input->GetSize() < input->GetOffset() ||
+            input->GetSize() - input->GetOffset() < outputByteSize) {
+            LOGE("NNExecutor::BindIoAliases failed, output %{public}u of %{public}zu bytes does not fit into input "
+                "%{public}u.", ioAlias.outputIndex, outputByteSize, ioAlias.inputIndex);
+            return OH_NN_INVALID_PARAMETER;
+        }
+
+        // The alias only describes the buffer of the input to the device, it never owns the memory.
+        std::unique_ptr<NNTensor2_0>& alias = m_aliasTensors[i];
+        if (alias == nullptr) {
+            alias.reset(new (std::nothrow) NNTensor2_0(m_backendID));
+            if (alias == nullptr) {
+                LOGE("NNExecutor::BindIoAliases failed, error happened when creating the aliased output.");
+                return OH_NN_MEMORY_ERROR;
             }
         }
+        if (alias->GetTensorDesc() != nullptr) {
+            *alias->GetTensorDesc() = outputDesc;
+        } else {
+            ret = alias->SetTensorDesc(&outputDesc);
+        }
+        if (ret != OH_NN_SUCCESS) {
+            LOGE("NNExecutor::BindIoAliases failed, error happened when setting desc of output %{public}u.",
+                ioAlias.outputIndex);
+            return ret;
+        }
+        alias->SetData(input->GetData());
+        alias->SetFd(input->GetFd());
+        alias->SetSize(input->GetSize());
+        alias->SetOffset(input->GetOffset());
+        outputs[ioAlias.outputIndex] = reinterpret_cast<NN_Tensor*>(alias.get());
+    }
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode NNExecutor::BindStateTensors(std::vector<NN_Tensor*>& boundInputs,
+    std::vector<NN_Tensor*>& boundOutputs)
+{
+    if (m_stateTensors.IsEmpty()) {
+        return OH_NN_SUCCESS;
+    }
+
+    if (!m_stateTensors.IsInitialized()) {
+        // The state buffers are sized by the max dim ranges, without them the state inputs must be static.
+        std::vector<std::vector<uint32_t>> minInputDims;
+        std::vector<std::vector<uint32_t>> maxInputDims;
+        if (m_preparedModel->GetInputDimRanges(minInputDims, maxInputDims) != OH_NN_SUCCESS) {
+            minInputDims.clear();
+            maxInputDims.clear();
+        }
+        OH_NN_ReturnCode ret = m_stateTensors.Init(m_inputTensorDescs, m_outputTensorDescs,
+            minInputDims, maxInputDims);
+        if (ret != OH_NN_SUCCESS) {
+            LOGE("NNExecutor::BindStateTensors failed, failed to allocate state tensors.");
+            return ret;
+        }
+    }
+
+    return m_stateTensors.Bind(boundInputs, boundOutputs);
+}
+
+OH_NN_ReturnCode NNExecutor::ResetState()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_stateTensors.IsEmpty()) {
+        LOGE("NNExecutor::ResetState failed, the model is compiled without state tensors.");
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    m_stateTensors.Reset();
+    return OH_NN_SUCCESS;
+}
+
+/* Memories made by CreateInputMemory() and CreateOutputMemory() belong to the borrower until it destroys them, they
+ * are kept. Everything else set through this executor is dropped. */
+OH_NN_ReturnCode NNExecutor::Recycle()
+{
+    std::vector<const void*> registeredBuffers;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        registeredBuffers = m_registeredBuffers;
+    }
+    for (const void* buffer : registeredBuffers) {
+        OH_NN_ReturnCode ret = UnregisterBuffer(const_cast<void*>(buffer));
+        if (ret != OH_NN_SUCCESS) {
+            LOGE("NNExecutor::Recycle failed, fail to unregister a buffer left by the borrower.");
+            return ret;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ReleaseLegacyTensors();
+    if (!m_stateTensors.IsEmpty()) {
+        m_stateTensors.Reset();
     }
+    m_outputSizeHints.clear();
+    m_outputShapes.clear();
+    m_outputGrowthStats = {};
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode NNExecutor::SetOutputSizeHint(uint32_t outputIndex, size_t sizeHint)
+{
+    if (outputIndex >= m_outputTensorDescs.size()) {
+        LOGE("NNExecutor::SetOutputSizeHint failed, outputIndex %{public}u is out of range %{public}zu.",
+            outputIndex, m_outputTensorDescs.size());
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_outputSizeHints[outputIndex] = sizeHint;
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode NNExecutor::GetOutputGrowthStats(OH_NN_OutputGrowthStats& stats)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    stats = m_outputGrowthStats;
+    return OH_NN_SUCCESS;
+}
+
+void NNExecutor::PostAutoUnloadTask()
+{
+    if (m_autoUnloadHandler == nullptr) {
+        return;
+    }
+
     auto autoUnloadTask = [this]() {
+        bool shouldUnload = true;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            shouldUnload = m_unloadPolicy.ShouldUnload(UnloadPolicy::Clock::now());
+        }
+        if (!shouldUnload) {
+            // The next run is expected soon, check again after another unload delay.
+            PostAutoUnloadTask();
+            return;
+        }
         DeinitModel("DelayUnload");
+        ScheduleWarmReload();
     };
     m_autoUnloadHandler->PostTask(autoUnloadTask,
-        "nnexecutor_autounload" + std::to_string(m_executorid), AUTOUNLOAD_TIME);
+        "nnexecutor_autounload" + std::to_string(m_executorid), m_unloadPolicy.GetUnloadDelay());
+}
 
+void NNExecutor::ScheduleWarmReload()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_preparedModel != nullptr || m_autoUnloadHandler == nullptr) {
+        return;
+    }
+
+    int64_t delay = m_unloadPolicy.GetWarmReloadDelay(UnloadPolicy::Clock::now());
+    if (delay < 0) {
+        return;
+    }
+
+    LOGI("[NNExecutor] Warm reload of executor %{public}llu scheduled in %{public}lld ms.",
+        static_cast<unsigned long long>(m_executorid), static_cast<long long>(delay));
+    auto warmReloadTask = [this]() {
+        WarmReload();
+    };
+    m_autoUnloadHandler->PostTask(warmReloadTask, "nnexecutor_warmreload" + std::to_string(m_executorid), delay);
+}
+
+void NNExecutor::WarmReload()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_preparedModel != nullptr || m_autoUnloadHandler == nullptr) {
+        return;
+    }
+
+    if (ReloadModel() != OH_NN_SUCCESS) {
+        LOGW("[NNExecutor] Warm reload failed, the model will be reloaded by the next run.");
+        return;
+    }
+
+    // Unload again if the expected run does not come.
+    m_autoUnloadHandler->RemoveTask("nnexecutor_autounload" + std::to_string(m_executorid));
+    PostAutoUnloadTask();
+}
+
+OH_NN_ReturnCode NNExecutor::Prefetch()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_autoUnloadHandler == nullptr) {
+        LOGE("[NNExecutor] Prefetch failed, the prepared model has been destroyed.");
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    if (m_preparedModel != nullptr) {
+        // Postpone the unloading, the model is about to be used.
+        m_autoUnloadHandler->RemoveTask("nnexecutor_autounload" + std::to_string(m_executorid));
+        PostAutoUnloadTask();
+        return OH_NN_SUCCESS;
+    }
+
+    m_autoUnloadHandler->RemoveTask("nnexecutor_warmreload" + std::to_string(m_executorid));
+    auto warmReloadTask = [this]() {
+        WarmReload();
+    };
+    m_autoUnloadHandler->PostTask(warmReloadTask, "nnexecutor_warmreload" + std::to_string(m_executorid), 0);
     return OH_NN_SUCCESS;
 }
 
@@ -1055,6 +1451,12 @@ OH_NN_ReturnCode NNExecutor::CheckInputDimRanges(uint32_t index, const OH_NN_Ten
 
 OH_NN_ReturnCode NNExecutor::SetInput(uint32_t index, const OH_NN_Tensor& nnTensor, const void* buffer, size_t length)
 {
+    // Registered buffers and buffers created by the device are shared with the device already, use them in place.
+    if (MemoryManager::GetInstance()->IsMapped(buffer)) {
+        OH_NN_Memory memory {const_cast<void*>(buffer), length};
+        return SetInputFromMemory(index, nnTensor, memory);
+    }
+
     auto nnRet = CheckInputDimRanges(index, nnTensor);
     if (nnRet == OH_NN_OPERATION_FORBIDDEN) {
         LOGI("Skip input dimension bounds check.");
@@ -1210,6 +1612,11 @@ std::shared_ptr<NNTensor> NNExecutor::BuildNNTensorFromDesc(
 
 OH_NN_ReturnCode NNExecutor::SetOutput(uint32_t index, void* buffer, size_t length)
 {
+    if (MemoryManager::GetInstance()->IsMapped(buffer)) {
+        OH_NN_Memory memory {buffer, length};
+        return SetOutputFromMemory(index, memory);
+    }
+
     if (index >= m_outputTensorDescs.size()) {
         LOGE("SetOutput failed, output index is out of range.");
         return OH_NN_INVALID_PARAMETER;
@@ -1452,6 +1859,57 @@ OH_NN_ReturnCode NNExecutor::DestroyOutputMemory(uint32_t index, OH_NN_Memory**
     return OH_NN_SUCCESS;
 }
 
+OH_NN_ReturnCode NNExecutor::RegisterBuffer(void* buffer, size_t length)
+{
+    if (buffer == nullptr) {
+        LOGE("RegisterBuffer failed, buffer is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    int fd = INVALID_FD;
+    auto ret = m_device->AllocateBuffer(length, fd);
+    if (ret != OH_NN_SUCCESS) {
+        LOGE("RegisterBuffer failed, allocating device buffer failed.");
+        return ret;
+    }
+
+    ret = MemoryManager::GetInstance()->RemapUserMemory(buffer, length, fd);
+    if (ret != OH_NN_SUCCESS) {
+        LOGE("RegisterBuffer failed, backing the buffer with device buffer failed.");
+        m_device->ReleaseBuffer(fd, length);
+        return ret;
+    }
+
+    m_registeredBuffers.emplace_back(buffer);
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode NNExecutor::UnregisterBuffer(void* buffer)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto pos = std::find(m_registeredBuffers.begin(), m_registeredBuffers.end(), buffer);
+    if (pos == m_registeredBuffers.end()) {
+        LOGE("UnregisterBuffer failed, the buffer is not registered to the executor.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    Memory memory;
+    auto ret = MemoryManager::GetInstance()->RestoreUserMemory(buffer, memory);
+    if (ret != OH_NN_SUCCESS) {
+        LOGE("UnregisterBuffer failed, restoring the buffer failed.");
+        return ret;
+    }
+    m_registeredBuffers.erase(pos);
+
+    ret = m_device->ReleaseBuffer(memory.fd, memory.length);
+    if (ret != OH_NN_SUCCESS) {
+        LOGE("UnregisterBuffer failed, release device buffer failed.");
+        return ret;
+    }
+    return OH_NN_SUCCESS;
+}
+
 OH_NN_ReturnCode NNExecutor::Run(const std::vector<std::shared_ptr<NNTensor>>& inputTensors,
     std::vector<std::shared_ptr<NNTensor>>& outputTensors)
 {
@@ -1491,12 +1949,11 @@ OH_NN_ReturnCode NNExecutor::Run(const std::vector<std::shared_ptr<NNTensor>>& i
             LOGE("Run failed, error happened when setting output tensor's dimensions, output id: %zu.", i);
             return ret;
         }
-        ret = m_outputTensorDescs[i].first->SetShape(outputsDims[i].data(), outputsDims[i].size());
-        if (ret != OH_NN_SUCCESS) {
-            LOGE("Run failed, error happened when setting inner output tensor's dimensions,"
-                 " output id: %zu.", i);
-            return ret;
-        }
+    }
+    ret = UpdateOutputShapes(outputsDims);
+    if (ret != OH_NN_SUCCESS) {
+        LOGE("Run failed, error happened when keeping the output shapes.");
+        return ret;
     }
 
     return OH_NN_SUCCESS;
@@ -1562,7 +2019,7 @@ OH_NN_ReturnCode NNExecutor::Run()
     return OH_NN_SUCCESS;
 }
 
-NNExecutor::~NNExecutor()
+void NNExecutor::ReleaseLegacyTensors()
 {
     for (auto& it : m_inputTensors) {
         if ((it.second).isInnerMem) {
@@ -1583,6 +2040,12 @@ NNExecutor::~NNExecutor()
         (it.second).userBuffer = nullptr;
     }
     m_outputTensors.clear();
+    m_isRun = false;
+}
+
+NNExecutor::~NNExecutor()
+{
+    ReleaseLegacyTensors();
 
     for (auto& it : m_inputCreatedMem) {
         it.second.clear();
@@ -1594,6 +2057,21 @@ NNExecutor::~NNExecutor()
     }
     m_outputCreatedMem.clear();
 
+    std::vector<const void*> registeredBuffers = m_registeredBuffers;
+    for (const void* buffer : registeredBuffers) {
+        UnregisterBuffer(const_cast<void*>(buffer));
+    }
+    m_registeredBuffers.clear();
+
+    // Aliased outputs borrow the buffers of user inputs, which must not be released with them.
+    for (auto& alias : m_aliasTensors) {
+        if (alias != nullptr) {
+            alias->SetData(nullptr);
+            alias->SetSize(0);
+        }
+    }
+    m_aliasTensors.clear();
+
     if (m_executorConfig != nullptr) {
         delete m_executorConfig;
         m_executorConfig = nullptr;
@@ -1605,6 +2083,10 @@ NNExecutor::~NNExecutor()
         UnSetHiaiModelCallBack();
     }
 
+    if (!m_cachePath.empty()) {
+        CacheDirManager::GetInstance().Unpin(m_cachePath, m_extensionConfig.modelName);
+    }
+
     uint32_t modelId;
     GetModelID(modelId);
 }
@@ -1615,6 +2097,7 @@ OH_NN_ReturnCode NNExecutor::DestroyPreparedModel()
 
     if (m_autoUnloadHandler != nullptr) {
         m_autoUnloadHandler->RemoveTask("nnexecutor_autounload" + std::to_string(m_executorid));
+        m_autoUnloadHandler->RemoveTask("nnexecutor_warmreload" + std::to_string(m_executorid));
         m_autoUnloadHandler.reset();
     }
 
@@ -1871,12 +2354,14 @@ bool NNExecutor::DeinitModel(std::string mode)
         if (mode == "FrozenDeinit") {
             if (m_autoUnloadHandler != nullptr) {
                 m_autoUnloadHandler->RemoveTask("nnexecutor_autounload" + std::to_string(m_executorid));
+                m_autoUnloadHandler->RemoveTask("nnexecutor_warmreload" + std::to_string(m_executorid));
                 LOGI("FrozenDeinit pid=%{public}ld originHiaiModelId=%{public}u hiaiModelId=%{public}u",
                     static_cast<long>(getpid()), m_originHiaiModelId, modelId);
             }
         } else if (mode == "HiaiAutoUnload") {
             if (m_autoUnloadHandler != nullptr) {
                 m_autoUnloadHandler->RemoveTask("nnexecutor_autounload" + std::to_string(m_executorid));
+                m_autoUnloadHandler->RemoveTask("nnexecutor_warmreload" + std::to_string(m_executorid));
                 LOGI("HiaiAutoUnload pid=%{public}ld originHiaiModelId=%{public}u hiaiModelId=%{public}u",
                     static_cast<long>(getpid()), m_originHiaiModelId, modelId);
             }
@@ -22,6 +22,8 @@
 #include "prepared_model.h"
 #include "nn_tensor.h"
 #include "log.h"
+#include "state_tensors.h"
+#include "unload_policy.h"
 
 #include "event_handler.h"
 #include "event_runner.h"
@@ -57,11 +59,23 @@ public:
                              size_t inputSize,
                              NN_Tensor* outputTensors[],
                              size_t outputSize) override;
+    OH_NN_ReturnCode RunSyncWithOutputShapes(NN_Tensor* inputTensors[],
+                                             size_t inputSize,
+                                             NN_Tensor* outputTensors[],
+                                             size_t outputSize,
+                                             int32_t* outputShapes,
+                                             size_t maxRank,
+                                             uint32_t* outputRanks) override;
     OH_NN_ReturnCode RunSyncWithAipp(NN_Tensor* inputTensors[],
                              size_t inputSize,
                              NN_Tensor* outputTensors[],
                              size_t outputSize,
                              const char* aippStrings) override;
+    OH_NN_ReturnCode RunSyncWithAippHandle(NN_Tensor* inputTensors[],
+                                           size_t inputSize,
+                                           NN_Tensor* outputTensors[],
+                                           size_t outputSize,
+                                           uint32_t aippHandle) override;
     OH_NN_ReturnCode RunAsync(NN_Tensor* inputTensors[],
                               size_t inputSize,
                               NN_Tensor* outputTensors[],
@@ -83,6 +97,8 @@ public:
     OH_NN_ReturnCode CreateOutputMemory(uint32_t index, size_t length, OH_NN_Memory** memory);
     OH_NN_ReturnCode DestroyInputMemory(uint32_t index, OH_NN_Memory** memory);
     OH_NN_ReturnCode DestroyOutputMemory(uint32_t index, OH_NN_Memory** memory);
+    OH_NN_ReturnCode RegisterBuffer(void* buffer, size_t length);
+    OH_NN_ReturnCode UnregisterBuffer(void* buffer);
 
     OH_NN_ReturnCode Run();
 
@@ -90,10 +106,23 @@ public:
     OH_NN_ReturnCode SetDeinitModelCallBack() override;
     OH_NN_ReturnCode UnSetDeinitModelCallBack() override;
     OH_NN_ReturnCode DestroyPreparedModel() override;
+    OH_NN_ReturnCode Prefetch() override;
+    OH_NN_ReturnCode ResetState() override;
+    OH_NN_ReturnCode Recycle() override;
+    OH_NN_ReturnCode SetOutputSizeHint(uint32_t outputIndex, size_t sizeHint) override;
+    OH_NN_ReturnCode GetOutputGrowthStats(OH_NN_OutputGrowthStats& stats) override;
 
 private:
     OH_NN_ReturnCode GetInputDimVec() const;
     OH_NN_ReturnCode CheckInputDimRanges(NN_Tensor* inputTensors[], size_t inputSize);
+    OH_NN_ReturnCode RunSyncLocked(NN_Tensor* inputTensors[], size_t inputSize, NN_Tensor* outputTensors[],
+                                   size_t outputSize);
+    OH_NN_ReturnCode UpdateOutputShapes(const std::vector<std::vector<int32_t>>& outputsDims);
+    OH_NN_ReturnCode RunWithOutputGrowth(const std::vector<NN_Tensor*>& inputs, const std::vector<NN_Tensor*>& outputs,
+                                         NN_Tensor* userOutputs[], std::vector<std::vector<int32_t>>& outputsDims);
+    OH_NN_ReturnCode GrowOutputs(const std::vector<NN_Tensor*>& outputs, NN_Tensor* userOutputs[],
+                                 const std::vector<std::vector<int32_t>>& outputsDims,
+                                 const std::vector<bool>& isSufficientDataBuffer, size_t& grownCount);
 
     // The following APIs are compatible with older versions
     OH_NN_ReturnCode Run(const std::vector<std::shared_ptr<NNTensor>>& inputTensors,
@@ -116,10 +145,18 @@ private:
     OH_NN_ReturnCode DeinitScheduling(uint32_t hiaimodelID, std::string mode);
     OH_NN_ReturnCode GetNNRtModelIDFromCache(const std::string& path, const std::string& modelName,
         size_t& nnrtModelID);
-    OH_NN_ReturnCode ReloadAippModel(uint32_t modelId);
-    OH_NN_ReturnCode RunAippModel(NN_Tensor* inputTensors[], size_t inputSize,
-                                  NN_Tensor* outputTensors[], size_t outputSize, const char* aippStrings);
+    OH_NN_ReturnCode ReloadModel();
+    void PostAutoUnloadTask();
+    void ScheduleWarmReload();
+    void WarmReload();
+    OH_NN_ReturnCode RunSyncWithAippConfig(NN_Tensor* inputTensors[], size_t inputSize, NN_Tensor* outputTensors[],
+                                           size_t outputSize, uint32_t aippHandle, const std::string& aippStrings);
+    OH_NN_ReturnCode RunAippModel(NN_Tensor* inputTensors[], size_t inputSize, NN_Tensor* outputTensors[],
+                                  size_t outputSize, uint32_t aippHandle, const std::string& aippStrings);
     OH_NN_ReturnCode UnSetHiaiModelCallBack();
+    OH_NN_ReturnCode BindIoAliases(std::vector<NN_Tensor*>& inputs, std::vector<NN_Tensor*>& outputs);
+    void ReleaseLegacyTensors();
+    OH_NN_ReturnCode BindStateTensors(std::vector<NN_Tensor*>& boundInputs, std::vector<NN_Tensor*>& boundOutputs);
 
 private:
     size_t m_backendID {0};
@@ -127,6 +164,13 @@ private:
     std::shared_ptr<PreparedModel> m_preparedModel {nullptr};
     std::vector<std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType>> m_inputTensorDescs;
     std::vector<std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType>> m_outputTensorDescs;
+    // Output shapes of the last run. The tensor descs above are shared by all executors of a compilation, runs never
+    // write into them.
+    std::vector<std::vector<int32_t>> m_outputShapes;
+    // Outputs whose buffer is grown and the run repeated when the device reports it too small, mapped to the
+    // expected byte size given by SetOutputSizeHint().
+    std::unordered_map<uint32_t, size_t> m_outputSizeHints;
+    OH_NN_OutputGrowthStats m_outputGrowthStats {};
     std::string m_cachePath;
     uint32_t m_cacheVersion {0};
     ExtensionConfig m_extensionConfig;
@@ -150,13 +194,18 @@ private:
     std::unordered_map<int, std::vector<void*>> m_outputCreatedMem;
     mutable std::vector<std::vector<size_t>> m_minInputDimsVec;
     mutable std::vector<std::vector<size_t>> m_maxInputDimsVec;
+    // User buffers backed by device shared memory, which SetInput() and SetOutput() use without a copy.
+    std::vector<const void*> m_registeredBuffers;
 
     std::shared_ptr<OHOS::AppExecFwk::EventRunner> m_autoUnloadRunner;
     std::shared_ptr<OHOS::AppExecFwk::EventHandler> m_autoUnloadHandler;
     uint64_t m_executorid;
     std::mutex m_mutex;
+    UnloadPolicy m_unloadPolicy;
+    StateTensors m_stateTensors;
+    // Outputs declared by IoAlias, each describing the buffer of its input.
+    std::vector<std::unique_ptr<NNTensor2_0>> m_aliasTensors;
     bool isHiaiModel = false;
-    std::string m_aippPara;
 };
 }  // namespace NeuralNetworkRuntime
 }  // namespace OHOS
@@ -18,6 +18,7 @@
 
 #include "log.h"
 #include "backend_manager.h"
+#include "latency_metrics.h"
 #include "nnbackend.h"
 #include "nntensor.h"
 #include "neural_network_runtime/neural_network_runtime_type.h"
@@ -171,6 +172,60 @@ OH_NN_ReturnCode NNTensor2_0::CreateData(int fd, size_t size, size_t offset)
     return OH_NN_SUCCESS;
 }
 
+OH_NN_ReturnCode NNTensor2_0::GrowData(size_t size)
+{
+    if (m_isUserData) {
+        LOGE("NNTensor2_0::GrowData failed, the buffer is provided by user.");
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+    if (m_data == nullptr) {
+        LOGE("NNTensor2_0::GrowData failed, m_data has not been created.");
+        return OH_NN_FAILED;
+    }
+    if (size <= m_size) {
+        return OH_NN_SUCCESS;
+    }
+    if (size > ALLOCATE_BUFFER_LIMIT) {
+        LOGE("NNTensor2_0::GrowData failed, Invalid buffer size, "
+             "it must less than 1Gb. length=%{public}zu", size);
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    // Allocates before releasing, so that the tensor keeps its old buffer if the allocation fails.
+    void* oldData = m_data;
+    int oldFd = m_fd;
+    size_t oldSize = m_size;
+    auto ret = AllocateMemory(size);
+    if (ret != OH_NN_SUCCESS) {
+        LOGE("NNTensor2_0::GrowData failed, failed to allocate memory.");
+        m_data = oldData;
+        m_fd = oldFd;
+        m_size = oldSize;
+        return ret;
+    }
+
+    void* newData = m_data;
+    int newFd = m_fd;
+    size_t newSize = m_size;
+    m_data = oldData;
+    m_fd = oldFd;
+    m_size = oldSize;
+    ret = ReleaseMemory();
+    if (ret != OH_NN_SUCCESS) {
+        LOGW("NNTensor2_0::GrowData, failed to release the old buffer.");
+    }
+    m_data = newData;
+    m_fd = newFd;
+    m_size = newSize;
+    m_offset = 0;
+    return OH_NN_SUCCESS;
+}
+
+bool NNTensor2_0::IsUserData() const
+{
+    return m_isUserData;
+}
+
 TensorDesc* NNTensor2_0::GetTensorDesc() const
 {
     return m_tensorDesc;
@@ -218,6 +273,7 @@ void NNTensor2_0::SetOffset(size_t offset)
 
 OH_NN_ReturnCode NNTensor2_0::AllocateMemory(size_t length)
 {
+    NNRT_LATENCY_SCOPE(OH_NN_STAGE_TENSOR_ALLOC);
     BackendManager& backendManager = BackendManager::GetInstance();
     std::shared_ptr<Backend> backend = backendManager.GetBackend(m_backendID);
     if (backend == nullptr) {
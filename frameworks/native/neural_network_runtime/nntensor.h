@@ -30,6 +30,9 @@ public:
     OH_NN_ReturnCode CreateData() override;
     OH_NN_ReturnCode CreateData(size_t size) override;
     OH_NN_ReturnCode CreateData(int fd, size_t size, size_t offset) override;
+    // Replaces the buffer allocated by CreateData() with one of at least size bytes, the data is not kept.
+    OH_NN_ReturnCode GrowData(size_t size);
+    bool IsUserData() const;
 
     TensorDesc* GetTensorDesc() const override;
     void* GetData() const override;
@@ -76,7 +76,7 @@ LiteGraphPrimitvePtr AbsBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(AbsBuilder, OH_NN_OPS_ABS);
+REGISTER_OPS_BUILDER(AbsBuilder, OH_NN_OPS_ABS);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
@@ -114,7 +114,7 @@ LiteGraphPrimitvePtr AddBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(AddBuilder, OH_NN_OPS_ADD);
+REGISTER_OPS_BUILDER(AddBuilder, OH_NN_OPS_ADD);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
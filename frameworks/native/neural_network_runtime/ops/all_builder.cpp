@@ -108,7 +108,7 @@ LiteGraphPrimitvePtr AllBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(AllBuilder, OH_NN_OPS_ALL);
+REGISTER_OPS_BUILDER(AllBuilder, OH_NN_OPS_ALL);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
@@ -166,7 +166,7 @@ LiteGraphPrimitvePtr ArgMaxBuilder::GetPrimitive()
     LiteGraphPrimitvePtr graphPrimitivePtr(primitive, DestroyLiteGraphPrimitive);
     return graphPrimitivePtr;
 }
-REGISTER_OPS(ArgMaxBuilder, OH_NN_OPS_ARG_MAX);
+REGISTER_OPS_BUILDER(ArgMaxBuilder, OH_NN_OPS_ARG_MAX);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
@@ -108,7 +108,7 @@ LiteGraphPrimitvePtr AssertBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(AssertBuilder, OH_NN_OPS_ASSERT);
+REGISTER_OPS_BUILDER(AssertBuilder, OH_NN_OPS_ASSERT);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
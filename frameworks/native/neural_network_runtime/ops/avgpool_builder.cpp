@@ -54,7 +54,7 @@ LiteGraphPrimitvePtr AvgPoolBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(AvgPoolBuilder, OH_NN_OPS_AVG_POOL);
+REGISTER_OPS_BUILDER(AvgPoolBuilder, OH_NN_OPS_AVG_POOL);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
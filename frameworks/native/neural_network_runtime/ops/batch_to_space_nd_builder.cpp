@@ -142,7 +142,7 @@ LiteGraphPrimitvePtr BatchToSpaceNDBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(BatchToSpaceNDBuilder, OH_NN_OPS_BATCH_TO_SPACE_ND);
+REGISTER_OPS_BUILDER(BatchToSpaceNDBuilder, OH_NN_OPS_BATCH_TO_SPACE_ND);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
@@ -115,7 +115,7 @@ LiteGraphPrimitvePtr BatchNormBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(BatchNormBuilder, OH_NN_OPS_BATCH_NORM);
+REGISTER_OPS_BUILDER(BatchNormBuilder, OH_NN_OPS_BATCH_NORM);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
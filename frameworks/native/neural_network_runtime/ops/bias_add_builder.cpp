@@ -72,7 +72,7 @@ LiteGraphPrimitvePtr BiasAddBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(BiasAddBuilder, OH_NN_OPS_BIAS_ADD);
+REGISTER_OPS_BUILDER(BiasAddBuilder, OH_NN_OPS_BIAS_ADD);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
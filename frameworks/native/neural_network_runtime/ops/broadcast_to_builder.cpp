@@ -110,7 +110,7 @@ LiteGraphPrimitvePtr BroadcastToBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(BroadcastToBuilder, OH_NN_OPS_BROADCAST_TO);
+REGISTER_OPS_BUILDER(BroadcastToBuilder, OH_NN_OPS_BROADCAST_TO);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
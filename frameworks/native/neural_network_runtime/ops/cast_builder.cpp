@@ -84,7 +84,7 @@ LiteGraphPrimitvePtr CastBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(CastBuilder, OH_NN_OPS_CAST);
+REGISTER_OPS_BUILDER(CastBuilder, OH_NN_OPS_CAST);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
@@ -72,7 +72,7 @@ LiteGraphPrimitvePtr CeilBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(CeilBuilder, OH_NN_OPS_CEIL);
+REGISTER_OPS_BUILDER(CeilBuilder, OH_NN_OPS_CEIL);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
@@ -130,7 +130,7 @@ LiteGraphPrimitvePtr ClipBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(ClipBuilder, OH_NN_OPS_CLIP);
+REGISTER_OPS_BUILDER(ClipBuilder, OH_NN_OPS_CLIP);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
@@ -148,7 +148,7 @@ LiteGraphPrimitvePtr ConcatBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(ConcatBuilder, OH_NN_OPS_CONCAT);
+REGISTER_OPS_BUILDER(ConcatBuilder, OH_NN_OPS_CONCAT);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
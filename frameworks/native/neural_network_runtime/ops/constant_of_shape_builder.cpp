@@ -133,7 +133,27 @@ LiteGraphPrimitvePtr ConstantOfShapeBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(ConstantOfShapeBuilder, OH_NN_OPS_CONSTANT_OF_SHAPE);
+OH_NN_ReturnCode ConstantOfShapeBuilder::Fold(const std::vector<std::shared_ptr<NNTensor>>& allTensors,
+                                              const std::vector<uint32_t>& modelInputs) const
+{
+    (void)modelInputs;
+    std::vector<int64_t> shape;
+    if (!m_isBuild || (GetIntegerValues(*allTensors[m_inputsIndex[0]], shape) != OH_NN_SUCCESS)) {
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    size_t elementCount = 0;
+    if (GetFoldedElementCount(shape, allTensors[m_outputsIndex[0]]->GetDataType(), elementCount) != OH_NN_SUCCESS) {
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    // The output takes the data type of its tensor, the value defaults to 0 as it does on the device.
+    double value = m_value.empty() ? 0.0 : static_cast<double>(m_value[0]);
+    std::vector<int32_t> outputDimensions(shape.begin(), shape.end());
+    return SetFoldedValue(*allTensors[m_outputsIndex[0]], outputDimensions, std::vector<double>(elementCount, value));
+}
+
+REGISTER_OPS_BUILDER(ConstantOfShapeBuilder, OH_NN_OPS_CONSTANT_OF_SHAPE);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
@@ -286,7 +286,7 @@ LiteGraphPrimitvePtr Conv2DBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(Conv2DBuilder, OH_NN_OPS_CONV2D);
+REGISTER_OPS_BUILDER(Conv2DBuilder, OH_NN_OPS_CONV2D);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
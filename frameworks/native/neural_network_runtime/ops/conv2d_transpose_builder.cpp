@@ -297,7 +297,7 @@ LiteGraphPrimitvePtr Conv2DTransposeBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(Conv2DTransposeBuilder, OH_NN_OPS_CONV2D_TRANSPOSE);
+REGISTER_OPS_BUILDER(Conv2DTransposeBuilder, OH_NN_OPS_CONV2D_TRANSPOSE);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
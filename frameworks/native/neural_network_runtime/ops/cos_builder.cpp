@@ -69,7 +69,7 @@ LiteGraphPrimitvePtr CosBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(CosBuilder, OH_NN_OPS_COS);
+REGISTER_OPS_BUILDER(CosBuilder, OH_NN_OPS_COS);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
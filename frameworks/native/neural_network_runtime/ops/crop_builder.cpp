@@ -136,7 +136,7 @@ LiteGraphPrimitvePtr CropBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(CropBuilder, OH_NN_OPS_CROP);
+REGISTER_OPS_BUILDER(CropBuilder, OH_NN_OPS_CROP);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
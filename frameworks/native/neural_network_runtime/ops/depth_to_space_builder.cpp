@@ -140,7 +140,7 @@ LiteGraphPrimitvePtr DepthToSpaceBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(DepthToSpaceBuilder, OH_NN_OPS_DEPTH_TO_SPACE);
+REGISTER_OPS_BUILDER(DepthToSpaceBuilder, OH_NN_OPS_DEPTH_TO_SPACE);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
@@ -265,7 +265,7 @@ LiteGraphPrimitvePtr DepthwiseConv2DNativeBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(DepthwiseConv2DNativeBuilder, OH_NN_OPS_DEPTHWISE_CONV2D_NATIVE);
+REGISTER_OPS_BUILDER(DepthwiseConv2DNativeBuilder, OH_NN_OPS_DEPTHWISE_CONV2D_NATIVE);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
@@ -321,7 +321,7 @@ LiteGraphPrimitvePtr DetectionPostProcessBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(DetectionPostProcessBuilder, OH_NN_OPS_DETECTION_POST_PROCESS);
+REGISTER_OPS_BUILDER(DetectionPostProcessBuilder, OH_NN_OPS_DETECTION_POST_PROCESS);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
@@ -119,7 +119,7 @@ LiteGraphPrimitvePtr DivBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(DivBuilder, OH_NN_OPS_DIV);
+REGISTER_OPS_BUILDER(DivBuilder, OH_NN_OPS_DIV);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
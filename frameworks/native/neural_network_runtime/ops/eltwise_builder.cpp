@@ -119,7 +119,7 @@ LiteGraphPrimitvePtr EltwiseBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(EltwiseBuilder, OH_NN_OPS_ELTWISE);
+REGISTER_OPS_BUILDER(EltwiseBuilder, OH_NN_OPS_ELTWISE);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
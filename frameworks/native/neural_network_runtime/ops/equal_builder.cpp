@@ -69,7 +69,7 @@ LiteGraphPrimitvePtr EqualBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(EqualBuilder, OH_NN_OPS_EQUAL);
+REGISTER_OPS_BUILDER(EqualBuilder, OH_NN_OPS_EQUAL);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
@@ -74,7 +74,7 @@ LiteGraphPrimitvePtr ErfBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(ErfBuilder, OH_NN_OPS_ERF);
+REGISTER_OPS_BUILDER(ErfBuilder, OH_NN_OPS_ERF);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
@@ -152,7 +152,7 @@ LiteGraphPrimitvePtr ExpBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(ExpBuilder, OH_NN_OPS_EXP);
+REGISTER_OPS_BUILDER(ExpBuilder, OH_NN_OPS_EXP);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
@@ -69,7 +69,7 @@ LiteGraphPrimitvePtr ExpandDimsBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(ExpandDimsBuilder, OH_NN_OPS_EXPAND_DIMS);
+REGISTER_OPS_BUILDER(ExpandDimsBuilder, OH_NN_OPS_EXPAND_DIMS);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
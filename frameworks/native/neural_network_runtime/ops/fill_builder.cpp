@@ -76,7 +76,45 @@ LiteGraphPrimitvePtr FillBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(FillBuilder, OH_NN_OPS_FILL);
+OH_NN_ReturnCode FillBuilder::Fold(const std::vector<std::shared_ptr<NNTensor>>& allTensors,
+                                   const std::vector<uint32_t>& modelInputs) const
+{
+    (void)modelInputs;
+    if (!m_isBuild) {
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    const NNTensor& value = *allTensors[m_inputsIndex[0]];
+    NNTensor& output = *allTensors[m_outputsIndex[0]];
+    std::vector<int64_t> shape;
+    if (!IsConstantTensor(value) || (value.GetElementCount() != 1) ||
+        (GetIntegerValues(*allTensors[m_inputsIndex[1]], shape) != OH_NN_SUCCESS)) {
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    // The bytes of the value are repeated as they are, which needs the output to take them as the same numbers.
+    if ((value.GetDataType() != output.GetDataType()) || !IsSameQuantization(value, output)) {
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    size_t elementCount = 0;
+    if (GetFoldedElementCount(shape, output.GetDataType(), elementCount) != OH_NN_SUCCESS) {
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    size_t elementSize = value.GetDataLength();
+    const char* source = static_cast<const char*>(value.GetBuffer());
+    std::vector<char> data;
+    data.reserve(elementCount * elementSize);
+    for (size_t i = 0; i < elementCount; ++i) {
+        data.insert(data.end(), source, source + elementSize);
+    }
+
+    std::vector<int32_t> outputDimensions(shape.begin(), shape.end());
+    return SetFoldedValue(output, outputDimensions, data.data(), data.size());
+}
+
+REGISTER_OPS_BUILDER(FillBuilder, OH_NN_OPS_FILL);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
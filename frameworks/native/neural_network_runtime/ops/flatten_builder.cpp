@@ -108,7 +108,7 @@ LiteGraphPrimitvePtr FlattenBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(FlattenBuilder, OH_NN_OPS_FLATTEN);
+REGISTER_OPS_BUILDER(FlattenBuilder, OH_NN_OPS_FLATTEN);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
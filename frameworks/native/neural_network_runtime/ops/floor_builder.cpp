@@ -72,7 +72,7 @@ LiteGraphPrimitvePtr FloorBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(FloorBuilder, OH_NN_OPS_FLOOR);
+REGISTER_OPS_BUILDER(FloorBuilder, OH_NN_OPS_FLOOR);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
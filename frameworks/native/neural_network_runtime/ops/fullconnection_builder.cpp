@@ -225,7 +225,7 @@ LiteGraphPrimitvePtr FullConnectionBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(FullConnectionBuilder, OH_NN_OPS_FULL_CONNECTION);
+REGISTER_OPS_BUILDER(FullConnectionBuilder, OH_NN_OPS_FULL_CONNECTION);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
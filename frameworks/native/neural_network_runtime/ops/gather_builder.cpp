@@ -17,6 +17,7 @@
 
 #include "mindir.h"
 #include "ops_registry.h"
+#include "transform.h"
 
 namespace OHOS {
 namespace NeuralNetworkRuntime {
@@ -75,7 +76,65 @@ LiteGraphPrimitvePtr GatherBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(GatherBuilder, OH_NN_OPS_GATHER);
+OH_NN_ReturnCode GatherBuilder::Fold(const std::vector<std::shared_ptr<NNTensor>>& allTensors,
+                                     const std::vector<uint32_t>& modelInputs) const
+{
+    (void)modelInputs;
+    if (!m_isBuild) {
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    const NNTensor& input = *allTensors[m_inputsIndex[0]];
+    const NNTensor& indicesTensor = *allTensors[m_inputsIndex[1]];
+    std::vector<int64_t> indices;
+    std::vector<int64_t> axes;
+    if (!IsConstantTensor(input) || !IsSameQuantization(input, *allTensors[m_outputsIndex[0]]) ||
+        (GetIntegerValues(indicesTensor, indices) != OH_NN_SUCCESS) ||
+        (GetIntegerValues(*allTensors[m_inputsIndex[2]], axes) != OH_NN_SUCCESS) || (axes.size() != 1)) {
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    std::vector<int32_t> dimensions = input.GetDimensions();
+    int64_t rank = static_cast<int64_t>(dimensions.size());
+    int64_t axis = (axes[0] < 0) ? axes[0] + rank : axes[0];
+    size_t innerSize = GetTypeSize(input.GetDataType());
+    if ((axis < 0) || (axis >= rank) || (innerSize == 0)) {
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    size_t outerCount = 1;
+    for (int64_t i = 0; i < rank; ++i) {
+        if (i < axis) {
+            outerCount *= static_cast<size_t>(dimensions[i]);
+        } else if (i > axis) {
+            innerSize *= static_cast<size_t>(dimensions[i]);
+        }
+    }
+
+    int64_t axisDim = dimensions[axis];
+    const char* source = static_cast<const char*>(input.GetBuffer());
+    std::vector<char> data;
+    data.reserve(outerCount * indices.size() * innerSize);
+    for (size_t outer = 0; outer < outerCount; ++outer) {
+        for (int64_t index : indices) {
+            index = (index < 0) ? index + axisDim : index;
+            if ((index < 0) || (index >= axisDim)) {
+                return OH_NN_OPERATION_FORBIDDEN;
+            }
+            const char* row = source + (outer * static_cast<size_t>(axisDim) + static_cast<size_t>(index)) * innerSize;
+            data.insert(data.end(), row, row + innerSize);
+        }
+    }
+
+    // The indexed axis is replaced by the dimensions of the indices.
+    std::vector<int32_t> outputDimensions(dimensions.begin(), dimensions.begin() + axis);
+    std::vector<int32_t> indicesDimensions = indicesTensor.GetDimensions();
+    outputDimensions.insert(outputDimensions.end(), indicesDimensions.begin(), indicesDimensions.end());
+    outputDimensions.insert(outputDimensions.end(), dimensions.begin() + axis + 1, dimensions.end());
+    return SetFoldedValue(*allTensors[m_outputsIndex[0]], outputDimensions, data.data(), data.size());
+}
+
+REGISTER_OPS_BUILDER(GatherBuilder, OH_NN_OPS_GATHER);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
@@ -75,7 +75,7 @@ LiteGraphPrimitvePtr GatherNDBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(GatherNDBuilder, OH_NN_OPS_GATHER_ND);
+REGISTER_OPS_BUILDER(GatherNDBuilder, OH_NN_OPS_GATHER_ND);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
@@ -116,7 +116,7 @@ LiteGraphPrimitvePtr GeluBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(GeluBuilder, OH_NN_OPS_GELU);
+REGISTER_OPS_BUILDER(GeluBuilder, OH_NN_OPS_GELU);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
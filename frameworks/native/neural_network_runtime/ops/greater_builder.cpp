@@ -72,7 +72,7 @@ LiteGraphPrimitvePtr GreaterBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(GreaterBuilder, OH_NN_OPS_GREATER);
+REGISTER_OPS_BUILDER(GreaterBuilder, OH_NN_OPS_GREATER);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
@@ -75,7 +75,7 @@ LiteGraphPrimitvePtr GreaterEqualBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(GreaterEqualBuilder, OH_NN_OPS_GREATER_EQUAL);
+REGISTER_OPS_BUILDER(GreaterEqualBuilder, OH_NN_OPS_GREATER_EQUAL);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
@@ -82,7 +82,7 @@ LiteGraphPrimitvePtr HardSigmoidBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(HardSigmoidBuilder, OH_NN_OPS_HARD_SIGMOID);
+REGISTER_OPS_BUILDER(HardSigmoidBuilder, OH_NN_OPS_HARD_SIGMOID);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
@@ -82,7 +82,7 @@ LiteGraphPrimitvePtr HswishBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(HswishBuilder, OH_NN_OPS_HSWISH);
+REGISTER_OPS_BUILDER(HswishBuilder, OH_NN_OPS_HSWISH);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
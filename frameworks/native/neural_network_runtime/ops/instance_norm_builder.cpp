@@ -108,7 +108,7 @@ LiteGraphPrimitvePtr InstanceNormBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(InstanceNormBuilder, OH_NN_OPS_INSTANCE_NORM);
+REGISTER_OPS_BUILDER(InstanceNormBuilder, OH_NN_OPS_INSTANCE_NORM);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
@@ -166,7 +166,7 @@ LiteGraphPrimitvePtr L2NormalizeBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(L2NormalizeBuilder, OH_NN_OPS_L2_NORMALIZE);
+REGISTER_OPS_BUILDER(L2NormalizeBuilder, OH_NN_OPS_L2_NORMALIZE);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
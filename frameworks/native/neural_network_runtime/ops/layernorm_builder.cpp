@@ -207,7 +207,7 @@ OH_NN_ReturnCode LayerNormBuilder::ValidateGammaAndBetaShape(const std::vector<u
     return OH_NN_SUCCESS;
 }
 
-REGISTER_OPS(LayerNormBuilder, OH_NN_OPS_LAYER_NORM);
+REGISTER_OPS_BUILDER(LayerNormBuilder, OH_NN_OPS_LAYER_NORM);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
@@ -115,7 +115,7 @@ LiteGraphPrimitvePtr LeakyReluBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(LeakyReluBuilder, OH_NN_OPS_LEAKY_RELU);
+REGISTER_OPS_BUILDER(LeakyReluBuilder, OH_NN_OPS_LEAKY_RELU);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
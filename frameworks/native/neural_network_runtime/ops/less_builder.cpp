@@ -69,7 +69,7 @@ LiteGraphPrimitvePtr LessBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(LessBuilder, OH_NN_OPS_LESS);
+REGISTER_OPS_BUILDER(LessBuilder, OH_NN_OPS_LESS);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
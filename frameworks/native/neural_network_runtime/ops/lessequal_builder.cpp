@@ -75,7 +75,7 @@ LiteGraphPrimitvePtr LessEqualBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(LessEqualBuilder, OH_NN_OPS_LESS_EQUAL);
+REGISTER_OPS_BUILDER(LessEqualBuilder, OH_NN_OPS_LESS_EQUAL);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
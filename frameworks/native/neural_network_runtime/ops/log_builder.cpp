@@ -69,7 +69,7 @@ LiteGraphPrimitvePtr LogBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(LogBuilder, OH_NN_OPS_LOG);
+REGISTER_OPS_BUILDER(LogBuilder, OH_NN_OPS_LOG);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
@@ -111,7 +111,7 @@ LiteGraphPrimitvePtr LogSoftmaxBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(LogSoftmaxBuilder, OH_NN_OPS_LOG_SOFTMAX);
+REGISTER_OPS_BUILDER(LogSoftmaxBuilder, OH_NN_OPS_LOG_SOFTMAX);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
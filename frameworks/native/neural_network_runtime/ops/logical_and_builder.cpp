@@ -69,7 +69,7 @@ LiteGraphPrimitvePtr LogicalAndBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(LogicalAndBuilder, OH_NN_OPS_LOGICAL_AND);
+REGISTER_OPS_BUILDER(LogicalAndBuilder, OH_NN_OPS_LOGICAL_AND);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
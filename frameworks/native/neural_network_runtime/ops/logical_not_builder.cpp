@@ -69,7 +69,7 @@ LiteGraphPrimitvePtr LogicalNotBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(LogicalNotBuilder, OH_NN_OPS_LOGICAL_NOT);
+REGISTER_OPS_BUILDER(LogicalNotBuilder, OH_NN_OPS_LOGICAL_NOT);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
@@ -69,7 +69,7 @@ LiteGraphPrimitvePtr LogicalOrBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(LogicalOrBuilder, OH_NN_OPS_LOGICAL_OR);
+REGISTER_OPS_BUILDER(LogicalOrBuilder, OH_NN_OPS_LOGICAL_OR);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
@@ -209,7 +209,7 @@ LiteGraphPrimitvePtr LRNBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(LRNBuilder, OH_NN_OPS_LRN);
+REGISTER_OPS_BUILDER(LRNBuilder, OH_NN_OPS_LRN);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
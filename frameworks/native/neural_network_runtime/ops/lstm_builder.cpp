@@ -319,7 +319,7 @@ LiteGraphPrimitvePtr LSTMBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(LSTMBuilder, OH_NN_OPS_LSTM);
+REGISTER_OPS_BUILDER(LSTMBuilder, OH_NN_OPS_LSTM);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
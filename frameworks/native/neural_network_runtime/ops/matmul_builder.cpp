@@ -168,7 +168,7 @@ LiteGraphPrimitvePtr MatmulBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(MatmulBuilder, OH_NN_OPS_MATMUL);
+REGISTER_OPS_BUILDER(MatmulBuilder, OH_NN_OPS_MATMUL);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
@@ -73,7 +73,7 @@ LiteGraphPrimitvePtr MaximumBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(MaximumBuilder, OH_NN_OPS_MAXIMUM);
+REGISTER_OPS_BUILDER(MaximumBuilder, OH_NN_OPS_MAXIMUM);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
@@ -52,7 +52,7 @@ LiteGraphPrimitvePtr MaxPoolBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(MaxPoolBuilder, OH_NN_OPS_MAX_POOL);
+REGISTER_OPS_BUILDER(MaxPoolBuilder, OH_NN_OPS_MAX_POOL);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
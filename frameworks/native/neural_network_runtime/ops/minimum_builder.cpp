@@ -72,7 +72,7 @@ LiteGraphPrimitvePtr MinimumBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(MinimumBuilder, OH_NN_OPS_MINIMUM);
+REGISTER_OPS_BUILDER(MinimumBuilder, OH_NN_OPS_MINIMUM);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
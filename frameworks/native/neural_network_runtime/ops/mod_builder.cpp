@@ -69,7 +69,7 @@ LiteGraphPrimitvePtr ModBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(ModBuilder, OH_NN_OPS_MOD);
+REGISTER_OPS_BUILDER(ModBuilder, OH_NN_OPS_MOD);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
@@ -123,7 +123,7 @@ LiteGraphPrimitvePtr MulBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(MulBuilder, OH_NN_OPS_MUL);
+REGISTER_OPS_BUILDER(MulBuilder, OH_NN_OPS_MUL);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
@@ -69,7 +69,7 @@ LiteGraphPrimitvePtr NegBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(NegBuilder, OH_NN_OPS_NEG);
+REGISTER_OPS_BUILDER(NegBuilder, OH_NN_OPS_NEG);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
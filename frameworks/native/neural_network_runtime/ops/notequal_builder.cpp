@@ -69,7 +69,7 @@ LiteGraphPrimitvePtr NotEqualBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(NotEqualBuilder, OH_NN_OPS_NOT_EQUAL);
+REGISTER_OPS_BUILDER(NotEqualBuilder, OH_NN_OPS_NOT_EQUAL);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
@@ -106,7 +106,7 @@ LiteGraphPrimitvePtr OnehotBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(OnehotBuilder, OH_NN_OPS_ONE_HOT);
+REGISTER_OPS_BUILDER(OnehotBuilder, OH_NN_OPS_ONE_HOT);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // OHOS
\ No newline at end of file
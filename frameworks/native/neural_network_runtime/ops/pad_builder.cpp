@@ -154,7 +154,7 @@ LiteGraphPrimitvePtr PadBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(PadBuilder, OH_NN_OPS_PAD);
+REGISTER_OPS_BUILDER(PadBuilder, OH_NN_OPS_PAD);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespcae OHOS
\ No newline at end of file
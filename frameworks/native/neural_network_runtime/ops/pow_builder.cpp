@@ -134,7 +134,7 @@ LiteGraphPrimitvePtr PowBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(PowBuilder, OH_NN_OPS_POW);
+REGISTER_OPS_BUILDER(PowBuilder, OH_NN_OPS_POW);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
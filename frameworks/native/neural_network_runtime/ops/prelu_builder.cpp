@@ -74,7 +74,7 @@ LiteGraphPrimitvePtr PReluBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(PReluBuilder, OH_NN_OPS_PRELU);
+REGISTER_OPS_BUILDER(PReluBuilder, OH_NN_OPS_PRELU);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
@@ -151,7 +151,7 @@ LiteGraphPrimitvePtr QuantDTypeCastBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(QuantDTypeCastBuilder, OH_NN_OPS_QUANT_DTYPE_CAST);
+REGISTER_OPS_BUILDER(QuantDTypeCastBuilder, OH_NN_OPS_QUANT_DTYPE_CAST);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
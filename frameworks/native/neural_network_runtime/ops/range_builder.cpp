@@ -153,7 +153,28 @@ LiteGraphPrimitvePtr RangeBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(RangeBuilder, OH_NN_OPS_RANGE);
+OH_NN_ReturnCode RangeBuilder::Fold(const std::vector<std::shared_ptr<NNTensor>>& allTensors,
+                                    const std::vector<uint32_t>& modelInputs) const
+{
+    (void)modelInputs;
+    if (!m_isBuild || (m_delta == 0) || !IsConstantTensor(*allTensors[m_inputsIndex[0]])) {
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    int64_t count = (m_limit - m_start + m_delta + ((m_delta > 0) ? -1 : 1)) / m_delta;
+    size_t elementCount = 0;
+    if (GetFoldedElementCount({count}, allTensors[m_outputsIndex[0]]->GetDataType(), elementCount) != OH_NN_SUCCESS) {
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    std::vector<double> values(static_cast<size_t>(count));
+    for (int64_t i = 0; i < count; ++i) {
+        values[i] = static_cast<double>(m_start + i * m_delta);
+    }
+    return SetFoldedValue(*allTensors[m_outputsIndex[0]], {static_cast<int32_t>(count)}, values);
+}
+
+REGISTER_OPS_BUILDER(RangeBuilder, OH_NN_OPS_RANGE);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
@@ -72,7 +72,7 @@ LiteGraphPrimitvePtr RankBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(RankBuilder, OH_NN_OPS_RANK);
+REGISTER_OPS_BUILDER(RankBuilder, OH_NN_OPS_RANK);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
@@ -69,7 +69,7 @@ LiteGraphPrimitvePtr ReciprocalBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(ReciprocalBuilder, OH_NN_OPS_RECIPROCAL);
+REGISTER_OPS_BUILDER(ReciprocalBuilder, OH_NN_OPS_RECIPROCAL);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
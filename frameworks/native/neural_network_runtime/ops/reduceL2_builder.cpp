@@ -158,7 +158,7 @@ LiteGraphPrimitvePtr ReduceL2Builder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(ReduceL2Builder, OH_NN_OPS_REDUCE_L2);
+REGISTER_OPS_BUILDER(ReduceL2Builder, OH_NN_OPS_REDUCE_L2);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
@@ -158,7 +158,7 @@ LiteGraphPrimitvePtr ReduceAllBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(ReduceAllBuilder, OH_NN_OPS_REDUCE_ALL);
+REGISTER_OPS_BUILDER(ReduceAllBuilder, OH_NN_OPS_REDUCE_ALL);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
@@ -158,7 +158,7 @@ LiteGraphPrimitvePtr ReduceMaxBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(ReduceMaxBuilder, OH_NN_OPS_REDUCE_MAX);
+REGISTER_OPS_BUILDER(ReduceMaxBuilder, OH_NN_OPS_REDUCE_MAX);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
@@ -160,7 +160,7 @@ LiteGraphPrimitvePtr ReduceMeanBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(ReduceMeanBuilder, OH_NN_OPS_REDUCE_MEAN);
+REGISTER_OPS_BUILDER(ReduceMeanBuilder, OH_NN_OPS_REDUCE_MEAN);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
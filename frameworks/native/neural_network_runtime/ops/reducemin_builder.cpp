@@ -158,7 +158,7 @@ LiteGraphPrimitvePtr ReduceMinBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(ReduceMinBuilder, OH_NN_OPS_REDUCE_MIN);
+REGISTER_OPS_BUILDER(ReduceMinBuilder, OH_NN_OPS_REDUCE_MIN);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
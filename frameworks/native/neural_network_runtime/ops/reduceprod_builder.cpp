@@ -160,7 +160,7 @@ LiteGraphPrimitvePtr ReduceProdBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(ReduceProdBuilder, OH_NN_OPS_REDUCE_PROD);
+REGISTER_OPS_BUILDER(ReduceProdBuilder, OH_NN_OPS_REDUCE_PROD);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
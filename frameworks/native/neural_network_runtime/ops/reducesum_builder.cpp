@@ -158,7 +158,7 @@ LiteGraphPrimitvePtr ReduceSumBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(ReduceSumBuilder, OH_NN_OPS_REDUCE_SUM);
+REGISTER_OPS_BUILDER(ReduceSumBuilder, OH_NN_OPS_REDUCE_SUM);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
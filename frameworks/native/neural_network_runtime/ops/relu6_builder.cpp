@@ -83,7 +83,7 @@ LiteGraphPrimitvePtr Relu6Builder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(Relu6Builder, OH_NN_OPS_RELU6);
+REGISTER_OPS_BUILDER(Relu6Builder, OH_NN_OPS_RELU6);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
@@ -83,7 +83,7 @@ LiteGraphPrimitvePtr ReluBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(ReluBuilder, OH_NN_OPS_RELU);
+REGISTER_OPS_BUILDER(ReluBuilder, OH_NN_OPS_RELU);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
@@ -75,7 +75,49 @@ LiteGraphPrimitvePtr ReshapeBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(ReshapeBuilder, OH_NN_OPS_RESHAPE);
+OH_NN_ReturnCode ReshapeBuilder::Fold(const std::vector<std::shared_ptr<NNTensor>>& allTensors,
+                                      const std::vector<uint32_t>& modelInputs) const
+{
+    (void)modelInputs;
+    if (!m_isBuild) {
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    const NNTensor& input = *allTensors[m_inputsIndex[0]];
+    std::vector<int64_t> shape;
+    if (!IsConstantTensor(input) || !IsSameQuantization(input, *allTensors[m_outputsIndex[0]]) ||
+        (GetIntegerValues(*allTensors[m_inputsIndex[1]], shape) != OH_NN_SUCCESS)) {
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    // At most one dimension may be -1, which takes the remaining elements.
+    int64_t knownCount = 1;
+    size_t inferredAxis = shape.size();
+    for (size_t i = 0; i < shape.size(); ++i) {
+        if ((shape[i] == -1) && (inferredAxis == shape.size())) {
+            inferredAxis = i;
+        } else if ((shape[i] <= 0) || (shape[i] > INT32_MAX)) {
+            return OH_NN_OPERATION_FORBIDDEN;
+        } else {
+            knownCount *= shape[i];
+        }
+    }
+
+    int64_t elementCount = static_cast<int64_t>(input.GetElementCount());
+    if (inferredAxis != shape.size()) {
+        if (elementCount % knownCount != 0) {
+            return OH_NN_OPERATION_FORBIDDEN;
+        }
+        shape[inferredAxis] = elementCount / knownCount;
+    } else if (knownCount != elementCount) {
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    std::vector<int32_t> outputDimensions(shape.begin(), shape.end());
+    return SetFoldedValue(*allTensors[m_outputsIndex[0]], outputDimensions, input.GetBuffer(), input.GetDataLength());
+}
+
+REGISTER_OPS_BUILDER(ReshapeBuilder, OH_NN_OPS_RESHAPE);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
@@ -31,6 +31,8 @@ public:
                            const std::vector<std::shared_ptr<NNTensor>>& allTensors) override;
 
     LiteGraphPrimitvePtr GetPrimitive() override;
+    OH_NN_ReturnCode Fold(const std::vector<std::shared_ptr<NNTensor>>& allTensors,
+                          const std::vector<uint32_t>& modelInputs) const override;
 };
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
@@ -214,7 +214,7 @@ LiteGraphPrimitvePtr ResizeBilinearBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(ResizeBilinearBuilder, OH_NN_OPS_RESIZE_BILINEAR);
+REGISTER_OPS_BUILDER(ResizeBilinearBuilder, OH_NN_OPS_RESIZE_BILINEAR);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
@@ -72,7 +72,7 @@ LiteGraphPrimitvePtr RoundBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(RoundBuilder, OH_NN_OPS_ROUND);
+REGISTER_OPS_BUILDER(RoundBuilder, OH_NN_OPS_ROUND);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
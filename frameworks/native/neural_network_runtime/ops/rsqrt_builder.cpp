@@ -75,7 +75,7 @@ LiteGraphPrimitvePtr RsqrtBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(RsqrtBuilder, OH_NN_OPS_RSQRT);
+REGISTER_OPS_BUILDER(RsqrtBuilder, OH_NN_OPS_RSQRT);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
@@ -145,7 +145,7 @@ LiteGraphPrimitvePtr ScaleBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(ScaleBuilder, OH_NN_OPS_SCALE);
+REGISTER_OPS_BUILDER(ScaleBuilder, OH_NN_OPS_SCALE);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
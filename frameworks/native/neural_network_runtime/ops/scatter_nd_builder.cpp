@@ -72,7 +72,7 @@ LiteGraphPrimitvePtr ScatterNDBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(ScatterNDBuilder, OH_NN_OPS_SCATTER_ND);
+REGISTER_OPS_BUILDER(ScatterNDBuilder, OH_NN_OPS_SCATTER_ND);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
@@ -69,7 +69,7 @@ LiteGraphPrimitvePtr SelectBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(SelectBuilder, OH_NN_OPS_SELECT);
+REGISTER_OPS_BUILDER(SelectBuilder, OH_NN_OPS_SELECT);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
@@ -15,6 +15,8 @@
 
 #include "shape_builder.h"
 
+#include <algorithm>
+
 #include "mindir.h"
 
 #include "ops_registry.h"
@@ -73,7 +75,28 @@ LiteGraphPrimitvePtr ShapeBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(ShapeBuilder, OH_NN_OPS_SHAPE);
+OH_NN_ReturnCode ShapeBuilder::Fold(const std::vector<std::shared_ptr<NNTensor>>& allTensors,
+                                    const std::vector<uint32_t>& modelInputs) const
+{
+    if (!m_isBuild) {
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    // Only the shape of the input is read, its value may be unknown. The dimensions declared for an intermediate
+    // tensor are not checked against what the device infers, so only model inputs and constants are trusted.
+    uint32_t inputIndex = m_inputsIndex[0];
+    const std::shared_ptr<NNTensor>& input = allTensors[inputIndex];
+    bool isModelInput = std::find(modelInputs.begin(), modelInputs.end(), inputIndex) != modelInputs.end();
+    if ((!isModelInput && !IsConstantTensor(*input)) || input->IsDynamicShape() || input->GetDimensions().empty()) {
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    std::vector<int32_t> dimensions = input->GetDimensions();
+    std::vector<double> values(dimensions.begin(), dimensions.end());
+    return SetFoldedValue(*allTensors[m_outputsIndex[0]], {static_cast<int32_t>(dimensions.size())}, values);
+}
+
+REGISTER_OPS_BUILDER(ShapeBuilder, OH_NN_OPS_SHAPE);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
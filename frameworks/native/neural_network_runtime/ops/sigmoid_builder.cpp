@@ -84,7 +84,7 @@ LiteGraphPrimitvePtr SigmoidBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(SigmoidBuilder, OH_NN_OPS_SIGMOID);
+REGISTER_OPS_BUILDER(SigmoidBuilder, OH_NN_OPS_SIGMOID);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
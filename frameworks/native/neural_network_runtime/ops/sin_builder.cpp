@@ -69,7 +69,7 @@ LiteGraphPrimitvePtr SinBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(SinBuilder, OH_NN_OPS_SIN);
+REGISTER_OPS_BUILDER(SinBuilder, OH_NN_OPS_SIN);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
@@ -126,7 +126,7 @@ LiteGraphPrimitvePtr SliceBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(SliceBuilder, OH_NN_OPS_SLICE);
+REGISTER_OPS_BUILDER(SliceBuilder, OH_NN_OPS_SLICE);
 } // namespace ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
@@ -120,7 +120,7 @@ LiteGraphTensorPtr SoftmaxBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(SoftmaxBuilder, OH_NN_OPS_SOFTMAX);
+REGISTER_OPS_BUILDER(SoftmaxBuilder, OH_NN_OPS_SOFTMAX);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
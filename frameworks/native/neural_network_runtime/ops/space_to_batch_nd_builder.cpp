@@ -188,7 +188,7 @@ LiteGraphTensorPtr SpaceToBatchNDBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(SpaceToBatchNDBuilder, OH_NN_OPS_SPACE_TO_BATCH_ND);
+REGISTER_OPS_BUILDER(SpaceToBatchNDBuilder, OH_NN_OPS_SPACE_TO_BATCH_ND);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
@@ -115,7 +115,7 @@ LiteGraphPrimitvePtr SpaceToDepthBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(SpaceToDepthBuilder, OH_NN_OPS_SPACE_TO_DEPTH);
+REGISTER_OPS_BUILDER(SpaceToDepthBuilder, OH_NN_OPS_SPACE_TO_DEPTH);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
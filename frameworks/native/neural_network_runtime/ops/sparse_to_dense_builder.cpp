@@ -69,7 +69,7 @@ LiteGraphPrimitvePtr SparseToDenseBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(SparseToDenseBuilder, OH_NN_OPS_SPARSE_TO_DENSE);
+REGISTER_OPS_BUILDER(SparseToDenseBuilder, OH_NN_OPS_SPARSE_TO_DENSE);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
@@ -181,7 +181,7 @@ LiteGraphTensorPtr SplitBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(SplitBuilder, OH_NN_OPS_SPLIT);
+REGISTER_OPS_BUILDER(SplitBuilder, OH_NN_OPS_SPLIT);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
@@ -84,7 +84,7 @@ LiteGraphTensorPtr SqrtBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(SqrtBuilder, OH_NN_OPS_SQRT);
+REGISTER_OPS_BUILDER(SqrtBuilder, OH_NN_OPS_SQRT);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
@@ -69,7 +69,7 @@ LiteGraphPrimitvePtr SquareBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(SquareBuilder, OH_NN_OPS_SQUARE);
+REGISTER_OPS_BUILDER(SquareBuilder, OH_NN_OPS_SQUARE);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
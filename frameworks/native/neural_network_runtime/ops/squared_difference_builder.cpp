@@ -82,7 +82,7 @@ LiteGraphTensorPtr SquaredDifferenceBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(SquaredDifferenceBuilder, OH_NN_OPS_SQUARED_DIFFERENCE);
+REGISTER_OPS_BUILDER(SquaredDifferenceBuilder, OH_NN_OPS_SQUARED_DIFFERENCE);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
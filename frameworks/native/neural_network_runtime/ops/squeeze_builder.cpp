@@ -124,7 +124,7 @@ LiteGraphTensorPtr SqueezeBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(SqueezeBuilder, OH_NN_OPS_SQUEEZE);
+REGISTER_OPS_BUILDER(SqueezeBuilder, OH_NN_OPS_SQUEEZE);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
@@ -123,7 +123,7 @@ LiteGraphTensorPtr StackBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(StackBuilder, OH_NN_OPS_STACK);
+REGISTER_OPS_BUILDER(StackBuilder, OH_NN_OPS_STACK);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
@@ -199,7 +199,7 @@ LiteGraphPrimitvePtr StridedSliceBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(StridedSliceBuilder, OH_NN_OPS_STRIDED_SLICE);
+REGISTER_OPS_BUILDER(StridedSliceBuilder, OH_NN_OPS_STRIDED_SLICE);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
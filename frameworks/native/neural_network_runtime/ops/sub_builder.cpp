@@ -130,7 +130,7 @@ LiteGraphPrimitvePtr SubBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(SubBuilder, OH_NN_OPS_SUB);
+REGISTER_OPS_BUILDER(SubBuilder, OH_NN_OPS_SUB);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
@@ -79,7 +79,7 @@ LiteGraphPrimitvePtr SwishBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(SwishBuilder, OH_NN_OPS_SWISH);
+REGISTER_OPS_BUILDER(SwishBuilder, OH_NN_OPS_SWISH);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
@@ -88,7 +88,7 @@ LiteGraphPrimitvePtr TanhBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(TanhBuilder, OH_NN_OPS_TANH);
+REGISTER_OPS_BUILDER(TanhBuilder, OH_NN_OPS_TANH);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
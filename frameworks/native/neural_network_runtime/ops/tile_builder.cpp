@@ -123,7 +123,7 @@ LiteGraphPrimitvePtr TileBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(TileBuilder, OH_NN_OPS_TILE);
+REGISTER_OPS_BUILDER(TileBuilder, OH_NN_OPS_TILE);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
@@ -138,7 +138,7 @@ LiteGraphPrimitvePtr TopKBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(TopKBuilder, OH_NN_OPS_TOP_K);
+REGISTER_OPS_BUILDER(TopKBuilder, OH_NN_OPS_TOP_K);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
@@ -82,7 +82,7 @@ LiteGraphPrimitvePtr TransposeBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(TransposeBuilder, OH_NN_OPS_TRANSPOSE);
+REGISTER_OPS_BUILDER(TransposeBuilder, OH_NN_OPS_TRANSPOSE);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
@@ -118,7 +118,7 @@ LiteGraphPrimitvePtr UnsqueezeBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(UnsqueezeBuilder, OH_NN_OPS_UNSQUEEZE);
+REGISTER_OPS_BUILDER(UnsqueezeBuilder, OH_NN_OPS_UNSQUEEZE);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
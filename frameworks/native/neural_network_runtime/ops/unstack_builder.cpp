@@ -129,7 +129,7 @@ LiteGraphPrimitvePtr UnstackBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(UnstackBuilder, OH_NN_OPS_UNSTACK);
+REGISTER_OPS_BUILDER(UnstackBuilder, OH_NN_OPS_UNSTACK);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
@@ -69,7 +69,7 @@ LiteGraphPrimitvePtr WhereBuilder::GetPrimitive()
     return graphPrimitivePtr;
 }
 
-REGISTER_OPS(WhereBuilder, OH_NN_OPS_WHERE);
+REGISTER_OPS_BUILDER(WhereBuilder, OH_NN_OPS_WHERE);
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
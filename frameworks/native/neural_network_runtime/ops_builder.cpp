@@ -14,12 +14,71 @@
  */
 
 #include "ops_builder.h"
+
+#include <algorithm>
+#include <new>
+
 #include "mindir.h"
 #include "mindir_types.h"
+#include "securec.h"
+
+#include "transform.h"
 
 namespace OHOS {
 namespace NeuralNetworkRuntime {
 namespace Ops {
+namespace {
+template<typename T>
+void WriteValues(const std::vector<double>& values, char* buffer)
+{
+    T* data = reinterpret_cast<T*>(buffer);
+    for (size_t i = 0; i < values.size(); ++i) {
+        data[i] = static_cast<T>(values[i]);
+    }
+}
+
+bool WriteValues(const std::vector<double>& values, OH_NN_DataType dataType, char* buffer)
+{
+    switch (dataType) {
+        case OH_NN_BOOL:
+            WriteValues<bool>(values, buffer);
+            return true;
+        case OH_NN_INT8:
+            WriteValues<int8_t>(values, buffer);
+            return true;
+        case OH_NN_INT16:
+            WriteValues<int16_t>(values, buffer);
+            return true;
+        case OH_NN_INT32:
+            WriteValues<int32_t>(values, buffer);
+            return true;
+        case OH_NN_INT64:
+            WriteValues<int64_t>(values, buffer);
+            return true;
+        case OH_NN_UINT8:
+            WriteValues<uint8_t>(values, buffer);
+            return true;
+        case OH_NN_UINT16:
+            WriteValues<uint16_t>(values, buffer);
+            return true;
+        case OH_NN_UINT32:
+            WriteValues<uint32_t>(values, buffer);
+            return true;
+        case OH_NN_UINT64:
+            WriteValues<uint64_t>(values, buffer);
+            return true;
+        case OH_NN_FLOAT32:
+            WriteValues<float>(values, buffer);
+            return true;
+        case OH_NN_FLOAT64:
+            WriteValues<double>(values, buffer);
+            return true;
+        default:
+            return false;
+    }
+}
+} // namespace
+
 void DestroyLiteGraphPrimitive(void* primitive)
 {
     mindspore::lite::MindIR_Primitive_Destroy(&primitive);
@@ -55,6 +114,24 @@ OpsQuantType OpsBuilder::GetQuantType() const
     return m_quantType;
 }
 
+OH_NN_ReturnCode OpsBuilder::Fold(const std::vector<std::shared_ptr<NNTensor>>& allTensors,
+                                  const std::vector<uint32_t>& modelInputs) const
+{
+    (void)allTensors;
+    (void)modelInputs;
+    return OH_NN_OPERATION_FORBIDDEN;
+}
+
+const std::vector<uint32_t>& OpsBuilder::GetInputsIndex() const
+{
+    return m_inputsIndex;
+}
+
+const std::vector<uint32_t>& OpsBuilder::GetOutputsIndex() const
+{
+    return m_outputsIndex;
+}
+
 OH_NN_ReturnCode OpsBuilder::CheckIOIndex(const std::vector<uint32_t>& inputsIndex,
                                           const std::vector<uint32_t>& outputsIndex,
                                           const std::vector<std::shared_ptr<NNTensor>>& allTensors,
@@ -121,6 +198,128 @@ void OpsBuilder::SetQuantType(const std::vector<uint32_t>& outputsIndex,
         m_quantType = OpsQuantType::QUANT_ALL;
     }
 }
+
+bool OpsBuilder::IsConstantTensor(const NNTensor& tensor)
+{
+    return (tensor.GetBuffer() != nullptr) && !tensor.IsOpParameter() && !tensor.IsDynamicShape();
+}
+
+OH_NN_ReturnCode OpsBuilder::GetIntegerValues(const NNTensor& tensor, std::vector<int64_t>& values)
+{
+    if (!IsConstantTensor(tensor)) {
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    size_t count = tensor.GetElementCount();
+    values.resize(count);
+    if (tensor.GetDataType() == OH_NN_INT32) {
+        const int32_t* data = static_cast<const int32_t*>(tensor.GetBuffer());
+        std::copy(data, data + count, values.begin());
+    } else if (tensor.GetDataType() == OH_NN_INT64) {
+        const int64_t* data = static_cast<const int64_t*>(tensor.GetBuffer());
+        std::copy(data, data + count, values.begin());
+    } else {
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+    return OH_NN_SUCCESS;
+}
+
+bool OpsBuilder::IsSameQuantization(const NNTensor& input, const NNTensor& output)
+{
+    if ((input.GetGroupQuantParam() != nullptr) || (output.GetGroupQuantParam() != nullptr)) {
+        return false;
+    }
+
+    std::vector<QuantParam> inputParams = input.GetQuantParam();
+    std::vector<QuantParam> outputParams = output.GetQuantParam();
+    if ((inputParams.size() != outputParams.size()) || (inputParams.size() > 1)) {
+        return false;
+    }
+    for (size_t i = 0; i < inputParams.size(); ++i) {
+        if ((inputParams[i].numBits != outputParams[i].numBits) || (inputParams[i].scale != outputParams[i].scale) ||
+            (inputParams[i].zeroPoint != outputParams[i].zeroPoint)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+OH_NN_ReturnCode OpsBuilder::GetFoldedElementCount(const std::vector<int64_t>& dimensions, OH_NN_DataType dataType,
+                                                   size_t& elementCount)
+{
+    size_t typeSize = GetTypeSize(dataType);
+    if (typeSize == 0) {
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    // Bounded by MAX_FOLDED_BYTES / typeSize on every step, so the product never overflows.
+    const size_t maxElementCount = MAX_FOLDED_BYTES / typeSize;
+    size_t count = 1;
+    for (int64_t dim : dimensions) {
+        if ((dim <= 0) || (static_cast<uint64_t>(dim) > maxElementCount / count)) {
+            return OH_NN_OPERATION_FORBIDDEN;
+        }
+        count *= static_cast<size_t>(dim);
+    }
+    elementCount = count;
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode OpsBuilder::SetFoldedValue(NNTensor& tensor, const std::vector<int32_t>& dimensions,
+                                            const void* data, size_t length)
+{
+    // Check everything SetDimensions() checks beforehand, a failed fold must not change the tensor.
+    if ((tensor.GetBuffer() != nullptr) || (dimensions.size() != tensor.GetDimensions().size())) {
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+    uint64_t elementCount = 1;
+    for (int32_t dim : dimensions) {
+        if (dim <= 0) {
+            return OH_NN_OPERATION_FORBIDDEN;
+        }
+        elementCount *= static_cast<uint64_t>(dim);
+        if (elementCount > UINT32_MAX) {
+            return OH_NN_OPERATION_FORBIDDEN;
+        }
+    }
+    if ((GetTypeSize(tensor.GetDataType()) == 0) || (GetDataByteSize(tensor.GetDataType(), elementCount) != length)) {
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    char* buffer = new (std::nothrow) char[length];
+    if (buffer == nullptr) {
+        LOGE("[OpsBuilder] SetFoldedValue failed, fail to create the buffer of the folded tensor.");
+        return OH_NN_MEMORY_ERROR;
+    }
+    if (memcpy_s(buffer, length, data, length) != EOK) {
+        LOGE("[OpsBuilder] SetFoldedValue failed, fail to copy the folded value.");
+        delete [] buffer;
+        return OH_NN_MEMORY_ERROR;
+    }
+
+    OH_NN_ReturnCode ret = tensor.SetDimensions(dimensions);
+    if (ret != OH_NN_SUCCESS) {
+        delete [] buffer;
+        return ret;
+    }
+    // Released by the tensor.
+    tensor.SetBuffer(buffer, length);
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode OpsBuilder::SetFoldedValue(NNTensor& tensor, const std::vector<int32_t>& dimensions,
+                                            const std::vector<double>& values)
+{
+    if (tensor.IsQuantTensor()) {
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    std::vector<char> data(values.size() * GetTypeSize(tensor.GetDataType()));
+    if (data.empty() || !WriteValues(values, tensor.GetDataType(), data.data())) {
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+    return SetFoldedValue(tensor, dimensions, data.data(), data.size());
+}
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
@@ -58,6 +58,14 @@ public:
                                 const std::unordered_map<uint32_t, uint32_t>& modelIDToGraphID) const;
     virtual std::string GetName() const;
     virtual OpsQuantType GetQuantType() const;
+    // Evaluates the operation on the host and stores the result as the value of its outputs, so that InnerModel can
+    // emit constants instead of the node. Operations which cannot be evaluated return OH_NN_OPERATION_FORBIDDEN and
+    // leave their outputs untouched. modelInputs are the indices of the model inputs, whose dimensions are known at
+    // build time unlike the dimensions declared for intermediate tensors.
+    virtual OH_NN_ReturnCode Fold(const std::vector<std::shared_ptr<NNTensor>>& allTensors,
+                                  const std::vector<uint32_t>& modelInputs) const;
+    const std::vector<uint32_t>& GetInputsIndex() const;
+    const std::vector<uint32_t>& GetOutputsIndex() const;
 
 protected:
     OH_NN_ReturnCode CheckIOIndex(const std::vector<uint32_t>& inputsIndex,
@@ -71,7 +79,27 @@ protected:
     void SetQuantType(const std::vector<uint32_t>& outputsIndex,
                       const std::vector<std::shared_ptr<NNTensor>>& allTensors);
 
+    // Helpers of Fold(). A constant is a tensor whose value has been set and which is not an operation parameter.
+    static bool IsConstantTensor(const NNTensor& tensor);
+    static OH_NN_ReturnCode GetIntegerValues(const NNTensor& tensor, std::vector<int64_t>& values);
+    // Whether the bytes of input can be moved to output unchanged, which needs both to be quantized the same way.
+    // Per channel and per group quantization are tied to the layout, so only per tensor quantization qualifies.
+    static bool IsSameQuantization(const NNTensor& input, const NNTensor& output);
+    // Counts the elements of a folded output before anything is allocated. Fails with OH_NN_OPERATION_FORBIDDEN, which
+    // leaves the operation to the device, if a dimension is not positive or the output would exceed MAX_FOLDED_BYTES.
+    static OH_NN_ReturnCode GetFoldedElementCount(const std::vector<int64_t>& dimensions, OH_NN_DataType dataType,
+                                                  size_t& elementCount);
+    // Gives the output its folded dimensions and a copy of data, the output must have no value yet.
+    static OH_NN_ReturnCode SetFoldedValue(NNTensor& tensor, const std::vector<int32_t>& dimensions,
+                                           const void* data, size_t length);
+    // Same as above, converting the values to the data type of the output.
+    static OH_NN_ReturnCode SetFoldedValue(NNTensor& tensor, const std::vector<int32_t>& dimensions,
+                                           const std::vector<double>& values);
+
 protected:
+    // Folding generated values beyond this size would only move a large constant from the device into the model.
+    static constexpr size_t MAX_FOLDED_BYTES = 64 * 1024;
+
     std::string m_name;
     std::vector<uint32_t> m_inputsIndex;
     std::vector<uint32_t> m_outputsIndex;
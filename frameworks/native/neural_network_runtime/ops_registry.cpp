@@ -18,10 +18,141 @@
 namespace OHOS {
 namespace NeuralNetworkRuntime {
 namespace Ops {
+// Every operation with a builder in ops/, each one defines its creator with REGISTER_OPS_BUILDER.
+#define NNRT_BUILTIN_OPS_LIST(X) \
+    X(OH_NN_OPS_ADD) \
+    X(OH_NN_OPS_AVG_POOL) \
+    X(OH_NN_OPS_BATCH_NORM) \
+    X(OH_NN_OPS_BATCH_TO_SPACE_ND) \
+    X(OH_NN_OPS_BIAS_ADD) \
+    X(OH_NN_OPS_CAST) \
+    X(OH_NN_OPS_CONCAT) \
+    X(OH_NN_OPS_CONV2D) \
+    X(OH_NN_OPS_CONV2D_TRANSPOSE) \
+    X(OH_NN_OPS_DEPTHWISE_CONV2D_NATIVE) \
+    X(OH_NN_OPS_DIV) \
+    X(OH_NN_OPS_ELTWISE) \
+    X(OH_NN_OPS_EXPAND_DIMS) \
+    X(OH_NN_OPS_FILL) \
+    X(OH_NN_OPS_FULL_CONNECTION) \
+    X(OH_NN_OPS_GATHER) \
+    X(OH_NN_OPS_HSWISH) \
+    X(OH_NN_OPS_LESS_EQUAL) \
+    X(OH_NN_OPS_MATMUL) \
+    X(OH_NN_OPS_MAXIMUM) \
+    X(OH_NN_OPS_MAX_POOL) \
+    X(OH_NN_OPS_MUL) \
+    X(OH_NN_OPS_ONE_HOT) \
+    X(OH_NN_OPS_PAD) \
+    X(OH_NN_OPS_POW) \
+    X(OH_NN_OPS_SCALE) \
+    X(OH_NN_OPS_SHAPE) \
+    X(OH_NN_OPS_SIGMOID) \
+    X(OH_NN_OPS_SLICE) \
+    X(OH_NN_OPS_SOFTMAX) \
+    X(OH_NN_OPS_SPACE_TO_BATCH_ND) \
+    X(OH_NN_OPS_SPLIT) \
+    X(OH_NN_OPS_SQRT) \
+    X(OH_NN_OPS_SQUARED_DIFFERENCE) \
+    X(OH_NN_OPS_SQUEEZE) \
+    X(OH_NN_OPS_STACK) \
+    X(OH_NN_OPS_STRIDED_SLICE) \
+    X(OH_NN_OPS_SUB) \
+    X(OH_NN_OPS_TANH) \
+    X(OH_NN_OPS_TILE) \
+    X(OH_NN_OPS_TRANSPOSE) \
+    X(OH_NN_OPS_REDUCE_MEAN) \
+    X(OH_NN_OPS_RESIZE_BILINEAR) \
+    X(OH_NN_OPS_RSQRT) \
+    X(OH_NN_OPS_RESHAPE) \
+    X(OH_NN_OPS_PRELU) \
+    X(OH_NN_OPS_RELU) \
+    X(OH_NN_OPS_RELU6) \
+    X(OH_NN_OPS_LAYER_NORM) \
+    X(OH_NN_OPS_REDUCE_PROD) \
+    X(OH_NN_OPS_REDUCE_ALL) \
+    X(OH_NN_OPS_QUANT_DTYPE_CAST) \
+    X(OH_NN_OPS_TOP_K) \
+    X(OH_NN_OPS_ARG_MAX) \
+    X(OH_NN_OPS_UNSQUEEZE) \
+    X(OH_NN_OPS_GELU) \
+    X(OH_NN_OPS_UNSTACK) \
+    X(OH_NN_OPS_ABS) \
+    X(OH_NN_OPS_ERF) \
+    X(OH_NN_OPS_EXP) \
+    X(OH_NN_OPS_LESS) \
+    X(OH_NN_OPS_SELECT) \
+    X(OH_NN_OPS_SQUARE) \
+    X(OH_NN_OPS_FLATTEN) \
+    X(OH_NN_OPS_DEPTH_TO_SPACE) \
+    X(OH_NN_OPS_RANGE) \
+    X(OH_NN_OPS_INSTANCE_NORM) \
+    X(OH_NN_OPS_CONSTANT_OF_SHAPE) \
+    X(OH_NN_OPS_BROADCAST_TO) \
+    X(OH_NN_OPS_EQUAL) \
+    X(OH_NN_OPS_GREATER) \
+    X(OH_NN_OPS_NOT_EQUAL) \
+    X(OH_NN_OPS_GREATER_EQUAL) \
+    X(OH_NN_OPS_LEAKY_RELU) \
+    X(OH_NN_OPS_LSTM) \
+    X(OH_NN_OPS_CLIP) \
+    X(OH_NN_OPS_ALL) \
+    X(OH_NN_OPS_ASSERT) \
+    X(OH_NN_OPS_COS) \
+    X(OH_NN_OPS_LOG) \
+    X(OH_NN_OPS_LOGICAL_AND) \
+    X(OH_NN_OPS_LOGICAL_NOT) \
+    X(OH_NN_OPS_MOD) \
+    X(OH_NN_OPS_NEG) \
+    X(OH_NN_OPS_RECIPROCAL) \
+    X(OH_NN_OPS_SIN) \
+    X(OH_NN_OPS_WHERE) \
+    X(OH_NN_OPS_SPARSE_TO_DENSE) \
+    X(OH_NN_OPS_LOGICAL_OR) \
+    X(OH_NN_OPS_CEIL) \
+    X(OH_NN_OPS_CROP) \
+    X(OH_NN_OPS_DETECTION_POST_PROCESS) \
+    X(OH_NN_OPS_FLOOR) \
+    X(OH_NN_OPS_L2_NORMALIZE) \
+    X(OH_NN_OPS_LOG_SOFTMAX) \
+    X(OH_NN_OPS_LRN) \
+    X(OH_NN_OPS_MINIMUM) \
+    X(OH_NN_OPS_RANK) \
+    X(OH_NN_OPS_REDUCE_MAX) \
+    X(OH_NN_OPS_REDUCE_MIN) \
+    X(OH_NN_OPS_REDUCE_SUM) \
+    X(OH_NN_OPS_ROUND) \
+    X(OH_NN_OPS_SCATTER_ND) \
+    X(OH_NN_OPS_SPACE_TO_DEPTH) \
+    X(OH_NN_OPS_SWISH) \
+    X(OH_NN_OPS_REDUCE_L2) \
+    X(OH_NN_OPS_HARD_SIGMOID) \
+    X(OH_NN_OPS_GATHER_ND)
+
+#define NNRT_DECLARE_OPS_CREATOR(opsType) template<> std::unique_ptr<OpsBuilder> CreateOpsBuilder<opsType>();
+#define NNRT_OPS_DISPATCH_KEY(opsType) static_cast<size_t>(opsType),
+#define NNRT_OPS_DISPATCH_SET(opsType) table.Set(static_cast<size_t>(opsType), &CreateOpsBuilder<opsType>);
+
+NNRT_BUILTIN_OPS_LIST(NNRT_DECLARE_OPS_CREATOR)
+
+namespace {
+constexpr size_t OPS_TABLE_SIZE = std::max({NNRT_BUILTIN_OPS_LIST(NNRT_OPS_DISPATCH_KEY)}) + 1;
+
+constexpr DispatchTable<OpsCreateFunc, OPS_TABLE_SIZE> BuildOpsTable()
+{
+    DispatchTable<OpsCreateFunc, OPS_TABLE_SIZE> table {};
+    NNRT_BUILTIN_OPS_LIST(NNRT_OPS_DISPATCH_SET)
+    return table;
+}
+
+constexpr DispatchTable<OpsCreateFunc, OPS_TABLE_SIZE> OPS_TABLE = BuildOpsTable();
+} // namespace
+
 OpsRegistry::Registrar::Registrar(OH_NN_OperationType opsType, std::function<std::unique_ptr<OpsBuilder>()> createFunc)
 {
     OpsRegistry& registry = OpsRegistry::GetSingleton();
-    if (registry.m_opsRegedit.find(opsType) != registry.m_opsRegedit.end()) {
+    if (OPS_TABLE.Find(static_cast<size_t>(opsType)) != nullptr ||
+        registry.m_opsRegedit.find(opsType) != registry.m_opsRegedit.end()) {
         LOGW("Operantion has been registered, cannot register twice. Operation type: %d", opsType);
     } else {
         registry.m_opsRegedit[opsType] = createFunc;
@@ -36,11 +167,17 @@ OpsRegistry& OpsRegistry::GetSingleton()
 
 std::unique_ptr<OpsBuilder> OpsRegistry::GetOpsBuilder(OH_NN_OperationType type) const
 {
-    if (m_opsRegedit.find(type) != m_opsRegedit.end()) {
-        return m_opsRegedit.at(type)();
+    OpsCreateFunc createFunc = OPS_TABLE.Find(static_cast<size_t>(type));
+    if (createFunc != nullptr) {
+        return createFunc();
+    }
+
+    auto iter = m_opsRegedit.find(type);
+    if (iter != m_opsRegedit.end()) {
+        return iter->second();
     }
     return nullptr;
 }
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
@@ -20,12 +20,19 @@
 #include <memory>
 #include <unordered_map>
 
+#include "dispatch_table.h"
 #include "ops_builder.h"
 #include "neural_network_runtime/neural_network_runtime.h"
 
 namespace OHOS {
 namespace NeuralNetworkRuntime {
 namespace Ops {
+using OpsCreateFunc = std::unique_ptr<OpsBuilder>(*)();
+
+// Creates the builder of a builtin operation, specialized for each operation type by REGISTER_OPS_BUILDER.
+template<OH_NN_OperationType opsType>
+std::unique_ptr<OpsBuilder> CreateOpsBuilder();
+
 class OpsRegistry {
 public:
     struct Registrar {
@@ -47,7 +54,14 @@ private:
 };
 
 #define CREATE_FUNC(T) ([]()->std::unique_ptr<OpsBuilder> {return std::make_unique<T>();})
+// Registers an operation builder at runtime, used for operations outside the builtin operation table.
 #define REGISTER_OPS(T, opsType) static OpsRegistry::Registrar g_##T(opsType, CREATE_FUNC(T))
+// Defines the creator of a builtin operation, which is looked up through the constant table in ops_registry.cpp.
+#define REGISTER_OPS_BUILDER(T, opsType)                                  \
+    template<> std::unique_ptr<OpsBuilder> CreateOpsBuilder<opsType>()    \
+    {                                                                     \
+        return std::make_unique<T>();                                     \
+    }
 } // namespace Ops
 } // namespace NeuralNetworkRuntime
 } // namespcae OHOS
@@ -16,6 +16,8 @@
 #ifndef NEURAL_NETWORK_RUNTIME_PREPARED_MODEL_H
 #define NEURAL_NETWORK_RUNTIME_PREPARED_MODEL_H
 
+#include <mutex>
+#include <string>
 #include <vector>
 
 #include "neural_network_runtime/neural_network_runtime_type.h"
@@ -51,6 +53,46 @@ public:
     }
 
     virtual OH_NN_ReturnCode SetAippString(const std::string& aippStrings) = 0;
+
+    // Passes aippStrings to SetAippString() unless the configuration registered under aippHandle is the one applied
+    // last. A handle always names the same string, handle 0 stands for an unregistered string and is always sent.
+    OH_NN_ReturnCode ApplyAippConfig(uint32_t aippHandle, const std::string& aippStrings)
+    {
+        std::lock_guard<std::mutex> lock(m_aippMutex);
+        return ApplyAippConfigLocked(aippHandle, aippStrings);
+    }
+
+    // Applies the configuration and runs under one lock, so that an executor sharing the prepared model cannot apply
+    // its own configuration in between.
+    OH_NN_ReturnCode RunWithAippConfig(uint32_t aippHandle, const std::string& aippStrings,
+                                       const std::vector<NN_Tensor*>& inputs,
+                                       const std::vector<NN_Tensor*>& outputs,
+                                       std::vector<std::vector<int32_t>>& outputsDims,
+                                       std::vector<bool>& isOutputBufferEnough)
+    {
+        std::lock_guard<std::mutex> lock(m_aippMutex);
+        OH_NN_ReturnCode ret = ApplyAippConfigLocked(aippHandle, aippStrings);
+        if (ret != OH_NN_SUCCESS) {
+            return ret;
+        }
+        return Run(inputs, outputs, outputsDims, isOutputBufferEnough);
+    }
+
+private:
+    OH_NN_ReturnCode ApplyAippConfigLocked(uint32_t aippHandle, const std::string& aippStrings)
+    {
+        if (aippHandle != 0 && aippHandle == m_appliedAippHandle) {
+            return OH_NN_SUCCESS;
+        }
+
+        OH_NN_ReturnCode ret = SetAippString(aippStrings);
+        m_appliedAippHandle = (ret == OH_NN_SUCCESS) ? aippHandle : 0;
+        return ret;
+    }
+
+private:
+    std::mutex m_aippMutex;
+    uint32_t m_appliedAippHandle {0};
 };
 } // OHOS
 } // namespace NeuralNetworkRuntime
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "prepared_model_registry.h"
+
+#include "log.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+PreparedModelRegistry& PreparedModelRegistry::GetInstance()
+{
+    // Intentionally leaked, builds on the threads of CompilePool may still use it while static objects are destroyed.
+    static PreparedModelRegistry* instance = new PreparedModelRegistry();
+    return *instance;
+}
+
+OH_NN_ReturnCode PreparedModelRegistry::Acquire(const std::string& key, const std::shared_ptr<const void>& owner,
+    const PrepareFunc& prepare, std::shared_ptr<PreparedModel>& preparedModel, bool& isPrepared)
+{
+    if (key.empty() || (prepare == nullptr)) {
+        LOGE("[PreparedModelRegistry] Acquire failed, key or prepare function is empty.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    std::unique_lock<std::mutex> lock(m_mtx);
+    RemoveExpiredEntries();
+    auto iter = m_models.find(key);
+    while ((iter != m_models.end()) && iter->second.isPreparing) {
+        m_prepared.wait(lock);
+        iter = m_models.find(key);
+    }
+
+    if ((iter != m_models.end()) && (iter->second.ownerAddress == owner.get()) && IsAlive(iter->second)) {
+        std::shared_ptr<PreparedModel> sharedModel = iter->second.preparedModel.lock();
+        if (sharedModel != nullptr) {
+            preparedModel = sharedModel;
+            isPrepared = false;
+            LOGD("[PreparedModelRegistry] Share the prepared model of an earlier compilation.");
+            return OH_NN_SUCCESS;
+        }
+    }
+
+    // Take the key over, the waiters of this key block until the preparation below ends.
+    ModelEntry& entry = m_models[key];
+    entry = ModelEntry {};
+    entry.owner = owner;
+    entry.ownerAddress = owner.get();
+    entry.isPreparing = true;
+    lock.unlock();
+
+    std::shared_ptr<PreparedModel> newModel;
+    OH_NN_ReturnCode ret = prepare(newModel);
+
+    lock.lock();
+    // Entries in preparation are never removed by others, the key is still there. A preparation which succeeds
+    // without a model is handed to the caller as it is, but there is nothing to share.
+    iter = m_models.find(key);
+    if ((ret == OH_NN_SUCCESS) && (newModel != nullptr)) {
+        iter->second.preparedModel = newModel;
+        iter->second.isPreparing = false;
+    } else {
+        m_models.erase(iter);
+    }
+    if (ret == OH_NN_SUCCESS) {
+        preparedModel = newModel;
+        isPrepared = true;
+    }
+    lock.unlock();
+    m_prepared.notify_all();
+    return ret;
+}
+
+size_t PreparedModelRegistry::GetModelCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    size_t count = 0;
+    for (const auto& model : m_models) {
+        if (!model.second.isPreparing && IsAlive(model.second)) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+bool PreparedModelRegistry::IsAlive(const ModelEntry& entry) const
+{
+    if (entry.preparedModel.expired()) {
+        return false;
+    }
+    // An owner which has been released may be followed by another object at the same address.
+    return (entry.ownerAddress == nullptr) || !entry.owner.expired();
+}
+
+void PreparedModelRegistry::RemoveExpiredEntries()
+{
+    for (auto iter = m_models.begin(); iter != m_models.end();) {
+        if (!iter->second.isPreparing && !IsAlive(iter->second)) {
+            iter = m_models.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+}
+}  // namespace NeuralNetworkRuntime
+}  // namespace OHOS
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NEURAL_NETWORK_RUNTIME_PREPARED_MODEL_REGISTRY_H
+#define NEURAL_NETWORK_RUNTIME_PREPARED_MODEL_REGISTRY_H
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "prepared_model.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+/**
+ * Process-wide table of the prepared models held by compilations, so that compilations of the same model with the
+ * same configuration on the same backend share one driver-side model.
+ *
+ * The table only keeps weak references, a prepared model is released by the driver once the last compilation or
+ * executor holding it is destroyed. A key may be bound to an owner, such as the graph the key is derived from, and is
+ * only matched while that owner is alive. Concurrent acquisitions of a key run one preparation and the others wait
+ * for its result. A failed preparation is not remembered, the next waiter prepares again.
+ */
+class PreparedModelRegistry {
+public:
+    using PrepareFunc = std::function<OH_NN_ReturnCode(std::shared_ptr<PreparedModel>&)>;
+
+    static PreparedModelRegistry& GetInstance();
+
+    // Hands out the prepared model of key, calling prepare if no one holds it. isPrepared tells whether prepare has
+    // been called by this acquisition, in which case the caller does the work following a new preparation.
+    OH_NN_ReturnCode Acquire(const std::string& key, const std::shared_ptr<const void>& owner,
+                             const PrepareFunc& prepare, std::shared_ptr<PreparedModel>& preparedModel,
+                             bool& isPrepared);
+    size_t GetModelCount() const;
+
+private:
+    PreparedModelRegistry() = default;
+    PreparedModelRegistry(const PreparedModelRegistry&) = delete;
+    PreparedModelRegistry& operator=(const PreparedModelRegistry&) = delete;
+    ~PreparedModelRegistry() = default;
+
+    struct ModelEntry {
+        std::weak_ptr<PreparedModel> preparedModel;
+        std::weak_ptr<const void> owner;
+        const void* ownerAddress {nullptr};
+        bool isPreparing {false};
+    };
+
+    bool IsAlive(const ModelEntry& entry) const;
+    void RemoveExpiredEntries();
+
+private:
+    mutable std::mutex m_mtx;
+    std::condition_variable m_prepared;
+    std::unordered_map<std::string, ModelEntry> m_models;
+};
+}  // namespace NeuralNetworkRuntime
+}  // namespace OHOS
+#endif  // NEURAL_NETWORK_RUNTIME_PREPARED_MODEL_REGISTRY_H
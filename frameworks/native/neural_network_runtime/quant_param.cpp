@@ -15,10 +15,66 @@
 
 #include "quant_param.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "log.h"
 
 namespace OHOS {
 namespace NeuralNetworkRuntime {
+namespace {
+float HalfToFloat(uint16_t half)
+{
+    const float sign = (half & 0x8000) != 0 ? -1.0f : 1.0f;
+    const int32_t exponent = (half >> 10) & 0x1f;
+    const int32_t mantissa = half & 0x3ff;
+    if (exponent == 0) {
+        return sign * std::ldexp(static_cast<float>(mantissa), -24);
+    }
+    if (exponent == 0x1f) {
+        return (mantissa == 0) ? sign * INFINITY : NAN;
+    }
+    return sign * std::ldexp(static_cast<float>(mantissa | 0x400), exponent - 25);
+}
+} // namespace
+
+size_t GroupQuantParam::GetGroupCount() const
+{
+    return halfScales.empty() ? scales.size() : halfScales.size();
+}
+
+double GroupQuantParam::GetScale(size_t index) const
+{
+    return halfScales.empty() ? scales[index] : HalfToFloat(halfScales[index]);
+}
+
+int32_t GroupQuantParam::GetZeroPoint(size_t index) const
+{
+    return zeroPoints.empty() ? 0 : zeroPoints[index];
+}
+
+size_t GroupQuantParam::CountGroups(const std::vector<int32_t>& dimensions, int32_t axis, uint32_t groupSize)
+{
+    const int32_t rank = static_cast<int32_t>(dimensions.size());
+    if (axis < -rank || axis >= rank) {
+        return 0;
+    }
+    const size_t axisIndex = static_cast<size_t>(axis < 0 ? axis + rank : axis);
+    if (groupSize == 0) {
+        return (dimensions[axisIndex] > 0) ? static_cast<size_t>(dimensions[axisIndex]) : 0;
+    }
+
+    size_t groupCount = 1;
+    for (size_t i = 0; i < dimensions.size(); ++i) {
+        if (dimensions[i] <= 0) {
+            return 0;
+        }
+        size_t dim = static_cast<size_t>(dimensions[i]);
+        groupCount *= (i == axisIndex) ? (dim + groupSize - 1) / groupSize : dim;
+    }
+    return groupCount;
+}
+
 void QuantParams::SetScales(const std::vector<double>& scales)
 {
     m_scales = scales;
@@ -34,6 +90,18 @@ void QuantParams::SetNumBits(const std::vector<uint32_t>& numBits)
     m_numBits = numBits;
 }
 
+void QuantParams::SetHalfScales(const std::vector<uint16_t>& halfScales)
+{
+    m_halfScales = halfScales;
+}
+
+void QuantParams::SetGroup(int32_t axis, uint32_t groupSize)
+{
+    m_isGroupQuant = true;
+    m_axis = axis;
+    m_groupSize = groupSize;
+}
+
 std::vector<double> QuantParams::GetScales() const
 {
     return m_scales;
@@ -49,8 +117,18 @@ std::vector<uint32_t> QuantParams::GetNumBits() const
     return m_numBits;
 }
 
+bool QuantParams::IsGroupQuant() const
+{
+    return m_isGroupQuant;
+}
+
 OH_NN_ReturnCode QuantParams::CopyToCompat(std::vector<OHOS::NeuralNetworkRuntime::QuantParam>& compatQuantParams) const
 {
+    if (!m_halfScales.empty()) {
+        LOGE("CopyToCompat failed, half scales are only supported by group quantization.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
     if ((m_scales.size() != m_zeroPoints.size()) || (m_zeroPoints.size() != m_numBits.size())) {
         LOGE("CopyToCompat failed, the size of scales(%zu), zeroPoints(%zu) and numBits(%zu) are not equal.",
             m_scales.size(), m_zeroPoints.size(), m_numBits.size());
@@ -68,5 +146,47 @@ OH_NN_ReturnCode QuantParams::CopyToCompat(std::vector<OHOS::NeuralNetworkRuntim
 
     return OH_NN_SUCCESS;
 }
+
+OH_NN_ReturnCode QuantParams::CopyToGroup(GroupQuantParam& groupQuantParam) const
+{
+    if (!m_isGroupQuant) {
+        LOGE("CopyToGroup failed, the quantization parameters are not grouped.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    if (m_scales.empty() == m_halfScales.empty()) {
+        LOGE("CopyToGroup failed, exactly one of scales(%zu) and half scales(%zu) must be set.",
+            m_scales.size(), m_halfScales.size());
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    // Every group shares one bit width, a per-group array is accepted as long as it does not vary.
+    if (m_numBits.empty() || std::any_of(m_numBits.begin(), m_numBits.end(),
+        [this](uint32_t numBits) { return numBits != m_numBits[0]; })) {
+        LOGE("CopyToGroup failed, numBits must be set to one value for all groups.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    size_t groupCount = m_halfScales.empty() ? m_scales.size() : m_halfScales.size();
+    if (!m_zeroPoints.empty() && m_zeroPoints.size() != groupCount) {
+        LOGE("CopyToGroup failed, the size of zeroPoints(%zu) is not equal to the group count(%zu).",
+            m_zeroPoints.size(), groupCount);
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    groupQuantParam.axis = m_axis;
+    groupQuantParam.groupSize = m_groupSize;
+    groupQuantParam.numBits = m_numBits[0];
+    groupQuantParam.scales.assign(m_scales.begin(), m_scales.end());
+    groupQuantParam.halfScales = m_halfScales;
+    // Symmetric quantization needs no zero point array at all.
+    if (std::any_of(m_zeroPoints.begin(), m_zeroPoints.end(), [](int32_t zeroPoint) { return zeroPoint != 0; })) {
+        groupQuantParam.zeroPoints = m_zeroPoints;
+    } else {
+        groupQuantParam.zeroPoints.clear();
+    }
+
+    return OH_NN_SUCCESS;
+}
 } // namespace NeuralNetworkRuntime
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
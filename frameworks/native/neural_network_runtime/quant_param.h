@@ -16,6 +16,7 @@
 #ifndef NEURAL_NETWORK_RUNTIME_QUANT_PARAMS_H
 #define NEURAL_NETWORK_RUNTIME_QUANT_PARAMS_H
 
+#include <cstdint>
 #include <vector>
 
 #include "cpp_type.h"
@@ -23,6 +24,30 @@
 
 namespace OHOS {
 namespace NeuralNetworkRuntime {
+/**
+ * Compact quantization parameters of a tensor quantized per group of elements.
+ *
+ * The groups follow the blocked layout of ONNX DequantizeLinear. With groupSize 0 there is one group per index along
+ * axis, otherwise the parameters take the shape of the tensor whose dimension axis is divided by groupSize (rounded
+ * up), in row-major order. All groups share numBits and the parameters are kept in contiguous arrays: scales as
+ * float, or as IEEE half in halfScales when those were given, and zero points all 0 when zeroPoints is empty.
+ */
+struct GroupQuantParam {
+    int32_t axis {0};
+    uint32_t groupSize {0};
+    uint32_t numBits {0};
+    std::vector<float> scales;
+    std::vector<uint16_t> halfScales;
+    std::vector<int32_t> zeroPoints;
+
+    size_t GetGroupCount() const;
+    double GetScale(size_t index) const;
+    int32_t GetZeroPoint(size_t index) const;
+
+    // Number of groups of a tensor with the given shape, 0 if axis or a dimension is invalid.
+    static size_t CountGroups(const std::vector<int32_t>& dimensions, int32_t axis, uint32_t groupSize);
+};
+
 class QuantParams {
 public:
     QuantParams() = default;
@@ -31,17 +56,26 @@ public:
     void SetScales(const std::vector<double>& scales);
     void SetZeroPoints(const std::vector<int32_t>& zeroPoints);
     void SetNumBits(const std::vector<uint32_t>& numBits);
+    void SetHalfScales(const std::vector<uint16_t>& halfScales);
+    void SetGroup(int32_t axis, uint32_t groupSize);
 
     std::vector<double> GetScales() const;
     std::vector<int32_t> GetZeroPoints() const;
     std::vector<uint32_t> GetNumBits() const;
 
+    bool IsGroupQuant() const;
+
     OH_NN_ReturnCode CopyToCompat(std::vector<OHOS::NeuralNetworkRuntime::QuantParam>& compatQuantParams) const;
+    OH_NN_ReturnCode CopyToGroup(GroupQuantParam& groupQuantParam) const;
 
 private:
     std::vector<double> m_scales;
     std::vector<int32_t> m_zeroPoints;
     std::vector<uint32_t> m_numBits;
+    std::vector<uint16_t> m_halfScales;
+    bool m_isGroupQuant {false};
+    int32_t m_axis {0};
+    uint32_t m_groupSize {0};
 };
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
@@ -0,0 +1,363 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "state_tensors.h"
+
+#include "log.h"
+#include "securec.h"
+#include "transform.h"
+#include "utils.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace {
+constexpr size_t MAX_BINDING_FIELDS = 3;
+
+uint64_t GetDimsProduct(const std::vector<int32_t>& dims, size_t begin, size_t end)
+{
+    uint64_t product = 1;
+    for (size_t i = begin; i < end; ++i) {
+        product *= static_cast<uint64_t>(dims[i]);
+    }
+    return product;
+}
+} // namespace
+
+StateTensors::StateTensors(size_t backendID, const std::vector<StateBinding>& bindings) : m_backendID(backendID)
+{
+    m_states.resize(bindings.size());
+    for (size_t i = 0; i < bindings.size(); ++i) {
+        m_states[i].binding = bindings[i];
+    }
+}
+
+OH_NN_ReturnCode StateTensors::ParseBindings(const std::string& value, std::vector<StateBinding>& bindings)
+{
+    bindings.clear();
+    std::vector<std::vector<uint32_t>> pairs;
+    OH_NN_ReturnCode ret = ParseIndexPairs(value, MAX_BINDING_FIELDS, pairs);
+    if (ret != OH_NN_SUCCESS) {
+        LOGE("[StateTensors] ParseBindings failed, %{public}s is not output:input[:axis].", value.c_str());
+        return ret;
+    }
+
+    for (const std::vector<uint32_t>& fields : pairs) {
+        StateBinding binding;
+        binding.outputIndex = fields[0];
+        binding.inputIndex = fields[1];
+        if (fields.size() == MAX_BINDING_FIELDS) {
+            if (fields[2] > INT32_MAX) {
+                LOGE("[StateTensors] ParseBindings failed, axis %{public}u is out of range.", fields[2]);
+                bindings.clear();
+                return OH_NN_INVALID_PARAMETER;
+            }
+            binding.appendAxis = static_cast<int32_t>(fields[2]);
+        }
+        bindings.emplace_back(binding);
+    }
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode StateTensors::Init(const TensorDescs& inputDescs, const TensorDescs& outputDescs,
+                                    const std::vector<std::vector<uint32_t>>& minInputDims,
+                                    const std::vector<std::vector<uint32_t>>& maxInputDims)
+{
+    for (State& state : m_states) {
+        OH_NN_ReturnCode ret = InitState(state, inputDescs, outputDescs, minInputDims, maxInputDims);
+        if (ret != OH_NN_SUCCESS) {
+            for (State& initialized : m_states) {
+                initialized.buffers[0].reset();
+                initialized.buffers[1].reset();
+            }
+            return ret;
+        }
+    }
+
+    m_isInitialized = true;
+    return OH_NN_SUCCESS;
+}
+
+bool StateTensors::IsInitialized() const
+{
+    return m_isInitialized;
+}
+
+bool StateTensors::IsEmpty() const
+{
+    return m_states.empty();
+}
+
+OH_NN_ReturnCode StateTensors::InitState(State& state, const TensorDescs& inputDescs, const TensorDescs& outputDescs,
+                                         const std::vector<std::vector<uint32_t>>& minInputDims,
+                                         const std::vector<std::vector<uint32_t>>& maxInputDims)
+{
+    const StateBinding& binding = state.binding;
+    if (binding.inputIndex >= inputDescs.size() || binding.outputIndex >= outputDescs.size() ||
+        inputDescs[binding.inputIndex].first == nullptr || outputDescs[binding.outputIndex].first == nullptr) {
+        LOGE("[StateTensors] Init failed, output %{public}u or input %{public}u does not exist.",
+            binding.outputIndex, binding.inputIndex);
+        return OH_NN_INVALID_PARAMETER;
+    }
+    state.inputDesc = *inputDescs[binding.inputIndex].first;
+    state.outputDesc = *outputDescs[binding.outputIndex].first;
+
+    OH_NN_DataType inputType {OH_NN_UNKNOWN};
+    OH_NN_DataType outputType {OH_NN_UNKNOWN};
+    state.inputDesc.GetDataType(&inputType);
+    state.outputDesc.GetDataType(&outputType);
+    state.elementSize = GetTypeSize(inputType);
+    if (inputType != outputType || state.elementSize == 0) {
+        LOGE("[StateTensors] Init failed, output %{public}u and input %{public}u must have the same data type, "
+            "which takes whole bytes.", binding.outputIndex, binding.inputIndex);
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    int32_t* shape = nullptr;
+    size_t shapeNum = 0;
+    state.inputDesc.GetShape(&shape, &shapeNum);
+    state.minDims.assign(shape, shape + shapeNum);
+    state.capacityDims.assign(shape, shape + shapeNum);
+    // Without dim ranges from the device, the shape of the input has to be static.
+    if (binding.inputIndex < minInputDims.size() && binding.inputIndex < maxInputDims.size()) {
+        const std::vector<uint32_t>& minDims = minInputDims[binding.inputIndex];
+        const std::vector<uint32_t>& maxDims = maxInputDims[binding.inputIndex];
+        if (minDims.size() != shapeNum || maxDims.size() != shapeNum) {
+            LOGE("[StateTensors] Init failed, dim ranges of input %{public}u do not match its shape.",
+                binding.inputIndex);
+            return OH_NN_INVALID_PARAMETER;
+        }
+        for (size_t i = 0; i < shapeNum; ++i) {
+            state.minDims[i] = static_cast<int32_t>(minDims[i]);
+            state.capacityDims[i] = static_cast<int32_t>(maxDims[i]);
+        }
+    }
+    for (size_t i = 0; i < shapeNum; ++i) {
+        if (state.minDims[i] < 0 || state.capacityDims[i] <= 0 || state.minDims[i] > state.capacityDims[i]) {
+            LOGE("[StateTensors] Init failed, dim %{public}zu of input %{public}u has no max range.",
+                i, binding.inputIndex);
+            return OH_NN_INVALID_PARAMETER;
+        }
+    }
+
+    state.outputDesc.GetShape(&shape, &shapeNum);
+    if (shapeNum != state.capacityDims.size() ||
+        (binding.appendAxis >= 0 && static_cast<size_t>(binding.appendAxis) >= shapeNum)) {
+        LOGE("[StateTensors] Init failed, output %{public}u does not fit the rank of input %{public}u.",
+            binding.outputIndex, binding.inputIndex);
+        return OH_NN_INVALID_PARAMETER;
+    }
+    // The output buffer takes any output the state can hold, dynamic output dims are as large as the state.
+    std::vector<int32_t> outputDims(shape, shape + shapeNum);
+    for (size_t i = 0; i < shapeNum; ++i) {
+        if (outputDims[i] <= 0 || outputDims[i] > state.capacityDims[i]) {
+            outputDims[i] = state.capacityDims[i];
+        }
+    }
+    state.outputDesc.SetShape(outputDims.data(), outputDims.size());
+
+    OH_NN_ReturnCode ret = CreateBuffer(state.inputDesc, state.capacityDims, state.buffers[0]);
+    if (ret != OH_NN_SUCCESS) {
+        return ret;
+    }
+    // Buffers swap when the output replaces the state, the second one then has to hold the state as well.
+    ret = CreateBuffer(state.outputDesc, (binding.appendAxis < 0) ? state.capacityDims : outputDims,
+        state.buffers[1]);
+    if (ret != OH_NN_SUCCESS) {
+        return ret;
+    }
+
+    ClearState(state);
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode StateTensors::CreateBuffer(const TensorDesc& desc, const std::vector<int32_t>& dims,
+                                            std::unique_ptr<NNTensor2_0>& buffer) const
+{
+    TensorDesc bufferDesc = desc;
+    OH_NN_ReturnCode ret = bufferDesc.SetShape(dims.data(), dims.size());
+    if (ret != OH_NN_SUCCESS) {
+        LOGE("[StateTensors] CreateBuffer failed, error happened when setting the shape of the state.");
+        return ret;
+    }
+
+    buffer.reset(new (std::nothrow) NNTensor2_0(m_backendID));
+    if (buffer == nullptr) {
+        LOGE("[StateTensors] CreateBuffer failed, error happened when creating the state tensor.");
+        return OH_NN_MEMORY_ERROR;
+    }
+    ret = buffer->SetTensorDesc(&bufferDesc);
+    if (ret == OH_NN_SUCCESS) {
+        ret = buffer->CreateData();
+    }
+    if (ret != OH_NN_SUCCESS) {
+        LOGE("[StateTensors] CreateBuffer failed, error happened when allocating the state on backend %{public}zu.",
+            m_backendID);
+        buffer.reset();
+    }
+    return ret;
+}
+
+OH_NN_ReturnCode StateTensors::Bind(std::vector<NN_Tensor*>& inputs, std::vector<NN_Tensor*>& outputs)
+{
+    if (!m_isInitialized) {
+        LOGE("[StateTensors] Bind failed, the states are not allocated.");
+        return OH_NN_FAILED;
+    }
+
+    for (State& state : m_states) {
+        const StateBinding& binding = state.binding;
+        if (inputs[binding.inputIndex] != nullptr || outputs[binding.outputIndex] != nullptr) {
+            LOGE("[StateTensors] Bind failed, output %{public}u and input %{public}u are kept by the executor, "
+                "pass nullptr for them.", binding.outputIndex, binding.inputIndex);
+            return OH_NN_INVALID_PARAMETER;
+        }
+
+        NNTensor2_0* input = state.buffers[state.current].get();
+        NNTensor2_0* output = state.buffers[1 - state.current].get();
+        *input->GetTensorDesc() = state.inputDesc;
+        OH_NN_ReturnCode ret = input->GetTensorDesc()->SetShape(state.dims.data(), state.dims.size());
+        if (ret != OH_NN_SUCCESS) {
+            LOGE("[StateTensors] Bind failed, error happened when setting the shape of input %{public}u.",
+                binding.inputIndex);
+            return ret;
+        }
+        *output->GetTensorDesc() = state.outputDesc;
+
+        inputs[binding.inputIndex] = reinterpret_cast<NN_Tensor*>(input);
+        outputs[binding.outputIndex] = reinterpret_cast<NN_Tensor*>(output);
+    }
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode StateTensors::Commit(const std::vector<std::vector<int32_t>>& outputsDims)
+{
+    // Check every output first, a failed run must leave all states as they were.
+    for (const State& state : m_states) {
+        const StateBinding& binding = state.binding;
+        if (binding.outputIndex >= outputsDims.size() ||
+            outputsDims[binding.outputIndex].size() != state.capacityDims.size()) {
+            LOGE("[StateTensors] Commit failed, output %{public}u has a wrong rank.", binding.outputIndex);
+            return OH_NN_INVALID_PARAMETER;
+        }
+        const std::vector<int32_t>& dims = outputsDims[binding.outputIndex];
+        for (size_t i = 0; i < dims.size(); ++i) {
+            int32_t dim = dims[i];
+            if (binding.appendAxis >= 0 && i == static_cast<size_t>(binding.appendAxis)) {
+                dim += state.dims[i];
+            } else if (binding.appendAxis >= 0 && dims[i] != state.dims[i]) {
+                dim = -1;
+            }
+            if (dim < 0 || dim > state.capacityDims[i]) {
+                LOGE("[StateTensors] Commit failed, output %{public}u does not fit into the state of input "
+                    "%{public}u at dim %{public}zu.", binding.outputIndex, binding.inputIndex, i);
+                return OH_NN_INVALID_PARAMETER;
+            }
+        }
+    }
+
+    for (State& state : m_states) {
+        const StateBinding& binding = state.binding;
+        const std::vector<int32_t>& dims = outputsDims[binding.outputIndex];
+        if (binding.appendAxis < 0) {
+            state.dims = dims;
+            state.current = 1 - state.current;
+            continue;
+        }
+
+        NNTensor2_0* stateBuffer = state.buffers[state.current].get();
+        NNTensor2_0* sliceBuffer = state.buffers[1 - state.current].get();
+        OH_NN_ReturnCode ret = AppendAlongAxis(stateBuffer->GetData(), stateBuffer->GetSize(), state.dims,
+            sliceBuffer->GetData(), dims, static_cast<size_t>(binding.appendAxis), state.elementSize);
+        if (ret != OH_NN_SUCCESS) {
+            LOGE("[StateTensors] Commit failed, error happened when appending output %{public}u.",
+                binding.outputIndex);
+            return ret;
+        }
+    }
+    return OH_NN_SUCCESS;
+}
+
+void StateTensors::Reset()
+{
+    if (!m_isInitialized) {
+        return;
+    }
+    for (State& state : m_states) {
+        ClearState(state);
+    }
+}
+
+void StateTensors::ClearState(State& state) const
+{
+    state.dims = state.minDims;
+    state.current = 0;
+    for (const std::unique_ptr<NNTensor2_0>& buffer : state.buffers) {
+        if (buffer != nullptr && buffer->GetData() != nullptr) {
+            (void)memset_s(buffer->GetData(), buffer->GetSize(), 0, buffer->GetSize());
+        }
+    }
+}
+
+OH_NN_ReturnCode StateTensors::AppendAlongAxis(void* state, size_t stateLength, std::vector<int32_t>& stateDims,
+                                               const void* slice, const std::vector<int32_t>& sliceDims,
+                                               size_t axis, size_t elementSize)
+{
+    if (state == nullptr || slice == nullptr || axis >= stateDims.size() || sliceDims.size() != stateDims.size()) {
+        LOGE("[StateTensors] AppendAlongAxis failed, invalid state or slice.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+    for (size_t i = 0; i < stateDims.size(); ++i) {
+        if (stateDims[i] < 0 || sliceDims[i] < 0 || (i != axis && stateDims[i] != sliceDims[i])) {
+            LOGE("[StateTensors] AppendAlongAxis failed, dim %{public}zu of the slice does not match the state.", i);
+            return OH_NN_INVALID_PARAMETER;
+        }
+    }
+
+    // The state is outerCount rows, each of which grows from stateRow to stateRow + sliceRow bytes.
+    uint64_t outerCount = GetDimsProduct(stateDims, 0, axis);
+    uint64_t innerBytes = GetDimsProduct(stateDims, axis + 1, stateDims.size()) * elementSize;
+    uint64_t stateRow = static_cast<uint64_t>(stateDims[axis]) * innerBytes;
+    uint64_t sliceRow = static_cast<uint64_t>(sliceDims[axis]) * innerBytes;
+    uint64_t newRow = stateRow + sliceRow;
+    if (outerCount * newRow > stateLength) {
+        LOGE("[StateTensors] AppendAlongAxis failed, the state buffer of %{public}zu bytes is too small.",
+            stateLength);
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    // Rows move towards the end of the buffer, so the last row is moved first. When every dim before the axis is
+    // 1, nothing moves and only the slice is copied.
+    auto* stateBytes = static_cast<char*>(state);
+    const auto* sliceBytes = static_cast<const char*>(slice);
+    for (uint64_t row = outerCount; row > 0; --row) {
+        uint64_t index = row - 1;
+        char* dst = stateBytes + index * newRow;
+        if (index != 0 && stateRow != 0 &&
+            memmove_s(dst, stateLength - index * newRow, stateBytes + index * stateRow, stateRow) != EOK) {
+            LOGE("[StateTensors] AppendAlongAxis failed, error happened when moving the state.");
+            return OH_NN_MEMORY_ERROR;
+        }
+        if (sliceRow != 0 && memcpy_s(dst + stateRow, stateLength - index * newRow - stateRow,
+            sliceBytes + index * sliceRow, sliceRow) != EOK) {
+            LOGE("[StateTensors] AppendAlongAxis failed, error happened when copying the slice.");
+            return OH_NN_MEMORY_ERROR;
+        }
+    }
+
+    stateDims[axis] += sliceDims[axis];
+    return OH_NN_SUCCESS;
+}
+}  // namespace NeuralNetworkRuntime
+}  // namespace OHOS
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NEURAL_NETWORK_RUNTIME_STATE_TENSORS_H
+#define NEURAL_NETWORK_RUNTIME_STATE_TENSORS_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "cpp_type.h"
+#include "nntensor.h"
+#include "tensor_desc.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+/**
+ * Keeps the state of a stateful model, such as the KV cache of a decoder, resident on the backend between runs.
+ *
+ * Every StateBinding ties a model output to a model input. The executor passes the state tensor in place of the
+ * bound input, and the bound output of the run becomes the state of the next run. An output replacing the whole
+ * state is written into a second buffer, and the two buffers swap after each run. An output appended along an axis
+ * is written into a scratch buffer and copied to the end of the state, whose buffer is sized by the max dim range
+ * of the input so that it never has to be reallocated.
+ *
+ * StateTensors is not thread safe, NNExecutor only uses it while holding its own mutex.
+ */
+class StateTensors {
+public:
+    using TensorDescs = std::vector<std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType>>;
+
+    StateTensors(size_t backendID, const std::vector<StateBinding>& bindings);
+    ~StateTensors() = default;
+
+    // Parses bindings written as "output:input[:axis]" and separated by ';', such as "0:1;1:2:2".
+    static OH_NN_ReturnCode ParseBindings(const std::string& value, std::vector<StateBinding>& bindings);
+
+    // Allocates the state buffers. Every state starts zero filled with the min dims of its input.
+    OH_NN_ReturnCode Init(const TensorDescs& inputDescs, const TensorDescs& outputDescs,
+                          const std::vector<std::vector<uint32_t>>& minInputDims,
+                          const std::vector<std::vector<uint32_t>>& maxInputDims);
+    bool IsInitialized() const;
+    // True if the model has no state, the executor then runs without StateTensors.
+    bool IsEmpty() const;
+
+    // Puts the state tensors into the bound slots, which the caller has to leave nullptr.
+    OH_NN_ReturnCode Bind(std::vector<NN_Tensor*>& inputs, std::vector<NN_Tensor*>& outputs);
+    // Makes the bound outputs of a successful run the state of the next run.
+    OH_NN_ReturnCode Commit(const std::vector<std::vector<int32_t>>& outputsDims);
+    // Drops the states, so that the next run starts a new sequence.
+    void Reset();
+
+    // Appends slice to the dense tensor state along axis in place, the buffer of state must hold the result.
+    static OH_NN_ReturnCode AppendAlongAxis(void* state, size_t stateLength, std::vector<int32_t>& stateDims,
+                                            const void* slice, const std::vector<int32_t>& sliceDims,
+                                            size_t axis, size_t elementSize);
+
+private:
+    struct State {
+        StateBinding binding;
+        TensorDesc inputDesc;
+        TensorDesc outputDesc;
+        std::vector<int32_t> minDims;
+        std::vector<int32_t> capacityDims;
+        std::vector<int32_t> dims;
+        size_t elementSize {0};
+        // The state is held by buffers[current]. The other buffer takes the output of the next run, it is a scratch
+        // buffer holding only the appended slice when the output is appended.
+        std::unique_ptr<NNTensor2_0> buffers[2];
+        size_t current {0};
+    };
+
+    OH_NN_ReturnCode InitState(State& state, const TensorDescs& inputDescs, const TensorDescs& outputDescs,
+                               const std::vector<std::vector<uint32_t>>& minInputDims,
+                               const std::vector<std::vector<uint32_t>>& maxInputDims);
+    OH_NN_ReturnCode CreateBuffer(const TensorDesc& desc, const std::vector<int32_t>& dims,
+                                  std::unique_ptr<NNTensor2_0>& buffer) const;
+    void ClearState(State& state) const;
+
+private:
+    size_t m_backendID {0};
+    std::vector<State> m_states;
+    bool m_isInitialized {false};
+};
+}  // namespace NeuralNetworkRuntime
+}  // namespace OHOS
+#endif  // NEURAL_NETWORK_RUNTIME_STATE_TENSORS_H
@@ -23,6 +23,7 @@ const uint32_t BIT8_TO_BYTE = 1;
 const uint32_t BIT16_TO_BYTE = 2;
 const uint32_t BIT32_TO_BYTE = 4;
 const uint32_t BIT64_TO_BYTE = 8;
+const uint64_t INT4_PER_BYTE = 2;
 
 uint32_t GetTypeSize(OH_NN_DataType type)
 {
@@ -35,6 +36,7 @@ uint32_t GetTypeSize(OH_NN_DataType type)
         case OH_NN_INT16:
         case OH_NN_UINT16:
         case OH_NN_FLOAT16:
+        case OH_NN_BFLOAT16:
             return BIT16_TO_BYTE;
         case OH_NN_INT32:
         case OH_NN_UINT32:
@@ -49,6 +51,14 @@ uint32_t GetTypeSize(OH_NN_DataType type)
     }
 }
 
+uint64_t GetDataByteSize(OH_NN_DataType type, uint64_t elementCount)
+{
+    if (type == OH_NN_INT4) {
+        return (elementCount + INT4_PER_BYTE - 1) / INT4_PER_BYTE;
+    }
+    return elementCount * GetTypeSize(type);
+}
+
 mindspore::lite::DataType NNToMS::TransformDataType(OH_NN_DataType type)
 {
     switch (type) {
@@ -76,6 +86,10 @@ mindspore::lite::DataType NNToMS::TransformDataType(OH_NN_DataType type)
             return mindspore::lite::DATA_TYPE_FLOAT32;
         case OH_NN_FLOAT64:
             return mindspore::lite::DATA_TYPE_FLOAT64;
+        case OH_NN_BFLOAT16:
+            return MS_DATA_TYPE_BFLOAT16;
+        case OH_NN_INT4:
+            return MS_DATA_TYPE_INT4;
         default:
             return mindspore::lite::DATA_TYPE_UNKNOWN;
     }
@@ -128,6 +142,14 @@ mindspore::lite::PadMode NNToMS::TransformPadModeValue(int8_t padMode)
 
 OH_NN_DataType MSToNN::TransformDataType(mindspore::lite::DataType type)
 {
+    // Not members of mindspore::lite::DataType, checked ahead of the switch to keep it exhaustive over the enum.
+    if (type == MS_DATA_TYPE_BFLOAT16) {
+        return OH_NN_BFLOAT16;
+    }
+    if (type == MS_DATA_TYPE_INT4) {
+        return OH_NN_INT4;
+    }
+
     switch (type) {
         case mindspore::lite::DATA_TYPE_BOOL:
             return OH_NN_BOOL;
@@ -34,8 +34,15 @@ std::vector<T> ConstructVectorFromArray(const T* data, size_t size)
     return array;
 }
 
+// Bytes taken by one element, 0 for unknown types and for sub-byte types such as OH_NN_INT4.
 uint32_t GetTypeSize(OH_NN_DataType type);
+// Bytes taken by elementCount elements, sub-byte elements are packed without padding.
+uint64_t GetDataByteSize(OH_NN_DataType type, uint64_t elementCount);
 
+// mindspore::lite::DataType takes the TypeId numbering of MindSpore, but has no member for these types yet.
+// The HDI data types follow the same numbering.
+constexpr mindspore::lite::DataType MS_DATA_TYPE_BFLOAT16 = static_cast<mindspore::lite::DataType>(45);
+constexpr mindspore::lite::DataType MS_DATA_TYPE_INT4 = static_cast<mindspore::lite::DataType>(50);
 
 namespace NNToMS {
 mindspore::lite::DataType TransformDataType(OH_NN_DataType type);
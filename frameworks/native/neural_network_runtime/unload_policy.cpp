@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "unload_policy.h"
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "log.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace {
+constexpr int64_t AUTOUNLOAD_TIME = 10 * 60 * 1000;
+constexpr int64_t MODERATE_AUTOUNLOAD_TIME = AUTOUNLOAD_TIME / 4;
+constexpr int64_t CRITICAL_AUTOUNLOAD_TIME = 30 * 1000;
+constexpr uint64_t MODERATE_AVAILABLE_PERCENT = 25;
+constexpr uint64_t CRITICAL_AVAILABLE_PERCENT = 10;
+constexpr uint64_t PERCENT = 100;
+constexpr int64_t MEMINFO_REFRESH_TIME = 1000;
+// Halve the histogram every so many gaps, so that it follows a change of the usage pattern.
+constexpr uint32_t GAP_DECAY_COUNT = 64;
+constexpr uint32_t MIN_PREDICT_GAPS = 3;
+// Reloading from cache takes up to a few hundred milliseconds, start it this much ahead of the expected run.
+constexpr int64_t WARM_RELOAD_LEAD_TIME = 1000;
+const std::string MEMINFO_PATH = "/proc/meminfo";
+
+bool ReadMemInfo(uint64_t& availableKb, uint64_t& totalKb)
+{
+    std::ifstream memInfo(MEMINFO_PATH);
+    if (!memInfo.is_open()) {
+        return false;
+    }
+
+    bool hasAvailable = false;
+    bool hasTotal = false;
+    std::string line;
+    while ((!hasAvailable || !hasTotal) && std::getline(memInfo, line)) {
+        std::istringstream fields(line);
+        std::string key;
+        uint64_t value = 0;
+        if (!(fields >> key >> value)) {
+            continue;
+        }
+        if (key == "MemTotal:") {
+            totalKb = value;
+            hasTotal = true;
+        } else if (key == "MemAvailable:") {
+            availableKb = value;
+            hasAvailable = true;
+        }
+    }
+    return hasAvailable && hasTotal;
+}
+} // namespace
+
+void UnloadPolicy::RecordArrival(Clock::time_point now)
+{
+    if (m_hasArrival) {
+        int64_t gapMs = std::chrono::duration_cast<std::chrono::milliseconds>(now - m_lastArrival).count();
+        if (m_gapCount >= GAP_DECAY_COUNT) {
+            m_gapCount = 0;
+            for (auto& bucket : m_gapBuckets) {
+                bucket /= 2;
+                m_gapCount += bucket;
+            }
+        }
+        ++m_gapBuckets[GetBucketIndex(gapMs)];
+        ++m_gapCount;
+    }
+
+    m_lastArrival = now;
+    m_hasArrival = true;
+}
+
+int64_t UnloadPolicy::GetUnloadDelay() const
+{
+    return GetUnloadDelay(GetMemoryPressure());
+}
+
+bool UnloadPolicy::ShouldUnload(Clock::time_point now) const
+{
+    return ShouldUnload(now, GetMemoryPressure());
+}
+
+int64_t UnloadPolicy::GetWarmReloadDelay(Clock::time_point now) const
+{
+    return GetWarmReloadDelay(now, GetMemoryPressure());
+}
+
+bool UnloadPolicy::ShouldUnload(Clock::time_point now, MemoryPressure pressure) const
+{
+    if (pressure == MemoryPressure::CRITICAL) {
+        return true;
+    }
+
+    int64_t unloadDelay = GetUnloadDelay(pressure);
+    int64_t expectedGap = PredictIdleGap(now, unloadDelay);
+    return expectedGap < 0 || expectedGap - WARM_RELOAD_LEAD_TIME > unloadDelay;
+}
+
+int64_t UnloadPolicy::GetWarmReloadDelay(Clock::time_point now, MemoryPressure pressure) const
+{
+    if (!m_hasArrival || pressure == MemoryPressure::CRITICAL) {
+        return -1;
+    }
+
+    int64_t unloadDelay = GetUnloadDelay(pressure);
+    int64_t expectedGap = PredictIdleGap(now, unloadDelay);
+    if (expectedGap < 0 || expectedGap - WARM_RELOAD_LEAD_TIME <= unloadDelay) {
+        // ShouldUnload() keeps such a model loaded, there is nothing to reload.
+        return -1;
+    }
+
+    int64_t idleMs = std::chrono::duration_cast<std::chrono::milliseconds>(now - m_lastArrival).count();
+    return std::max(expectedGap - WARM_RELOAD_LEAD_TIME - idleMs, static_cast<int64_t>(0));
+}
+
+int64_t UnloadPolicy::PredictIdleGap(Clock::time_point now, int64_t unloadDelay) const
+{
+    if (!m_hasArrival) {
+        return -1;
+    }
+
+    // Gaps shorter than the unload delay never find the model unloaded, only the longer ones need a reload.
+    uint32_t idleGapCount = 0;
+    size_t likelyBucket = GAP_BUCKET_NUM;
+    for (size_t i = GetBucketIndex(unloadDelay); i < GAP_BUCKET_NUM; ++i) {
+        idleGapCount += m_gapBuckets[i];
+        if (likelyBucket == GAP_BUCKET_NUM || m_gapBuckets[i] > m_gapBuckets[likelyBucket]) {
+            likelyBucket = i;
+        }
+    }
+    if (likelyBucket == GAP_BUCKET_NUM || m_gapBuckets[likelyBucket] < MIN_PREDICT_GAPS ||
+        m_gapBuckets[likelyBucket] * 2 < idleGapCount) {
+        return -1;
+    }
+
+    int64_t idleMs = std::chrono::duration_cast<std::chrono::milliseconds>(now - m_lastArrival).count();
+    int64_t bucketEnd = static_cast<int64_t>(1) << (likelyBucket + 1);
+    if (idleMs >= bucketEnd) {
+        // The expected run did not come, do not rely on a pattern that has just been broken.
+        return -1;
+    }
+    return static_cast<int64_t>(1) << likelyBucket;
+}
+
+int64_t UnloadPolicy::GetUnloadDelay(MemoryPressure pressure)
+{
+    switch (pressure) {
+        case MemoryPressure::CRITICAL:
+            return CRITICAL_AUTOUNLOAD_TIME;
+        case MemoryPressure::MODERATE:
+            return MODERATE_AUTOUNLOAD_TIME;
+        default:
+            return AUTOUNLOAD_TIME;
+    }
+}
+
+MemoryPressure UnloadPolicy::GetPressureLevel(uint64_t availableKb, uint64_t totalKb)
+{
+    if (totalKb == 0) {
+        return MemoryPressure::NORMAL;
+    }
+
+    uint64_t availablePercent = availableKb * PERCENT / totalKb;
+    if (availablePercent < CRITICAL_AVAILABLE_PERCENT) {
+        return MemoryPressure::CRITICAL;
+    }
+    if (availablePercent < MODERATE_AVAILABLE_PERCENT) {
+        return MemoryPressure::MODERATE;
+    }
+    return MemoryPressure::NORMAL;
+}
+
+MemoryPressure UnloadPolicy::GetMemoryPressure()
+{
+    static std::atomic<int64_t> lastReadTime {INT64_MIN};
+    static std::atomic<MemoryPressure> pressure {MemoryPressure::NORMAL};
+
+    int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now().time_since_epoch()).count();
+    int64_t lastRead = lastReadTime.load(std::memory_order_relaxed);
+    if (lastRead != INT64_MIN && now - lastRead < MEMINFO_REFRESH_TIME) {
+        return pressure.load(std::memory_order_relaxed);
+    }
+    // Only the thread winning the exchange reads the file, the others use the level it last published.
+    if (!lastReadTime.compare_exchange_strong(lastRead, now, std::memory_order_relaxed)) {
+        return pressure.load(std::memory_order_relaxed);
+    }
+
+    uint64_t availableKb = 0;
+    uint64_t totalKb = 0;
+    if (!ReadMemInfo(availableKb, totalKb)) {
+        LOGW("[UnloadPolicy] Fail to read %{public}s, assume there is no memory pressure.", MEMINFO_PATH.c_str());
+        pressure.store(MemoryPressure::NORMAL, std::memory_order_relaxed);
+        return MemoryPressure::NORMAL;
+    }
+
+    MemoryPressure level = GetPressureLevel(availableKb, totalKb);
+    pressure.store(level, std::memory_order_relaxed);
+    return level;
+}
+
+size_t UnloadPolicy::GetBucketIndex(int64_t gapMs)
+{
+    size_t index = 0;
+    while (gapMs > 1 && index < GAP_BUCKET_NUM - 1) {
+        gapMs >>= 1;
+        ++index;
+    }
+    return index;
+}
+}  // namespace NeuralNetworkRuntime
+}  // namespace OHOS
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NEURAL_NETWORK_RUNTIME_UNLOAD_POLICY_H
+#define NEURAL_NETWORK_RUNTIME_UNLOAD_POLICY_H
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+enum class MemoryPressure {
+    NORMAL,
+    MODERATE,
+    CRITICAL
+};
+
+/**
+ * Decides when the model of an idle executor is unloaded and when it is worth reloading it ahead of the next run.
+ *
+ * The gaps between consecutive runs are kept in a histogram with power-of-two millisecond buckets. Once the gaps
+ * long enough to outlast the unload delay mostly fall into one bucket, the next run is predicted to come after the
+ * shortest gap of that bucket, and the model is reloaded just before. If that gap is not clearly longer than the
+ * unload delay, the model would be reloaded right after being unloaded, so it is kept loaded instead. The unload
+ * delay shrinks as the free memory
+ * of the system gets scarce, and no model is reloaded ahead of time under critical pressure.
+ *
+ * UnloadPolicy is not thread safe, NNExecutor only uses it while holding its own mutex.
+ */
+class UnloadPolicy {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    UnloadPolicy() = default;
+    ~UnloadPolicy() = default;
+
+    void RecordArrival(Clock::time_point now);
+
+    // Delay in milliseconds before the model of an idle executor is unloaded.
+    int64_t GetUnloadDelay() const;
+    // False while the next run is expected about when the model would be unloaded, so that it is kept loaded.
+    bool ShouldUnload(Clock::time_point now) const;
+    bool ShouldUnload(Clock::time_point now, MemoryPressure pressure) const;
+    // Delay in milliseconds from now until the model should be reloaded, -1 if no run is expected.
+    int64_t GetWarmReloadDelay(Clock::time_point now) const;
+    int64_t GetWarmReloadDelay(Clock::time_point now, MemoryPressure pressure) const;
+
+    static int64_t GetUnloadDelay(MemoryPressure pressure);
+    static MemoryPressure GetPressureLevel(uint64_t availableKb, uint64_t totalKb);
+    // Memory pressure of the system read from /proc/meminfo, refreshed at most once per second.
+    static MemoryPressure GetMemoryPressure();
+
+    static constexpr size_t GAP_BUCKET_NUM = 32;
+    static size_t GetBucketIndex(int64_t gapMs);
+
+private:
+    // Shortest gap of the bucket most idle gaps fall into, -1 if the gaps do not predict the next run.
+    int64_t PredictIdleGap(Clock::time_point now, int64_t unloadDelay) const;
+
+private:
+    std::array<uint32_t, GAP_BUCKET_NUM> m_gapBuckets {};
+    uint32_t m_gapCount {0};
+    bool m_hasArrival {false};
+    Clock::time_point m_lastArrival;
+};
+}  // namespace NeuralNetworkRuntime
+}  // namespace OHOS
+#endif  // NEURAL_NETWORK_RUNTIME_UNLOAD_POLICY_H
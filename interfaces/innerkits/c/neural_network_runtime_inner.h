@@ -48,6 +48,176 @@ typedef struct OH_NN_Extension {
     size_t valueSize;
 } OH_NN_Extension;
 
+/**
+ * @brief 定义异步编译完成时的回调函数类型。
+ *
+ * @param userData 调用{@link OH_NNCompilation_BuildAsync}时传入的userData。
+ * @param errCode 编译的结果状态，与{@link OH_NNCompilation_Build}的返回值相同。
+ * @param compilation 完成编译的{@link OH_NNCompilation}实例。
+ * @since 12
+ * @version 1.0
+ */
+typedef void (*NN_OnBuildDone)(void *userData, OH_NN_ReturnCode errCode, OH_NNCompilation *compilation);
+
+/**
+ * @brief 时延直方图的桶数量。
+ *
+ * 第0个桶统计小于1us的样本，第i个桶(0 < i < 31)统计[2^(i-1), 2^i)us内的样本，最后一个桶统计其余样本。
+ *
+ * @since 12
+ * @version 1.0
+ */
+#define OH_NN_LATENCY_BUCKET_NUM 32
+
+/**
+ * @brief 定义时延统计的阶段。
+ *
+ * @since 12
+ * @version 1.0
+ */
+typedef enum {
+    /** 模型编译，包括从cache恢复的耗时 */
+    OH_NN_STAGE_BUILD = 0,
+    /** 从cache文件恢复模型，包括编译阶段和执行器自动重载 */
+    OH_NN_STAGE_CACHE_RESTORE = 1,
+    /** Tensor共享内存申请 */
+    OH_NN_STAGE_TENSOR_ALLOC = 2,
+    /** 将输入输出Tensor转换为HDI IOTensor */
+    OH_NN_STAGE_IO_TRANSLATION = 3,
+    /** HDI推理调用(IPC) */
+    OH_NN_STAGE_HDI_RUN = 4,
+    /** 推理后更新输出Tensor的维度信息 */
+    OH_NN_STAGE_OUTPUT_SHAPE_UPDATE = 5,
+    /** 阶段数量，不作为有效阶段 */
+    OH_NN_STAGE_NUM = 6,
+} OH_NN_LatencyStage;
+
+/**
+ * @brief 定义单个阶段的时延直方图。时间单位为纳秒，基于单调时钟统计。
+ *
+ * @since 12
+ * @version 1.0
+ */
+typedef struct OH_NN_LatencyHistogram {
+    uint64_t count;
+    uint64_t totalNs;
+    uint64_t minNs;
+    uint64_t maxNs;
+    uint64_t buckets[OH_NN_LATENCY_BUCKET_NUM];
+} OH_NN_LatencyHistogram;
+
+/**
+ * @brief 定义执行器因输出内存不足而扩容的统计信息。
+ *
+ * @since 12
+ * @version 1.0
+ */
+typedef struct OH_NN_OutputGrowthStats {
+    /** 输出内存不足，扩容后重新推理的次数 */
+    uint64_t rerunCount;
+    /** 扩容的输出张量数量 */
+    uint64_t grownTensorCount;
+    /** 扩容增加的内存字节数 */
+    uint64_t grownBytes;
+    /** 达到重新推理次数上限后仍因输出内存不足而失败的推理次数 */
+    uint64_t failedRunCount;
+} OH_NN_OutputGrowthStats;
+
+/**
+ * @brief 将量化参数设置为按组量化。
+ *
+ * 调用本接口后，量化参数以紧凑的连续数组保存，不再按组展开为单独的结构体。groupSize为0时，沿axis维度的每个下标为一组，
+ * 即逐通道量化；groupSize不为0时，axis维度上每groupSize个连续元素为一组，量化参数的排布为将Tensor的axis维度除以groupSize
+ * (向上取整)后的形状，按行优先顺序存放，与ONNX DequantizeLinear的分块量化一致。\n
+ *
+ * 按组量化时，{@link OH_NNQuantParam_SetScales}或{@link OH_NNQuantParam_SetHalfScales}设置的缩放系数个数须等于组数，
+ * {@link OH_NNQuantParam_SetZeroPoints}可不设置(即零点均为0)，{@link OH_NNQuantParam_SetNumBits}对所有组只能设置同一个值。\n
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param quantParams 指向{@link NN_QuantParam}实例的指针。
+ * @param axis 分组所沿的维度，支持负数表示从最后一维倒数。
+ * @param groupSize 每组的元素个数，为0时表示逐通道量化。
+ * @return 函数执行的结果状态，执行成功返回OH_NN_SUCCESS，失败返回具体错误码，参考{@link OH_NN_ReturnCode}。
+ * @since 12
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NNQuantParam_SetGroup(NN_QuantParam *quantParams, int32_t axis, uint32_t groupSize);
+
+/**
+ * @brief 以半精度浮点数(IEEE 754 binary16)设置按组量化的缩放系数。
+ *
+ * 与{@link OH_NNQuantParam_SetScales}二选一，每组仅占2字节，仅在调用{@link OH_NNQuantParam_SetGroup}后生效。\n
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param quantParams 指向{@link NN_QuantParam}实例的指针。
+ * @param scales 半精度缩放系数数组，按组的顺序存放。
+ * @param quantCount 缩放系数的个数，即组数。
+ * @return 函数执行的结果状态，执行成功返回OH_NN_SUCCESS，失败返回具体错误码，参考{@link OH_NN_ReturnCode}。
+ * @since 12
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NNQuantParam_SetHalfScales(NN_QuantParam *quantParams, const uint16_t *scales, size_t quantCount);
+
+/**
+ * @brief 定义图像的像素格式。每个分量均为8bit。
+ *
+ * @since 12
+ * @version 1.0
+ */
+typedef enum {
+    /** 按R、G、B顺序交织存放 */
+    OH_NN_PIXEL_FORMAT_RGB888 = 0,
+    /** 按B、G、R顺序交织存放 */
+    OH_NN_PIXEL_FORMAT_BGR888 = 1,
+    /** 按R、G、B、A顺序交织存放，A分量不参与预处理 */
+    OH_NN_PIXEL_FORMAT_RGBA8888 = 2,
+    /** 按B、G、R、A顺序交织存放，A分量不参与预处理 */
+    OH_NN_PIXEL_FORMAT_BGRA8888 = 3,
+    /** 单通道灰度图 */
+    OH_NN_PIXEL_FORMAT_GRAY8 = 4,
+} OH_NN_PixelFormat;
+
+/**
+ * @brief 定义主机侧图像预处理参数，参数含义与AIPP一致。
+ *
+ * 预处理依次完成抠图、双线性缩放到输入Tensor的宽高、通道重排、归一化和量化，并按输入Tensor的格式(NHWC或NCHW)
+ * 写入Tensor数据。每个输出通道的值为(pixel - mean[c]) * scale[c]；输入Tensor为OH_NN_INT8或OH_NN_UINT8时，
+ * 再按round(value / quantScale) + quantZeroPoint量化并截断到数据类型的取值范围。\n
+ *
+ * @since 12
+ * @version 1.0
+ */
+typedef struct OH_NN_PreprocessConfig {
+    /** 源图像的像素格式 */
+    OH_NN_PixelFormat srcFormat;
+    /** 源图像的宽，单位为像素 */
+    uint32_t srcWidth;
+    /** 源图像的高，单位为像素 */
+    uint32_t srcHeight;
+    /** 源图像每行的字节数，为0时表示各行紧密排列 */
+    uint32_t srcStride;
+    /** 抠图区域左上角的横坐标 */
+    uint32_t cropX;
+    /** 抠图区域左上角的纵坐标 */
+    uint32_t cropY;
+    /** 抠图区域的宽，为0时表示到源图像右边界 */
+    uint32_t cropWidth;
+    /** 抠图区域的高，为0时表示到源图像下边界 */
+    uint32_t cropHeight;
+    /** 写入Tensor的通道顺序，仅支持OH_NN_PIXEL_FORMAT_RGB888、OH_NN_PIXEL_FORMAT_BGR888和OH_NN_PIXEL_FORMAT_GRAY8 */
+    OH_NN_PixelFormat dstFormat;
+    /** 各输出通道的均值 */
+    float mean[3];
+    /** 各输出通道的缩放系数，即方差的倒数 */
+    float scale[3];
+    /** 量化步长，仅输入Tensor为整型时生效，不能为0 */
+    float quantScale;
+    /** 量化零点，仅输入Tensor为整型时生效 */
+    int32_t quantZeroPoint;
+} OH_NN_PreprocessConfig;
+
 /**
  * @brief 直接加载LiteGraph，完成模型搭建。
  *
@@ -141,6 +311,118 @@ OH_NN_ReturnCode OH_NNModel_BuildFromMetaGraph(OH_NNModel *model, const void *me
  */
 bool OH_NNModel_HasCache(const char *cacheDir, const char *modelName, uint32_t version);
 
+/**
+ * @brief 异步编译模型。
+ *
+ * 编译在运行时的编译线程池中执行，本接口立即返回。不同设备上的编译并发执行，同一设备同时执行的编译数量受设备限制，
+ * 可执行的编译中，通过{@link OH_NNCompilation_SetPriority}设置的优先级高者先执行，优先级相同时按提交顺序执行。
+ * 编译结束后在编译线程中调用onBuildDone，回调前不能销毁或再次编译该compilation。进程退出时尚未结束的编译将被放弃，
+ * 不再调用onBuildDone。\n
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param compilation 指向{@link OH_NNCompilation}实例的指针。
+ * @param onBuildDone 编译结束时的回调函数。
+ * @param userData 传给onBuildDone的用户数据。
+ * @return 函数执行的结果状态，编译提交成功返回OH_NN_SUCCESS，编译结果通过onBuildDone返回。
+ * @since 12
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NNCompilation_BuildAsync(OH_NNCompilation *compilation, NN_OnBuildDone onBuildDone,
+                                             void *userData);
+
+/**
+ * @brief 为编译完成的compilation创建执行器池。
+ *
+ * 执行器池预先创建minCount个执行器，池中的执行器共享compilation编译得到的模型，可供多个线程并发借用，
+ * 无需每个线程各自调用{@link OH_NNExecutor_Construct}。借用的执行器不足时按需创建，总数不超过maxCount。
+ * 执行器池随compilation一起销毁，销毁compilation前需归还所有借用的执行器，仍有执行器未归还时
+ * {@link OH_NNCompilation_Destroy}不销毁compilation并打印错误日志。
+ * 本接口需在借用执行器前调用，一个compilation只能创建一个执行器池。\n
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param compilation 指向{@link OH_NNCompilation}实例的指针。
+ * @param minCount 预先创建的执行器数量。
+ * @param maxCount 执行器数量的上限，不能为0或小于minCount。
+ * @return 函数执行的结果状态，执行成功返回OH_NN_SUCCESS，失败返回具体错误码，参考{@link OH_NN_ReturnCode}。
+ * @since 12
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NNCompilation_CreateExecutorPool(OH_NNCompilation *compilation, size_t minCount,
+                                                     size_t maxCount);
+
+/**
+ * @brief 从compilation的执行器池中借用一个执行器。
+ *
+ * 有空闲执行器时立即返回；执行器全部被借出时，总数未达到上限则创建新的执行器，否则等待其他线程归还。
+ * 借用的执行器由一个线程独占使用，用完后通过{@link OH_NNCompilation_ReleaseExecutor}归还，不能调用
+ * {@link OH_NNExecutor_Destroy}销毁。\n
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param compilation 指向{@link OH_NNCompilation}实例的指针。
+ * @param timeoutMs 等待归还的最长时间，单位为毫秒，为0时一直等待到有执行器可用。
+ * @param executor 传出借用的执行器。
+ * @return 函数执行的结果状态，执行成功返回OH_NN_SUCCESS，超时返回OH_NN_TIMEOUT，失败返回具体错误码，
+ *         参考{@link OH_NN_ReturnCode}。
+ * @since 12
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NNCompilation_AcquireExecutor(OH_NNCompilation *compilation, uint32_t timeoutMs,
+                                                  OH_NNExecutor **executor);
+
+/**
+ * @brief 将借用的执行器归还到compilation的执行器池。
+ *
+ * 归还时清空借用者留在执行器上的状态：状态张量、通过旧版SetInput/SetOutput系列接口设置的输入输出、
+ * 通过{@link OH_NNExecutor_RegisterBuffer}注册的内存、输出大小提示、输出形状和输出扩容统计，
+ * 下一个借用者得到的执行器与新创建的相同。通过CreateInputMemory/CreateOutputMemory创建的内存仍需借用者自行销毁。
+ * 清空失败的执行器被销毁，不再放回池中。\n
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param compilation 指向{@link OH_NNCompilation}实例的指针。
+ * @param executor 通过{@link OH_NNCompilation_AcquireExecutor}借用的执行器。
+ * @return 函数执行的结果状态，执行成功返回OH_NN_SUCCESS，失败返回具体错误码，参考{@link OH_NN_ReturnCode}。
+ * @since 12
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NNCompilation_ReleaseExecutor(OH_NNCompilation *compilation, OH_NNExecutor *executor);
+
+/**
+ * @brief 等待后台的模型cache写入完成。
+ *
+ * 编译时模型cache在后台写入，进程退出时尚未完成的写入将被丢弃。进程退出或需要立即使用cache文件前需调用本接口
+ * 确保cache已写入磁盘。\n
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param timeoutMs 等待的最长时间，单位为毫秒，为0时一直等待到写入完成。
+ * @return 函数执行的结果状态，写入全部完成返回OH_NN_SUCCESS，超时返回OH_NN_TIMEOUT。
+ * @since 12
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NN_FlushCacheWrites(uint32_t timeoutMs);
+
+/**
+ * @brief 设置模型cache目录占用空间的上限。
+ *
+ * 运行时记录目录中每个模型cache最近一次保存或加载的时间，保存cache后目录超出上限时，按最久未使用的顺序删除整个模型cache，
+ * 直到目录不超出上限，刚保存的cache不会被删除。上限记录在cache目录中，对之后的进程同样生效。
+
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。
+
+ *
+ * @param cacheDir 模型cache目录。
+ * @param sizeLimit 目录中模型cache占用的最大字节数，为0时不限制。
+ * @return 函数执行的结果状态，执行成功返回OH_NN_SUCCESS，cacheDir不存在返回OH_NN_INVALID_PARAMETER。
+ * @since 12
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NN_SetCacheSizeLimit(const char *cacheDir, uint64_t sizeLimit);
+
 /**
  * @brief 获取NNRt device信息。
  *
@@ -190,6 +472,208 @@ OH_NN_ReturnCode OH_NNExecutor_RunSyncWithAipp(OH_NNExecutor *executor,
                                                size_t outputCount,
                                                const char* aippString);
 
+/**
+ * @brief 注册AIPP配置，获取代表该配置的句柄。
+ *
+ * 同一进程内，句柄始终对应同一份配置，注册相同的配置返回相同的句柄并增加其引用计数。
+ * 通过{@link OH_NNExecutor_RunSyncWithAippHandle}使用句柄推理时，若模型上一次使用的就是该句柄，则不再向设备下发配置。\n
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param aippString AIPP配置字符串。
+ * @param aippHandle 传出的AIPP配置句柄，不为0。
+ * @return 函数执行的结果状态，执行成功返回OH_NN_SUCCESS，失败返回具体错误码，参考{@link OH_NN_ReturnCode}。
+ * @since 12
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NN_RegisterAippConfig(const char *aippString, uint32_t *aippHandle);
+
+/**
+ * @brief 注销AIPP配置句柄。
+ *
+ * 注销次数与注册次数相同时释放该句柄，之后不能再使用该句柄推理。\n
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param aippHandle {@link OH_NN_RegisterAippConfig}返回的AIPP配置句柄。
+ * @return 函数执行的结果状态，执行成功返回OH_NN_SUCCESS，失败返回具体错误码，参考{@link OH_NN_ReturnCode}。
+ * @since 12
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NN_UnregisterAippConfig(uint32_t aippHandle);
+
+/**
+ * @brief 使用已注册的AIPP配置同步执行推理。
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param executor 指向{@link OH_NNExecutor}实例的指针。
+ * @param inputTensor 输入张量{@link NN_Tensor}数组。
+ * @param inputCount 输入张量的个数。
+ * @param outputTensor 输出张量{@link NN_Tensor}数组。
+ * @param outputCount 输出张量的个数。
+ * @param aippHandle {@link OH_NN_RegisterAippConfig}返回的AIPP配置句柄。
+ * @return 函数执行的结果状态，执行成功返回OH_NN_SUCCESS，失败返回具体错误码，参考{@link OH_NN_ReturnCode}。
+ * @since 12
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NNExecutor_RunSyncWithAippHandle(OH_NNExecutor *executor,
+                                                     NN_Tensor *inputTensor[],
+                                                     size_t inputCount,
+                                                     NN_Tensor *outputTensor[],
+                                                     size_t outputCount,
+                                                     uint32_t aippHandle);
+
+/**
+ * @brief 在主机侧完成图像预处理，并将结果直接写入Tensor的共享内存。
+ *
+ * 适用于不支持AIPP的设备，抠图、缩放、通道重排、归一化、量化和排布转换在一次遍历中完成，无需额外的中间缓冲区。
+ * 支持的Tensor数据类型为OH_NN_FLOAT32、OH_NN_FLOAT16、OH_NN_INT8和OH_NN_UINT8，Tensor的形状须为4维，
+ * 格式须为OH_NN_FORMAT_NHWC或OH_NN_FORMAT_NCHW，通道数须与config中的dstFormat一致。\n
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param tensor 指向{@link NN_Tensor}实例的指针，须已申请数据内存。
+ * @param image 源图像数据。
+ * @param imageLength 源图像数据的字节数。
+ * @param config 预处理参数，参考{@link OH_NN_PreprocessConfig}。
+ * @return 函数执行的结果状态，执行成功返回OH_NN_SUCCESS，失败返回具体错误码，参考{@link OH_NN_ReturnCode}。
+ * @since 12
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NNTensor_FillWithPreprocess(NN_Tensor *tensor, const void *image, size_t imageLength,
+                                                const OH_NN_PreprocessConfig *config);
+
+/**
+ * @brief 提示执行器即将被使用。
+ *
+ * 执行器的模型因空闲被自动卸载后，在后台从cache重新加载模型，使下一次推理无需等待模型加载；模型未被卸载时推迟其自动卸载。
+ * 本接口立即返回，不等待模型加载完成。\n
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param executor 指向{@link OH_NNExecutor}实例的指针。
+ * @return 函数执行的结果状态，执行成功返回OH_NN_SUCCESS，失败返回具体错误码，参考{@link OH_NN_ReturnCode}。
+ * @since 12
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NNExecutor_Prefetch(OH_NNExecutor *executor);
+
+/**
+ * @brief 清空执行器保存的状态张量，使下一次推理开始新的序列。
+ *
+ * 状态张量在编译时通过扩展配置"StateTensors"声明，取值形如"0:1;1:2:2"，每一项"output:input[:axis]"表示
+ * 将输出output保存在设备侧，作为下一次推理的输入input；给出axis时输出沿该维度追加到状态末尾，否则替换整个状态。
+ * 推理时状态对应的输入和输出位置传入nullptr。状态清空后回到输入维度范围的最小值，数据全部为0。\n
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param executor 指向{@link OH_NNExecutor}实例的指针。
+ * @return 函数执行的结果状态，执行成功返回OH_NN_SUCCESS，失败返回具体错误码，参考{@link OH_NN_ReturnCode}。
+ * @since 12
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NNExecutor_ResetState(OH_NNExecutor *executor);
+
+/**
+ * @brief 执行同步推理，并将输出的维度信息写入调用者提供的数组。
+ *
+ * 推理方式与{@link OH_NNExecutor_RunSync}相同。推理成功后第i个输出的维度写入outputShapes[i * maxRank]开始的位置，
+ * 维度数量写入outputRanks[i]。维度信息在执行器内部保存，不修改编译得到的张量描述，
+ * 动态输出的模型无需再调用{@link OH_NNExecutor_GetOutputShape}，多个执行器并发推理时也不会互相覆盖。\n
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param executor 指向{@link OH_NNExecutor}实例的指针。
+ * @param inputTensor 输入张量的数组。
+ * @param inputCount 输入张量的数量。
+ * @param outputTensor 输出张量的数组。
+ * @param outputCount 输出张量的数量。
+ * @param outputShapes 存放输出维度的数组，长度至少为outputCount * maxRank。
+ * @param maxRank outputShapes中每个输出可存放的维度数量，输出的维度数量超过maxRank时返回OH_NN_INVALID_PARAMETER。
+ * @param outputRanks 存放输出维度数量的数组，长度至少为outputCount。
+ * @return 函数执行的结果状态，执行成功返回OH_NN_SUCCESS，失败返回具体错误码，参考{@link OH_NN_ReturnCode}。
+ * @since 12
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NNExecutor_RunSyncWithOutputShapes(OH_NNExecutor *executor,
+                                                       NN_Tensor *inputTensor[],
+                                                       size_t inputCount,
+                                                       NN_Tensor *outputTensor[],
+                                                       size_t outputCount,
+                                                       int32_t *outputShapes,
+                                                       size_t maxRank,
+                                                       uint32_t *outputRanks);
+
+/**
+ * @brief 设置动态输出的预期内存大小，并允许推理时对该输出的内存扩容。
+ *
+ * 调用本接口后，{@link OH_NNExecutor_RunSync}等推理接口发现该输出的内存不足时，将其内存扩容后重新推理，
+ * 不再返回错误，调用者无需按最大可能的大小申请输出内存。设备返回了输出维度时扩容到所需大小与sizeHint中的较大值，
+ * 否则扩容到当前大小的两倍与sizeHint中的较大值，每次推理最多重新推理3次。
+ * 只有通过{@link OH_NNTensor_Create}或{@link OH_NNTensor_CreateWithSize}创建的输出张量可以扩容，
+ * 扩容后张量的数据地址发生变化，推理后需重新调用{@link OH_NNTensor_GetDataBuffer}获取。\n
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param executor 指向{@link OH_NNExecutor}实例的指针。
+ * @param outputIndex 输出的索引值。
+ * @param sizeHint 输出的预期字节数，为0时只按设备返回的维度扩容。
+ * @return 函数执行的结果状态，执行成功返回OH_NN_SUCCESS，失败返回具体错误码，参考{@link OH_NN_ReturnCode}。
+ * @since 12
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NNExecutor_SetOutputSizeHint(OH_NNExecutor *executor, uint32_t outputIndex, size_t sizeHint);
+
+/**
+ * @brief 获取执行器因输出内存不足而扩容的统计信息。
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param executor 指向{@link OH_NNExecutor}实例的指针。
+ * @param stats 指向{@link OH_NN_OutputGrowthStats}的指针，用于返回统计信息。
+ * @return 函数执行的结果状态，执行成功返回OH_NN_SUCCESS，失败返回具体错误码，参考{@link OH_NN_ReturnCode}。
+ * @since 12
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NNExecutor_GetOutputGrowthStats(OH_NNExecutor *executor, OH_NN_OutputGrowthStats *stats);
+
+/**
+ * @brief 将用户内存注册到执行器，使{@link OH_NNExecutor_SetInput}和{@link OH_NNExecutor_SetOutput}不再拷贝数据。
+ *
+ * 本接口申请一块设备共享内存，拷贝buffer的内容后，将其原地映射到buffer所在的地址，buffer的地址和内容均保持不变。
+ * 之后使用该buffer设置输入输出时，设备直接读写buffer：设置输入后对buffer的修改会影响下一次推理，推理结果直接写入
+ * buffer。buffer和length均需按页对齐，且必须是进程私有的匿名内存（如malloc或以MAP_PRIVATE | MAP_ANONYMOUS方式mmap
+ * 得到的内存），文件映射或共享映射的内存将被拒绝。本接口执行期间不得读写buffer，否则写入的数据可能丢失。
+ * 释放buffer前需调用{@link OH_NNExecutor_UnregisterBuffer}，销毁执行器时自动注销其仍注册的buffer。\n
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param executor 指向{@link OH_NNExecutor}实例的指针。
+ * @param buffer 按页对齐的用户内存。
+ * @param length buffer的长度，按页对齐。
+ * @return 函数执行的结果状态，执行成功返回OH_NN_SUCCESS，失败返回具体错误码，参考{@link OH_NN_ReturnCode}。
+ * @since 12
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NNExecutor_RegisterBuffer(OH_NNExecutor *executor, void *buffer, size_t length);
+
+/**
+ * @brief 注销通过{@link OH_NNExecutor_RegisterBuffer}注册的用户内存。
+ *
+ * buffer恢复为进程私有内存，地址和内容保持不变。注销后不能再使用以该buffer设置的输入输出推理，需重新设置。
+ * 本接口执行期间不得读写buffer，其内容在注销完成前可能读到全零。\n
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param executor 指向{@link OH_NNExecutor}实例的指针。
+ * @param buffer 已注册的用户内存。
+ * @return 函数执行的结果状态，执行成功返回OH_NN_SUCCESS，失败返回具体错误码，参考{@link OH_NN_ReturnCode}。
+ * @since 12
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NNExecutor_UnregisterBuffer(OH_NNExecutor *executor, void *buffer);
+
 /**
  * @brief 对cache进行crc校验和检验
  *
@@ -202,6 +686,47 @@ OH_NN_ReturnCode OH_NNExecutor_RunSyncWithAipp(OH_NNExecutor *executor,
  * @version 1.0
  */
 unsigned short CacheInfoGetCrc16(char* buffer, size_t length);
+
+/**
+ * @brief 获取指定阶段在当前进程内的时延直方图。
+ *
+ * 统计数据由所有线程的直方图汇总得到，记录过程不加锁。\n
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param stage 时延统计阶段，参考{@link OH_NN_LatencyStage}。
+ * @param histogram 传出的直方图。
+ * @return 函数执行的结果状态，执行成功返回OH_NN_SUCCESS，失败返回具体错误码，参考{@link OH_NN_ReturnCode}。
+ * @since 12
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NN_GetLatencyHistogram(OH_NN_LatencyStage stage, OH_NN_LatencyHistogram *histogram);
+
+/**
+ * @brief 以JSON格式导出所有阶段的时延直方图。
+ *
+ * buffer为nullptr时只通过dumpLength返回所需的buffer长度(包含结尾的'\0')。\n
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param buffer 存放JSON字符串的buffer。
+ * @param length buffer的长度。
+ * @param dumpLength 传出JSON字符串所需的长度，包含结尾的'\0'。
+ * @return 函数执行的结果状态，执行成功返回OH_NN_SUCCESS，buffer长度不足时返回OH_NN_INVALID_PARAMETER。
+ * @since 12
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NN_DumpLatencyHistograms(char *buffer, size_t length, size_t *dumpLength);
+
+/**
+ * @brief 清空所有阶段的时延直方图。
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @since 12
+ * @version 1.0
+ */
+void OH_NN_ResetLatencyHistograms();
 #ifdef __cplusplus
 }
 #endif // __cpluscplus
@@ -313,7 +313,21 @@ typedef enum {
     /** float32 */
     OH_NN_FLOAT32 = 11,
     /** float64 */
-    OH_NN_FLOAT64 = 12
+    OH_NN_FLOAT64 = 12,
+    /**
+     * bfloat16, with the 8-bit exponent of float32 and a 7-bit mantissa.
+     * @since 12
+     */
+    OH_NN_BFLOAT16 = 13,
+    /**
+     * Signed 4-bit integer. Two elements are packed into one byte, the element with the lower index in the lower
+     * four bits, and a tensor with an odd number of elements leaves the upper four bits of its last byte unused.
+     * Tensors of this type must be quantized with 4 bits, and their quantization parameters are shared by equally
+     * sized groups of consecutive elements, that is, <b>quantCount</b> must divide the number of elements. Per-tensor
+     * and per-channel quantization are the special cases of one group and of one group per channel.
+     * @since 12
+     */
+    OH_NN_INT4 = 14
 } OH_NN_DataType;
 
 
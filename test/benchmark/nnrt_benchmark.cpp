@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <vector>
+#include <sys/stat.h>
+
+#include "benchmark/benchmark.h"
+#include "mindir.h"
+
+#include "lite_graph_to_hdi_model_v2_1.h"
+#include "memory_manager.h"
+#include "nncompiled_cache.h"
+#include "neural_network_runtime/neural_network_runtime.h"
+#include "nnrt_benchmark_common.h"
+
+using namespace OHOS::NeuralNetworkRuntime;
+using namespace OHOS::NeuralNetworkRuntime::Benchmark;
+
+namespace {
+namespace V2_1 = OHOS::HDI::Nnrt::V2_1;
+const std::string BENCHMARK_CACHE_DIR = "/data/local/tmp/nnrt_benchmark_cache";
+constexpr uint32_t BENCHMARK_CACHE_VERSION = 1;
+constexpr size_t MEMORY_BENCHMARK_LENGTH = 4096;
+
+void BM_TensorCreateDestroy(benchmark::State& state)
+{
+    size_t backendID = GetBenchmarkBackendID();
+    NN_TensorDesc* desc = OH_NNTensorDesc_Create();
+    int32_t shape[] = {1, static_cast<int32_t>(state.range(0))};
+    OH_NNTensorDesc_SetDataType(desc, OH_NN_FLOAT32);
+    OH_NNTensorDesc_SetShape(desc, shape, sizeof(shape) / sizeof(shape[0]));
+
+    for (auto _ : state) {
+        NN_Tensor* tensor = OH_NNTensor_Create(backendID, desc);
+        if (tensor == nullptr) {
+            state.SkipWithError("OH_NNTensor_Create failed.");
+            break;
+        }
+        OH_NNTensor_Destroy(&tensor);
+    }
+    OH_NNTensorDesc_Destroy(&desc);
+}
+BENCHMARK(BM_TensorCreateDestroy)->RangeMultiplier(16)->Range(16, 1 << 20);
+
+void BM_ExecutorRunSync(benchmark::State& state)
+{
+    SetSimulatedLatency(0, 0);
+    BenchmarkExecution execution(static_cast<size_t>(state.range(0)));
+    if (!execution.IsValid()) {
+        state.SkipWithError("Failed to compile the benchmark model.");
+        return;
+    }
+    for (auto _ : state) {
+        if (execution.RunSync() != OH_NN_SUCCESS) {
+            state.SkipWithError("OH_NNExecutor_RunSync failed.");
+            break;
+        }
+    }
+}
+BENCHMARK(BM_ExecutorRunSync)->Arg(1)->Arg(64);
+
+void BM_InnerModelBuild(benchmark::State& state)
+{
+    size_t nodeNum = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        InnerModel model;
+        if (BuildAddChainModel(model, nodeNum) != OH_NN_SUCCESS) {
+            state.SkipWithError("InnerModel::Build failed.");
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_InnerModelBuild)->RangeMultiplier(8)->Range(1, 4096);
+
+void BM_LiteGraphToHDIModel(benchmark::State& state)
+{
+    InnerModel model;
+    if (BuildAddChainModel(model, static_cast<size_t>(state.range(0))) != OH_NN_SUCCESS) {
+        state.SkipWithError("InnerModel::Build failed.");
+        return;
+    }
+    auto liteGraph = model.GetLiteGraphs();
+    V2_1::SharedBuffer buffer {INVALID_FD, 0, 0, 0};
+    size_t constSize = mindspore::lite::MindIR_LiteGraph_GetConstTensorSize(liteGraph.get());
+    if ((constSize > 0) && (CreateSharedBuffer(constSize, buffer) != OH_NN_SUCCESS)) {
+        state.SkipWithError("Failed to create the constant tensor buffer.");
+        return;
+    }
+
+    for (auto _ : state) {
+        V2_1::Model* iModel = NNRt_V2_1::LiteGraph_To_HDIModel(liteGraph.get(), buffer);
+        if (iModel == nullptr) {
+            state.SkipWithError("LiteGraph_To_HDIModel failed.");
+            break;
+        }
+        NNRt_V2_1::HDIModel_Destroy(&iModel);
+    }
+    ReleaseSharedBuffer(buffer);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_LiteGraphToHDIModel)->RangeMultiplier(8)->Range(1, 4096);
+
+void BM_CompiledCacheSaveRestore(benchmark::State& state)
+{
+    (void)mkdir(BENCHMARK_CACHE_DIR.c_str(), S_IRWXU);
+    std::vector<char> cacheData(static_cast<size_t>(state.range(0)), 'c');
+    std::vector<Buffer> caches {{cacheData.data(), cacheData.size(), -1}};
+
+    NNCompiledCache compiledCache;
+    if (compiledCache.SetBackend(GetBenchmarkBackendID()) != OH_NN_SUCCESS) {
+        state.SkipWithError("NNCompiledCache::SetBackend failed.");
+        return;
+    }
+    compiledCache.SetModelName("nnrt_benchmark");
+
+    for (auto _ : state) {
+        if (compiledCache.Save(caches, BENCHMARK_CACHE_DIR, BENCHMARK_CACHE_VERSION) != OH_NN_SUCCESS) {
+            state.SkipWithError("NNCompiledCache::Save failed.");
+            break;
+        }
+        std::vector<Buffer> restoredCaches;
+        if (compiledCache.Restore(BENCHMARK_CACHE_DIR, BENCHMARK_CACHE_VERSION, restoredCaches) != OH_NN_SUCCESS) {
+            state.SkipWithError("NNCompiledCache::Restore failed.");
+            break;
+        }
+        compiledCache.ReleaseCacheBuffer(restoredCaches);
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CompiledCacheSaveRestore)->RangeMultiplier(16)->Range(1 << 10, 1 << 24);
+
+// Every thread maps, looks up and unmaps its own buffer, so the cost above one thread is lock contention.
+void BM_MemoryManagerContention(benchmark::State& state)
+{
+    V2_1::SharedBuffer buffer {INVALID_FD, 0, 0, 0};
+    if (CreateSharedBuffer(MEMORY_BENCHMARK_LENGTH, buffer) != OH_NN_SUCCESS) {
+        state.SkipWithError("Failed to create the shared buffer.");
+        return;
+    }
+
+    MemoryManager* memManager = MemoryManager::GetInstance();
+    for (auto _ : state) {
+        void* data = memManager->MapMemory(buffer.fd, MEMORY_BENCHMARK_LENGTH);
+        if (data == nullptr) {
+            state.SkipWithError("MemoryManager::MapMemory failed.");
+            break;
+        }
+        Memory memory;
+        benchmark::DoNotOptimize(memManager->GetMemory(data, memory));
+        memManager->UnMapMemory(data);
+    }
+    ReleaseSharedBuffer(buffer);
+}
+BENCHMARK(BM_MemoryManagerContention)->ThreadRange(1, 8)->UseRealTime();
+} // namespace
+
+BENCHMARK_MAIN();
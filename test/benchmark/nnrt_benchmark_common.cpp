@@ -0,0 +1,390 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "nnrt_benchmark_common.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "ashmem.h"
+#include "hdf_base.h"
+
+#include "backend_manager.h"
+#include "hdi_device_v2_1.h"
+#include "log.h"
+#include "nnbackend.h"
+#include "utils.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace Benchmark {
+namespace {
+namespace V2_1 = OHOS::HDI::Nnrt::V2_1;
+using ::testing::_;
+using ::testing::DoAll;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::SetArgReferee;
+
+const std::string BENCHMARK_DEVICE_NAME = "NNRtBenchmarkDevice";
+constexpr uint32_t BENCHMARK_HDI_MAJOR_VERSION = 2;
+constexpr uint32_t BENCHMARK_HDI_MINOR_VERSION = 1;
+constexpr uint32_t BENCHMARK_MODEL_CACHE_SIZE = 4096;
+constexpr size_t PERCENTILE_50 = 50;
+constexpr size_t PERCENTILE_99 = 99;
+constexpr size_t PERCENT = 100;
+constexpr double NS_PER_US = 1000.0;
+
+std::atomic<uint32_t> g_runLatencyUs {0};
+std::atomic<uint32_t> g_prepareLatencyUs {0};
+
+// Collects the latency samples of all threads of one benchmark run for LatencyRecorder::Report().
+struct LatencySink {
+    std::mutex mtx;
+    std::condition_variable merged;
+    std::vector<int64_t> samples;
+    int mergedThreads {0};
+};
+LatencySink g_latencySink;
+
+void SimulateLatency(const std::atomic<uint32_t>& latencyUs)
+{
+    uint32_t latency = latencyUs.load(std::memory_order_relaxed);
+    if (latency > 0) {
+        std::this_thread::sleep_for(std::chrono::microseconds(latency));
+    }
+}
+
+int32_t AllocateAshmem(uint32_t length, V2_1::SharedBuffer& buffer)
+{
+    return (CreateSharedBuffer(length, buffer) == OH_NN_SUCCESS) ? HDF_SUCCESS : HDF_FAILURE;
+}
+
+int32_t ReleaseAshmem(const V2_1::SharedBuffer& buffer)
+{
+    return (close(buffer.fd) == 0) ? HDF_SUCCESS : HDF_FAILURE;
+}
+
+int32_t ExportAshmemCache(std::vector<V2_1::SharedBuffer>& modelCache)
+{
+    V2_1::SharedBuffer buffer;
+    if (CreateSharedBuffer(BENCHMARK_MODEL_CACHE_SIZE, buffer) != OH_NN_SUCCESS) {
+        return HDF_FAILURE;
+    }
+    modelCache.emplace_back(buffer);
+    return HDF_SUCCESS;
+}
+
+// The prepared model reports the model's own input shapes as the only valid dim range.
+sptr<V2_1::IPreparedModel> CreateMockPreparedModel(const std::vector<std::vector<uint32_t>>& inputDims)
+{
+    sptr<NiceMock<V2_1::MockIPreparedModel>> preparedModel =
+        new (std::nothrow) NiceMock<V2_1::MockIPreparedModel>();
+    if (preparedModel == nullptr) {
+        return nullptr;
+    }
+
+    ON_CALL(*preparedModel, GetVersion(_, _))
+        .WillByDefault(DoAll(SetArgReferee<0>(BENCHMARK_HDI_MAJOR_VERSION),
+            SetArgReferee<1>(BENCHMARK_HDI_MINOR_VERSION), Return(HDF_SUCCESS)));
+    ON_CALL(*preparedModel, GetInputDimRanges(_, _))
+        .WillByDefault(DoAll(SetArgReferee<0>(inputDims), SetArgReferee<1>(inputDims), Return(HDF_SUCCESS)));
+    ON_CALL(*preparedModel, ExportModelCache(_)).WillByDefault(Invoke(ExportAshmemCache));
+    ON_CALL(*preparedModel, Run(_, _, _))
+        .WillByDefault(Invoke([](const std::vector<V2_1::IOTensor>& inputs,
+            const std::vector<V2_1::IOTensor>& outputs, std::vector<std::vector<int32_t>>& outputsDims) {
+            SimulateLatency(g_runLatencyUs);
+            for (const auto& output : outputs) {
+                outputsDims.emplace_back(output.dimensions);
+            }
+            return HDF_SUCCESS;
+        }));
+    return preparedModel;
+}
+
+int32_t PrepareMockModel(const V2_1::Model& model, const V2_1::ModelConfig& config,
+    sptr<V2_1::IPreparedModel>& preparedModel)
+{
+    SimulateLatency(g_prepareLatencyUs);
+    std::vector<std::vector<uint32_t>> inputDims;
+    for (uint32_t index : model.inputIndex) {
+        const std::vector<int32_t>& dims = model.allTensors[index].dims;
+        inputDims.emplace_back(dims.begin(), dims.end());
+    }
+    preparedModel = CreateMockPreparedModel(inputDims);
+    return (preparedModel == nullptr) ? HDF_FAILURE : HDF_SUCCESS;
+}
+
+int32_t PrepareMockModelFromCache(const std::vector<V2_1::SharedBuffer>& modelCache,
+    const V2_1::ModelConfig& config, sptr<V2_1::IPreparedModel>& preparedModel)
+{
+    SimulateLatency(g_prepareLatencyUs);
+    std::vector<uint32_t> dims(BENCHMARK_TENSOR_DIMS.begin(), BENCHMARK_TENSOR_DIMS.end());
+    preparedModel = CreateMockPreparedModel({dims, dims});
+    return (preparedModel == nullptr) ? HDF_FAILURE : HDF_SUCCESS;
+}
+
+sptr<V2_1::INnrtDevice> CreateMockIDevice()
+{
+    sptr<NiceMock<V2_1::MockIDevice>> iDevice = new (std::nothrow) NiceMock<V2_1::MockIDevice>();
+    if (iDevice == nullptr) {
+        return nullptr;
+    }
+
+    ON_CALL(*iDevice, GetDeviceName(_))
+        .WillByDefault(DoAll(SetArgReferee<0>(BENCHMARK_DEVICE_NAME), Return(HDF_SUCCESS)));
+    ON_CALL(*iDevice, GetVendorName(_))
+        .WillByDefault(DoAll(SetArgReferee<0>(BENCHMARK_DEVICE_NAME), Return(HDF_SUCCESS)));
+    ON_CALL(*iDevice, GetVersion(_, _))
+        .WillByDefault(DoAll(SetArgReferee<0>(BENCHMARK_HDI_MAJOR_VERSION),
+            SetArgReferee<1>(BENCHMARK_HDI_MINOR_VERSION), Return(HDF_SUCCESS)));
+    ON_CALL(*iDevice, GetDeviceType(_)).WillByDefault(DoAll(SetArgReferee<0>(V2_1::DeviceType::CPU),
+        Return(HDF_SUCCESS)));
+    ON_CALL(*iDevice, GetDeviceStatus(_)).WillByDefault(DoAll(SetArgReferee<0>(V2_1::DeviceStatus::AVAILABLE),
+        Return(HDF_SUCCESS)));
+    ON_CALL(*iDevice, IsModelCacheSupported(_)).WillByDefault(DoAll(SetArgReferee<0>(true), Return(HDF_SUCCESS)));
+    ON_CALL(*iDevice, AllocateBuffer(_, _)).WillByDefault(Invoke(AllocateAshmem));
+    ON_CALL(*iDevice, ReleaseBuffer(_)).WillByDefault(Invoke(ReleaseAshmem));
+    ON_CALL(*iDevice, PrepareModel(_, _, _)).WillByDefault(Invoke(PrepareMockModel));
+    ON_CALL(*iDevice, PrepareModelFromModelCache(_, _, _)).WillByDefault(Invoke(PrepareMockModelFromCache));
+    return iDevice;
+}
+
+std::shared_ptr<Backend> CreateBenchmarkBackend()
+{
+    sptr<V2_1::INnrtDevice> iDevice = CreateMockIDevice();
+    if (iDevice == nullptr) {
+        return nullptr;
+    }
+
+    std::shared_ptr<Device> device = CreateSharedPtr<HDIDeviceV2_1>(iDevice);
+    if (device == nullptr) {
+        return nullptr;
+    }
+    return CreateSharedPtr<NNBackend>(device, std::hash<std::string>{}(BENCHMARK_DEVICE_NAME));
+}
+} // namespace
+
+size_t GetBenchmarkBackendID()
+{
+    static std::once_flag registerFlag;
+    std::call_once(registerFlag, []() {
+        OH_NN_ReturnCode ret = BackendManager::GetInstance().RegisterBackend(BENCHMARK_DEVICE_NAME,
+            CreateBenchmarkBackend);
+        if (ret != OH_NN_SUCCESS) {
+            LOGE("[NNRtBenchmark] Failed to register the benchmark backend.");
+        }
+    });
+    return std::hash<std::string>{}(BENCHMARK_DEVICE_NAME);
+}
+
+OH_NN_ReturnCode BuildAddChainModel(InnerModel& model, size_t nodeNum)
+{
+    if (nodeNum == 0) {
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    OH_NN_Tensor tensor = {OH_NN_FLOAT32, static_cast<uint32_t>(BENCHMARK_TENSOR_DIMS.size()),
+        BENCHMARK_TENSOR_DIMS.data(), nullptr, OH_NN_TENSOR};
+    int32_t activationDims = 1;
+    int8_t activationValue = OH_NN_FUSED_NONE;
+    OH_NN_Tensor activation = {OH_NN_INT8, 1, &activationDims, nullptr, OH_NN_ADD_ACTIVATIONTYPE};
+
+    // Tensor 0 and 1 are the model inputs, every node then adds an activation parameter and an output.
+    uint32_t modelInputs[2] = {0, 1};
+    uint32_t tensorIndex = 2;
+    OH_NN_ReturnCode ret = model.AddTensor(tensor);
+    if (ret == OH_NN_SUCCESS) {
+        ret = model.AddTensor(tensor);
+    }
+
+    uint32_t lastOutput = modelInputs[0];
+    for (size_t i = 0; (i < nodeNum) && (ret == OH_NN_SUCCESS); ++i) {
+        uint32_t paramIndex = tensorIndex++;
+        uint32_t outputIndex = tensorIndex++;
+        ret = model.AddTensor(activation);
+        if (ret == OH_NN_SUCCESS) {
+            ret = model.SetTensorValue(paramIndex, &activationValue, sizeof(int8_t));
+        }
+        if (ret == OH_NN_SUCCESS) {
+            ret = model.AddTensor(tensor);
+        }
+        if (ret == OH_NN_SUCCESS) {
+            uint32_t inputIndices[2] = {lastOutput, modelInputs[1]};
+            OH_NN_UInt32Array params = {&paramIndex, 1};
+            OH_NN_UInt32Array inputs = {inputIndices, 2};
+            OH_NN_UInt32Array outputs = {&outputIndex, 1};
+            ret = model.AddOperation(OH_NN_OPS_ADD, params, inputs, outputs);
+        }
+        lastOutput = outputIndex;
+    }
+    if (ret != OH_NN_SUCCESS) {
+        LOGE("[NNRtBenchmark] Failed to add the nodes of the benchmark model.");
+        return ret;
+    }
+
+    OH_NN_UInt32Array inputs = {modelInputs, 2};
+    OH_NN_UInt32Array outputs = {&lastOutput, 1};
+    ret = model.SpecifyInputsAndOutputs(inputs, outputs);
+    if (ret != OH_NN_SUCCESS) {
+        LOGE("[NNRtBenchmark] Failed to specify the inputs and outputs of the benchmark model.");
+        return ret;
+    }
+    return model.Build();
+}
+
+void SetSimulatedLatency(uint32_t runUs, uint32_t prepareUs)
+{
+    g_runLatencyUs.store(runUs, std::memory_order_relaxed);
+    g_prepareLatencyUs.store(prepareUs, std::memory_order_relaxed);
+}
+
+BenchmarkExecution::BenchmarkExecution(size_t nodeNum)
+{
+    if (BuildAddChainModel(m_model, nodeNum) != OH_NN_SUCCESS) {
+        return;
+    }
+    m_compilation = OH_NNCompilation_Construct(reinterpret_cast<OH_NNModel*>(&m_model));
+    if ((m_compilation == nullptr) ||
+        (OH_NNCompilation_SetDevice(m_compilation, GetBenchmarkBackendID()) != OH_NN_SUCCESS) ||
+        (OH_NNCompilation_Build(m_compilation) != OH_NN_SUCCESS)) {
+        return;
+    }
+    m_executor = OH_NNExecutor_Construct(m_compilation);
+    if (m_executor == nullptr) {
+        return;
+    }
+
+    size_t inputCount = 0;
+    size_t outputCount = 0;
+    (void)OH_NNExecutor_GetInputCount(m_executor, &inputCount);
+    (void)OH_NNExecutor_GetOutputCount(m_executor, &outputCount);
+    for (size_t i = 0; i < inputCount; ++i) {
+        NN_TensorDesc* desc = OH_NNExecutor_CreateInputTensorDesc(m_executor, i);
+        m_inputs.emplace_back(OH_NNTensor_Create(GetBenchmarkBackendID(), desc));
+        OH_NNTensorDesc_Destroy(&desc);
+    }
+    for (size_t i = 0; i < outputCount; ++i) {
+        NN_TensorDesc* desc = OH_NNExecutor_CreateOutputTensorDesc(m_executor, i);
+        m_outputs.emplace_back(OH_NNTensor_Create(GetBenchmarkBackendID(), desc));
+        OH_NNTensorDesc_Destroy(&desc);
+    }
+}
+
+BenchmarkExecution::~BenchmarkExecution()
+{
+    for (NN_Tensor* tensor : m_inputs) {
+        OH_NNTensor_Destroy(&tensor);
+    }
+    for (NN_Tensor* tensor : m_outputs) {
+        OH_NNTensor_Destroy(&tensor);
+    }
+    OH_NNExecutor_Destroy(&m_executor);
+    OH_NNCompilation_Destroy(&m_compilation);
+}
+
+bool BenchmarkExecution::IsValid() const
+{
+    return (m_executor != nullptr) && !m_inputs.empty() && !m_outputs.empty() &&
+        std::find(m_inputs.begin(), m_inputs.end(), nullptr) == m_inputs.end() &&
+        std::find(m_outputs.begin(), m_outputs.end(), nullptr) == m_outputs.end();
+}
+
+OH_NN_ReturnCode BenchmarkExecution::RunSync()
+{
+    if (m_executor == nullptr) {
+        return OH_NN_FAILED;
+    }
+    return OH_NNExecutor_RunSync(m_executor, m_inputs.data(), m_inputs.size(), m_outputs.data(), m_outputs.size());
+}
+
+LatencyRecorder::LatencyRecorder(benchmark::State& state) : m_state(state)
+{
+    m_samples.reserve(static_cast<size_t>(state.max_iterations));
+}
+
+void LatencyRecorder::Report(uint32_t simulatedUs)
+{
+    m_state.SetItemsProcessed(static_cast<int64_t>(m_samples.size()));
+
+    std::vector<int64_t> samples;
+    {
+        std::unique_lock<std::mutex> lock(g_latencySink.mtx);
+        g_latencySink.samples.insert(g_latencySink.samples.end(), m_samples.begin(), m_samples.end());
+        ++g_latencySink.mergedThreads;
+        g_latencySink.merged.notify_all();
+        if (m_state.thread_index() != 0) {
+            return;
+        }
+
+        // The threads of the next run start after this one returns, so the sink is empty for them.
+        g_latencySink.merged.wait(lock, [this]() { return g_latencySink.mergedThreads == m_state.threads(); });
+        samples.swap(g_latencySink.samples);
+        g_latencySink.mergedThreads = 0;
+    }
+    if (samples.empty()) {
+        return;
+    }
+
+    std::sort(samples.begin(), samples.end());
+    size_t count = samples.size();
+    double totalNs = 0;
+    for (int64_t sample : samples) {
+        totalNs += static_cast<double>(sample);
+    }
+    double meanUs = totalNs / count / NS_PER_US;
+
+    // Only thread 0 sets the counters, so the sum the benchmark takes over the threads is its value.
+    m_state.counters["p50_us"] = benchmark::Counter(samples[count * PERCENTILE_50 / PERCENT] / NS_PER_US);
+    m_state.counters["p99_us"] = benchmark::Counter(samples[count * PERCENTILE_99 / PERCENT] / NS_PER_US);
+    m_state.counters["overhead_us"] = benchmark::Counter(std::max(meanUs - simulatedUs, 0.0));
+}
+
+OH_NN_ReturnCode CreateSharedBuffer(size_t length, OHOS::HDI::Nnrt::V2_1::SharedBuffer& buffer)
+{
+    int fd = AshmemCreate("nnrt_benchmark", length);
+    if (fd < 0) {
+        LOGE("[NNRtBenchmark] Failed to create ashmem of %{public}zu bytes.", length);
+        return OH_NN_MEMORY_ERROR;
+    }
+    if (AshmemSetProt(fd, PROT_READ | PROT_WRITE) < 0) {
+        close(fd);
+        return OH_NN_MEMORY_ERROR;
+    }
+
+    buffer.fd = fd;
+    buffer.bufferSize = length;
+    buffer.offset = 0;
+    buffer.dataSize = length;
+    return OH_NN_SUCCESS;
+}
+
+void ReleaseSharedBuffer(OHOS::HDI::Nnrt::V2_1::SharedBuffer& buffer)
+{
+    if (buffer.fd >= 0) {
+        close(buffer.fd);
+    }
+    buffer.fd = INVALID_FD;
+}
+} // namespace Benchmark
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
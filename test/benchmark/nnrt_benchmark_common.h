@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NEURAL_NETWORK_RUNTIME_BENCHMARK_COMMON_H
+#define NEURAL_NETWORK_RUNTIME_BENCHMARK_COMMON_H
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "inner_model.h"
+#include "neural_network_runtime/neural_network_runtime.h"
+#include "test/unittest/common/v2_1/mock_idevice.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace Benchmark {
+// Shape of every input and output tensor of the benchmark models.
+const std::vector<int32_t> BENCHMARK_TENSOR_DIMS = {1, 256};
+
+/**
+ * Registers a backend built on the v2.1 MockIDevice the first time it is called and returns its backend ID. The
+ * mock hands out ashmem buffers and its prepared models answer Run() by echoing the output dimensions, so the
+ * runtime paths above the HDI interface run unchanged without an NNRt driver.
+ */
+size_t GetBenchmarkBackendID();
+
+/**
+ * Builds a model made of nodeNum chained Add nodes: out_0 = in_0 + in_1, out_i = out_(i-1) + in_1.
+ */
+OH_NN_ReturnCode BuildAddChainModel(InnerModel& model, size_t nodeNum);
+
+/**
+ * Sets the time the mock device spends in IPreparedModel::Run() and in preparing a model, from a model or from
+ * its cache. Both are 0 unless a benchmark sets them, they hold for every backend the benchmark has registered.
+ */
+void SetSimulatedLatency(uint32_t runUs, uint32_t prepareUs);
+
+// Compiles a model of nodeNum Add nodes on the benchmark backend and keeps everything needed to run it.
+class BenchmarkExecution {
+public:
+    explicit BenchmarkExecution(size_t nodeNum);
+    ~BenchmarkExecution();
+    BenchmarkExecution(const BenchmarkExecution&) = delete;
+    BenchmarkExecution& operator=(const BenchmarkExecution&) = delete;
+
+    bool IsValid() const;
+    OH_NN_ReturnCode RunSync();
+
+private:
+    InnerModel m_model;
+    OH_NNCompilation* m_compilation {nullptr};
+    OH_NNExecutor* m_executor {nullptr};
+    std::vector<NN_Tensor*> m_inputs;
+    std::vector<NN_Tensor*> m_outputs;
+};
+
+/**
+ * Times every operation of one benchmark thread. Report() sets items_per_second, which the benchmark sums over the
+ * threads into the QPS. Every thread then merges its samples, and thread 0 reports the p50/p99 latency of the
+ * samples of all threads. overhead_us is the mean latency beyond the simulated device latency: the time spent in
+ * the runtime, whose growth with the thread count is the cost of lock contention.
+ */
+class LatencyRecorder {
+public:
+    explicit LatencyRecorder(benchmark::State& state);
+
+    template<typename Operation>
+    bool Measure(Operation&& operation)
+    {
+        auto start = std::chrono::steady_clock::now();
+        OH_NN_ReturnCode ret = operation();
+        m_samples.emplace_back(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count());
+        return ret == OH_NN_SUCCESS;
+    }
+
+    void Report(uint32_t simulatedUs);
+
+private:
+    benchmark::State& m_state;
+    std::vector<int64_t> m_samples;
+};
+
+// Ashmem buffers in the layout the HDI device expects, used by the benchmarks that call the converters directly.
+OH_NN_ReturnCode CreateSharedBuffer(size_t length, OHOS::HDI::Nnrt::V2_1::SharedBuffer& buffer);
+void ReleaseSharedBuffer(OHOS::HDI::Nnrt::V2_1::SharedBuffer& buffer);
+} // namespace Benchmark
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
+#endif // NEURAL_NETWORK_RUNTIME_BENCHMARK_COMMON_H
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Throughput of the runtime under concurrent load. Every benchmark runs on 1 to 16 threads. The actions installed on
+// the mock device by nnrt_benchmark_common sleep for the simulated latency given by the last argument, so that the
+// runtime scales as it would in front of a real accelerator; the shared MockIDevice itself never sleeps. Compare
+// overhead_us across the thread counts to find the locks which serialize the callers.
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <sys/stat.h>
+
+#include "benchmark/benchmark.h"
+
+#include "neural_network_runtime/neural_network_runtime.h"
+#include "neural_network_runtime_inner.h"
+#include "nnrt_benchmark_common.h"
+
+using namespace OHOS::NeuralNetworkRuntime;
+using namespace OHOS::NeuralNetworkRuntime::Benchmark;
+
+namespace {
+const std::string STRESS_CACHE_DIR = "/data/local/tmp/nnrt_stress_benchmark_cache";
+constexpr uint32_t STRESS_CACHE_VERSION = 1;
+constexpr size_t STRESS_NODE_NUM = 8;
+constexpr int STRESS_MAX_THREADS = 16;
+
+// Arguments: executors per thread, simulated Run() latency in microseconds. The executors of a thread are run in
+// turn, every executor has its own compilation.
+void BM_StressExecutorRunSync(benchmark::State& state)
+{
+    size_t executorNum = static_cast<size_t>(state.range(0));
+    uint32_t runUs = static_cast<uint32_t>(state.range(1));
+    SetSimulatedLatency(runUs, 0);
+
+    std::vector<std::unique_ptr<BenchmarkExecution>> executions;
+    for (size_t i = 0; i < executorNum; ++i) {
+        executions.emplace_back(std::make_unique<BenchmarkExecution>(STRESS_NODE_NUM));
+        if (!executions.back()->IsValid()) {
+            state.SkipWithError("Failed to compile the benchmark model.");
+            return;
+        }
+    }
+
+    LatencyRecorder recorder(state);
+    size_t next = 0;
+    for (auto _ : state) {
+        if (!recorder.Measure([&executions, next]() { return executions[next]->RunSync(); })) {
+            state.SkipWithError("OH_NNExecutor_RunSync failed.");
+            break;
+        }
+        next = (next + 1) % executorNum;
+    }
+    recorder.Report(runUs);
+}
+BENCHMARK(BM_StressExecutorRunSync)->Args({1, 0})->Args({4, 0})->Args({1, 100})->Args({4, 100})
+    ->ThreadRange(1, STRESS_MAX_THREADS)->UseRealTime();
+
+// Arguments: element count of the tensor. The device buffer of every tensor is allocated and released by the mock.
+void BM_StressTensorCreateDestroy(benchmark::State& state)
+{
+    size_t backendID = GetBenchmarkBackendID();
+    NN_TensorDesc* desc = OH_NNTensorDesc_Create();
+    int32_t shape[] = {1, static_cast<int32_t>(state.range(0))};
+    OH_NNTensorDesc_SetDataType(desc, OH_NN_FLOAT32);
+    OH_NNTensorDesc_SetShape(desc, shape, sizeof(shape) / sizeof(shape[0]));
+
+    LatencyRecorder recorder(state);
+    for (auto _ : state) {
+        bool isCreated = recorder.Measure([backendID, desc]() {
+            NN_Tensor* tensor = OH_NNTensor_Create(backendID, desc);
+            if (tensor == nullptr) {
+                return OH_NN_MEMORY_ERROR;
+            }
+            return OH_NNTensor_Destroy(&tensor);
+        });
+        if (!isCreated) {
+            state.SkipWithError("OH_NNTensor_Create failed.");
+            break;
+        }
+    }
+    OH_NNTensorDesc_Destroy(&desc);
+    recorder.Report(0);
+}
+BENCHMARK(BM_StressTensorCreateDestroy)->Arg(256)->Arg(1 << 16)->ThreadRange(1, STRESS_MAX_THREADS)->UseRealTime();
+
+// Arguments: whether all threads compile the same model, simulated prepare latency in microseconds. Builds of the
+// same model share its prepared model, builds of the models of different threads go to the device each.
+void BM_StressCompile(benchmark::State& state)
+{
+    static InnerModel sharedModel;
+    static std::once_flag sharedModelFlag;
+    std::call_once(sharedModelFlag, []() { (void)BuildAddChainModel(sharedModel, STRESS_NODE_NUM); });
+
+    bool isShared = (state.range(0) != 0);
+    uint32_t prepareUs = static_cast<uint32_t>(state.range(1));
+    SetSimulatedLatency(0, prepareUs);
+    InnerModel ownModel;
+    if (!isShared && (BuildAddChainModel(ownModel, STRESS_NODE_NUM) != OH_NN_SUCCESS)) {
+        state.SkipWithError("InnerModel::Build failed.");
+        return;
+    }
+    OH_NNModel* model = reinterpret_cast<OH_NNModel*>(isShared ? &sharedModel : &ownModel);
+
+    LatencyRecorder recorder(state);
+    for (auto _ : state) {
+        OH_NNCompilation* compilation = OH_NNCompilation_Construct(model);
+        bool isBuilt = (compilation != nullptr) &&
+            (OH_NNCompilation_SetDevice(compilation, GetBenchmarkBackendID()) == OH_NN_SUCCESS) &&
+            recorder.Measure([compilation]() { return OH_NNCompilation_Build(compilation); });
+        OH_NNCompilation_Destroy(&compilation);
+        if (!isBuilt) {
+            state.SkipWithError("OH_NNCompilation_Build failed.");
+            break;
+        }
+    }
+    recorder.Report(prepareUs);
+}
+BENCHMARK(BM_StressCompile)->Args({0, 0})->Args({1, 0})->Args({0, 1000})->Args({1, 1000})
+    ->ThreadRange(1, STRESS_MAX_THREADS)->UseRealTime();
+
+// Arguments: simulated prepare latency in microseconds. Every build restores the same model cache.
+void BM_StressRestoreFromCache(benchmark::State& state)
+{
+    static bool hasCache = false;
+    static std::once_flag cacheFlag;
+    std::call_once(cacheFlag, []() {
+        (void)mkdir(STRESS_CACHE_DIR.c_str(), S_IRWXU);
+        InnerModel model;
+        if (BuildAddChainModel(model, STRESS_NODE_NUM) != OH_NN_SUCCESS) {
+            return;
+        }
+        OH_NNCompilation* compilation = OH_NNCompilation_Construct(reinterpret_cast<OH_NNModel*>(&model));
+        hasCache = (compilation != nullptr) &&
+            (OH_NNCompilation_SetDevice(compilation, GetBenchmarkBackendID()) == OH_NN_SUCCESS) &&
+            (OH_NNCompilation_SetCache(compilation, STRESS_CACHE_DIR.c_str(), STRESS_CACHE_VERSION) ==
+                OH_NN_SUCCESS) &&
+            (OH_NNCompilation_Build(compilation) == OH_NN_SUCCESS) &&
+            (OH_NN_FlushCacheWrites(0) == OH_NN_SUCCESS);
+        OH_NNCompilation_Destroy(&compilation);
+    });
+    if (!hasCache) {
+        state.SkipWithError("Failed to write the model cache.");
+        return;
+    }
+
+    uint32_t prepareUs = static_cast<uint32_t>(state.range(0));
+    SetSimulatedLatency(0, prepareUs);
+    LatencyRecorder recorder(state);
+    for (auto _ : state) {
+        OH_NNCompilation* compilation = OH_NNCompilation_ConstructForCache();
+        bool isRestored = (compilation != nullptr) &&
+            (OH_NNCompilation_SetDevice(compilation, GetBenchmarkBackendID()) == OH_NN_SUCCESS) &&
+            (OH_NNCompilation_SetCache(compilation, STRESS_CACHE_DIR.c_str(), STRESS_CACHE_VERSION) ==
+                OH_NN_SUCCESS) &&
+            recorder.Measure([compilation]() { return OH_NNCompilation_Build(compilation); });
+        OH_NNCompilation_Destroy(&compilation);
+        if (!isRestored) {
+            state.SkipWithError("Failed to restore the compilation from the model cache.");
+            break;
+        }
+    }
+    recorder.Report(prepareUs);
+}
+BENCHMARK(BM_StressRestoreFromCache)->Arg(0)->Arg(1000)->ThreadRange(1, STRESS_MAX_THREADS)->UseRealTime();
+} // namespace
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "aipp_config_registry.h"
+#include "neural_network_runtime_inner.h"
+#include "prepared_model.h"
+
+using namespace testing;
+using namespace testing::ext;
+using namespace OHOS::NeuralNetworkRuntime;
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace UnitTest {
+class MockIPreparedModel : public PreparedModel {
+public:
+    MOCK_METHOD1(ExportModelCache, OH_NN_ReturnCode(std::vector<Buffer>&));
+    MOCK_METHOD4(Run, OH_NN_ReturnCode(const std::vector<IOTensor>&,
+                                 const std::vector<IOTensor>&,
+                                 std::vector<std::vector<int32_t>>&,
+                                 std::vector<bool>&));
+    MOCK_METHOD4(Run, OH_NN_ReturnCode(const std::vector<NN_Tensor*>&,
+                                 const std::vector<NN_Tensor*>&,
+                                 std::vector<std::vector<int32_t>>&,
+                                 std::vector<bool>&));
+    MOCK_CONST_METHOD1(GetModelID, OH_NN_ReturnCode(uint32_t&));
+    MOCK_METHOD2(GetInputDimRanges, OH_NN_ReturnCode(std::vector<std::vector<uint32_t>>&,
+                                               std::vector<std::vector<uint32_t>>&));
+    MOCK_METHOD0(ReleaseBuiltModel, OH_NN_ReturnCode());
+    MOCK_METHOD1(SetAippString, OH_NN_ReturnCode(const std::string&));
+};
+
+class AippConfigRegistryTest : public testing::Test {
+public:
+    AippConfigRegistryTest() = default;
+    ~AippConfigRegistryTest() = default;
+};
+
+/**
+ * @tc.name: aipp_config_registry_register_001
+ * @tc.desc: Verify that an identical configuration shares one handle until it is unregistered as often as registered.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AippConfigRegistryTest, aipp_config_registry_register_001, TestSize.Level0)
+{
+    uint32_t firstHandle = AippConfigRegistry::INVALID_HANDLE;
+    uint32_t secondHandle = AippConfigRegistry::INVALID_HANDLE;
+    uint32_t otherHandle = AippConfigRegistry::INVALID_HANDLE;
+    EXPECT_EQ(OH_NN_SUCCESS, OH_NN_RegisterAippConfig("crop:0,0,224,224", &firstHandle));
+    EXPECT_EQ(OH_NN_SUCCESS, OH_NN_RegisterAippConfig("crop:0,0,224,224", &secondHandle));
+    EXPECT_EQ(OH_NN_SUCCESS, OH_NN_RegisterAippConfig("crop:0,0,112,112", &otherHandle));
+    EXPECT_NE(AippConfigRegistry::INVALID_HANDLE, firstHandle);
+    EXPECT_EQ(firstHandle, secondHandle);
+    EXPECT_NE(firstHandle, otherHandle);
+
+    std::shared_ptr<const std::string> aippStrings = AippConfigRegistry::GetInstance().Get(firstHandle);
+    ASSERT_NE(nullptr, aippStrings);
+    EXPECT_EQ("crop:0,0,224,224", *aippStrings);
+
+    EXPECT_EQ(OH_NN_SUCCESS, OH_NN_UnregisterAippConfig(firstHandle));
+    EXPECT_NE(nullptr, AippConfigRegistry::GetInstance().Get(firstHandle));
+    EXPECT_EQ(OH_NN_SUCCESS, OH_NN_UnregisterAippConfig(secondHandle));
+    EXPECT_EQ(nullptr, AippConfigRegistry::GetInstance().Get(firstHandle));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, OH_NN_UnregisterAippConfig(firstHandle));
+    EXPECT_EQ(OH_NN_SUCCESS, OH_NN_UnregisterAippConfig(otherHandle));
+}
+
+/**
+ * @tc.name: aipp_config_registry_register_002
+ * @tc.desc: Verify that an empty configuration cannot be registered.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AippConfigRegistryTest, aipp_config_registry_register_002, TestSize.Level0)
+{
+    uint32_t aippHandle = AippConfigRegistry::INVALID_HANDLE;
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, OH_NN_RegisterAippConfig(nullptr, &aippHandle));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, OH_NN_RegisterAippConfig("", &aippHandle));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, OH_NN_RegisterAippConfig("crop:0,0,224,224", nullptr));
+}
+
+/**
+ * @tc.name: aipp_config_registry_apply_001
+ * @tc.desc: Verify that a prepared model only receives the configuration string when the handle changes.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AippConfigRegistryTest, aipp_config_registry_apply_001, TestSize.Level0)
+{
+    MockIPreparedModel preparedModel;
+    EXPECT_CALL(preparedModel, SetAippString("first")).Times(2).WillRepeatedly(Return(OH_NN_SUCCESS));
+    EXPECT_CALL(preparedModel, SetAippString("second")).WillOnce(Return(OH_NN_SUCCESS));
+
+    const uint32_t firstHandle = 1;
+    const uint32_t secondHandle = 2;
+    EXPECT_EQ(OH_NN_SUCCESS, preparedModel.ApplyAippConfig(firstHandle, "first"));
+    EXPECT_EQ(OH_NN_SUCCESS, preparedModel.ApplyAippConfig(firstHandle, "first"));
+    EXPECT_EQ(OH_NN_SUCCESS, preparedModel.ApplyAippConfig(secondHandle, "second"));
+    EXPECT_EQ(OH_NN_SUCCESS, preparedModel.ApplyAippConfig(firstHandle, "first"));
+}
+
+/**
+ * @tc.name: aipp_config_registry_apply_002
+ * @tc.desc: Verify that unregistered strings are always sent and a failed send is retried by the next run.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AippConfigRegistryTest, aipp_config_registry_apply_002, TestSize.Level0)
+{
+    MockIPreparedModel preparedModel;
+    EXPECT_CALL(preparedModel, SetAippString("inline")).Times(2).WillRepeatedly(Return(OH_NN_SUCCESS));
+    EXPECT_CALL(preparedModel, SetAippString("first"))
+        .WillOnce(Return(OH_NN_FAILED))
+        .WillOnce(Return(OH_NN_SUCCESS));
+
+    EXPECT_EQ(OH_NN_SUCCESS, preparedModel.ApplyAippConfig(AippConfigRegistry::INVALID_HANDLE, "inline"));
+    EXPECT_EQ(OH_NN_SUCCESS, preparedModel.ApplyAippConfig(AippConfigRegistry::INVALID_HANDLE, "inline"));
+
+    const uint32_t firstHandle = 1;
+    EXPECT_EQ(OH_NN_FAILED, preparedModel.ApplyAippConfig(firstHandle, "first"));
+    EXPECT_EQ(OH_NN_SUCCESS, preparedModel.ApplyAippConfig(firstHandle, "first"));
+    EXPECT_EQ(OH_NN_SUCCESS, preparedModel.ApplyAippConfig(firstHandle, "first"));
+}
+
+/**
+ * @tc.name: aipp_config_registry_run_001
+ * @tc.desc: Verify that a run with a configuration applies it before running and does not run when it fails to apply.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AippConfigRegistryTest, aipp_config_registry_run_001, TestSize.Level0)
+{
+    MockIPreparedModel preparedModel;
+    {
+        InSequence sequence;
+        EXPECT_CALL(preparedModel, SetAippString("first")).WillOnce(Return(OH_NN_SUCCESS));
+        EXPECT_CALL(preparedModel, Run(Matcher<const std::vector<NN_Tensor*>&>(_), _, _, _))
+            .WillOnce(Return(OH_NN_SUCCESS));
+        EXPECT_CALL(preparedModel, SetAippString("second")).WillOnce(Return(OH_NN_FAILED));
+    }
+
+    std::vector<NN_Tensor*> inputs;
+    std::vector<NN_Tensor*> outputs;
+    std::vector<std::vector<int32_t>> outputsDims;
+    std::vector<bool> isOutputBufferEnough;
+    const uint32_t firstHandle = 1;
+    const uint32_t secondHandle = 2;
+    EXPECT_EQ(OH_NN_SUCCESS, preparedModel.RunWithAippConfig(firstHandle, "first", inputs, outputs, outputsDims,
+        isOutputBufferEnough));
+    EXPECT_EQ(OH_NN_FAILED, preparedModel.RunWithAippConfig(secondHandle, "second", inputs, outputs, outputsDims,
+        isOutputBufferEnough));
+}
+} // namespace UnitTest
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
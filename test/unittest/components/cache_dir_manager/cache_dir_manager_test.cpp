@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#include "nlohmann/json.hpp"
+
+#include "cache_dir_manager.h"
+#include "neural_network_runtime_inner.h"
+
+using namespace testing;
+using namespace testing::ext;
+using namespace OHOS::NeuralNetworkRuntime;
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace UnitTest {
+namespace {
+constexpr size_t MODEL_CACHE_SIZE = 1000;
+}
+
+class CacheDirManagerTest : public testing::Test {
+public:
+    CacheDirManagerTest() = default;
+    ~CacheDirManagerTest() = default;
+
+    void SetUp() override
+    {
+        char dirTemplate[] = "/data/local/tmp/nncache_dir_XXXXXX";
+        char* dir = mkdtemp(dirTemplate);
+        if (dir == nullptr) {
+            char tmpTemplate[] = "/tmp/nncache_dir_XXXXXX";
+            dir = mkdtemp(tmpTemplate);
+        }
+        ASSERT_NE(nullptr, dir);
+        m_cacheDir = dir;
+    }
+
+    void TearDown() override
+    {
+        std::error_code errorCode;
+        std::filesystem::remove_all(m_cacheDir, errorCode);
+    }
+
+    void WriteCache(const std::string& modelName, int64_t version) const
+    {
+        nlohmann::json cacheInfo;
+        cacheInfo["data"]["fileNumber"] = 1;
+        cacheInfo["data"]["version"] = version;
+        cacheInfo["data"]["deviceId"] = 0;
+        std::string data = cacheInfo["data"].dump();
+        cacheInfo["CheckSum"] = static_cast<int64_t>(CacheInfoGetCrc16(data.data(), data.length()));
+
+        std::ofstream(m_cacheDir + "/" + modelName + "0.nncache") << std::string(MODEL_CACHE_SIZE, 'x');
+        std::ofstream(m_cacheDir + "/" + modelName + "cache_info.nncache") << cacheInfo.dump();
+    }
+
+    bool HasCacheFiles(const std::string& modelName) const
+    {
+        return std::filesystem::exists(m_cacheDir + "/" + modelName + "cache_info.nncache") &&
+            std::filesystem::exists(m_cacheDir + "/" + modelName + "0.nncache");
+    }
+
+protected:
+    std::string m_cacheDir;
+};
+
+/**
+ * @tc.name: cache_dir_manager_get_entry_001
+ * @tc.desc: Verify that the entry of a cache is read from its cache info and a rewritten cache info is read again.
+ * @tc.type: FUNC
+ */
+HWTEST_F(CacheDirManagerTest, cache_dir_manager_get_entry_001, TestSize.Level0)
+{
+    WriteCache("a", 1);
+    CacheIndexEntry entry;
+    ASSERT_EQ(OH_NN_SUCCESS, CacheDirManager::GetInstance().GetEntry(m_cacheDir, "a", entry));
+    EXPECT_EQ(1, entry.fileNumber);
+    EXPECT_EQ(1, entry.version);
+    EXPECT_EQ(MODEL_CACHE_SIZE + entry.infoSize, entry.size);
+
+    WriteCache("a", 22);
+    ASSERT_EQ(OH_NN_SUCCESS, CacheDirManager::GetInstance().GetEntry(m_cacheDir, "a", entry));
+    EXPECT_EQ(22, entry.version);
+
+    std::ofstream(m_cacheDir + "/acache_info.nncache") << "{\"data\":{}}";
+    EXPECT_EQ(OH_NN_INVALID_FILE, CacheDirManager::GetInstance().GetEntry(m_cacheDir, "a", entry));
+    EXPECT_EQ(OH_NN_INVALID_FILE, CacheDirManager::GetInstance().GetEntry(m_cacheDir, "b", entry));
+    EXPECT_TRUE(std::filesystem::exists(m_cacheDir + "/.nncache_index"));
+}
+
+/**
+ * @tc.name: cache_dir_manager_size_limit_001
+ * @tc.desc: Verify that the least recently used caches are removed to fit into the limit and the saved one is kept.
+ * @tc.type: FUNC
+ */
+HWTEST_F(CacheDirManagerTest, cache_dir_manager_size_limit_001, TestSize.Level0)
+{
+    CacheDirManager& manager = CacheDirManager::GetInstance();
+    WriteCache("a", 1);
+    manager.OnCacheSaved(m_cacheDir, "a");
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    WriteCache("b", 1);
+    manager.OnCacheSaved(m_cacheDir, "b");
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    manager.OnCacheRestored(m_cacheDir, "a");
+
+    CacheIndexEntry entry;
+    ASSERT_EQ(OH_NN_SUCCESS, manager.GetEntry(m_cacheDir, "a", entry));
+    EXPECT_EQ(OH_NN_SUCCESS, manager.SetSizeLimit(m_cacheDir, entry.size * 2));
+    EXPECT_TRUE(HasCacheFiles("a"));
+    EXPECT_TRUE(HasCacheFiles("b"));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    WriteCache("c", 1);
+    manager.OnCacheSaved(m_cacheDir, "c");
+    EXPECT_TRUE(HasCacheFiles("a"));
+    EXPECT_FALSE(std::filesystem::exists(m_cacheDir + "/bcache_info.nncache"));
+    EXPECT_FALSE(std::filesystem::exists(m_cacheDir + "/b0.nncache"));
+    EXPECT_TRUE(HasCacheFiles("c"));
+
+    // A limit below the size of a single cache still keeps the cache which has just been saved.
+    EXPECT_EQ(OH_NN_SUCCESS, manager.SetSizeLimit(m_cacheDir, 1));
+    EXPECT_FALSE(HasCacheFiles("a"));
+    EXPECT_FALSE(HasCacheFiles("c"));
+    WriteCache("d", 1);
+    manager.OnCacheSaved(m_cacheDir, "d");
+    EXPECT_TRUE(HasCacheFiles("d"));
+
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, manager.SetSizeLimit(m_cacheDir + "/missing", 1));
+}
+
+/**
+ * @tc.name: cache_dir_manager_remove_cache_001
+ * @tc.desc: Verify that RemoveCache removes the cache info and the model cache files.
+ * @tc.type: FUNC
+ */
+HWTEST_F(CacheDirManagerTest, cache_dir_manager_remove_cache_001, TestSize.Level0)
+{
+    WriteCache("a", 1);
+    CacheIndexEntry entry;
+    ASSERT_EQ(OH_NN_SUCCESS, CacheDirManager::GetInstance().GetEntry(m_cacheDir, "a", entry));
+    CacheDirManager::GetInstance().RemoveCache(m_cacheDir, "a");
+    EXPECT_FALSE(std::filesystem::exists(m_cacheDir + "/acache_info.nncache"));
+    EXPECT_FALSE(std::filesystem::exists(m_cacheDir + "/a0.nncache"));
+    EXPECT_EQ(OH_NN_INVALID_FILE, CacheDirManager::GetInstance().GetEntry(m_cacheDir, "a", entry));
+}
+
+/**
+ * @tc.name: cache_dir_manager_pin_001
+ * @tc.desc: Verify that a pinned cache is not removed to fit into the limit until it is unpinned as often as pinned.
+ * @tc.type: FUNC
+ */
+HWTEST_F(CacheDirManagerTest, cache_dir_manager_pin_001, TestSize.Level0)
+{
+    CacheDirManager& manager = CacheDirManager::GetInstance();
+    WriteCache("a", 1);
+    manager.OnCacheSaved(m_cacheDir, "a");
+    manager.Pin(m_cacheDir, "a");
+    manager.Pin(m_cacheDir, "a");
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    WriteCache("b", 1);
+    manager.OnCacheSaved(m_cacheDir, "b");
+    EXPECT_EQ(OH_NN_SUCCESS, manager.SetSizeLimit(m_cacheDir, 1));
+    EXPECT_TRUE(HasCacheFiles("a"));
+    EXPECT_FALSE(HasCacheFiles("b"));
+
+    manager.Unpin(m_cacheDir, "a");
+    EXPECT_EQ(OH_NN_SUCCESS, manager.SetSizeLimit(m_cacheDir, 1));
+    EXPECT_TRUE(HasCacheFiles("a"));
+
+    manager.Unpin(m_cacheDir, "a");
+    EXPECT_EQ(OH_NN_SUCCESS, manager.SetSizeLimit(m_cacheDir, 1));
+    EXPECT_FALSE(HasCacheFiles("a"));
+}
+} // namespace UnitTest
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
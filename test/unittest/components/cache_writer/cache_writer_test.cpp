@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include "cache_writer.h"
+
+using namespace testing;
+using namespace testing::ext;
+using namespace OHOS::NeuralNetworkRuntime;
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace UnitTest {
+class CacheWriterTest : public testing::Test {
+public:
+    CacheWriterTest() = default;
+    ~CacheWriterTest() = default;
+};
+
+/**
+ * @tc.name: cache_writer_post_001
+ * @tc.desc: Verify that writes run in the order they are posted and Wait returns after the writes of its cache.
+ * @tc.type: FUNC
+ */
+HWTEST_F(CacheWriterTest, cache_writer_post_001, TestSize.Level0)
+{
+    CacheWriter& writer = CacheWriter::GetInstance();
+    std::vector<int> order;
+    std::mutex orderMutex;
+    auto write = [&order, &orderMutex](int id) {
+        return [&order, &orderMutex, id]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            std::lock_guard<std::mutex> lock(orderMutex);
+            order.emplace_back(id);
+            return OH_NN_SUCCESS;
+        };
+    };
+
+    std::string firstKey = CacheWriter::GetCacheKey("/data/post_001", "first");
+    std::string secondKey = CacheWriter::GetCacheKey("/data/post_001", "second");
+    writer.Post(firstKey, write(0));
+    writer.Post(secondKey, write(1));
+    writer.Post(firstKey, write(2));
+
+    writer.Wait(firstKey);
+    {
+        std::lock_guard<std::mutex> lock(orderMutex);
+        EXPECT_EQ((std::vector<int> {0, 1, 2}), order);
+    }
+
+    // Nothing is pending for a cache that has never been written.
+    writer.Wait(CacheWriter::GetCacheKey("/data/post_001", "none"));
+}
+
+/**
+ * @tc.name: cache_writer_flush_001
+ * @tc.desc: Verify that Flush times out while a write is running and succeeds once all writes have ended.
+ * @tc.type: FUNC
+ */
+HWTEST_F(CacheWriterTest, cache_writer_flush_001, TestSize.Level0)
+{
+    CacheWriter& writer = CacheWriter::GetInstance();
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::atomic<bool> isWritten {false};
+    writer.Post("flush_001", [released, &isWritten]() {
+        released.wait();
+        isWritten = true;
+        return OH_NN_FAILED;
+    });
+
+    EXPECT_EQ(OH_NN_TIMEOUT, writer.Flush(10));
+    release.set_value();
+    EXPECT_EQ(OH_NN_SUCCESS, writer.Flush(0));
+    EXPECT_TRUE(isWritten.load());
+}
+} // namespace UnitTest
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
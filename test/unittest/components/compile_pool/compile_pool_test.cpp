@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include <future>
+#include <mutex>
+#include <vector>
+
+#include "compile_pool.h"
+
+using namespace testing;
+using namespace testing::ext;
+using namespace OHOS::NeuralNetworkRuntime;
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace UnitTest {
+class CompilePoolTest : public testing::Test {
+public:
+    CompilePoolTest() = default;
+    ~CompilePoolTest() = default;
+};
+
+/**
+ * @tc.name: compile_pool_post_001
+ * @tc.desc: Verify that the queued builds of a busy backend start in the order of their priorities.
+ * @tc.type: FUNC
+ */
+HWTEST_F(CompilePoolTest, compile_pool_post_001, TestSize.Level0)
+{
+    CompilePool& pool = CompilePool::GetInstance();
+    const size_t backendID = 1001;
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::promise<void> started;
+    ASSERT_EQ(OH_NN_SUCCESS, pool.Post(backendID, 1, OH_NN_PRIORITY_NONE, [released, &started]() {
+        started.set_value();
+        released.wait();
+    }));
+    started.get_future().wait();
+
+    std::mutex orderMutex;
+    std::vector<OH_NN_Priority> order;
+    std::promise<void> allDone;
+    auto build = [&orderMutex, &order, &allDone](OH_NN_Priority priority) {
+        return [&orderMutex, &order, &allDone, priority]() {
+            std::lock_guard<std::mutex> lock(orderMutex);
+            order.emplace_back(priority);
+            if (order.size() == 4) {
+                allDone.set_value();
+            }
+        };
+    };
+    EXPECT_EQ(OH_NN_SUCCESS, pool.Post(backendID, 1, OH_NN_PRIORITY_LOW, build(OH_NN_PRIORITY_LOW)));
+    EXPECT_EQ(OH_NN_SUCCESS, pool.Post(backendID, 1, OH_NN_PRIORITY_HIGH, build(OH_NN_PRIORITY_HIGH)));
+    EXPECT_EQ(OH_NN_SUCCESS, pool.Post(backendID, 1, OH_NN_PRIORITY_MEDIUM, build(OH_NN_PRIORITY_MEDIUM)));
+    EXPECT_EQ(OH_NN_SUCCESS, pool.Post(backendID, 1, OH_NN_PRIORITY_HIGH, build(OH_NN_PRIORITY_HIGH)));
+
+    release.set_value();
+    allDone.get_future().wait();
+    std::vector<OH_NN_Priority> expected {OH_NN_PRIORITY_HIGH, OH_NN_PRIORITY_HIGH, OH_NN_PRIORITY_MEDIUM,
+        OH_NN_PRIORITY_LOW};
+    std::lock_guard<std::mutex> lock(orderMutex);
+    EXPECT_EQ(expected, order);
+}
+
+/**
+ * @tc.name: compile_pool_post_002
+ * @tc.desc: Verify that a busy backend does not hold back the builds of another backend.
+ * @tc.type: FUNC
+ */
+HWTEST_F(CompilePoolTest, compile_pool_post_002, TestSize.Level0)
+{
+    CompilePool& pool = CompilePool::GetInstance();
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::promise<void> blocked;
+    ASSERT_EQ(OH_NN_SUCCESS, pool.Post(1002, 1, OH_NN_PRIORITY_HIGH, [released, &blocked]() {
+        blocked.set_value();
+        released.wait();
+    }));
+    blocked.get_future().wait();
+
+    std::promise<void> otherDone;
+    ASSERT_EQ(OH_NN_SUCCESS, pool.Post(1003, 1, OH_NN_PRIORITY_LOW, [&otherDone]() { otherDone.set_value(); }));
+    otherDone.get_future().wait();
+    release.set_value();
+
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, pool.Post(1003, 1, OH_NN_PRIORITY_LOW, nullptr));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, pool.Post(1003, 0, OH_NN_PRIORITY_LOW, []() {}));
+}
+} // namespace UnitTest
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
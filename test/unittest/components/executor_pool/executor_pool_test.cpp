@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "executor_pool.h"
+
+using namespace testing;
+using namespace testing::ext;
+using namespace OHOS::NeuralNetworkRuntime;
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace UnitTest {
+class ExecutorPoolTest : public testing::Test {
+public:
+    ExecutorPoolTest() = default;
+    ~ExecutorPoolTest() = default;
+
+protected:
+    std::unique_ptr<ExecutorPool> CreatePool()
+    {
+        return std::make_unique<ExecutorPool>(
+            [this]() -> OH_NNExecutor* {
+                if (m_failCreate) {
+                    return nullptr;
+                }
+                ++m_created;
+                return reinterpret_cast<OH_NNExecutor*>(new int(0));
+            },
+            [this](OH_NNExecutor* executor) {
+                if (m_failReset) {
+                    return OH_NN_FAILED;
+                }
+                ++m_reset;
+                if (m_resetPool != nullptr) {
+                    m_borrowedOnReset = m_resetPool->GetBorrowedCount();
+                }
+                *reinterpret_cast<int*>(executor) = 0;
+                return OH_NN_SUCCESS;
+            },
+            [this](OH_NNExecutor* executor) {
+                ++m_destroyed;
+                delete reinterpret_cast<int*>(executor);
+            });
+    }
+
+protected:
+    std::atomic<size_t> m_created {0};
+    std::atomic<size_t> m_destroyed {0};
+    std::atomic<size_t> m_reset {0};
+    bool m_failCreate {false};
+    bool m_failReset {false};
+    ExecutorPool* m_resetPool {nullptr};
+    size_t m_borrowedOnReset {0};
+};
+
+/**
+ * @tc.name: executor_pool_init_001
+ * @tc.desc: Verify that Init creates minCount executors up front and rejects an invalid count range.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ExecutorPoolTest, executor_pool_init_001, TestSize.Level0)
+{
+    std::unique_ptr<ExecutorPool> pool = CreatePool();
+    OH_NNExecutor* executor = nullptr;
+    EXPECT_EQ(OH_NN_OPERATION_FORBIDDEN, pool->Acquire(1, &executor));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, pool->Init(0, 0));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, pool->Init(3, 2));
+
+    EXPECT_EQ(OH_NN_SUCCESS, pool->Init(2, 4));
+    EXPECT_EQ(2, m_created.load());
+    EXPECT_EQ(2, pool->GetExecutorCount());
+    EXPECT_EQ(2, pool->GetIdleCount());
+    EXPECT_EQ(OH_NN_OPERATION_FORBIDDEN, pool->Init(2, 4));
+
+    pool.reset();
+    EXPECT_EQ(2, m_destroyed.load());
+}
+
+/**
+ * @tc.name: executor_pool_init_002
+ * @tc.desc: Verify that the executors created so far are destroyed when Init fails to create one.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ExecutorPoolTest, executor_pool_init_002, TestSize.Level0)
+{
+    std::unique_ptr<ExecutorPool> pool = CreatePool();
+    m_failCreate = true;
+    EXPECT_EQ(OH_NN_FAILED, pool->Init(2, 2));
+    EXPECT_EQ(0, pool->GetIdleCount());
+}
+
+/**
+ * @tc.name: executor_pool_acquire_001
+ * @tc.desc: Verify that released executors are reused and new ones are created only up to maxCount.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ExecutorPoolTest, executor_pool_acquire_001, TestSize.Level0)
+{
+    std::unique_ptr<ExecutorPool> pool = CreatePool();
+    ASSERT_EQ(OH_NN_SUCCESS, pool->Init(1, 2));
+
+    OH_NNExecutor* first = nullptr;
+    EXPECT_EQ(OH_NN_SUCCESS, pool->Acquire(1, &first));
+    EXPECT_EQ(OH_NN_SUCCESS, pool->Release(first));
+    OH_NNExecutor* reused = nullptr;
+    EXPECT_EQ(OH_NN_SUCCESS, pool->Acquire(1, &reused));
+    EXPECT_EQ(first, reused);
+    EXPECT_EQ(1, m_created.load());
+
+    OH_NNExecutor* second = nullptr;
+    EXPECT_EQ(OH_NN_SUCCESS, pool->Acquire(1, &second));
+    EXPECT_NE(first, second);
+    EXPECT_EQ(2, pool->GetExecutorCount());
+
+    OH_NNExecutor* third = nullptr;
+    EXPECT_EQ(OH_NN_TIMEOUT, pool->Acquire(1, &third));
+    EXPECT_EQ(nullptr, third);
+    EXPECT_EQ(2, m_created.load());
+
+    EXPECT_EQ(OH_NN_SUCCESS, pool->Release(first));
+    EXPECT_EQ(OH_NN_SUCCESS, pool->Release(second));
+    EXPECT_EQ(2, pool->GetIdleCount());
+}
+
+/**
+ * @tc.name: executor_pool_acquire_002
+ * @tc.desc: Verify that a borrower waiting on a full pool gets the executor released by another thread.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ExecutorPoolTest, executor_pool_acquire_002, TestSize.Level0)
+{
+    std::unique_ptr<ExecutorPool> pool = CreatePool();
+    ASSERT_EQ(OH_NN_SUCCESS, pool->Init(1, 1));
+    OH_NNExecutor* borrowed = nullptr;
+    ASSERT_EQ(OH_NN_SUCCESS, pool->Acquire(0, &borrowed));
+
+    OH_NNExecutor* waited = nullptr;
+    OH_NN_ReturnCode waitRet = OH_NN_FAILED;
+    std::thread waiter([&pool, &waited, &waitRet]() { waitRet = pool->Acquire(0, &waited); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_EQ(OH_NN_SUCCESS, pool->Release(borrowed));
+    waiter.join();
+
+    EXPECT_EQ(OH_NN_SUCCESS, waitRet);
+    EXPECT_EQ(borrowed, waited);
+    EXPECT_EQ(1, m_created.load());
+    EXPECT_EQ(OH_NN_SUCCESS, pool->Release(waited));
+}
+
+/**
+ * @tc.name: executor_pool_release_001
+ * @tc.desc: Verify that an executor which is not borrowed from the pool cannot be released into it.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ExecutorPoolTest, executor_pool_release_001, TestSize.Level0)
+{
+    std::unique_ptr<ExecutorPool> pool = CreatePool();
+    ASSERT_EQ(OH_NN_SUCCESS, pool->Init(1, 1));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, pool->Release(nullptr));
+
+    int other = 0;
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, pool->Release(reinterpret_cast<OH_NNExecutor*>(&other)));
+
+    OH_NNExecutor* executor = nullptr;
+    ASSERT_EQ(OH_NN_SUCCESS, pool->Acquire(0, &executor));
+    EXPECT_EQ(OH_NN_SUCCESS, pool->Release(executor));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, pool->Release(executor));
+    EXPECT_EQ(1, pool->GetIdleCount());
+}
+
+/**
+ * @tc.name: executor_pool_release_002
+ * @tc.desc: Verify that a released executor is reset before reuse and destroyed when it fails to reset.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ExecutorPoolTest, executor_pool_release_002, TestSize.Level0)
+{
+    std::unique_ptr<ExecutorPool> pool = CreatePool();
+    ASSERT_EQ(OH_NN_SUCCESS, pool->Init(1, 1));
+
+    OH_NNExecutor* executor = nullptr;
+    ASSERT_EQ(OH_NN_SUCCESS, pool->Acquire(0, &executor));
+    EXPECT_EQ(1, pool->GetBorrowedCount());
+    // Stands for the state the borrower leaves on the executor.
+    *reinterpret_cast<int*>(executor) = 1;
+    EXPECT_EQ(OH_NN_SUCCESS, pool->Release(executor));
+    EXPECT_EQ(0, pool->GetBorrowedCount());
+    EXPECT_EQ(1, m_reset.load());
+
+    OH_NNExecutor* reused = nullptr;
+    ASSERT_EQ(OH_NN_SUCCESS, pool->Acquire(0, &reused));
+    EXPECT_EQ(executor, reused);
+    EXPECT_EQ(0, *reinterpret_cast<int*>(reused));
+
+    m_failReset = true;
+    EXPECT_EQ(OH_NN_SUCCESS, pool->Release(reused));
+    EXPECT_EQ(1, m_destroyed.load());
+    EXPECT_EQ(0, pool->GetExecutorCount());
+    EXPECT_EQ(0, pool->GetIdleCount());
+
+    OH_NNExecutor* created = nullptr;
+    EXPECT_EQ(OH_NN_SUCCESS, pool->Acquire(1, &created));
+    EXPECT_EQ(2, m_created.load());
+    m_failReset = false;
+    EXPECT_EQ(OH_NN_SUCCESS, pool->Release(created));
+}
+
+/**
+ * @tc.name: executor_pool_release_003
+ * @tc.desc: Verify that a released executor still counts as borrowed while it is reset, so that the owner does not
+ *           destroy the pool under it.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ExecutorPoolTest, executor_pool_release_003, TestSize.Level0)
+{
+    std::unique_ptr<ExecutorPool> pool = CreatePool();
+    ASSERT_EQ(OH_NN_SUCCESS, pool->Init(1, 1));
+    m_resetPool = pool.get();
+
+    OH_NNExecutor* executor = nullptr;
+    ASSERT_EQ(OH_NN_SUCCESS, pool->Acquire(0, &executor));
+    EXPECT_EQ(OH_NN_SUCCESS, pool->Release(executor));
+    EXPECT_EQ(1, m_reset.load());
+    EXPECT_EQ(1, m_borrowedOnReset);
+    EXPECT_EQ(0, pool->GetBorrowedCount());
+    EXPECT_EQ(1, pool->GetIdleCount());
+}
+} // namespace UnitTest
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
@@ -0,0 +1,329 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "backend_manager.h"
+#include "device.h"
+#include "hetero_partitioner.h"
+#include "hetero_prepared_model.h"
+#include "inner_model.h"
+#include "nnbackend.h"
+#include "utils.h"
+
+using namespace testing;
+using namespace testing::ext;
+using namespace OHOS::NeuralNetworkRuntime;
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace UnitTest {
+namespace {
+const std::string HETERO_TEST_DEVICE_NAME = "HeteroTestCPU";
+constexpr size_t PRIMARY_BACKEND_ID = 1;
+// LiteGraph tensor indices of the two-node model built by BuildAddChainModel().
+constexpr uint32_t GRAPH_INPUT_0 = 0;
+constexpr uint32_t GRAPH_INPUT_1 = 1;
+constexpr uint32_t GRAPH_MIDDLE = 2;
+constexpr uint32_t GRAPH_OUTPUT = 3;
+} // namespace
+
+class MockIDevice : public Device {
+public:
+    MOCK_METHOD1(GetDeviceName, OH_NN_ReturnCode(std::string&));
+    MOCK_METHOD1(GetVendorName, OH_NN_ReturnCode(std::string&));
+    MOCK_METHOD1(GetVersion, OH_NN_ReturnCode(std::string&));
+    MOCK_METHOD1(GetDeviceType, OH_NN_ReturnCode(OH_NN_DeviceType&));
+    MOCK_METHOD1(GetDeviceStatus, OH_NN_ReturnCode(DeviceStatus&));
+    MOCK_METHOD2(GetSupportedOperation, OH_NN_ReturnCode(std::shared_ptr<const mindspore::lite::LiteGraph>,
+        std::vector<bool>&));
+    MOCK_METHOD1(IsFloat16PrecisionSupported, OH_NN_ReturnCode(bool&));
+    MOCK_METHOD1(IsPerformanceModeSupported, OH_NN_ReturnCode(bool&));
+    MOCK_METHOD1(IsPrioritySupported, OH_NN_ReturnCode(bool&));
+    MOCK_METHOD1(IsDynamicInputSupported, OH_NN_ReturnCode(bool&));
+    MOCK_METHOD1(IsModelCacheSupported, OH_NN_ReturnCode(bool&));
+    MOCK_METHOD3(PrepareModel, OH_NN_ReturnCode(std::shared_ptr<const mindspore::lite::LiteGraph>,
+                                          const ModelConfig&,
+                                          std::shared_ptr<PreparedModel>&));
+    MOCK_METHOD3(PrepareModel, OH_NN_ReturnCode(const void*,
+                                          const ModelConfig&,
+                                          std::shared_ptr<PreparedModel>&));
+    MOCK_METHOD4(PrepareModelFromModelCache, OH_NN_ReturnCode(const std::vector<Buffer>&,
+                                                        const ModelConfig&,
+                                                        std::shared_ptr<PreparedModel>&,
+                                                        bool&));
+    MOCK_METHOD3(PrepareOfflineModel, OH_NN_ReturnCode(std::shared_ptr<const mindspore::lite::LiteGraph>,
+                                                 const ModelConfig&,
+                                                 std::shared_ptr<PreparedModel>&));
+    MOCK_METHOD1(AllocateBuffer, void*(size_t));
+    MOCK_METHOD2(AllocateTensorBuffer, void*(size_t, std::shared_ptr<TensorDesc>));
+    MOCK_METHOD2(AllocateTensorBuffer, void*(size_t, std::shared_ptr<NNTensor>));
+    MOCK_METHOD1(ReleaseBuffer, OH_NN_ReturnCode(const void*));
+    MOCK_METHOD2(AllocateBuffer, OH_NN_ReturnCode(size_t, int&));
+    MOCK_METHOD2(ReleaseBuffer, OH_NN_ReturnCode(int, size_t));
+    MOCK_METHOD1(ReadOpVersion, OH_NN_ReturnCode(int&));
+};
+
+class MockIPreparedModel : public PreparedModel {
+public:
+    MOCK_METHOD1(ExportModelCache, OH_NN_ReturnCode(std::vector<Buffer>&));
+    MOCK_METHOD4(Run, OH_NN_ReturnCode(const std::vector<IOTensor>&,
+                                 const std::vector<IOTensor>&,
+                                 std::vector<std::vector<int32_t>>&,
+                                 std::vector<bool>&));
+    MOCK_METHOD4(Run, OH_NN_ReturnCode(const std::vector<NN_Tensor*>&,
+                                 const std::vector<NN_Tensor*>&,
+                                 std::vector<std::vector<int32_t>>&,
+                                 std::vector<bool>&));
+    MOCK_CONST_METHOD1(GetModelID, OH_NN_ReturnCode(uint32_t&));
+    MOCK_METHOD2(GetInputDimRanges, OH_NN_ReturnCode(std::vector<std::vector<uint32_t>>&,
+                                               std::vector<std::vector<uint32_t>>&));
+    MOCK_METHOD0(ReleaseBuiltModel, OH_NN_ReturnCode());
+    MOCK_METHOD1(SetAippString, OH_NN_ReturnCode(const std::string&));
+};
+
+class HeteroPartitionerTest : public testing::Test {
+public:
+    HeteroPartitionerTest() = default;
+    ~HeteroPartitionerTest() = default;
+
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+
+    OH_NN_ReturnCode BuildAddChainModel(InnerModel& innerModel);
+
+protected:
+    static std::shared_ptr<MockIDevice> m_cpuDevice;
+    static size_t m_cpuBackendID;
+};
+
+std::shared_ptr<MockIDevice> HeteroPartitionerTest::m_cpuDevice = nullptr;
+size_t HeteroPartitionerTest::m_cpuBackendID = 0;
+
+void HeteroPartitionerTest::SetUpTestCase()
+{
+    m_cpuDevice = std::make_shared<MockIDevice>();
+    ON_CALL(*m_cpuDevice, GetDeviceName(_))
+        .WillByDefault(DoAll(SetArgReferee<0>(HETERO_TEST_DEVICE_NAME), Return(OH_NN_SUCCESS)));
+    ON_CALL(*m_cpuDevice, GetDeviceStatus(_)).WillByDefault(DoAll(SetArgReferee<0>(AVAILABLE),
+        Return(OH_NN_SUCCESS)));
+    ON_CALL(*m_cpuDevice, GetDeviceType(_)).WillByDefault(DoAll(SetArgReferee<0>(OH_NN_CPU),
+        Return(OH_NN_SUCCESS)));
+    testing::Mock::AllowLeak(m_cpuDevice.get());
+
+    m_cpuBackendID = std::hash<std::string>{}(HETERO_TEST_DEVICE_NAME);
+    BackendManager::GetInstance().RegisterBackend(HETERO_TEST_DEVICE_NAME, []() {
+        return CreateSharedPtr<NNBackend>(m_cpuDevice, m_cpuBackendID);
+    });
+}
+
+void HeteroPartitionerTest::TearDownTestCase()
+{
+    BackendManager::GetInstance().RemoveBackend(HETERO_TEST_DEVICE_NAME);
+    m_cpuDevice.reset();
+}
+
+// Builds output = (input0 + input1) + input1, two Add nodes joined by one intermediate tensor.
+OH_NN_ReturnCode HeteroPartitionerTest::BuildAddChainModel(InnerModel& innerModel)
+{
+    int32_t dims[2] = {1, 8};
+    OH_NN_Tensor tensor = {OH_NN_FLOAT32, 2, dims, nullptr, OH_NN_TENSOR};
+    int32_t activationDims = 1;
+    int8_t activationValue = OH_NN_FUSED_NONE;
+    OH_NN_Tensor activation = {OH_NN_INT8, 1, &activationDims, nullptr, OH_NN_ADD_ACTIVATIONTYPE};
+
+    // Model tensors: input0, input1, param0, middle, param1, output.
+    uint32_t param0 = 2;
+    uint32_t middle = 3;
+    uint32_t param1 = 4;
+    uint32_t output = 5;
+    OH_NN_ReturnCode ret = innerModel.AddTensor(tensor);
+    EXPECT_EQ(OH_NN_SUCCESS, ret);
+    ret = innerModel.AddTensor(tensor);
+    EXPECT_EQ(OH_NN_SUCCESS, ret);
+    ret = innerModel.AddTensor(activation);
+    EXPECT_EQ(OH_NN_SUCCESS, ret);
+    ret = innerModel.SetTensorValue(param0, &activationValue, sizeof(int8_t));
+    EXPECT_EQ(OH_NN_SUCCESS, ret);
+    ret = innerModel.AddTensor(tensor);
+    EXPECT_EQ(OH_NN_SUCCESS, ret);
+    ret = innerModel.AddTensor(activation);
+    EXPECT_EQ(OH_NN_SUCCESS, ret);
+    ret = innerModel.SetTensorValue(param1, &activationValue, sizeof(int8_t));
+    EXPECT_EQ(OH_NN_SUCCESS, ret);
+    ret = innerModel.AddTensor(tensor);
+    EXPECT_EQ(OH_NN_SUCCESS, ret);
+
+    uint32_t firstInputs[2] = {0, 1};
+    OH_NN_UInt32Array firstInputArray = {firstInputs, 2};
+    OH_NN_UInt32Array firstParamArray = {&param0, 1};
+    OH_NN_UInt32Array firstOutputArray = {&middle, 1};
+    ret = innerModel.AddOperation(OH_NN_OPS_ADD, firstParamArray, firstInputArray, firstOutputArray);
+    EXPECT_EQ(OH_NN_SUCCESS, ret);
+
+    uint32_t secondInputs[2] = {middle, 1};
+    OH_NN_UInt32Array secondInputArray = {secondInputs, 2};
+    OH_NN_UInt32Array secondParamArray = {&param1, 1};
+    OH_NN_UInt32Array secondOutputArray = {&output, 1};
+    ret = innerModel.AddOperation(OH_NN_OPS_ADD, secondParamArray, secondInputArray, secondOutputArray);
+    EXPECT_EQ(OH_NN_SUCCESS, ret);
+
+    ret = innerModel.SpecifyInputsAndOutputs(firstInputArray, secondOutputArray);
+    EXPECT_EQ(OH_NN_SUCCESS, ret);
+    return innerModel.Build();
+}
+
+/**
+ * @tc.name: hetero_partitioner_partition_001
+ * @tc.desc: Verify the nodes rejected by the primary device are moved to another backend.
+ * @tc.type: FUNC
+ */
+HWTEST_F(HeteroPartitionerTest, hetero_partitioner_partition_001, TestSize.Level0)
+{
+    InnerModel innerModel;
+    EXPECT_EQ(OH_NN_SUCCESS, BuildAddChainModel(innerModel));
+
+    std::shared_ptr<MockIDevice> primaryDevice = std::make_shared<MockIDevice>();
+    EXPECT_CALL(*primaryDevice, GetSupportedOperation(_, _))
+        .WillOnce(DoAll(SetArgReferee<1>(std::vector<bool>{true, false}), Return(OH_NN_SUCCESS)));
+    EXPECT_CALL(*m_cpuDevice, GetSupportedOperation(_, _))
+        .WillOnce(DoAll(SetArgReferee<1>(std::vector<bool>{true, true}), Return(OH_NN_SUCCESS)));
+
+    HeteroPartitioner partitioner(PRIMARY_BACKEND_ID, primaryDevice);
+    std::vector<HeteroSubgraph> subgraphs;
+    EXPECT_EQ(OH_NN_SUCCESS, partitioner.Partition(innerModel.GetLiteGraphs(), subgraphs));
+    ASSERT_EQ(2, subgraphs.size());
+
+    EXPECT_EQ(PRIMARY_BACKEND_ID, subgraphs[0].backendID);
+    EXPECT_EQ(1, subgraphs[0].liteGraph->all_nodes_.size());
+    EXPECT_EQ((std::vector<uint32_t>{GRAPH_INPUT_0, GRAPH_INPUT_1}), subgraphs[0].inputIndices);
+    EXPECT_EQ((std::vector<uint32_t>{GRAPH_MIDDLE}), subgraphs[0].outputIndices);
+
+    EXPECT_EQ(m_cpuBackendID, subgraphs[1].backendID);
+    EXPECT_EQ(1, subgraphs[1].liteGraph->all_nodes_.size());
+    EXPECT_EQ((std::vector<uint32_t>{GRAPH_MIDDLE, GRAPH_INPUT_1}), subgraphs[1].inputIndices);
+    EXPECT_EQ((std::vector<uint32_t>{GRAPH_OUTPUT}), subgraphs[1].outputIndices);
+    // Tensors of the subgraph are renumbered from zero.
+    EXPECT_EQ((std::vector<uint32_t>{0, 1}), subgraphs[1].liteGraph->input_indices_);
+    EXPECT_EQ((std::vector<uint32_t>{2}), subgraphs[1].liteGraph->output_indices_);
+
+    testing::Mock::AllowLeak(primaryDevice.get());
+}
+
+/**
+ * @tc.name: hetero_partitioner_partition_002
+ * @tc.desc: Verify the whole model stays on the primary device if it supports every node.
+ * @tc.type: FUNC
+ */
+HWTEST_F(HeteroPartitionerTest, hetero_partitioner_partition_002, TestSize.Level0)
+{
+    InnerModel innerModel;
+    EXPECT_EQ(OH_NN_SUCCESS, BuildAddChainModel(innerModel));
+
+    std::shared_ptr<MockIDevice> primaryDevice = std::make_shared<MockIDevice>();
+    EXPECT_CALL(*primaryDevice, GetSupportedOperation(_, _))
+        .WillOnce(DoAll(SetArgReferee<1>(std::vector<bool>{true, true}), Return(OH_NN_SUCCESS)));
+    EXPECT_CALL(*m_cpuDevice, GetSupportedOperation(_, _))
+        .WillOnce(DoAll(SetArgReferee<1>(std::vector<bool>{true, true}), Return(OH_NN_SUCCESS)));
+
+    HeteroPartitioner partitioner(PRIMARY_BACKEND_ID, primaryDevice);
+    std::vector<HeteroSubgraph> subgraphs;
+    EXPECT_EQ(OH_NN_SUCCESS, partitioner.Partition(innerModel.GetLiteGraphs(), subgraphs));
+    ASSERT_EQ(1, subgraphs.size());
+    EXPECT_EQ(PRIMARY_BACKEND_ID, subgraphs[0].backendID);
+    EXPECT_EQ(2, subgraphs[0].liteGraph->all_nodes_.size());
+    EXPECT_EQ((std::vector<uint32_t>{GRAPH_OUTPUT}), subgraphs[0].outputIndices);
+
+    testing::Mock::AllowLeak(primaryDevice.get());
+}
+
+/**
+ * @tc.name: hetero_partitioner_partition_003
+ * @tc.desc: Verify Partition fails if a node is not supported by any backend.
+ * @tc.type: FUNC
+ */
+HWTEST_F(HeteroPartitionerTest, hetero_partitioner_partition_003, TestSize.Level0)
+{
+    InnerModel innerModel;
+    EXPECT_EQ(OH_NN_SUCCESS, BuildAddChainModel(innerModel));
+
+    std::shared_ptr<MockIDevice> primaryDevice = std::make_shared<MockIDevice>();
+    EXPECT_CALL(*primaryDevice, GetSupportedOperation(_, _))
+        .WillOnce(DoAll(SetArgReferee<1>(std::vector<bool>{true, false}), Return(OH_NN_SUCCESS)));
+    EXPECT_CALL(*m_cpuDevice, GetSupportedOperation(_, _))
+        .WillOnce(DoAll(SetArgReferee<1>(std::vector<bool>{true, false}), Return(OH_NN_SUCCESS)));
+
+    HeteroPartitioner partitioner(PRIMARY_BACKEND_ID, primaryDevice);
+    std::vector<HeteroSubgraph> subgraphs;
+    EXPECT_EQ(OH_NN_FAILED, partitioner.Partition(innerModel.GetLiteGraphs(), subgraphs));
+    EXPECT_TRUE(subgraphs.empty());
+
+    testing::Mock::AllowLeak(primaryDevice.get());
+}
+
+/**
+ * @tc.name: hetero_prepared_model_stage_001
+ * @tc.desc: Verify the input dim ranges of the model are taken from the stages reading the model inputs.
+ * @tc.type: FUNC
+ */
+HWTEST_F(HeteroPartitionerTest, hetero_prepared_model_stage_001, TestSize.Level0)
+{
+    InnerModel innerModel;
+    EXPECT_EQ(OH_NN_SUCCESS, BuildAddChainModel(innerModel));
+
+    std::shared_ptr<MockIDevice> primaryDevice = std::make_shared<MockIDevice>();
+    EXPECT_CALL(*primaryDevice, GetSupportedOperation(_, _))
+        .WillOnce(DoAll(SetArgReferee<1>(std::vector<bool>{true, false}), Return(OH_NN_SUCCESS)));
+    EXPECT_CALL(*m_cpuDevice, GetSupportedOperation(_, _))
+        .WillOnce(DoAll(SetArgReferee<1>(std::vector<bool>{false, true}), Return(OH_NN_SUCCESS)));
+
+    HeteroPartitioner partitioner(PRIMARY_BACKEND_ID, primaryDevice);
+    std::vector<HeteroSubgraph> subgraphs;
+    std::shared_ptr<mindspore::lite::LiteGraph> liteGraph = innerModel.GetLiteGraphs();
+    EXPECT_EQ(OH_NN_SUCCESS, partitioner.Partition(liteGraph, subgraphs));
+    ASSERT_EQ(2, subgraphs.size());
+
+    HeteroPreparedModel heteroModel(liteGraph->input_indices_, liteGraph->output_indices_);
+    EXPECT_EQ(OH_NN_OPERATION_FORBIDDEN, heteroModel.Finish());
+
+    std::vector<std::vector<uint32_t>> firstDims = {{1, 8}, {1, 8}};
+    std::shared_ptr<MockIPreparedModel> firstModel = std::make_shared<MockIPreparedModel>();
+    EXPECT_CALL(*firstModel, GetInputDimRanges(_, _))
+        .WillOnce(DoAll(SetArgReferee<0>(firstDims), SetArgReferee<1>(firstDims), Return(OH_NN_SUCCESS)));
+    std::shared_ptr<MockIPreparedModel> secondModel = std::make_shared<MockIPreparedModel>();
+    EXPECT_CALL(*secondModel, GetInputDimRanges(_, _)).Times(0);
+
+    EXPECT_EQ(OH_NN_SUCCESS, heteroModel.AddStage(subgraphs[0], firstModel));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, heteroModel.Finish());
+    EXPECT_EQ(OH_NN_SUCCESS, heteroModel.AddStage(subgraphs[1], secondModel));
+    EXPECT_EQ(OH_NN_SUCCESS, heteroModel.Finish());
+
+    std::vector<std::vector<uint32_t>> minDims;
+    std::vector<std::vector<uint32_t>> maxDims;
+    EXPECT_EQ(OH_NN_SUCCESS, heteroModel.GetInputDimRanges(minDims, maxDims));
+    EXPECT_EQ(firstDims, minDims);
+    EXPECT_EQ(firstDims, maxDims);
+
+    std::vector<Buffer> modelCache;
+    EXPECT_EQ(OH_NN_OPERATION_FORBIDDEN, heteroModel.ExportModelCache(modelCache));
+
+    testing::Mock::AllowLeak(primaryDevice.get());
+    testing::Mock::AllowLeak(firstModel.get());
+    testing::Mock::AllowLeak(secondModel.get());
+}
+} // namespace UnitTest
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "host_preprocess.h"
+
+using namespace testing;
+using namespace testing::ext;
+using namespace OHOS::NeuralNetworkRuntime;
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace UnitTest {
+class HostPreprocessTest : public testing::Test {
+public:
+    HostPreprocessTest() = default;
+    ~HostPreprocessTest() = default;
+
+    static TensorDesc CreateDesc(OH_NN_DataType dataType, OH_NN_Format format, std::vector<int32_t> shape)
+    {
+        TensorDesc desc;
+        desc.SetDataType(dataType);
+        desc.SetFormat(format);
+        desc.SetShape(shape.data(), shape.size());
+        return desc;
+    }
+
+    static OH_NN_PreprocessConfig CreateConfig(OH_NN_PixelFormat srcFormat, uint32_t width, uint32_t height)
+    {
+        OH_NN_PreprocessConfig config {};
+        config.srcFormat = srcFormat;
+        config.srcWidth = width;
+        config.srcHeight = height;
+        config.dstFormat = OH_NN_PIXEL_FORMAT_RGB888;
+        for (size_t i = 0; i < 3; ++i) {
+            config.scale[i] = 1.0f;
+        }
+        config.quantScale = 1.0f;
+        return config;
+    }
+};
+
+/**
+ * @tc.name: host_preprocess_normalize_001
+ * @tc.desc: Verify that the vectorized normalization matches the scalar one, including the tail elements.
+ * @tc.type: FUNC
+ */
+HWTEST_F(HostPreprocessTest, host_preprocess_normalize_001, TestSize.Level0)
+{
+    const size_t count = 37;
+    std::vector<float> src(count);
+    std::vector<float> mean(count);
+    std::vector<float> scale(count);
+    for (size_t i = 0; i < count; ++i) {
+        src[i] = static_cast<float>(i * 7 % 256);
+        mean[i] = static_cast<float>(i % 3) * 10.0f;
+        scale[i] = 1.0f / static_cast<float>(i + 1);
+    }
+
+    std::vector<float> expected(count);
+    std::vector<float> actual(count);
+    HostPreprocess::NormalizeRowScalar(src.data(), mean.data(), scale.data(), expected.data(), count);
+    HostPreprocess::NormalizeRow(src.data(), mean.data(), scale.data(), actual.data(), count);
+    for (size_t i = 0; i < count; ++i) {
+        EXPECT_FLOAT_EQ(expected[i], actual[i]);
+    }
+}
+
+/**
+ * @tc.name: host_preprocess_run_001
+ * @tc.desc: Verify that a BGRA image is cropped, reordered to RGB and normalized into an NCHW float tensor.
+ * @tc.type: FUNC
+ */
+HWTEST_F(HostPreprocessTest, host_preprocess_run_001, TestSize.Level0)
+{
+    // 3x2 BGRA image with one padding byte per row, pixel (x, y) has B = 10x + y, G = 100, R = 200, A = 255.
+    const uint32_t stride = 13;
+    std::vector<uint8_t> image(stride * 2, 0);
+    for (uint32_t y = 0; y < 2; ++y) {
+        for (uint32_t x = 0; x < 3; ++x) {
+            uint8_t* pixel = image.data() + y * stride + x * 4;
+            pixel[0] = static_cast<uint8_t>(10 * x + y);
+            pixel[1] = 100;
+            pixel[2] = 200;
+            pixel[3] = 255;
+        }
+    }
+
+    OH_NN_PreprocessConfig config = CreateConfig(OH_NN_PIXEL_FORMAT_BGRA8888, 3, 2);
+    config.srcStride = stride;
+    config.cropX = 1;
+    config.mean[0] = 100.0f;
+    config.scale[0] = 0.5f;
+    TensorDesc desc = CreateDesc(OH_NN_FLOAT32, OH_NN_FORMAT_NCHW, {1, 3, 2, 2});
+    std::vector<float> data(12, -1.0f);
+    EXPECT_EQ(OH_NN_SUCCESS, HostPreprocess::Run(config, image.data(), image.size(), desc, data.data(),
+        data.size() * sizeof(float)));
+
+    const std::vector<float> expected {50.0f, 50.0f, 50.0f, 50.0f, 100.0f, 100.0f, 100.0f, 100.0f,
+                                       10.0f, 20.0f, 11.0f, 21.0f};
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_FLOAT_EQ(expected[i], data[i]);
+    }
+}
+
+/**
+ * @tc.name: host_preprocess_run_002
+ * @tc.desc: Verify that a gray image is resized bilinearly and quantized into an NHWC int8 tensor.
+ * @tc.type: FUNC
+ */
+HWTEST_F(HostPreprocessTest, host_preprocess_run_002, TestSize.Level0)
+{
+    const std::vector<uint8_t> image {0, 100, 200, 255};
+    OH_NN_PreprocessConfig config = CreateConfig(OH_NN_PIXEL_FORMAT_GRAY8, 4, 1);
+    config.dstFormat = OH_NN_PIXEL_FORMAT_GRAY8;
+    config.mean[0] = 128.0f;
+    config.quantScale = 2.0f;
+    config.quantZeroPoint = -10;
+    TensorDesc desc = CreateDesc(OH_NN_INT8, OH_NN_FORMAT_NHWC, {1, 1, 2, 1});
+    std::vector<int8_t> data(2, 0);
+    EXPECT_EQ(OH_NN_SUCCESS, HostPreprocess::Run(config, image.data(), image.size(), desc, data.data(),
+        data.size()));
+
+    // Samples fall at source x = 0.5 and x = 2.5, giving 50 and 227.5 before normalization.
+    EXPECT_EQ(-49, data[0]);
+    EXPECT_EQ(40, data[1]);
+}
+
+/**
+ * @tc.name: host_preprocess_run_003
+ * @tc.desc: Verify that invalid images, crops and tensors are rejected.
+ * @tc.type: FUNC
+ */
+HWTEST_F(HostPreprocessTest, host_preprocess_run_003, TestSize.Level0)
+{
+    std::vector<uint8_t> image(12, 0);
+    std::vector<float> data(12, 0.0f);
+    const size_t length = data.size() * sizeof(float);
+    TensorDesc desc = CreateDesc(OH_NN_FLOAT32, OH_NN_FORMAT_NHWC, {1, 2, 2, 3});
+
+    OH_NN_PreprocessConfig config = CreateConfig(OH_NN_PIXEL_FORMAT_RGB888, 2, 2);
+    EXPECT_EQ(OH_NN_SUCCESS, HostPreprocess::Run(config, image.data(), image.size(), desc, data.data(), length));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, HostPreprocess::Run(config, image.data(), image.size() - 1, desc,
+        data.data(), length));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, HostPreprocess::Run(config, image.data(), image.size(), desc, data.data(),
+        length - 1));
+
+    config.cropX = 1;
+    config.cropWidth = 2;
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, HostPreprocess::Run(config, image.data(), image.size(), desc, data.data(),
+        length));
+
+    config = CreateConfig(OH_NN_PIXEL_FORMAT_RGB888, 2, 2);
+    config.dstFormat = OH_NN_PIXEL_FORMAT_GRAY8;
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, HostPreprocess::Run(config, image.data(), image.size(), desc, data.data(),
+        length));
+
+    config = CreateConfig(OH_NN_PIXEL_FORMAT_RGB888, 2, 2);
+    TensorDesc fourChannels = CreateDesc(OH_NN_FLOAT32, OH_NN_FORMAT_NHWC, {1, 2, 2, 4});
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, HostPreprocess::Run(config, image.data(), image.size(), fourChannels,
+        data.data(), length));
+    TensorDesc quantized = CreateDesc(OH_NN_UINT8, OH_NN_FORMAT_NHWC, {1, 2, 2, 3});
+    config.quantScale = 0.0f;
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, HostPreprocess::Run(config, image.data(), image.size(), quantized,
+        data.data(), length));
+}
+
+/**
+ * @tc.name: host_preprocess_float_to_half_001
+ * @tc.desc: Verify the float16 conversion of normal, subnormal, overflowing and rounded values.
+ * @tc.type: FUNC
+ */
+HWTEST_F(HostPreprocessTest, host_preprocess_float_to_half_001, TestSize.Level0)
+{
+    EXPECT_EQ(0x0000, HostPreprocess::FloatToHalf(0.0f));
+    EXPECT_EQ(0x8000, HostPreprocess::FloatToHalf(-0.0f));
+    EXPECT_EQ(0x3c00, HostPreprocess::FloatToHalf(1.0f));
+    EXPECT_EQ(0xc000, HostPreprocess::FloatToHalf(-2.0f));
+    EXPECT_EQ(0x7bff, HostPreprocess::FloatToHalf(65504.0f));
+    EXPECT_EQ(0x7c00, HostPreprocess::FloatToHalf(1.0e6f));
+    EXPECT_EQ(0x0001, HostPreprocess::FloatToHalf(std::ldexp(1.0f, -24)));
+    EXPECT_EQ(0x0200, HostPreprocess::FloatToHalf(std::ldexp(1.0f, -15)));
+    // 1 + 2^-11 is halfway between 1 and the next half, it rounds to the even mantissa.
+    EXPECT_EQ(0x3c00, HostPreprocess::FloatToHalf(1.0f + std::ldexp(1.0f, -11)));
+    EXPECT_EQ(0x3c02, HostPreprocess::FloatToHalf(1.0f + 3.0f * std::ldexp(1.0f, -11)));
+}
+} // namespace UnitTest
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "latency_metrics.h"
+#include "neural_network_runtime_inner.h"
+
+using namespace testing;
+using namespace testing::ext;
+using namespace OHOS::NeuralNetworkRuntime;
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace UnitTest {
+class LatencyMetricsTest : public testing::Test {
+public:
+    LatencyMetricsTest() = default;
+    ~LatencyMetricsTest() = default;
+
+    void SetUp() override
+    {
+        OH_NN_ResetLatencyHistograms();
+    }
+};
+
+/**
+ * @tc.name: latency_metrics_bucket_001
+ * @tc.desc: Verify that durations are bucketed by powers of two microseconds.
+ * @tc.type: FUNC
+ */
+HWTEST_F(LatencyMetricsTest, latency_metrics_bucket_001, TestSize.Level0)
+{
+    EXPECT_EQ(0, LatencyMetrics::GetBucketIndex(999));
+    EXPECT_EQ(1, LatencyMetrics::GetBucketIndex(1000));
+    EXPECT_EQ(2, LatencyMetrics::GetBucketIndex(2000));
+    EXPECT_EQ(2, LatencyMetrics::GetBucketIndex(3999));
+    EXPECT_EQ(OH_NN_LATENCY_BUCKET_NUM - 1, LatencyMetrics::GetBucketIndex(UINT64_MAX));
+}
+
+/**
+ * @tc.name: latency_metrics_record_001
+ * @tc.desc: Verify that samples recorded by exited threads are kept in the histogram.
+ * @tc.type: FUNC
+ */
+HWTEST_F(LatencyMetricsTest, latency_metrics_record_001, TestSize.Level0)
+{
+    const size_t threadNum = 4;
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadNum; ++i) {
+        threads.emplace_back([]() {
+            LatencyMetrics::GetInstance().Record(OH_NN_STAGE_HDI_RUN, 1500);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    LatencyMetrics::GetInstance().Record(OH_NN_STAGE_HDI_RUN, 500);
+
+    OH_NN_LatencyHistogram histogram;
+    EXPECT_EQ(OH_NN_SUCCESS, OH_NN_GetLatencyHistogram(OH_NN_STAGE_HDI_RUN, &histogram));
+    EXPECT_EQ(threadNum + 1, histogram.count);
+    EXPECT_EQ(500, histogram.minNs);
+    EXPECT_EQ(1500, histogram.maxNs);
+    EXPECT_EQ(1, histogram.buckets[0]);
+    EXPECT_EQ(threadNum, histogram.buckets[1]);
+}
+
+/**
+ * @tc.name: latency_metrics_get_001
+ * @tc.desc: Verify that an invalid stage or a nullptr histogram is rejected.
+ * @tc.type: FUNC
+ */
+HWTEST_F(LatencyMetricsTest, latency_metrics_get_001, TestSize.Level0)
+{
+    OH_NN_LatencyHistogram histogram;
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, OH_NN_GetLatencyHistogram(OH_NN_STAGE_NUM, &histogram));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, OH_NN_GetLatencyHistogram(OH_NN_STAGE_BUILD, nullptr));
+}
+
+/**
+ * @tc.name: latency_metrics_dump_001
+ * @tc.desc: Verify that the JSON dump reports the required length and fails on a short buffer.
+ * @tc.type: FUNC
+ */
+HWTEST_F(LatencyMetricsTest, latency_metrics_dump_001, TestSize.Level0)
+{
+    {
+        NNRT_LATENCY_SCOPE(OH_NN_STAGE_BUILD);
+    }
+
+    size_t dumpLength = 0;
+    EXPECT_EQ(OH_NN_SUCCESS, OH_NN_DumpLatencyHistograms(nullptr, 0, &dumpLength));
+    EXPECT_LT(0, dumpLength);
+
+    std::vector<char> buffer(dumpLength);
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, OH_NN_DumpLatencyHistograms(buffer.data(), dumpLength - 1, &dumpLength));
+    EXPECT_EQ(OH_NN_SUCCESS, OH_NN_DumpLatencyHistograms(buffer.data(), buffer.size(), &dumpLength));
+
+    std::string json(buffer.data());
+    EXPECT_NE(std::string::npos, json.find("\"name\":\"build\",\"count\":1"));
+    EXPECT_NE(std::string::npos, json.find("\"output_shape_update\""));
+}
+} // namespace UnitTest
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
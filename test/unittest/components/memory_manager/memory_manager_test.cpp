@@ -19,6 +19,7 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <fcntl.h>
+#include <unistd.h>
 
 #include <gtest/gtest.h>
 
@@ -226,6 +227,115 @@ HWTEST_F(MemoryManagerTest, memorymanagertest_getmemory_003, TestSize.Level0)
     EXPECT_EQ('D', static_cast<char>(tmpData[3]));
     memoryManager->UnMapMemory(buffer);
 }
+
+/**
+ * @tc.name: memorymanagertest_remapusermemory_001
+ * @tc.desc: Verify that a remapped user buffer keeps its content and is shared with the fd until it is restored.
+ * @tc.type: FUNC
+ */
+HWTEST_F(MemoryManagerTest, memorymanagertest_remapusermemory_001, TestSize.Level0)
+{
+    size_t length = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    std::string data(length, '*');
+    std::string filename = "/data/log/memory-002.dat";
+    FileUtils fileUtils(filename);
+    fileUtils.WriteFile(data);
+    int fd = open(filename.c_str(), O_RDWR);
+    ASSERT_NE(-1, fd);
+
+    void* mapped = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    ASSERT_NE(MAP_FAILED, mapped);
+    char* buffer = static_cast<char*>(mapped);
+    buffer[0] = 'A';
+
+    const auto& memoryManager = MemoryManager::GetInstance();
+    EXPECT_EQ(OH_NN_SUCCESS, memoryManager->RemapUserMemory(buffer, length, fd));
+    EXPECT_TRUE(memoryManager->IsMapped(buffer));
+    EXPECT_EQ('A', buffer[0]);
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, memoryManager->UnMapMemory(buffer));
+
+    // Writes through the buffer reach the shared memory.
+    buffer[1] = 'B';
+    char shared[2] = {0};
+    EXPECT_EQ(2, pread(fd, shared, sizeof(shared), 0));
+    EXPECT_EQ('A', shared[0]);
+    EXPECT_EQ('B', shared[1]);
+
+    Memory memory;
+    EXPECT_EQ(OH_NN_SUCCESS, memoryManager->RestoreUserMemory(buffer, memory));
+    EXPECT_EQ(fd, memory.fd);
+    EXPECT_EQ(length, memory.length);
+    EXPECT_FALSE(memoryManager->IsMapped(buffer));
+    EXPECT_EQ('B', buffer[1]);
+
+    // The restored buffer is private again.
+    buffer[2] = 'C';
+    EXPECT_EQ(1, pread(fd, shared, 1, 2));
+    EXPECT_EQ('\0', shared[0]);
+
+    munmap(mapped, length);
+    close(fd);
+}
+
+/**
+ * @tc.name: memorymanagertest_remapusermemory_002
+ * @tc.desc: Verify that RemapUserMemory rejects buffers which are not page aligned.
+ * @tc.type: FUNC
+ */
+HWTEST_F(MemoryManagerTest, memorymanagertest_remapusermemory_002, TestSize.Level0)
+{
+    size_t length = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    void* mapped = mmap(nullptr, length * 2, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    ASSERT_NE(MAP_FAILED, mapped);
+    char* buffer = static_cast<char*>(mapped);
+
+    const auto& memoryManager = MemoryManager::GetInstance();
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, memoryManager->RemapUserMemory(buffer + 1, length, 0));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, memoryManager->RemapUserMemory(buffer, length + 1, 0));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, memoryManager->RemapUserMemory(buffer, length, -1));
+
+    Memory memory;
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, memoryManager->RestoreUserMemory(buffer, memory));
+    munmap(mapped, length * 2);
+}
+
+/**
+ * @tc.name: memorymanagertest_remapusermemory_003
+ * @tc.desc: Verify that RemapUserMemory rejects buffers which are not private anonymous memory.
+ * @tc.type: FUNC
+ */
+HWTEST_F(MemoryManagerTest, memorymanagertest_remapusermemory_003, TestSize.Level0)
+{
+    size_t length = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    std::string data(length, '*');
+    std::string filename = "/data/log/memory-003.dat";
+    FileUtils fileUtils(filename);
+    fileUtils.WriteFile(data);
+    int fd = open(filename.c_str(), O_RDWR);
+    ASSERT_NE(-1, fd);
+
+    const auto& memoryManager = MemoryManager::GetInstance();
+    void* fileMapped = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    ASSERT_NE(MAP_FAILED, fileMapped);
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, memoryManager->RemapUserMemory(fileMapped, length, fd));
+    EXPECT_FALSE(memoryManager->IsMapped(fileMapped));
+    EXPECT_EQ('*', static_cast<char*>(fileMapped)[0]);
+    munmap(fileMapped, length);
+
+    void* shared = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    ASSERT_NE(MAP_FAILED, shared);
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, memoryManager->RemapUserMemory(shared, length, fd));
+    EXPECT_FALSE(memoryManager->IsMapped(shared));
+    munmap(shared, length);
+
+    // A range which runs past the end of the private mapping is rejected as well.
+    void* mapped = mmap(nullptr, length * 2, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    ASSERT_NE(MAP_FAILED, mapped);
+    munmap(static_cast<char*>(mapped) + length, length);
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, memoryManager->RemapUserMemory(mapped, length * 2, fd));
+    munmap(mapped, length);
+    close(fd);
+}
 } // namespace UnitTest
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
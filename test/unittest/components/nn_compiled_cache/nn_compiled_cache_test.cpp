@@ -16,6 +16,12 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <filesystem>
+
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
 #include "nncompiled_cache.h"
 #include "device.h"
 #include "nnbackend.h"
@@ -256,6 +262,49 @@ HWTEST_F(NNCompiledCacheTest, nncompiledcachetest_save_004, TestSize.Level0)
     EXPECT_EQ(OH_NN_SUCCESS, retSave2);
 }
 
+/**
+ * @tc.name: nncompiledcachetest_save_005
+ * @tc.desc: Verify that Save removes the temporary directories left by dead writers and keeps those of live ones.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNCompiledCacheTest, nncompiledcachetest_save_005, TestSize.Level0)
+{
+    NNCompiledCache nncompiledCache;
+    BackendManager& backendManager = BackendManager::GetInstance();
+    std::function<std::shared_ptr<Backend>()> creator = Creator;
+    backendManager.RegisterBackend("mock", creator);
+    size_t backendID = 1;
+    EXPECT_EQ(OH_NN_SUCCESS, nncompiledCache.SetBackend(backendID));
+    nncompiledCache.SetModelName("stale");
+
+    pid_t deadPid = fork();
+    ASSERT_NE(-1, deadPid);
+    if (deadPid == 0) {
+        _exit(0);
+    }
+    ASSERT_EQ(deadPid, waitpid(deadPid, nullptr, 0));
+
+    std::string cacheDir = "/data/local/tmp/save_005";
+    ASSERT_EQ(0, mkdir(cacheDir.c_str(), S_IRWXU));
+    std::string deadDir = cacheDir + "/.staletmp_" + std::to_string(deadPid) + "_0";
+    std::string liveDir = cacheDir + "/.staletmp_" + std::to_string(getpid()) + "_1000";
+    ASSERT_EQ(0, mkdir(deadDir.c_str(), S_IRWXU));
+    ASSERT_EQ(0, mkdir(liveDir.c_str(), S_IRWXU));
+
+    Buffer buffer;
+    float dataArry[9] {0, 1, 2, 3, 4, 5, 6, 7, 8};
+    buffer.data = dataArry;
+    buffer.length = 1;
+    std::vector<Buffer> caches {buffer};
+    uint32_t cacheVersion = 1;
+    nncompiledCache.Save(caches, cacheDir, cacheVersion);
+
+    EXPECT_NE(0, access(deadDir.c_str(), F_OK));
+    EXPECT_EQ(0, access(liveDir.c_str(), F_OK));
+    std::error_code errorCode;
+    std::filesystem::remove_all(cacheDir, errorCode);
+}
+
 /**
  * @tc.name: nncompiledcachetest_restore_001
  * @tc.desc: Verify the QuantParams function return nullptr in case of fd -1.
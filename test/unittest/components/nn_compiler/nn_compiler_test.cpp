@@ -1091,6 +1091,55 @@ HWTEST_F(NNCompilerTest, nncompilertest_setextensionconfig_001, TestSize.Level0)
     testing::Mock::AllowLeak(device.get());
 }
 
+/**
+ * @tc.name: nncompilertest_setextensionconfig_002
+ * @tc.desc: Verify that io aliases are accepted with or without the terminating null character.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNCompilerTest, nncompilertest_setextensionconfig_002, TestSize.Level0)
+{
+    size_t backendID = 1;
+    std::shared_ptr<MockIDevice> device = std::make_shared<MockIDevice>();
+
+    NNCompiler* nncompiler = new (std::nothrow) NNCompiler(device, backendID);
+    EXPECT_NE(nullptr, nncompiler);
+
+    std::string aliases = "0:0;1:2";
+    std::unordered_map<std::string, std::vector<char>> configs;
+    configs["IoAlias"] = std::vector<char>(aliases.begin(), aliases.end());
+    EXPECT_EQ(OH_NN_SUCCESS, nncompiler->SetExtensionConfig(configs));
+
+    configs["IoAlias"] = std::vector<char>(aliases.c_str(), aliases.c_str() + aliases.size() + 1);
+    EXPECT_EQ(OH_NN_SUCCESS, nncompiler->SetExtensionConfig(configs));
+
+    delete nncompiler;
+    testing::Mock::AllowLeak(device.get());
+}
+
+/**
+ * @tc.name: nncompilertest_setextensionconfig_003
+ * @tc.desc: Verify that malformed io aliases and slots aliased twice are rejected.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNCompilerTest, nncompilertest_setextensionconfig_003, TestSize.Level0)
+{
+    size_t backendID = 1;
+    std::shared_ptr<MockIDevice> device = std::make_shared<MockIDevice>();
+
+    NNCompiler* nncompiler = new (std::nothrow) NNCompiler(device, backendID);
+    EXPECT_NE(nullptr, nncompiler);
+
+    std::vector<std::string> invalidAliases {"", "0", "0:1:2", "a:1", "-1:0", "0:0;0:1", "0:0;1:0"};
+    for (const std::string& aliases : invalidAliases) {
+        std::unordered_map<std::string, std::vector<char>> configs;
+        configs["IoAlias"] = std::vector<char>(aliases.begin(), aliases.end());
+        EXPECT_EQ(OH_NN_INVALID_PARAMETER, nncompiler->SetExtensionConfig(configs));
+    }
+
+    delete nncompiler;
+    testing::Mock::AllowLeak(device.get());
+}
+
 /**
  * @tc.name: nncompilertest_setoptions_001
  * @tc.desc: Verify the QuantParams function return nullptr in case of fd -1.
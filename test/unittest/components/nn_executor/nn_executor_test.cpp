@@ -15,8 +15,12 @@
 
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
+#include <sys/mman.h>
+#include <unistd.h>
 
+#include "backend_manager.h"
 #include "nnexecutor.h"
+#include "nntensor.h"
 #include "nncompiler.h"
 #include "nnbackend.h"
 #include "device.h"
@@ -2545,6 +2549,416 @@ HWTEST_F(NNExecutorTest, nnexecutortest_setextensionconfig_001, TestSize.Level0)
 
     testing::Mock::AllowLeak(mockIPreparedMode.get());
 }
+
+/**
+ * @tc.name: nnexecutortest_runsyncwithoutputshapes_001
+ * @tc.desc: Verify that RunSyncWithOutputShapes rejects a missing shape array or a zero maxRank.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNExecutorTest, nnexecutortest_runsyncwithoutputshapes_001, TestSize.Level0)
+{
+    size_t m_backendID {0};
+    std::shared_ptr<Device> m_device {nullptr};
+    std::shared_ptr<MockIPreparedModel> mockIPreparedMode = std::make_shared<MockIPreparedModel>();
+    EXPECT_CALL(*((MockIPreparedModel *) mockIPreparedMode.get()), GetInputDimRanges(::testing::_, ::testing::_))
+        .WillRepeatedly(::testing::Return(OH_NN_FAILED));
+    std::vector<std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType>> m_inputTensorDescs;
+    std::vector<std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType>> m_outputTensorDescs;
+    ExtensionConfig extensionConfig;
+    OH_NN_PerformanceMode performance {OH_NN_PERFORMANCE_EXTREME};
+    OH_NN_Priority priority {OH_NN_PRIORITY_HIGH};
+
+    NNExecutor* nnExecutor = new (std::nothrow) NNExecutor(
+        m_backendID, m_device, mockIPreparedMode, m_inputTensorDescs, m_outputTensorDescs, "", 0, extensionConfig,
+        false, performance, priority);
+
+    int32_t outputShapes[4] = {0};
+    uint32_t outputRanks[1] = {0};
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER,
+        nnExecutor->RunSyncWithOutputShapes(nullptr, 0, nullptr, 0, nullptr, 4, outputRanks));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER,
+        nnExecutor->RunSyncWithOutputShapes(nullptr, 0, nullptr, 0, outputShapes, 4, nullptr));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER,
+        nnExecutor->RunSyncWithOutputShapes(nullptr, 0, nullptr, 0, outputShapes, 0, outputRanks));
+
+    testing::Mock::AllowLeak(mockIPreparedMode.get());
+}
+
+/**
+ * @tc.name: nnexecutortest_runsyncwithoutputshapes_002
+ * @tc.desc: Verify that the output shapes of a run are returned to the caller and kept by the executor, while the
+ *           tensor desc shared with the compilation stays unchanged.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNExecutorTest, nnexecutortest_runsyncwithoutputshapes_002, TestSize.Level0)
+{
+    size_t m_backendID {0};
+    std::shared_ptr<Device> m_device {nullptr};
+    std::shared_ptr<MockIPreparedModel> mockIPreparedMode = std::make_shared<MockIPreparedModel>();
+    EXPECT_CALL(*((MockIPreparedModel *) mockIPreparedMode.get()), GetInputDimRanges(::testing::_, ::testing::_))
+        .WillRepeatedly(::testing::Return(OH_NN_FAILED));
+    EXPECT_CALL(*((MockIPreparedModel *) mockIPreparedMode.get()),
+        Run(::testing::Matcher<const std::vector<NN_Tensor*>&>(::testing::_), ::testing::_, ::testing::_,
+            ::testing::_))
+        .WillRepeatedly(Invoke([](const std::vector<NN_Tensor*>& inputs, const std::vector<NN_Tensor*>& outputs,
+            std::vector<std::vector<int32_t>>& outputsDims, std::vector<bool>& isOutputBufferEnough) {
+                outputsDims = {{2, 5}};
+                isOutputBufferEnough = {true};
+                return OH_NN_SUCCESS;
+            }));
+
+    int32_t dynamicDims[2] = {-1, 5};
+    std::shared_ptr<TensorDesc> sharedDesc = std::make_shared<TensorDesc>();
+    sharedDesc->SetShape(dynamicDims, 2);
+    std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType> pair1 {sharedDesc, OH_NN_TENSOR};
+    std::vector<std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType>> m_inputTensorDescs {pair1};
+    std::vector<std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType>> m_outputTensorDescs {pair1};
+    ExtensionConfig extensionConfig;
+    OH_NN_PerformanceMode performance {OH_NN_PERFORMANCE_EXTREME};
+    OH_NN_Priority priority {OH_NN_PRIORITY_HIGH};
+
+    NNExecutor* nnExecutor = new (std::nothrow) NNExecutor(
+        m_backendID, m_device, mockIPreparedMode, m_inputTensorDescs, m_outputTensorDescs, "", 0, extensionConfig,
+        false, performance, priority);
+
+    std::shared_ptr<MockIDevice> device = std::make_shared<MockIDevice>();
+    std::unique_ptr<NNBackend> hdiDevice = std::make_unique<NNBackend>(device, 1);
+    TensorDesc inputDesc;
+    TensorDesc outputDesc;
+    NN_Tensor* input = reinterpret_cast<NN_Tensor*>(hdiDevice->CreateTensor(&inputDesc));
+    NN_Tensor* output = reinterpret_cast<NN_Tensor*>(hdiDevice->CreateTensor(&outputDesc));
+
+    const size_t maxRank = 4;
+    int32_t outputShapes[maxRank] = {0};
+    uint32_t outputRanks[1] = {0};
+    EXPECT_EQ(OH_NN_SUCCESS,
+        nnExecutor->RunSyncWithOutputShapes(&input, 1, &output, 1, outputShapes, maxRank, outputRanks));
+    EXPECT_EQ(2, outputRanks[0]);
+    EXPECT_EQ(2, outputShapes[0]);
+    EXPECT_EQ(5, outputShapes[1]);
+
+    int32_t* shape = nullptr;
+    uint32_t shapeNum = 0;
+    EXPECT_EQ(OH_NN_SUCCESS, nnExecutor->GetOutputShape(0, &shape, &shapeNum));
+    ASSERT_EQ(2, shapeNum);
+    EXPECT_EQ(2, shape[0]);
+
+    int32_t* sharedShape = nullptr;
+    size_t sharedShapeNum = 0;
+    EXPECT_EQ(OH_NN_SUCCESS, sharedDesc->GetShape(&sharedShape, &sharedShapeNum));
+    EXPECT_EQ(-1, sharedShape[0]);
+
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER,
+        nnExecutor->RunSyncWithOutputShapes(&input, 1, &output, 1, outputShapes, 1, outputRanks));
+
+    testing::Mock::AllowLeak(mockIPreparedMode.get());
+    testing::Mock::AllowLeak(device.get());
+}
+
+/**
+ * @tc.name: nnexecutortest_setoutputsizehint_001
+ * @tc.desc: Verify that SetOutputSizeHint rejects an output index out of range and the growth stats start at zero.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNExecutorTest, nnexecutortest_setoutputsizehint_001, TestSize.Level0)
+{
+    size_t m_backendID {0};
+    std::shared_ptr<Device> m_device {nullptr};
+    std::shared_ptr<MockIPreparedModel> mockIPreparedMode = std::make_shared<MockIPreparedModel>();
+    EXPECT_CALL(*((MockIPreparedModel *) mockIPreparedMode.get()), GetInputDimRanges(::testing::_, ::testing::_))
+        .WillRepeatedly(::testing::Return(OH_NN_FAILED));
+    std::shared_ptr<TensorDesc> tensorDesc = std::make_shared<TensorDesc>();
+    std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType> pair1 {tensorDesc, OH_NN_TENSOR};
+    std::vector<std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType>> m_inputTensorDescs {pair1};
+    std::vector<std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType>> m_outputTensorDescs {pair1};
+    ExtensionConfig extensionConfig;
+    OH_NN_PerformanceMode performance {OH_NN_PERFORMANCE_EXTREME};
+    OH_NN_Priority priority {OH_NN_PRIORITY_HIGH};
+
+    NNExecutor* nnExecutor = new (std::nothrow) NNExecutor(
+        m_backendID, m_device, mockIPreparedMode, m_inputTensorDescs, m_outputTensorDescs, "", 0, extensionConfig,
+        false, performance, priority);
+
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, nnExecutor->SetOutputSizeHint(1, 1024));
+    EXPECT_EQ(OH_NN_SUCCESS, nnExecutor->SetOutputSizeHint(0, 1024));
+
+    OH_NN_OutputGrowthStats stats;
+    EXPECT_EQ(OH_NN_SUCCESS, nnExecutor->GetOutputGrowthStats(stats));
+    EXPECT_EQ(0, stats.rerunCount);
+    EXPECT_EQ(0, stats.grownTensorCount);
+    EXPECT_EQ(0, stats.grownBytes);
+    EXPECT_EQ(0, stats.failedRunCount);
+
+    testing::Mock::AllowLeak(mockIPreparedMode.get());
+}
+
+/**
+ * @tc.name: nnexecutortest_runsync_outputgrowth_001
+ * @tc.desc: Verify that a run with an output buffer too small is not repeated if the output has no size hint.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNExecutorTest, nnexecutortest_runsync_outputgrowth_001, TestSize.Level0)
+{
+    size_t m_backendID {0};
+    std::shared_ptr<Device> m_device {nullptr};
+    std::shared_ptr<MockIPreparedModel> mockIPreparedMode = std::make_shared<MockIPreparedModel>();
+    EXPECT_CALL(*((MockIPreparedModel *) mockIPreparedMode.get()), GetInputDimRanges(::testing::_, ::testing::_))
+        .WillRepeatedly(::testing::Return(OH_NN_FAILED));
+    EXPECT_CALL(*((MockIPreparedModel *) mockIPreparedMode.get()),
+        Run(::testing::Matcher<const std::vector<NN_Tensor*>&>(::testing::_), ::testing::_, ::testing::_,
+            ::testing::_))
+        .Times(1)
+        .WillOnce(Invoke([](const std::vector<NN_Tensor*>& inputs, const std::vector<NN_Tensor*>& outputs,
+            std::vector<std::vector<int32_t>>& outputsDims, std::vector<bool>& isOutputBufferEnough) {
+                isOutputBufferEnough = {false, true};
+                return OH_NN_MEMORY_ERROR;
+            }));
+
+    std::shared_ptr<TensorDesc> tensorDesc = std::make_shared<TensorDesc>();
+    std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType> pair1 {tensorDesc, OH_NN_TENSOR};
+    std::vector<std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType>> m_inputTensorDescs {pair1};
+    std::vector<std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType>> m_outputTensorDescs {pair1, pair1};
+    ExtensionConfig extensionConfig;
+    OH_NN_PerformanceMode performance {OH_NN_PERFORMANCE_EXTREME};
+    OH_NN_Priority priority {OH_NN_PRIORITY_HIGH};
+
+    NNExecutor* nnExecutor = new (std::nothrow) NNExecutor(
+        m_backendID, m_device, mockIPreparedMode, m_inputTensorDescs, m_outputTensorDescs, "", 0, extensionConfig,
+        false, performance, priority);
+    // Only the second output may grow, but the buffer of the first output is the one too small.
+    EXPECT_EQ(OH_NN_SUCCESS, nnExecutor->SetOutputSizeHint(1, 1024));
+
+    std::shared_ptr<MockIDevice> device = std::make_shared<MockIDevice>();
+    std::unique_ptr<NNBackend> hdiDevice = std::make_unique<NNBackend>(device, 1);
+    TensorDesc desc;
+    NN_Tensor* input = reinterpret_cast<NN_Tensor*>(hdiDevice->CreateTensor(&desc));
+    NN_Tensor* outputs[2] = {reinterpret_cast<NN_Tensor*>(hdiDevice->CreateTensor(&desc)),
+        reinterpret_cast<NN_Tensor*>(hdiDevice->CreateTensor(&desc))};
+    EXPECT_EQ(OH_NN_MEMORY_ERROR, nnExecutor->RunSync(&input, 1, outputs, 2));
+
+    OH_NN_OutputGrowthStats stats;
+    EXPECT_EQ(OH_NN_SUCCESS, nnExecutor->GetOutputGrowthStats(stats));
+    EXPECT_EQ(0, stats.rerunCount);
+    EXPECT_EQ(0, stats.grownTensorCount);
+
+    testing::Mock::AllowLeak(mockIPreparedMode.get());
+    testing::Mock::AllowLeak(device.get());
+}
+
+/**
+ * @tc.name: nnexecutortest_recycle_001
+ * @tc.desc: Verify that Recycle drops the output size hints, so that a later run is not repeated with grown outputs.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNExecutorTest, nnexecutortest_recycle_001, TestSize.Level0)
+{
+    size_t m_backendID {0};
+    std::shared_ptr<Device> m_device {nullptr};
+    std::shared_ptr<MockIPreparedModel> mockIPreparedMode = std::make_shared<MockIPreparedModel>();
+    EXPECT_CALL(*((MockIPreparedModel *) mockIPreparedMode.get()), GetInputDimRanges(::testing::_, ::testing::_))
+        .WillRepeatedly(::testing::Return(OH_NN_FAILED));
+    EXPECT_CALL(*((MockIPreparedModel *) mockIPreparedMode.get()),
+        Run(::testing::Matcher<const std::vector<NN_Tensor*>&>(::testing::_), ::testing::_, ::testing::_,
+            ::testing::_))
+        .Times(1)
+        .WillOnce(Invoke([](const std::vector<NN_Tensor*>& inputs, const std::vector<NN_Tensor*>& outputs,
+            std::vector<std::vector<int32_t>>& outputsDims, std::vector<bool>& isOutputBufferEnough) {
+                isOutputBufferEnough = {false};
+                return OH_NN_MEMORY_ERROR;
+            }));
+
+    std::shared_ptr<TensorDesc> tensorDesc = std::make_shared<TensorDesc>();
+    std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType> pair1 {tensorDesc, OH_NN_TENSOR};
+    std::vector<std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType>> m_inputTensorDescs {pair1};
+    std::vector<std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType>> m_outputTensorDescs {pair1};
+    ExtensionConfig extensionConfig;
+    OH_NN_PerformanceMode performance {OH_NN_PERFORMANCE_EXTREME};
+    OH_NN_Priority priority {OH_NN_PRIORITY_HIGH};
+
+    NNExecutor* nnExecutor = new (std::nothrow) NNExecutor(
+        m_backendID, m_device, mockIPreparedMode, m_inputTensorDescs, m_outputTensorDescs, "", 0, extensionConfig,
+        false, performance, priority);
+    // The hint of the previous borrower would let the output grow and the run be repeated.
+    EXPECT_EQ(OH_NN_SUCCESS, nnExecutor->SetOutputSizeHint(0, 1024));
+    EXPECT_EQ(OH_NN_SUCCESS, nnExecutor->Recycle());
+
+    std::shared_ptr<MockIDevice> device = std::make_shared<MockIDevice>();
+    std::unique_ptr<NNBackend> hdiDevice = std::make_unique<NNBackend>(device, 1);
+    TensorDesc desc;
+    NN_Tensor* input = reinterpret_cast<NN_Tensor*>(hdiDevice->CreateTensor(&desc));
+    NN_Tensor* output = reinterpret_cast<NN_Tensor*>(hdiDevice->CreateTensor(&desc));
+    EXPECT_EQ(OH_NN_MEMORY_ERROR, nnExecutor->RunSync(&input, 1, &output, 1));
+
+    OH_NN_OutputGrowthStats stats;
+    EXPECT_EQ(OH_NN_SUCCESS, nnExecutor->GetOutputGrowthStats(stats));
+    EXPECT_EQ(0, stats.rerunCount);
+    EXPECT_EQ(0, stats.grownTensorCount);
+
+    testing::Mock::AllowLeak(mockIPreparedMode.get());
+    testing::Mock::AllowLeak(device.get());
+}
+
+std::shared_ptr<Backend> CreateGrowthBackend()
+{
+    size_t backendID = 2;
+    std::string backendName = "mock_growth";
+    std::shared_ptr<MockIDevice> device = std::make_shared<MockIDevice>();
+    EXPECT_CALL(*((MockIDevice *) device.get()), GetDeviceStatus(::testing::_))
+        .WillRepeatedly(::testing::DoAll(::testing::SetArgReferee<0>(AVAILABLE), ::testing::Return(OH_NN_SUCCESS)));
+    EXPECT_CALL(*((MockIDevice *) device.get()), GetDeviceName(::testing::_))
+        .WillRepeatedly(::testing::DoAll(::testing::SetArgReferee<0>(backendName), ::testing::Return(OH_NN_SUCCESS)));
+    EXPECT_CALL(*((MockIDevice *) device.get()), GetVendorName(::testing::_))
+        .WillRepeatedly(::testing::DoAll(::testing::SetArgReferee<0>(backendName), ::testing::Return(OH_NN_SUCCESS)));
+    EXPECT_CALL(*((MockIDevice *) device.get()), GetVersion(::testing::_))
+        .WillRepeatedly(::testing::DoAll(::testing::SetArgReferee<0>(backendName), ::testing::Return(OH_NN_SUCCESS)));
+    // The initial output buffer and the grown one.
+    EXPECT_CALL(*((MockIDevice *) device.get()), AllocateBuffer(::testing::_, ::testing::Matcher<int&>(::testing::_)))
+        .Times(2)
+        .WillRepeatedly(Invoke([](size_t length, int& fd) {
+            fd = memfd_create("nnexecutortest_growth", 0);
+            return (fd >= 0 && ftruncate(fd, length) == 0) ? OH_NN_SUCCESS : OH_NN_MEMORY_ERROR;
+        }));
+    EXPECT_CALL(*((MockIDevice *) device.get()), ReleaseBuffer(::testing::Matcher<int>(::testing::_), ::testing::_))
+        .WillRepeatedly(Invoke([](int fd, size_t length) {
+            close(fd);
+            return OH_NN_SUCCESS;
+        }));
+    testing::Mock::AllowLeak(device.get());
+    return std::make_shared<NNBackend>(device, backendID);
+}
+
+/**
+ * @tc.name: nnexecutortest_runsync_outputgrowth_002
+ * @tc.desc: Verify that a short INT4 output grows to the packed size of the shape the device reports and the run is
+ *           repeated once.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNExecutorTest, nnexecutortest_runsync_outputgrowth_002, TestSize.Level0)
+{
+    BackendManager& backendManager = BackendManager::GetInstance();
+    ASSERT_EQ(OH_NN_SUCCESS, backendManager.RegisterBackend("mock_growth", CreateGrowthBackend));
+
+    // 64 INT4 elements take 32 bytes, twice the current 8 bytes would still be too small.
+    const std::vector<int32_t> reportedDims {4, 16};
+    const size_t initialSize = 8;
+    const size_t requiredSize = 32;
+    std::shared_ptr<MockIPreparedModel> mockIPreparedMode = std::make_shared<MockIPreparedModel>();
+    EXPECT_CALL(*((MockIPreparedModel *) mockIPreparedMode.get()), GetInputDimRanges(::testing::_, ::testing::_))
+        .WillRepeatedly(::testing::Return(OH_NN_FAILED));
+    EXPECT_CALL(*((MockIPreparedModel *) mockIPreparedMode.get()),
+        Run(::testing::Matcher<const std::vector<NN_Tensor*>&>(::testing::_), ::testing::_, ::testing::_,
+            ::testing::_))
+        .Times(2)
+        .WillOnce(Invoke([&reportedDims](const std::vector<NN_Tensor*>& inputs, const std::vector<NN_Tensor*>& outputs,
+            std::vector<std::vector<int32_t>>& outputsDims, std::vector<bool>& isOutputBufferEnough) {
+                outputsDims = {reportedDims};
+                isOutputBufferEnough = {false};
+                return OH_NN_MEMORY_ERROR;
+            }))
+        .WillOnce(Invoke([&reportedDims, requiredSize](const std::vector<NN_Tensor*>& inputs,
+            const std::vector<NN_Tensor*>& outputs, std::vector<std::vector<int32_t>>& outputsDims,
+            std::vector<bool>& isOutputBufferEnough) {
+                EXPECT_EQ(requiredSize, reinterpret_cast<NNTensor2_0*>(outputs[0])->GetSize());
+                outputsDims = {reportedDims};
+                isOutputBufferEnough = {true};
+                return OH_NN_SUCCESS;
+            }));
+
+    std::shared_ptr<TensorDesc> tensorDesc = std::make_shared<TensorDesc>();
+    std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType> pair1 {tensorDesc, OH_NN_TENSOR};
+    std::vector<std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType>> m_inputTensorDescs {pair1};
+    std::vector<std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType>> m_outputTensorDescs {pair1};
+    ExtensionConfig extensionConfig;
+    NNExecutor* nnExecutor = new (std::nothrow) NNExecutor(
+        2, nullptr, mockIPreparedMode, m_inputTensorDescs, m_outputTensorDescs, "", 0, extensionConfig,
+        false, OH_NN_PERFORMANCE_EXTREME, OH_NN_PRIORITY_HIGH);
+    EXPECT_EQ(OH_NN_SUCCESS, nnExecutor->SetOutputSizeHint(0, 1));
+
+    NNTensor2_0 input(2);
+    TensorDesc outputDesc;
+    outputDesc.SetDataType(OH_NN_INT4);
+    const int32_t outputShape[2] = {-1, 16};
+    outputDesc.SetShape(outputShape, 2);
+    NNTensor2_0 output(2);
+    ASSERT_EQ(OH_NN_SUCCESS, output.SetTensorDesc(&outputDesc));
+    ASSERT_EQ(OH_NN_SUCCESS, output.CreateData(initialSize));
+    NN_Tensor* inputs[1] = {reinterpret_cast<NN_Tensor*>(&input)};
+    NN_Tensor* outputs[1] = {reinterpret_cast<NN_Tensor*>(&output)};
+    EXPECT_EQ(OH_NN_SUCCESS, nnExecutor->RunSync(inputs, 1, outputs, 1));
+    EXPECT_EQ(requiredSize, output.GetSize());
+
+    OH_NN_OutputGrowthStats stats;
+    EXPECT_EQ(OH_NN_SUCCESS, nnExecutor->GetOutputGrowthStats(stats));
+    EXPECT_EQ(1, stats.rerunCount);
+    EXPECT_EQ(1, stats.grownTensorCount);
+    EXPECT_EQ(requiredSize - initialSize, stats.grownBytes);
+    EXPECT_EQ(0, stats.failedRunCount);
+
+    delete nnExecutor;
+    backendManager.RemoveBackend("mock_growth");
+    testing::Mock::AllowLeak(mockIPreparedMode.get());
+}
+
+/**
+ * @tc.name: nnexecutortest_runsync_outputgrowth_003
+ * @tc.desc: Verify that a short output created from a user fd is not grown even with a size hint, and the run is not
+ *           repeated.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNExecutorTest, nnexecutortest_runsync_outputgrowth_003, TestSize.Level0)
+{
+    std::shared_ptr<MockIPreparedModel> mockIPreparedMode = std::make_shared<MockIPreparedModel>();
+    EXPECT_CALL(*((MockIPreparedModel *) mockIPreparedMode.get()), GetInputDimRanges(::testing::_, ::testing::_))
+        .WillRepeatedly(::testing::Return(OH_NN_FAILED));
+    EXPECT_CALL(*((MockIPreparedModel *) mockIPreparedMode.get()),
+        Run(::testing::Matcher<const std::vector<NN_Tensor*>&>(::testing::_), ::testing::_, ::testing::_,
+            ::testing::_))
+        .Times(1)
+        .WillOnce(Invoke([](const std::vector<NN_Tensor*>& inputs, const std::vector<NN_Tensor*>& outputs,
+            std::vector<std::vector<int32_t>>& outputsDims, std::vector<bool>& isOutputBufferEnough) {
+                outputsDims = {{4, 16}};
+                isOutputBufferEnough = {false};
+                return OH_NN_MEMORY_ERROR;
+            }));
+
+    std::shared_ptr<TensorDesc> tensorDesc = std::make_shared<TensorDesc>();
+    std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType> pair1 {tensorDesc, OH_NN_TENSOR};
+    std::vector<std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType>> m_inputTensorDescs {pair1};
+    std::vector<std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType>> m_outputTensorDescs {pair1};
+    ExtensionConfig extensionConfig;
+    NNExecutor* nnExecutor = new (std::nothrow) NNExecutor(
+        0, nullptr, mockIPreparedMode, m_inputTensorDescs, m_outputTensorDescs, "", 0, extensionConfig,
+        false, OH_NN_PERFORMANCE_EXTREME, OH_NN_PRIORITY_HIGH);
+    EXPECT_EQ(OH_NN_SUCCESS, nnExecutor->SetOutputSizeHint(0, 1024));
+
+    const size_t fdSize = 32;
+    int fd = memfd_create("nnexecutortest_userfd", 0);
+    ASSERT_GE(fd, 0);
+    ASSERT_EQ(0, ftruncate(fd, fdSize));
+
+    NNTensor2_0 input(0);
+    TensorDesc outputDesc;
+    outputDesc.SetDataType(OH_NN_FLOAT32);
+    const int32_t outputShape[2] = {2, 4};
+    outputDesc.SetShape(outputShape, 2);
+    NNTensor2_0 output(0);
+    ASSERT_EQ(OH_NN_SUCCESS, output.SetTensorDesc(&outputDesc));
+    ASSERT_EQ(OH_NN_SUCCESS, output.CreateData(fd, fdSize, 0));
+    NN_Tensor* inputs[1] = {reinterpret_cast<NN_Tensor*>(&input)};
+    NN_Tensor* outputs[1] = {reinterpret_cast<NN_Tensor*>(&output)};
+    EXPECT_EQ(OH_NN_MEMORY_ERROR, nnExecutor->RunSync(inputs, 1, outputs, 1));
+    EXPECT_EQ(fd, output.GetFd());
+    EXPECT_EQ(fdSize, output.GetSize());
+
+    OH_NN_OutputGrowthStats stats;
+    EXPECT_EQ(OH_NN_SUCCESS, nnExecutor->GetOutputGrowthStats(stats));
+    EXPECT_EQ(0, stats.rerunCount);
+    EXPECT_EQ(0, stats.grownTensorCount);
+
+    delete nnExecutor;
+    close(fd);
+    testing::Mock::AllowLeak(mockIPreparedMode.get());
+}
 } // namespace UnitTest
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
@@ -1478,6 +1478,70 @@ HWTEST_F(NNTensor2Test, nntensor2_0test_checkdimranges_004, TestSize.Level0)
     OH_NN_ReturnCode ret = nnTensor->CheckDimRanges(minDimRanges, maxDimRanges);
     EXPECT_EQ(OH_NN_INVALID_PARAMETER, ret);
 }
+
+/**
+ * @tc.name: nntensor2_0test_growdata_001
+ * @tc.desc: Verify the GrowData function return failed in case of no data created.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNTensor2Test, nntensor2_0test_growdata_001, TestSize.Level0)
+{
+    LOGE("GrowData nntensor2_0test_growdata_001");
+    size_t backendId = 1;
+
+    NNTensor2_0* nnTensor = new (std::nothrow) NNTensor2_0(backendId);
+    EXPECT_NE(nullptr, nnTensor);
+
+    OH_NN_ReturnCode ret = nnTensor->GrowData(64);
+    EXPECT_EQ(OH_NN_FAILED, ret);
+}
+
+/**
+ * @tc.name: nntensor2_0test_growdata_002
+ * @tc.desc: Verify the GrowData function keeps the buffer in case of a size not larger than the current one.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNTensor2Test, nntensor2_0test_growdata_002, TestSize.Level0)
+{
+    LOGE("GrowData nntensor2_0test_growdata_002");
+    size_t backendId = 1;
+
+    NNTensor2_0* nnTensor = new (std::nothrow) NNTensor2_0(backendId);
+    EXPECT_NE(nullptr, nnTensor);
+
+    float dataArry[9] {0, 1, 2, 3, 4, 5, 6, 7, 8};
+    void* buffer = dataArry;
+    nnTensor->SetData(buffer);
+    nnTensor->SetSize(sizeof(dataArry));
+
+    OH_NN_ReturnCode ret = nnTensor->GrowData(sizeof(dataArry));
+    EXPECT_EQ(OH_NN_SUCCESS, ret);
+    EXPECT_EQ(buffer, nnTensor->GetData());
+    EXPECT_EQ(sizeof(dataArry), nnTensor->GetSize());
+}
+
+/**
+ * @tc.name: nntensor2_0test_growdata_003
+ * @tc.desc: Verify the GrowData function return invalid parameter in case of a size over the allocation limit.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNTensor2Test, nntensor2_0test_growdata_003, TestSize.Level0)
+{
+    LOGE("GrowData nntensor2_0test_growdata_003");
+    size_t backendId = 1;
+
+    NNTensor2_0* nnTensor = new (std::nothrow) NNTensor2_0(backendId);
+    EXPECT_NE(nullptr, nnTensor);
+
+    float dataArry[9] {0, 1, 2, 3, 4, 5, 6, 7, 8};
+    void* buffer = dataArry;
+    nnTensor->SetData(buffer);
+    nnTensor->SetSize(sizeof(dataArry));
+
+    OH_NN_ReturnCode ret = nnTensor->GrowData(ALLOCATE_BUFFER_LIMIT + 1);
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, ret);
+    EXPECT_EQ(buffer, nnTensor->GetData());
+}
 } // namespace UnitTest
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "prepared_model_registry.h"
+
+using namespace testing;
+using namespace testing::ext;
+using namespace OHOS::NeuralNetworkRuntime;
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace UnitTest {
+class MockIPreparedModel : public PreparedModel {
+public:
+    MOCK_METHOD1(ExportModelCache, OH_NN_ReturnCode(std::vector<Buffer>&));
+    MOCK_METHOD4(Run, OH_NN_ReturnCode(const std::vector<IOTensor>&,
+                                 const std::vector<IOTensor>&,
+                                 std::vector<std::vector<int32_t>>&,
+                                 std::vector<bool>&));
+    MOCK_METHOD4(Run, OH_NN_ReturnCode(const std::vector<NN_Tensor*>&,
+                                 const std::vector<NN_Tensor*>&,
+                                 std::vector<std::vector<int32_t>>&,
+                                 std::vector<bool>&));
+    MOCK_CONST_METHOD1(GetModelID, OH_NN_ReturnCode(uint32_t&));
+    MOCK_METHOD2(GetInputDimRanges, OH_NN_ReturnCode(std::vector<std::vector<uint32_t>>&,
+                                               std::vector<std::vector<uint32_t>>&));
+    MOCK_METHOD0(ReleaseBuiltModel, OH_NN_ReturnCode());
+    MOCK_METHOD1(SetAippString, OH_NN_ReturnCode(const std::string&));
+};
+
+class PreparedModelRegistryTest : public testing::Test {
+public:
+    PreparedModelRegistryTest() = default;
+    ~PreparedModelRegistryTest() = default;
+};
+
+/**
+ * @tc.name: prepared_model_registry_acquire_001
+ * @tc.desc: Verify that a prepared model is shared while it is held and the owner of its key is alive.
+ * @tc.type: FUNC
+ */
+HWTEST_F(PreparedModelRegistryTest, prepared_model_registry_acquire_001, TestSize.Level0)
+{
+    PreparedModelRegistry& registry = PreparedModelRegistry::GetInstance();
+    int prepareCount = 0;
+    auto prepare = [&prepareCount](std::shared_ptr<PreparedModel>& preparedModel) {
+        ++prepareCount;
+        preparedModel = std::make_shared<MockIPreparedModel>();
+        return OH_NN_SUCCESS;
+    };
+
+    std::shared_ptr<int> owner = std::make_shared<int>(0);
+    std::shared_ptr<PreparedModel> first;
+    std::shared_ptr<PreparedModel> second;
+    bool isPrepared = false;
+    EXPECT_EQ(OH_NN_SUCCESS, registry.Acquire("acquire_001", owner, prepare, first, isPrepared));
+    EXPECT_TRUE(isPrepared);
+    EXPECT_EQ(OH_NN_SUCCESS, registry.Acquire("acquire_001", owner, prepare, second, isPrepared));
+    EXPECT_FALSE(isPrepared);
+    EXPECT_EQ(1, prepareCount);
+    EXPECT_EQ(first, second);
+
+    // Another owner never matches the key, even at a reused address.
+    std::shared_ptr<PreparedModel> other;
+    EXPECT_EQ(OH_NN_SUCCESS, registry.Acquire("acquire_001", std::make_shared<int>(0), prepare, other, isPrepared));
+    EXPECT_TRUE(isPrepared);
+    EXPECT_NE(first, other);
+
+    // Released models are prepared again.
+    other.reset();
+    first.reset();
+    second.reset();
+    EXPECT_EQ(OH_NN_SUCCESS, registry.Acquire("acquire_001", owner, prepare, first, isPrepared));
+    EXPECT_TRUE(isPrepared);
+    EXPECT_EQ(3, prepareCount);
+}
+
+/**
+ * @tc.name: prepared_model_registry_acquire_002
+ * @tc.desc: Verify that concurrent acquisitions of a key run one preparation.
+ * @tc.type: FUNC
+ */
+HWTEST_F(PreparedModelRegistryTest, prepared_model_registry_acquire_002, TestSize.Level0)
+{
+    constexpr size_t threadNum = 8;
+    std::atomic<int> prepareCount {0};
+    auto prepare = [&prepareCount](std::shared_ptr<PreparedModel>& preparedModel) {
+        ++prepareCount;
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        preparedModel = std::make_shared<MockIPreparedModel>();
+        return OH_NN_SUCCESS;
+    };
+
+    std::vector<std::shared_ptr<PreparedModel>> models(threadNum);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadNum; ++i) {
+        threads.emplace_back([&models, &prepare, i]() {
+            bool isPrepared = false;
+            PreparedModelRegistry::GetInstance().Acquire("acquire_002", nullptr, prepare, models[i], isPrepared);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(1, prepareCount.load());
+    for (const auto& model : models) {
+        ASSERT_NE(nullptr, model);
+        EXPECT_EQ(models[0], model);
+    }
+}
+
+/**
+ * @tc.name: prepared_model_registry_acquire_003
+ * @tc.desc: Verify that failed or empty preparations are not remembered and an empty key is rejected.
+ * @tc.type: FUNC
+ */
+HWTEST_F(PreparedModelRegistryTest, prepared_model_registry_acquire_003, TestSize.Level0)
+{
+    PreparedModelRegistry& registry = PreparedModelRegistry::GetInstance();
+    auto fail = [](std::shared_ptr<PreparedModel>& preparedModel) {
+        return OH_NN_FAILED;
+    };
+    auto prepare = [](std::shared_ptr<PreparedModel>& preparedModel) {
+        preparedModel = std::make_shared<MockIPreparedModel>();
+        return OH_NN_SUCCESS;
+    };
+
+    std::shared_ptr<PreparedModel> model;
+    bool isPrepared = false;
+    EXPECT_EQ(OH_NN_FAILED, registry.Acquire("acquire_003", nullptr, fail, model, isPrepared));
+    EXPECT_EQ(nullptr, model);
+    EXPECT_EQ(OH_NN_SUCCESS, registry.Acquire("acquire_003", nullptr, prepare, model, isPrepared));
+    EXPECT_TRUE(isPrepared);
+    EXPECT_NE(nullptr, model);
+
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, registry.Acquire("", nullptr, prepare, model, isPrepared));
+
+    // A preparation without a model is not shared.
+    int emptyCount = 0;
+    auto prepareEmpty = [&emptyCount](std::shared_ptr<PreparedModel>& preparedModel) {
+        ++emptyCount;
+        return OH_NN_SUCCESS;
+    };
+    std::shared_ptr<PreparedModel> empty;
+    EXPECT_EQ(OH_NN_SUCCESS, registry.Acquire("acquire_003_empty", nullptr, prepareEmpty, empty, isPrepared));
+    EXPECT_EQ(OH_NN_SUCCESS, registry.Acquire("acquire_003_empty", nullptr, prepareEmpty, empty, isPrepared));
+    EXPECT_TRUE(isPrepared);
+    EXPECT_EQ(nullptr, empty);
+    EXPECT_EQ(2, emptyCount);
+}
+} // namespace UnitTest
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
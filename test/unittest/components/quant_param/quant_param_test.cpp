@@ -15,6 +15,8 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
+
 #include "quant_param.h"
 
 using namespace testing;
@@ -138,6 +140,78 @@ HWTEST_F(QuantParamsTest, quantparamstest_copytocompat_002, TestSize.Level0)
     EXPECT_EQ(OH_NN_SUCCESS, quantParams.CopyToCompat(compatQuantParams));
 }
 
+/**
+ * @tc.name: quantparamstest_copytogroup_001
+ * @tc.desc: Verify that group quantization keeps contiguous scales and drops all-zero zero points.
+ * @tc.type: FUNC
+ */
+HWTEST_F(QuantParamsTest, quantparamstest_copytogroup_001, TestSize.Level0)
+{
+    QuantParams quantParams;
+    GroupQuantParam groupQuantParam;
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, quantParams.CopyToGroup(groupQuantParam));
+
+    quantParams.SetGroup(-1, 32);
+    quantParams.SetScales({0.5, 0.25, 0.125});
+    quantParams.SetZeroPoints({0, 0, 0});
+    quantParams.SetNumBits({4});
+    EXPECT_TRUE(quantParams.IsGroupQuant());
+    EXPECT_EQ(OH_NN_SUCCESS, quantParams.CopyToGroup(groupQuantParam));
+    EXPECT_EQ(-1, groupQuantParam.axis);
+    EXPECT_EQ(static_cast<uint32_t>(32), groupQuantParam.groupSize);
+    EXPECT_EQ(static_cast<uint32_t>(4), groupQuantParam.numBits);
+    EXPECT_EQ(static_cast<size_t>(3), groupQuantParam.GetGroupCount());
+    EXPECT_TRUE(groupQuantParam.zeroPoints.empty());
+    EXPECT_DOUBLE_EQ(0.25, groupQuantParam.GetScale(1));
+    EXPECT_EQ(0, groupQuantParam.GetZeroPoint(2));
+
+    quantParams.SetNumBits({4, 8, 4});
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, quantParams.CopyToGroup(groupQuantParam));
+    quantParams.SetNumBits({4});
+    quantParams.SetZeroPoints({1, 2});
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, quantParams.CopyToGroup(groupQuantParam));
+}
+
+/**
+ * @tc.name: quantparamstest_copytogroup_002
+ * @tc.desc: Verify that half scales are decoded and cannot be mixed with double scales.
+ * @tc.type: FUNC
+ */
+HWTEST_F(QuantParamsTest, quantparamstest_copytogroup_002, TestSize.Level0)
+{
+    QuantParams quantParams;
+    quantParams.SetGroup(0, 0);
+    // 1.0, 0.5 and the smallest subnormal half.
+    quantParams.SetHalfScales({0x3c00, 0x3800, 0x0001});
+    quantParams.SetNumBits({8});
+    GroupQuantParam groupQuantParam;
+    EXPECT_EQ(OH_NN_SUCCESS, quantParams.CopyToGroup(groupQuantParam));
+    EXPECT_TRUE(groupQuantParam.scales.empty());
+    EXPECT_DOUBLE_EQ(1.0, groupQuantParam.GetScale(0));
+    EXPECT_DOUBLE_EQ(0.5, groupQuantParam.GetScale(1));
+    EXPECT_DOUBLE_EQ(std::ldexp(1.0, -24), groupQuantParam.GetScale(2));
+
+    std::vector<OHOS::NeuralNetworkRuntime::QuantParam> compatQuantParams;
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, quantParams.CopyToCompat(compatQuantParams));
+    quantParams.SetScales({1.0, 0.5, 0.25});
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, quantParams.CopyToGroup(groupQuantParam));
+}
+
+/**
+ * @tc.name: quantparamstest_countgroups_001
+ * @tc.desc: Verify the group count of per-channel and blocked layouts.
+ * @tc.type: FUNC
+ */
+HWTEST_F(QuantParamsTest, quantparamstest_countgroups_001, TestSize.Level0)
+{
+    const std::vector<int32_t> dimensions = {64, 100};
+    EXPECT_EQ(static_cast<size_t>(64), GroupQuantParam::CountGroups(dimensions, 0, 0));
+    EXPECT_EQ(static_cast<size_t>(64 * 4), GroupQuantParam::CountGroups(dimensions, 1, 32));
+    EXPECT_EQ(static_cast<size_t>(64 * 4), GroupQuantParam::CountGroups(dimensions, -1, 32));
+    EXPECT_EQ(static_cast<size_t>(0), GroupQuantParam::CountGroups(dimensions, 2, 32));
+    EXPECT_EQ(static_cast<size_t>(0), GroupQuantParam::CountGroups({64, -1}, 1, 32));
+}
+
 } // namespace UnitTest
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "state_tensors.h"
+
+using namespace testing;
+using namespace testing::ext;
+using namespace OHOS::NeuralNetworkRuntime;
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace UnitTest {
+class StateTensorsTest : public testing::Test {
+public:
+    StateTensorsTest() = default;
+    ~StateTensorsTest() = default;
+};
+
+/**
+ * @tc.name: state_tensors_parse_bindings_001
+ * @tc.desc: Verify that replacing and appending bindings are parsed.
+ * @tc.type: FUNC
+ */
+HWTEST_F(StateTensorsTest, state_tensors_parse_bindings_001, TestSize.Level0)
+{
+    std::vector<StateBinding> bindings;
+    EXPECT_EQ(OH_NN_SUCCESS, StateTensors::ParseBindings("0:1;2:3:2;", bindings));
+    ASSERT_EQ(2, bindings.size());
+    EXPECT_EQ(0, bindings[0].outputIndex);
+    EXPECT_EQ(1, bindings[0].inputIndex);
+    EXPECT_EQ(-1, bindings[0].appendAxis);
+    EXPECT_EQ(2, bindings[1].outputIndex);
+    EXPECT_EQ(3, bindings[1].inputIndex);
+    EXPECT_EQ(2, bindings[1].appendAxis);
+}
+
+/**
+ * @tc.name: state_tensors_parse_bindings_002
+ * @tc.desc: Verify that malformed bindings and slots bound twice are rejected.
+ * @tc.type: FUNC
+ */
+HWTEST_F(StateTensorsTest, state_tensors_parse_bindings_002, TestSize.Level0)
+{
+    std::vector<StateBinding> bindings;
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, StateTensors::ParseBindings("", bindings));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, StateTensors::ParseBindings("0", bindings));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, StateTensors::ParseBindings("0:1:2:3", bindings));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, StateTensors::ParseBindings("0:a", bindings));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, StateTensors::ParseBindings("0:-1", bindings));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, StateTensors::ParseBindings("0:1;0:2", bindings));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, StateTensors::ParseBindings("0:1;1:1", bindings));
+}
+
+/**
+ * @tc.name: state_tensors_append_001
+ * @tc.desc: Verify that a slice is appended to the end of a state whose leading dims are 1.
+ * @tc.type: FUNC
+ */
+HWTEST_F(StateTensorsTest, state_tensors_append_001, TestSize.Level0)
+{
+    std::vector<float> state(8, 0.0f);
+    state[0] = 1.0f;
+    state[1] = 2.0f;
+    std::vector<int32_t> stateDims {1, 1, 2};
+    std::vector<float> slice {3.0f};
+    std::vector<int32_t> sliceDims {1, 1, 1};
+
+    EXPECT_EQ(OH_NN_SUCCESS, StateTensors::AppendAlongAxis(state.data(), state.size() * sizeof(float), stateDims,
+        slice.data(), sliceDims, 2, sizeof(float)));
+    EXPECT_EQ(3, stateDims[2]);
+    EXPECT_EQ(1.0f, state[0]);
+    EXPECT_EQ(2.0f, state[1]);
+    EXPECT_EQ(3.0f, state[2]);
+}
+
+/**
+ * @tc.name: state_tensors_append_002
+ * @tc.desc: Verify that the rows of a state are moved apart in place when the dims before the axis are not 1.
+ * @tc.type: FUNC
+ */
+HWTEST_F(StateTensorsTest, state_tensors_append_002, TestSize.Level0)
+{
+    // Two heads of two tokens with a head size of 2, one token is appended to each head.
+    std::vector<int32_t> state(12, 0);
+    std::vector<int32_t> initial {1, 2, 3, 4, 5, 6, 7, 8};
+    std::copy(initial.begin(), initial.end(), state.begin());
+    std::vector<int32_t> stateDims {1, 2, 2, 2};
+    std::vector<int32_t> slice {10, 11, 12, 13};
+    std::vector<int32_t> sliceDims {1, 2, 1, 2};
+
+    EXPECT_EQ(OH_NN_SUCCESS, StateTensors::AppendAlongAxis(state.data(), state.size() * sizeof(int32_t), stateDims,
+        slice.data(), sliceDims, 2, sizeof(int32_t)));
+    EXPECT_EQ(3, stateDims[2]);
+    std::vector<int32_t> expected {1, 2, 3, 4, 10, 11, 5, 6, 7, 8, 12, 13};
+    EXPECT_EQ(expected, state);
+}
+
+/**
+ * @tc.name: state_tensors_append_003
+ * @tc.desc: Verify that a slice which does not fit into the buffer or does not match the state is rejected.
+ * @tc.type: FUNC
+ */
+HWTEST_F(StateTensorsTest, state_tensors_append_003, TestSize.Level0)
+{
+    std::vector<int8_t> state(4, 0);
+    std::vector<int32_t> stateDims {1, 4};
+    std::vector<int8_t> slice {1, 2};
+    std::vector<int32_t> sliceDims {1, 1};
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, StateTensors::AppendAlongAxis(state.data(), state.size(), stateDims,
+        slice.data(), sliceDims, 1, sizeof(int8_t)));
+    EXPECT_EQ(4, stateDims[1]);
+
+    stateDims = {1, 2};
+    sliceDims = {2, 1};
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, StateTensors::AppendAlongAxis(state.data(), state.size(), stateDims,
+        slice.data(), sliceDims, 1, sizeof(int8_t)));
+    EXPECT_EQ(2, stateDims[1]);
+}
+} // namespace UnitTest
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <chrono>
+#include <cstdint>
+#include <gtest/gtest.h>
+
+#include "unload_policy.h"
+
+using namespace testing;
+using namespace testing::ext;
+using namespace OHOS::NeuralNetworkRuntime;
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace UnitTest {
+namespace {
+// Twenty minutes, the gaps fall into the bucket [2^20, 2^21) ms.
+constexpr int64_t PERIOD_MS = 20 * 60 * 1000;
+constexpr int64_t PERIOD_BUCKET_BEGIN = static_cast<int64_t>(1) << 20;
+constexpr int64_t PERIOD_BUCKET_END = static_cast<int64_t>(1) << 21;
+constexpr int64_t WARM_RELOAD_LEAD_TIME = 1000;
+// About nine minutes, the gaps fall into the bucket [2^19, 2^20) ms which holds the ten minute unload delay.
+constexpr int64_t SHORT_PERIOD_MS = 9 * 60 * 1000;
+constexpr int64_t SHORT_PERIOD_BUCKET_END = static_cast<int64_t>(1) << 20;
+} // namespace
+
+class UnloadPolicyTest : public testing::Test {
+public:
+    UnloadPolicyTest() = default;
+    ~UnloadPolicyTest() = default;
+
+    // Records count runs which are periodMs apart, returns the time of the last one.
+    UnloadPolicy::Clock::time_point RecordPeriodicRuns(UnloadPolicy& policy, int64_t periodMs, uint32_t count)
+    {
+        UnloadPolicy::Clock::time_point arrival = UnloadPolicy::Clock::time_point();
+        for (uint32_t i = 0; i < count; ++i) {
+            policy.RecordArrival(arrival);
+            if (i + 1 < count) {
+                arrival += std::chrono::milliseconds(periodMs);
+            }
+        }
+        return arrival;
+    }
+};
+
+/**
+ * @tc.name: unload_policy_bucket_001
+ * @tc.desc: Verify that gaps are bucketed by powers of two milliseconds.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UnloadPolicyTest, unload_policy_bucket_001, TestSize.Level0)
+{
+    EXPECT_EQ(0, UnloadPolicy::GetBucketIndex(0));
+    EXPECT_EQ(0, UnloadPolicy::GetBucketIndex(1));
+    EXPECT_EQ(1, UnloadPolicy::GetBucketIndex(2));
+    EXPECT_EQ(1, UnloadPolicy::GetBucketIndex(3));
+    EXPECT_EQ(10, UnloadPolicy::GetBucketIndex(1024));
+    EXPECT_EQ(UnloadPolicy::GAP_BUCKET_NUM - 1, UnloadPolicy::GetBucketIndex(INT64_MAX));
+}
+
+/**
+ * @tc.name: unload_policy_pressure_001
+ * @tc.desc: Verify that the unload delay shrinks as the available memory gets scarce.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UnloadPolicyTest, unload_policy_pressure_001, TestSize.Level0)
+{
+    EXPECT_EQ(MemoryPressure::NORMAL, UnloadPolicy::GetPressureLevel(0, 0));
+    EXPECT_EQ(MemoryPressure::NORMAL, UnloadPolicy::GetPressureLevel(50, 100));
+    EXPECT_EQ(MemoryPressure::MODERATE, UnloadPolicy::GetPressureLevel(20, 100));
+    EXPECT_EQ(MemoryPressure::CRITICAL, UnloadPolicy::GetPressureLevel(5, 100));
+
+    int64_t normalDelay = UnloadPolicy::GetUnloadDelay(MemoryPressure::NORMAL);
+    int64_t moderateDelay = UnloadPolicy::GetUnloadDelay(MemoryPressure::MODERATE);
+    int64_t criticalDelay = UnloadPolicy::GetUnloadDelay(MemoryPressure::CRITICAL);
+    EXPECT_GT(normalDelay, moderateDelay);
+    EXPECT_GT(moderateDelay, criticalDelay);
+    EXPECT_GT(criticalDelay, 0);
+}
+
+/**
+ * @tc.name: unload_policy_warm_reload_001
+ * @tc.desc: Verify that periodic runs longer than the unload delay predict a warm reload before the next run.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UnloadPolicyTest, unload_policy_warm_reload_001, TestSize.Level0)
+{
+    UnloadPolicy policy;
+    auto lastRun = RecordPeriodicRuns(policy, PERIOD_MS, 4);
+
+    int64_t unloadDelay = UnloadPolicy::GetUnloadDelay(MemoryPressure::NORMAL);
+    auto unloadTime = lastRun + std::chrono::milliseconds(unloadDelay);
+    EXPECT_EQ(PERIOD_BUCKET_BEGIN - WARM_RELOAD_LEAD_TIME - unloadDelay,
+        policy.GetWarmReloadDelay(unloadTime, MemoryPressure::NORMAL));
+
+    // No reload for a pattern which has just been broken, and none under critical memory pressure.
+    EXPECT_EQ(-1, policy.GetWarmReloadDelay(lastRun + std::chrono::milliseconds(PERIOD_BUCKET_END),
+        MemoryPressure::NORMAL));
+    EXPECT_EQ(-1, policy.GetWarmReloadDelay(unloadTime, MemoryPressure::CRITICAL));
+}
+
+/**
+ * @tc.name: unload_policy_warm_reload_002
+ * @tc.desc: Verify that no warm reload is predicted without enough long gaps.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UnloadPolicyTest, unload_policy_warm_reload_002, TestSize.Level0)
+{
+    UnloadPolicy emptyPolicy;
+    EXPECT_EQ(-1, emptyPolicy.GetWarmReloadDelay(UnloadPolicy::Clock::time_point(), MemoryPressure::NORMAL));
+
+    UnloadPolicy fewRunsPolicy;
+    auto lastRun = RecordPeriodicRuns(fewRunsPolicy, PERIOD_MS, 3);
+    EXPECT_EQ(-1, fewRunsPolicy.GetWarmReloadDelay(lastRun, MemoryPressure::NORMAL));
+
+    // Runs a second apart keep the model loaded, there is nothing to predict.
+    UnloadPolicy busyPolicy;
+    lastRun = RecordPeriodicRuns(busyPolicy, 1000, 100);
+    EXPECT_EQ(-1, busyPolicy.GetWarmReloadDelay(lastRun, MemoryPressure::NORMAL));
+}
+
+/**
+ * @tc.name: unload_policy_should_unload_001
+ * @tc.desc: Verify that a model whose runs come about when it would be unloaded is kept loaded instead of being
+ *           unloaded and reloaded right away.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UnloadPolicyTest, unload_policy_should_unload_001, TestSize.Level0)
+{
+    UnloadPolicy policy;
+    auto lastRun = RecordPeriodicRuns(policy, SHORT_PERIOD_MS, 4);
+
+    int64_t unloadDelay = UnloadPolicy::GetUnloadDelay(MemoryPressure::NORMAL);
+    auto unloadTime = lastRun + std::chrono::milliseconds(unloadDelay);
+    EXPECT_FALSE(policy.ShouldUnload(unloadTime, MemoryPressure::NORMAL));
+    EXPECT_EQ(-1, policy.GetWarmReloadDelay(unloadTime, MemoryPressure::NORMAL));
+
+    // Unloaded once the expected run did not come, and always under critical memory pressure.
+    EXPECT_TRUE(policy.ShouldUnload(lastRun + std::chrono::milliseconds(SHORT_PERIOD_BUCKET_END),
+        MemoryPressure::NORMAL));
+    EXPECT_TRUE(policy.ShouldUnload(unloadTime, MemoryPressure::CRITICAL));
+}
+
+/**
+ * @tc.name: unload_policy_should_unload_002
+ * @tc.desc: Verify that a model is unloaded when its runs come well after the unload delay or are not predictable.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UnloadPolicyTest, unload_policy_should_unload_002, TestSize.Level0)
+{
+    UnloadPolicy emptyPolicy;
+    EXPECT_TRUE(emptyPolicy.ShouldUnload(UnloadPolicy::Clock::time_point(), MemoryPressure::NORMAL));
+
+    UnloadPolicy policy;
+    auto lastRun = RecordPeriodicRuns(policy, PERIOD_MS, 4);
+    int64_t unloadDelay = UnloadPolicy::GetUnloadDelay(MemoryPressure::NORMAL);
+    EXPECT_TRUE(policy.ShouldUnload(lastRun + std::chrono::milliseconds(unloadDelay), MemoryPressure::NORMAL));
+}
+} // namespace UnitTest
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
@@ -13,6 +13,8 @@
  * limitations under the License.
  */
 
+#include <string>
+
 #include <gtest/gtest.h>
 
 #include "validation.h"
@@ -60,7 +62,7 @@ HWTEST_F(NnTensorDescTest, nn_get_datatype_002, TestSize.Level1)
 HWTEST_F(NnTensorDescTest, nn_set_datatype_001, TestSize.Level1)
 {
     TensorDesc tensordesc;
-    int dataTypeTest = 13;
+    int dataTypeTest = 15;
     OH_NN_DataType testdataType = (OH_NN_DataType)dataTypeTest;
     EXPECT_EQ(OH_NN_INVALID_PARAMETER, tensordesc.SetDataType(testdataType));
 }
@@ -216,5 +218,49 @@ HWTEST_F(NnTensorDescTest, nn_get_name_001, TestSize.Level1)
     const char** testgetname = nullptr;
     EXPECT_EQ(OH_NN_INVALID_PARAMETER, tensordesc.GetName(testgetname));
 }
+
+/**
+ * @tc.name: nn_set_shape_003
+ * @tc.desc: Verify that SetShape keeps the shape in place for the maximum rank and rejects a larger one
+ * @tc.type: FUNC
+ */
+HWTEST_F(NnTensorDescTest, nn_set_shape_003, TestSize.Level1)
+{
+    TensorDesc tensordesc;
+    const int32_t testShape[TensorDesc::SHAPE_MAX_NUM + 1] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+    EXPECT_EQ(OH_NN_SUCCESS, tensordesc.SetShape(testShape, 2));
+    int32_t* shape = nullptr;
+    size_t shapeNum = 0;
+    EXPECT_EQ(OH_NN_SUCCESS, tensordesc.GetShape(&shape, &shapeNum));
+
+    EXPECT_EQ(OH_NN_SUCCESS, tensordesc.SetShape(testShape, TensorDesc::SHAPE_MAX_NUM));
+    int32_t* maxShape = nullptr;
+    EXPECT_EQ(OH_NN_SUCCESS, tensordesc.GetShape(&maxShape, &shapeNum));
+    EXPECT_EQ(shape, maxShape);
+    EXPECT_EQ(TensorDesc::SHAPE_MAX_NUM, shapeNum);
+    EXPECT_EQ(10, maxShape[9]);
+
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, tensordesc.SetShape(testShape, TensorDesc::SHAPE_MAX_NUM + 1));
+}
+
+/**
+ * @tc.name: nn_get_name_002
+ * @tc.desc: Verify that a copied desc keeps the name after the original desc and the source string are gone
+ * @tc.type: FUNC
+ */
+HWTEST_F(NnTensorDescTest, nn_get_name_002, TestSize.Level1)
+{
+    TensorDesc copied;
+    {
+        std::string sourceName = "input0";
+        TensorDesc tensordesc;
+        EXPECT_EQ(OH_NN_SUCCESS, tensordesc.SetName(sourceName.c_str()));
+        copied = tensordesc;
+    }
+
+    const char* copiedName = nullptr;
+    EXPECT_EQ(OH_NN_SUCCESS, copied.GetName(&copiedName));
+    EXPECT_STREQ("input0", copiedName);
+}
 } // namespace UnitTest
 } // namespace NNRT
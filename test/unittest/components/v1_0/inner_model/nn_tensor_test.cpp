@@ -405,7 +405,7 @@ HWTEST_F(NnTensorTest, nn_tensor_build_from_tensor_002, TestSize.Level1)
 {
     const int dim[2] = {2, 2};
 
-    int dataTypeTest = 13;
+    int dataTypeTest = 15;
     OH_NN_DataType dataType = (OH_NN_DataType)dataTypeTest;
     OH_NN_Tensor tensor {dataType, 2, dim, nullptr, OH_NN_TENSOR};
 
@@ -480,7 +480,7 @@ HWTEST_F(NnTensorTest, nn_tensor_build_001, TestSize.Level1)
  */
 HWTEST_F(NnTensorTest, nn_tensor_build_002, TestSize.Level1)
 {
-    int dataTypeTest = 13;
+    int dataTypeTest = 15;
     OH_NN_DataType dataType = (OH_NN_DataType)dataTypeTest;
     const std::vector<int32_t> dimensions = {2, 2};
     const std::vector<QuantParam> quantParam = {{8, 1.0, 0}, {8, 1.0, 0}, {8, 1.0, 0}};
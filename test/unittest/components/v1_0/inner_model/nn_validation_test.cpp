@@ -47,7 +47,7 @@ HWTEST_F(NnValidationTest, nn_validation_validate_tensor_datatype_001, TestSize.
  */
 HWTEST_F(NnValidationTest, nn_validation_validate_tensor_datatype_002, TestSize.Level1)
 {
-    int dataTypeTest = 13;
+    int dataTypeTest = 15;
     OH_NN_DataType dataType = (OH_NN_DataType)dataTypeTest;
     EXPECT_EQ(false, ValidateTensorDataType(dataType));
 }
@@ -888,6 +888,146 @@ HWTEST_F(InnerModelTest, inner_model_get_supported_operation_004, TestSize.Level
 
     EXPECT_EQ(OH_NN_OPERATION_FORBIDDEN, m_innerModelTest.GetSupportedOperations(deviceID, &isSupported, opCount));
 }
+
+/**
+ * @tc.name: inner_model_build_005
+ * @tc.desc: Verify that the build function folds a Shape node and removes a node whose output is not used
+ * @tc.type: FUNC
+ */
+HWTEST_F(InnerModelTest, inner_model_build_005, TestSize.Level1)
+{
+    const int inputDim[2] = {2, 3};
+    const int shapeDim[1] = {2};
+    const int outputDim[2] = {3, 2};
+    EXPECT_EQ(OH_NN_SUCCESS, m_innerModelTest.AddTensor({OH_NN_FLOAT32, 2, inputDim, nullptr, OH_NN_TENSOR}));
+    EXPECT_EQ(OH_NN_SUCCESS, m_innerModelTest.AddTensor({OH_NN_INT32, 1, shapeDim, nullptr, OH_NN_TENSOR}));
+    EXPECT_EQ(OH_NN_SUCCESS, m_innerModelTest.AddTensor({OH_NN_FLOAT32, 2, outputDim, nullptr, OH_NN_TENSOR}));
+    EXPECT_EQ(OH_NN_SUCCESS, m_innerModelTest.AddTensor({OH_NN_INT32, 1, shapeDim, nullptr, OH_NN_TENSOR}));
+
+    uint32_t modelInput[1] = {0};
+    uint32_t shapeOutput[1] = {1};
+    uint32_t reshapeInputs[2] = {0, 1};
+    uint32_t modelOutput[1] = {2};
+    uint32_t unusedOutput[1] = {3};
+    OH_NN_UInt32Array params = {nullptr, 0};
+    OH_NN_UInt32Array inputs = {modelInput, 1};
+    OH_NN_UInt32Array outputs = {shapeOutput, 1};
+    EXPECT_EQ(OH_NN_SUCCESS, m_innerModelTest.AddOperation(OH_NN_OPS_SHAPE, params, inputs, outputs));
+    inputs = {reshapeInputs, 2};
+    outputs = {modelOutput, 1};
+    EXPECT_EQ(OH_NN_SUCCESS, m_innerModelTest.AddOperation(OH_NN_OPS_RESHAPE, params, inputs, outputs));
+    inputs = {modelInput, 1};
+    outputs = {unusedOutput, 1};
+    EXPECT_EQ(OH_NN_SUCCESS, m_innerModelTest.AddOperation(OH_NN_OPS_SHAPE, params, inputs, outputs));
+
+    inputs = {modelInput, 1};
+    outputs = {modelOutput, 1};
+    EXPECT_EQ(OH_NN_SUCCESS, m_innerModelTest.SpecifyInputsAndOutputs(inputs, outputs));
+    EXPECT_EQ(OH_NN_SUCCESS, m_innerModelTest.Build());
+
+    // Only Reshape reaches the device, the folded shape is passed to it as a constant tensor.
+    std::shared_ptr<mindspore::lite::LiteGraph> liteGraph = m_innerModelTest.GetLiteGraphs();
+    ASSERT_EQ(1, liteGraph->all_nodes_.size());
+    EXPECT_EQ("Reshape:1", liteGraph->all_nodes_[0]->name_);
+    EXPECT_EQ(3, liteGraph->all_tensors_.size());
+    ASSERT_EQ(1, liteGraph->sub_graphs_.size());
+    EXPECT_EQ(1, liteGraph->sub_graphs_[0]->node_indices_.size());
+    std::vector<uint8_t> shapeData = mindspore::lite::MindIR_Tensor_GetData(liteGraph->all_tensors_[1]);
+    ASSERT_EQ(2 * sizeof(int32_t), shapeData.size());
+    EXPECT_EQ(2, reinterpret_cast<const int32_t*>(shapeData.data())[0]);
+    EXPECT_EQ(3, reinterpret_cast<const int32_t*>(shapeData.data())[1]);
+}
+
+namespace {
+void BuildReshapeModel(InnerModel& innerModel, const int32_t (&shape)[2], const QuantParams* inputQuantParam = nullptr)
+{
+    const int inputDim[2] = {2, 3};
+    const int shapeDim[1] = {2};
+    const int outputDim[2] = {shape[0], shape[1]};
+    EXPECT_EQ(OH_NN_SUCCESS, innerModel.AddTensor({OH_NN_FLOAT32, 2, inputDim, nullptr, OH_NN_TENSOR}));
+    EXPECT_EQ(OH_NN_SUCCESS, innerModel.AddTensor({OH_NN_INT32, 1, shapeDim, nullptr, OH_NN_TENSOR}));
+    EXPECT_EQ(OH_NN_SUCCESS, innerModel.AddTensor({OH_NN_FLOAT32, 2, outputDim, nullptr, OH_NN_TENSOR}));
+    EXPECT_EQ(OH_NN_SUCCESS, innerModel.SetTensorValue(1, shape, sizeof(shape)));
+    if (inputQuantParam != nullptr) {
+        EXPECT_EQ(OH_NN_SUCCESS, innerModel.SetTensorQuantParam(0,
+            reinterpret_cast<const NN_QuantParam*>(inputQuantParam)));
+    }
+
+    uint32_t modelInput[1] = {0};
+    uint32_t reshapeInputs[2] = {0, 1};
+    uint32_t modelOutput[1] = {2};
+    OH_NN_UInt32Array params = {nullptr, 0};
+    OH_NN_UInt32Array inputs = {reshapeInputs, 2};
+    OH_NN_UInt32Array outputs = {modelOutput, 1};
+    EXPECT_EQ(OH_NN_SUCCESS, innerModel.AddOperation(OH_NN_OPS_RESHAPE, params, inputs, outputs));
+
+    inputs = {modelInput, 1};
+    EXPECT_EQ(OH_NN_SUCCESS, innerModel.SpecifyInputsAndOutputs(inputs, outputs));
+    EXPECT_EQ(OH_NN_SUCCESS, innerModel.Build());
+}
+} // namespace
+
+/**
+ * @tc.name: inner_model_get_fingerprint_001
+ * @tc.desc: Verify that the fingerprint is kept for the same structure and tells apart models with the same node names
+ * @tc.type: FUNC
+ */
+HWTEST_F(InnerModelTest, inner_model_get_fingerprint_001, TestSize.Level1)
+{
+    EXPECT_EQ(0, m_innerModelTest.GetFingerprint());
+
+    const int32_t shape[2] = {3, 2};
+    const int32_t otherShape[2] = {6, 1};
+    BuildReshapeModel(m_innerModelTest, shape);
+    InnerModel sameModel;
+    BuildReshapeModel(sameModel, shape);
+    InnerModel otherModel;
+    BuildReshapeModel(otherModel, otherShape);
+
+    EXPECT_NE(0, m_innerModelTest.GetFingerprint());
+    EXPECT_EQ(m_innerModelTest.GetFingerprint(), sameModel.GetFingerprint());
+    ASSERT_EQ(1, otherModel.GetLiteGraphs()->all_nodes_.size());
+    EXPECT_EQ(m_innerModelTest.GetLiteGraphs()->all_nodes_[0]->name_, otherModel.GetLiteGraphs()->all_nodes_[0]->name_);
+    EXPECT_NE(m_innerModelTest.GetFingerprint(), otherModel.GetFingerprint());
+}
+
+/**
+ * @tc.name: inner_model_get_fingerprint_002
+ * @tc.desc: Verify that models which differ only in the layout or the scales of group quantization are told apart
+ * @tc.type: FUNC
+ */
+HWTEST_F(InnerModelTest, inner_model_get_fingerprint_002, TestSize.Level1)
+{
+    const int32_t shape[2] = {3, 2};
+    // Both layouts split the 2x3 input into two groups.
+    QuantParams rowGroups;
+    rowGroups.SetGroup(1, 3);
+    rowGroups.SetScales({0.5, 0.25});
+    rowGroups.SetNumBits({8});
+    QuantParams channelGroups;
+    channelGroups.SetGroup(0, 0);
+    channelGroups.SetScales({0.5, 0.25});
+    channelGroups.SetNumBits({8});
+    QuantParams otherScales;
+    otherScales.SetGroup(1, 3);
+    otherScales.SetScales({0.5, 0.125});
+    otherScales.SetNumBits({8});
+
+    BuildReshapeModel(m_innerModelTest, shape, &rowGroups);
+    InnerModel sameModel;
+    BuildReshapeModel(sameModel, shape, &rowGroups);
+    InnerModel plainModel;
+    BuildReshapeModel(plainModel, shape);
+    InnerModel channelModel;
+    BuildReshapeModel(channelModel, shape, &channelGroups);
+    InnerModel otherScalesModel;
+    BuildReshapeModel(otherScalesModel, shape, &otherScales);
+
+    EXPECT_EQ(m_innerModelTest.GetFingerprint(), sameModel.GetFingerprint());
+    EXPECT_NE(m_innerModelTest.GetFingerprint(), plainModel.GetFingerprint());
+    EXPECT_NE(m_innerModelTest.GetFingerprint(), channelModel.GetFingerprint());
+    EXPECT_NE(m_innerModelTest.GetFingerprint(), otherScalesModel.GetFingerprint());
+}
 } // namespace UnitTest
 } // namespace NNRT
 
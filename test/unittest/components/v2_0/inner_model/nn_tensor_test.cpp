@@ -178,6 +178,36 @@ HWTEST_F(NnTensorTest, nn_tensor_parse_quant_params_005, TestSize.Level1)
     EXPECT_EQ(OH_NN_INVALID_PARAMETER, nnTensor.BuildFromOHNNTensor(tensor));
 }
 
+/**
+ * @tc.name: nn_tensor_parse_quant_params_006
+ * @tc.desc: Verify that a packed int4 tensor takes 4-bit group quantization and half a byte per element.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NnTensorTest, nn_tensor_parse_quant_params_006, TestSize.Level1)
+{
+    const double scale[2] = {0.5, 0.25};
+    const int32_t zeroPoint[2] = {0, 0};
+    const uint32_t numBits[2] = {4, 4};
+    const OH_NN_QuantParam quantParam = {2, numBits, scale, zeroPoint};
+
+    NNTensor nnTensor;
+    const int dim[2] = {3, 3};
+    OH_NN_Tensor tensor {OH_NN_INT4, 2, dim, &quantParam, OH_NN_TENSOR};
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, nnTensor.BuildFromOHNNTensor(tensor));
+
+    NNTensor groupTensor;
+    const int groupDim[2] = {2, 5};
+    OH_NN_Tensor validTensor {OH_NN_INT4, 2, groupDim, &quantParam, OH_NN_TENSOR};
+    EXPECT_EQ(OH_NN_SUCCESS, groupTensor.BuildFromOHNNTensor(validTensor));
+    EXPECT_EQ(static_cast<size_t>(5), groupTensor.GetDataLength());
+
+    const uint32_t eightBits[2] = {8, 8};
+    const OH_NN_QuantParam eightBitParam = {2, eightBits, scale, zeroPoint};
+    NNTensor eightBitTensor;
+    OH_NN_Tensor invalidTensor {OH_NN_INT4, 2, groupDim, &eightBitParam, OH_NN_TENSOR};
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, eightBitTensor.BuildFromOHNNTensor(invalidTensor));
+}
+
 /**
  * @tc.name: nn_tensor_set_dimensions_001
  * @tc.desc: Verify the success of the set_dimensions function
@@ -405,7 +435,7 @@ HWTEST_F(NnTensorTest, nn_tensor_build_from_tensor_002, TestSize.Level1)
 {
     const int dim[2] = {2, 2};
 
-    int dataTypeTest = 13;
+    int dataTypeTest = 15;
     OH_NN_DataType dataType = (OH_NN_DataType)dataTypeTest;
     OH_NN_Tensor tensor {dataType, 2, dim, nullptr, OH_NN_TENSOR};
 
@@ -480,7 +510,7 @@ HWTEST_F(NnTensorTest, nn_tensor_build_001, TestSize.Level1)
  */
 HWTEST_F(NnTensorTest, nn_tensor_build_002, TestSize.Level1)
 {
-    int dataTypeTest = 13;
+    int dataTypeTest = 15;
     OH_NN_DataType dataType = (OH_NN_DataType)dataTypeTest;
     const std::vector<int32_t> dimensions = {2, 2};
     const std::vector<QuantParam> quantParam = {{8, 1.0, 0}, {8, 1.0, 0}, {8, 1.0, 0}};
@@ -60,5 +60,20 @@ HWTEST_F(OpsRegistryTest, registry_002, TestSize.Level1)
 
     REGISTER_OPS(DivBuilder, OH_NN_OperationType(newRegistryOperationType));
 }
+
+/**
+ * @tc.name: registry_003
+ * @tc.desc: Verify the builtin operations are found in the constant table and unknown types are rejected
+ * @tc.type: FUNC
+ */
+HWTEST_F(OpsRegistryTest, registry_003, TestSize.Level1)
+{
+    const int unknownOperationType = 2000;
+    OpsRegistry& opsregistry = OpsRegistry::GetSingleton();
+    EXPECT_NE(nullptr, opsregistry.GetOpsBuilder(OH_NN_OPS_ADD));
+    EXPECT_NE(nullptr, opsregistry.GetOpsBuilder(OH_NN_OPS_GATHER_ND));
+    EXPECT_EQ(nullptr, opsregistry.GetOpsBuilder(OH_NN_OperationType(0)));
+    EXPECT_EQ(nullptr, opsregistry.GetOpsBuilder(OH_NN_OperationType(unknownOperationType)));
+}
 } // namespace UnitTest
 } // namespace NNRT
@@ -90,6 +90,30 @@ HWTEST_F(TransformTest, transform_gettypesize_005, TestSize.Level0)
     EXPECT_EQ(static_cast<uint32_t>(0), result);
 }
 
+/**
+ * @tc.name: transform_gettypesize_006
+ * @tc.desc: Verify the GetTypeSize function return 2 for bfloat16 and 0 for the sub-byte int4.
+ * @tc.type: FUNC
+ */
+HWTEST_F(TransformTest, transform_gettypesize_006, TestSize.Level0)
+{
+    EXPECT_EQ(static_cast<uint32_t>(2), GetTypeSize(OH_NN_BFLOAT16));
+    EXPECT_EQ(static_cast<uint32_t>(0), GetTypeSize(OH_NN_INT4));
+}
+
+/**
+ * @tc.name: transform_getdatabytesize_001
+ * @tc.desc: Verify the GetDataByteSize function packs two int4 elements per byte.
+ * @tc.type: FUNC
+ */
+HWTEST_F(TransformTest, transform_getdatabytesize_001, TestSize.Level0)
+{
+    EXPECT_EQ(static_cast<uint64_t>(12), GetDataByteSize(OH_NN_FLOAT32, 3));
+    EXPECT_EQ(static_cast<uint64_t>(6), GetDataByteSize(OH_NN_BFLOAT16, 3));
+    EXPECT_EQ(static_cast<uint64_t>(2), GetDataByteSize(OH_NN_INT4, 4));
+    EXPECT_EQ(static_cast<uint64_t>(3), GetDataByteSize(OH_NN_INT4, 5));
+}
+
 /**
  * @tc.name: transform_nntoms_transformdatatype_001
  * @tc.desc: Verify the TransIOTensor function return DATA_TYPE_BOOL.
@@ -246,6 +270,19 @@ HWTEST_F(TransformTest, transform_nntoms_transformdatatype_013, TestSize.Level0)
     EXPECT_EQ(mindspore::lite::DATA_TYPE_FLOAT64, result);
 }
 
+/**
+ * @tc.name: transform_nntoms_transformdatatype_014
+ * @tc.desc: Verify the TransDataType function round trips OH_NN_BFLOAT16 and OH_NN_INT4.
+ * @tc.type: FUNC
+ */
+HWTEST_F(TransformTest, transform_nntoms_transformdatatype_014, TestSize.Level0)
+{
+    EXPECT_EQ(MS_DATA_TYPE_BFLOAT16, NNToMS::TransformDataType(OH_NN_BFLOAT16));
+    EXPECT_EQ(MS_DATA_TYPE_INT4, NNToMS::TransformDataType(OH_NN_INT4));
+    EXPECT_EQ(OH_NN_BFLOAT16, MSToNN::TransformDataType(MS_DATA_TYPE_BFLOAT16));
+    EXPECT_EQ(OH_NN_INT4, MSToNN::TransformDataType(MS_DATA_TYPE_INT4));
+}
+
 /**
  * @tc.name: transform_nntoms_transformformat_001
  * @tc.desc: Verify the TransFormat function return FORMAT_NCHW.
@@ -319,6 +319,52 @@ HWTEST_F(ConstantOfShapeBuilderTest, constant_of_shape_getprimitive_002, TestSiz
     LiteGraphPrimitvePtr expectPrimitive(nullptr, DestroyLiteGraphPrimitive);
     EXPECT_EQ(expectPrimitive, primitive);
 }
+
+/**
+ * @tc.name: constant_of_shape_fold_001
+ * @tc.desc: Verify that the fold function fills a constant shape with the value in the output data type.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ConstantOfShapeBuilderTest, constant_of_shape_fold_001, TestSize.Level1)
+{
+    std::shared_ptr<NNTensor> shape = TransToNNTensor(OH_NN_INT32, {2}, nullptr, OH_NN_TENSOR);
+    int32_t* shapeValue = new (std::nothrow) int32_t[2] {2, 3};
+    ASSERT_NE(nullptr, shapeValue);
+    shape->SetBuffer(shapeValue, 2 * sizeof(int32_t));
+
+    m_allTensors = {shape, TransToNNTensor(OH_NN_INT32, {-1, -1}, nullptr, OH_NN_TENSOR)};
+    SaveDataType(OH_NN_INT64, m_dataTypeDim, nullptr, OH_NN_CONSTANT_OF_SHAPE_DATA_TYPE);
+    SaveValue(OH_NN_FLOAT32, m_valueDim, nullptr, OH_NN_CONSTANT_OF_SHAPE_VALUE);
+    EXPECT_EQ(OH_NN_SUCCESS, m_builder.Build(m_params, m_inputs, m_outputs, m_allTensors));
+    EXPECT_EQ(OH_NN_SUCCESS, m_builder.Fold(m_allTensors, {}));
+
+    const std::shared_ptr<NNTensor>& output = m_allTensors[m_outputs[0]];
+    std::vector<int32_t> expectDim {2, 3};
+    EXPECT_EQ(expectDim, output->GetDimensions());
+    ASSERT_NE(nullptr, output->GetBuffer());
+    const int32_t* outputValue = static_cast<const int32_t*>(output->GetBuffer());
+    EXPECT_EQ(std::vector<int32_t>(6, 1), std::vector<int32_t>(outputValue, outputValue + 6));
+}
+
+/**
+ * @tc.name: constant_of_shape_fold_002
+ * @tc.desc: Verify that the fold function leaves the op to the device when the output exceeds the folding size limit.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ConstantOfShapeBuilderTest, constant_of_shape_fold_002, TestSize.Level1)
+{
+    std::shared_ptr<NNTensor> shape = TransToNNTensor(OH_NN_INT32, {2}, nullptr, OH_NN_TENSOR);
+    int32_t* shapeValue = new (std::nothrow) int32_t[2] {256, 257};
+    ASSERT_NE(nullptr, shapeValue);
+    shape->SetBuffer(shapeValue, 2 * sizeof(int32_t));
+
+    m_allTensors = {shape, TransToNNTensor(OH_NN_INT32, {-1, -1}, nullptr, OH_NN_TENSOR)};
+    SaveDataType(OH_NN_INT64, m_dataTypeDim, nullptr, OH_NN_CONSTANT_OF_SHAPE_DATA_TYPE);
+    SaveValue(OH_NN_FLOAT32, m_valueDim, nullptr, OH_NN_CONSTANT_OF_SHAPE_VALUE);
+    EXPECT_EQ(OH_NN_SUCCESS, m_builder.Build(m_params, m_inputs, m_outputs, m_allTensors));
+    EXPECT_EQ(OH_NN_OPERATION_FORBIDDEN, m_builder.Fold(m_allTensors, {}));
+    EXPECT_EQ(nullptr, m_allTensors[m_outputs[0]]->GetBuffer());
+}
 }
 }
 }
\ No newline at end of file
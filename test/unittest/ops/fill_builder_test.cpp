@@ -175,6 +175,92 @@ HWTEST_F(FillBuilderTest, fill_getprimitive_002, TestSize.Level0)
     LiteGraphPrimitvePtr expectPrimitive(nullptr, DestroyLiteGraphPrimitive);
     EXPECT_EQ(expectPrimitive, primitive);
 }
+
+/**
+ * @tc.name: fill_fold_001
+ * @tc.desc: Verify that the fold function repeats a constant value of the output type over the output shape.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FillBuilderTest, fill_fold_001, TestSize.Level0)
+{
+    std::shared_ptr<NNTensor> value = TransToNNTensor(OH_NN_FLOAT32, m_inputDim, nullptr, OH_NN_TENSOR);
+    float* valueData = new (std::nothrow) float(2.5f);
+    ASSERT_NE(nullptr, valueData);
+    value->SetBuffer(valueData, sizeof(float));
+
+    std::shared_ptr<NNTensor> shape = TransToNNTensor(OH_NN_INT32, {2}, nullptr, OH_NN_TENSOR);
+    int32_t* shapeValue = new (std::nothrow) int32_t[2] {2, 3};
+    ASSERT_NE(nullptr, shapeValue);
+    shape->SetBuffer(shapeValue, 2 * sizeof(int32_t));
+
+    m_allTensors = {value, shape, TransToNNTensor(OH_NN_FLOAT32, {-1, -1}, nullptr, OH_NN_TENSOR)};
+    EXPECT_EQ(OH_NN_SUCCESS, m_fill.Build(m_params, m_inputs, m_outputs, m_allTensors));
+    EXPECT_EQ(OH_NN_SUCCESS, m_fill.Fold(m_allTensors, {}));
+
+    const std::shared_ptr<NNTensor>& output = m_allTensors[m_outputs[0]];
+    EXPECT_EQ(m_outputDim, output->GetDimensions());
+    ASSERT_NE(nullptr, output->GetBuffer());
+    const float* outputValue = static_cast<const float*>(output->GetBuffer());
+    EXPECT_EQ(std::vector<float>(6, 2.5f), std::vector<float>(outputValue, outputValue + 6));
+}
+
+/**
+ * @tc.name: fill_fold_002
+ * @tc.desc: Verify that the fold function leaves the op to the device when the value type differs from the output.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FillBuilderTest, fill_fold_002, TestSize.Level0)
+{
+    std::shared_ptr<NNTensor> value = TransToNNTensor(OH_NN_INT32, m_inputDim, nullptr, OH_NN_TENSOR);
+    int32_t* valueData = new (std::nothrow) int32_t(2);
+    ASSERT_NE(nullptr, valueData);
+    value->SetBuffer(valueData, sizeof(int32_t));
+
+    std::shared_ptr<NNTensor> shape = TransToNNTensor(OH_NN_INT32, {2}, nullptr, OH_NN_TENSOR);
+    int32_t* shapeValue = new (std::nothrow) int32_t[2] {2, 3};
+    ASSERT_NE(nullptr, shapeValue);
+    shape->SetBuffer(shapeValue, 2 * sizeof(int32_t));
+
+    m_allTensors = {value, shape, TransToNNTensor(OH_NN_FLOAT32, {-1, -1}, nullptr, OH_NN_TENSOR)};
+    EXPECT_EQ(OH_NN_SUCCESS, m_fill.Build(m_params, m_inputs, m_outputs, m_allTensors));
+    EXPECT_EQ(OH_NN_OPERATION_FORBIDDEN, m_fill.Fold(m_allTensors, {}));
+    EXPECT_EQ(nullptr, m_allTensors[m_outputs[0]]->GetBuffer());
+}
+
+/**
+ * @tc.name: fill_fold_003
+ * @tc.desc: Verify that the fold function leaves the op to the device when the output exceeds the folding size limit,
+ *           including a shape whose element count overflows.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FillBuilderTest, fill_fold_003, TestSize.Level0)
+{
+    std::shared_ptr<NNTensor> value = TransToNNTensor(OH_NN_FLOAT32, m_inputDim, nullptr, OH_NN_TENSOR);
+    float* valueData = new (std::nothrow) float(2.5f);
+    ASSERT_NE(nullptr, valueData);
+    value->SetBuffer(valueData, sizeof(float));
+
+    std::shared_ptr<NNTensor> shape = TransToNNTensor(OH_NN_INT32, {2}, nullptr, OH_NN_TENSOR);
+    int32_t* shapeValue = new (std::nothrow) int32_t[2] {128, 129};
+    ASSERT_NE(nullptr, shapeValue);
+    shape->SetBuffer(shapeValue, 2 * sizeof(int32_t));
+
+    m_allTensors = {value, shape, TransToNNTensor(OH_NN_FLOAT32, {-1, -1}, nullptr, OH_NN_TENSOR)};
+    EXPECT_EQ(OH_NN_SUCCESS, m_fill.Build(m_params, m_inputs, m_outputs, m_allTensors));
+    EXPECT_EQ(OH_NN_OPERATION_FORBIDDEN, m_fill.Fold(m_allTensors, {}));
+    EXPECT_EQ(nullptr, m_allTensors[m_outputs[0]]->GetBuffer());
+
+    std::shared_ptr<NNTensor> overflowShape = TransToNNTensor(OH_NN_INT32, {3}, nullptr, OH_NN_TENSOR);
+    int32_t* overflowValue = new (std::nothrow) int32_t[3] {INT32_MAX, INT32_MAX, INT32_MAX};
+    ASSERT_NE(nullptr, overflowValue);
+    overflowShape->SetBuffer(overflowValue, 3 * sizeof(int32_t));
+
+    FillBuilder overflowFill;
+    m_allTensors = {value, overflowShape, TransToNNTensor(OH_NN_FLOAT32, {-1, -1, -1}, nullptr, OH_NN_TENSOR)};
+    EXPECT_EQ(OH_NN_SUCCESS, overflowFill.Build(m_params, m_inputs, m_outputs, m_allTensors));
+    EXPECT_EQ(OH_NN_OPERATION_FORBIDDEN, overflowFill.Fold(m_allTensors, {}));
+    EXPECT_EQ(nullptr, m_allTensors[m_outputs[0]]->GetBuffer());
+}
 }
 }
 }
\ No newline at end of file
@@ -176,6 +176,112 @@ HWTEST_F(GatherBuilderTest, gather_getprimitive_002, TestSize.Level0)
     LiteGraphPrimitvePtr expectPrimitive(nullptr, DestroyLiteGraphPrimitive);
     EXPECT_EQ(expectPrimitive, primitive);
 }
+
+/**
+ * @tc.name: gather_fold_001
+ * @tc.desc: Verify that the fold function gathers constant rows along the axis into the output.
+ * @tc.type: FUNC
+ */
+HWTEST_F(GatherBuilderTest, gather_fold_001, TestSize.Level0)
+{
+    std::shared_ptr<NNTensor> input = TransToNNTensor(OH_NN_FLOAT32, m_inputDim, nullptr, OH_NN_TENSOR);
+    const int32_t elementCount = 12;
+    float* inputValue = new (std::nothrow) float[elementCount];
+    ASSERT_NE(nullptr, inputValue);
+    for (int32_t i = 0; i < elementCount; ++i) {
+        inputValue[i] = static_cast<float>(i);
+    }
+    input->SetBuffer(inputValue, elementCount * sizeof(float));
+
+    std::shared_ptr<NNTensor> indices = TransToNNTensor(OH_NN_INT32, {2}, nullptr, OH_NN_TENSOR);
+    int32_t* indicesValue = new (std::nothrow) int32_t[2] {2, -3};
+    ASSERT_NE(nullptr, indicesValue);
+    indices->SetBuffer(indicesValue, 2 * sizeof(int32_t));
+
+    std::shared_ptr<NNTensor> axis = TransToNNTensor(OH_NN_INT32, {1}, nullptr, OH_NN_TENSOR);
+    int32_t* axisValue = new (std::nothrow) int32_t(1);
+    ASSERT_NE(nullptr, axisValue);
+    axis->SetBuffer(axisValue, sizeof(int32_t));
+
+    std::vector<int32_t> outputDim {4, -1};
+    m_allTensors = {input, indices, axis, TransToNNTensor(OH_NN_FLOAT32, outputDim, nullptr, OH_NN_TENSOR)};
+    EXPECT_EQ(OH_NN_SUCCESS, m_gather.Build(m_params, m_inputs, m_outputs, m_allTensors));
+    EXPECT_EQ(OH_NN_SUCCESS, m_gather.Fold(m_allTensors, {}));
+
+    const std::shared_ptr<NNTensor>& output = m_allTensors[m_outputs[0]];
+    EXPECT_EQ(m_outputDim, output->GetDimensions());
+    ASSERT_NE(nullptr, output->GetBuffer());
+    const float* outputValue = static_cast<const float*>(output->GetBuffer());
+    std::vector<float> expectValue {2.0f, 0.0f, 5.0f, 3.0f, 8.0f, 6.0f, 11.0f, 9.0f};
+    EXPECT_EQ(expectValue, std::vector<float>(outputValue, outputValue + expectValue.size()));
+}
+
+/**
+ * @tc.name: gather_fold_002
+ * @tc.desc: Verify that the fold function leaves the output untouched when the input is not constant.
+ * @tc.type: FUNC
+ */
+HWTEST_F(GatherBuilderTest, gather_fold_002, TestSize.Level0)
+{
+    std::shared_ptr<NNTensor> indices = TransToNNTensor(OH_NN_INT32, {2}, nullptr, OH_NN_TENSOR);
+    int32_t* indicesValue = new (std::nothrow) int32_t[2] {0, 1};
+    ASSERT_NE(nullptr, indicesValue);
+    indices->SetBuffer(indicesValue, 2 * sizeof(int32_t));
+
+    std::shared_ptr<NNTensor> axis = TransToNNTensor(OH_NN_INT32, {1}, nullptr, OH_NN_TENSOR);
+    int32_t* axisValue = new (std::nothrow) int32_t(1);
+    ASSERT_NE(nullptr, axisValue);
+    axis->SetBuffer(axisValue, sizeof(int32_t));
+
+    m_allTensors = {TransToNNTensor(OH_NN_FLOAT32, m_inputDim, nullptr, OH_NN_TENSOR), indices, axis,
+        TransToNNTensor(OH_NN_FLOAT32, m_outputDim, nullptr, OH_NN_TENSOR)};
+    EXPECT_EQ(OH_NN_OPERATION_FORBIDDEN, m_gather.Fold(m_allTensors, {}));
+    EXPECT_EQ(OH_NN_SUCCESS, m_gather.Build(m_params, m_inputs, m_outputs, m_allTensors));
+    EXPECT_EQ(OH_NN_OPERATION_FORBIDDEN, m_gather.Fold(m_allTensors, {}));
+    EXPECT_EQ(nullptr, m_allTensors[m_outputs[0]]->GetBuffer());
+}
+
+/**
+ * @tc.name: gather_fold_003
+ * @tc.desc: Verify that the fold function leaves the output untouched when the input and the output are quantized
+ *           differently.
+ * @tc.type: FUNC
+ */
+HWTEST_F(GatherBuilderTest, gather_fold_003, TestSize.Level0)
+{
+    const uint32_t numBits[1] = {8};
+    const double inputScale[1] = {0.5};
+    const double outputScale[1] = {0.25};
+    const int32_t zeroPoint[1] = {0};
+    OH_NN_QuantParam inputQuant = {1, numBits, inputScale, zeroPoint};
+    OH_NN_QuantParam outputQuant = {1, numBits, outputScale, zeroPoint};
+
+    std::shared_ptr<NNTensor> input = TransToNNTensor(OH_NN_INT8, m_inputDim, &inputQuant, OH_NN_TENSOR);
+    const int32_t elementCount = 12;
+    int8_t* inputValue = new (std::nothrow) int8_t[elementCount] {0};
+    ASSERT_NE(nullptr, inputValue);
+    input->SetBuffer(inputValue, elementCount * sizeof(int8_t));
+
+    std::shared_ptr<NNTensor> indices = TransToNNTensor(OH_NN_INT32, {2}, nullptr, OH_NN_TENSOR);
+    int32_t* indicesValue = new (std::nothrow) int32_t[2] {0, 1};
+    ASSERT_NE(nullptr, indicesValue);
+    indices->SetBuffer(indicesValue, 2 * sizeof(int32_t));
+
+    std::shared_ptr<NNTensor> axis = TransToNNTensor(OH_NN_INT32, {1}, nullptr, OH_NN_TENSOR);
+    int32_t* axisValue = new (std::nothrow) int32_t(1);
+    ASSERT_NE(nullptr, axisValue);
+    axis->SetBuffer(axisValue, sizeof(int32_t));
+
+    m_allTensors = {input, indices, axis, TransToNNTensor(OH_NN_INT8, m_outputDim, &outputQuant, OH_NN_TENSOR)};
+    EXPECT_EQ(OH_NN_SUCCESS, m_gather.Build(m_params, m_inputs, m_outputs, m_allTensors));
+    EXPECT_EQ(OH_NN_OPERATION_FORBIDDEN, m_gather.Fold(m_allTensors, {}));
+    EXPECT_EQ(nullptr, m_allTensors[m_outputs[0]]->GetBuffer());
+
+    // The same quantization on both sides lets the bytes be gathered as they are.
+    m_allTensors[m_outputs[0]] = TransToNNTensor(OH_NN_INT8, m_outputDim, &inputQuant, OH_NN_TENSOR);
+    EXPECT_EQ(OH_NN_SUCCESS, m_gather.Fold(m_allTensors, {}));
+    EXPECT_NE(nullptr, m_allTensors[m_outputs[0]]->GetBuffer());
+}
 }
 }
 }
\ No newline at end of file
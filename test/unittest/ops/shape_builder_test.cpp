@@ -173,6 +173,28 @@ HWTEST_F(ShapeBuilderTest, shape_get_primitive_002, TestSize.Level0)
     LiteGraphTensorPtr expectPrimitive = {nullptr, DestroyLiteGraphPrimitive};
     EXPECT_NE(shapePrimitive, expectPrimitive);
 }
+
+/**
+ * @tc.name: shape_fold_001
+ * @tc.desc: Verify that the fold function only trusts the dimensions of model inputs and constants.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ShapeBuilderTest, shape_fold_001, TestSize.Level0)
+{
+    SaveInputTensor(m_inputs, OH_NN_FLOAT32, m_inputDim, nullptr);
+    SaveOutputTensor(m_outputs, OH_NN_INT32, m_outputDim, nullptr);
+    EXPECT_EQ(OH_NN_SUCCESS, m_builder.Build(m_paramsIndex, m_inputsIndex, m_outputsIndex, m_allTensors));
+
+    // The input is produced by another operation, its declared dimensions may differ from the inferred ones.
+    EXPECT_EQ(OH_NN_OPERATION_FORBIDDEN, m_builder.Fold(m_allTensors, {}));
+    EXPECT_EQ(nullptr, m_allTensors[m_outputs[0]]->GetBuffer());
+
+    EXPECT_EQ(OH_NN_SUCCESS, m_builder.Fold(m_allTensors, m_inputs));
+    const std::shared_ptr<NNTensor>& output = m_allTensors[m_outputs[0]];
+    ASSERT_NE(nullptr, output->GetBuffer());
+    const int32_t* outputValue = static_cast<const int32_t*>(output->GetBuffer());
+    EXPECT_EQ(m_inputDim, std::vector<int32_t>(outputValue, outputValue + m_inputDim.size()));
+}
 } // namespace UnitTest
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
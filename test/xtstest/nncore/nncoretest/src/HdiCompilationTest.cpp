@@ -16,6 +16,7 @@
 #include <unistd.h>
 
 #include "nncore_utils.h"
+#include "neural_network_runtime_inner.h"
 
 using namespace testing::ext;
 using namespace OHOS::NeuralNetworkRuntime::Test;
@@ -38,6 +39,8 @@ public:
             .cacheVersion = CACHEVERSION,
         };
         ASSERT_EQ(OH_NN_SUCCESS, CompileGraphMock(compilation, compileParam));
+        // The cache is written in the background after the build.
+        ASSERT_EQ(OH_NN_SUCCESS, OH_NN_FlushCacheWrites(0));
         ASSERT_TRUE(CheckPath(cachePath + CACHE_FILE) == PathType::FILE);
         ASSERT_TRUE(CheckPath(cachePath + CACHE_INFO_FILE) == PathType::FILE);
         OH_NNModel_Destroy(&model);
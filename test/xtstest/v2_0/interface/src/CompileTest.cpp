@@ -20,6 +20,7 @@
 #include <unistd.h>
 
 #include "nnrt_utils.h"
+#include "neural_network_runtime_inner.h"
 #include "model.h"
 
 using namespace testing::ext;
@@ -50,6 +51,8 @@ public:
         };
         ASSERT_EQ(OH_NN_SUCCESS, CompileGraphMock(compilation, compileParam));
         Free(model, compilation);
+        // The cache is written in the background after the build.
+        ASSERT_EQ(OH_NN_SUCCESS, OH_NN_FlushCacheWrites(0));
         ASSERT_TRUE(CheckPath(cachePath + CACHE_FILE) == PathType::FILE);
         ASSERT_TRUE(CheckPath(cachePath + CACHE_INFO_FILE) == PathType::FILE);
     }